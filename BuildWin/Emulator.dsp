@@ -360,26 +360,14 @@ SOURCE=..\SrcWin\SonyWin\OpenFileList.h
 # End Source File
 # Begin Source File
 
-SOURCE=..\SrcWin\SonyWin\Platform_ExpMgrLib.h
-# End Source File
-# Begin Source File
-
 SOURCE=..\SrcWin\SonyWin\Platform_ExpMgrLib_Win.cpp
 # End Source File
 # Begin Source File
 
-SOURCE=..\SrcWin\SonyWin\Platform_MsfsLib.h
-# End Source File
-# Begin Source File
-
 SOURCE=..\SrcWin\SonyWin\Platform_MsfsLib_Win.cpp
 # End Source File
 # Begin Source File
 
-SOURCE=..\SrcWin\SonyWin\Platform_VfsLib.h
-# End Source File
-# Begin Source File
-
 SOURCE=..\SrcWin\SonyWin\Platform_VfsLib_Win.cpp
 # End Source File
 # Begin Source File
@@ -832,10 +820,26 @@ SOURCE=..\SrcShared\EmApplication.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmBenchmark.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\EmAtomic.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmAssert.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmCatalog.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\EmClock.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmCommands.h
 # End Source File
 # Begin Source File
@@ -864,6 +868,10 @@ SOURCE=..\SrcShared\EmErrCodes.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmEventLog.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmEventOutput.h
 # End Source File
 # Begin Source File
@@ -872,6 +880,10 @@ SOURCE=..\SrcShared\EmEventPlayback.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmGremlinCoverage.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmException.h
 # End Source File
 # Begin Source File
@@ -936,6 +948,10 @@ SOURCE=..\SrcShared\EmPoint.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmPrefStore.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmQuantizer.h
 # End Source File
 # Begin Source File
@@ -972,6 +988,14 @@ SOURCE=..\SrcShared\EmSession.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmSkinCache.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\EmStorageReader.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmStream.h
 # End Source File
 # Begin Source File
@@ -1649,6 +1673,10 @@ SOURCE=..\SrcShared\UAE\cpuemu.c
 # SUBTRACT CPP /YX /Yc /Yu
 # End Source File
 # Begin Source File
+SOURCE=..\SrcShared\UAE\cpuemufast.c
+# SUBTRACT CPP /YX /Yc /Yu
+# End Source File
+# Begin Source File
 
 SOURCE=..\SrcShared\UAE\cpustbl.c
 # SUBTRACT CPP /YX /Yc /Yu
@@ -2130,6 +2158,14 @@ SOURCE=..\SrcShared\Patches\EmPatchState.cpp
 
 SOURCE=..\SrcShared\Patches\EmPatchState.h
 # End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\Patches\EmTrackedChunks.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\Patches\EmTrackedChunks.h
+# End Source File
 # End Group
 # Begin Group "Sony - Shared"
 
@@ -2356,6 +2392,18 @@ SOURCE=..\SrcShared\SonyShared\MiscellaneousSony.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\SonyShared\Platform_ExpMgrLib.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\SonyShared\Platform_MsfsLib.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\SonyShared\Platform_VfsLib.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\SonyShared\ROMStubsSony.cpp
 # End Source File
 # Begin Source File
@@ -2422,6 +2470,18 @@ SOURCE=..\SrcShared\EmApplication.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmBenchmark.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\EmCatalog.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\EmClock.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmCommon.cpp
 # ADD CPP /Yc"EmCommon.h"
 # End Source File
@@ -2443,6 +2503,10 @@ SOURCE=..\SrcShared\EmDocument.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmEventLog.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmEventOutput.cpp
 # End Source File
 # Begin Source File
@@ -2451,6 +2515,10 @@ SOURCE=..\SrcShared\EmEventPlayback.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmGremlinCoverage.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmException.cpp
 # End Source File
 # Begin Source File
@@ -2511,6 +2579,10 @@ SOURCE=..\SrcShared\EmPoint.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmPrefStore.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmQuantizer.cpp
 # End Source File
 # Begin Source File
@@ -2547,6 +2619,14 @@ SOURCE=..\SrcShared\EmSession.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\SrcShared\EmSkinCache.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\SrcShared\EmStorageReader.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\SrcShared\EmStream.cpp
 # End Source File
 # Begin Source File
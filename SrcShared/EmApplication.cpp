@@ -14,6 +14,7 @@
 #include "EmCommon.h"
 #include "EmApplication.h"
 
+#include "EmCatalog.h"			// EmCatalog::Startup, EmCatalog::Shutdown
 #include "EmCommands.h"			// EmCommandID
 #include "EmDlg.h"				// EmDlg, DoEditPreferences, etc.
 #include "EmDocument.h"			// EmDocument::AskNewSession, etc.
@@ -200,6 +201,11 @@ Bool EmApplication::Startup (int argc, char** argv)
 
 	LogStartup ();
 
+	// Bring the catalog of ROM information up to date, so that checking
+	// the ROM on the command line or in the preferences is quick.
+
+	EmCatalog::Startup ();
+
 	// Check to see if any skins were loaded. Report a possible problem if
 	// not. Only warn the user once. Don't warn for bound Posers, which have
 	// the only skin they need to use included as a resource.
@@ -251,9 +257,11 @@ void EmApplication::Shutdown (void)
 	gTracer.Dispose ();
 #endif
 
-	// Save the preferences.
+	// Save the preferences and anything new in the catalog.
 
 	gPrefs->Save ();
+
+	EmCatalog::Shutdown ();
 }
 
 
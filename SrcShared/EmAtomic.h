@@ -0,0 +1,131 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmAtomic_h
+#define EmAtomic_h
+
+// A very small set of atomic operations for the places where taking an
+// omni_mutex on every call is too expensive (the logging fast path, for
+// instance).  These are full barriers on all platforms; we don't try to
+// be any cleverer than that.
+//
+// Only 32-bit integers are supported.  Pointers are handled by the "Ptr"
+// variants, which use the host's pointer-sized operations, so they work
+// whatever size a host pointer is.
+
+#if PLATFORM_WINDOWS
+
+	inline void EmMemoryBarrier (void)
+	{
+		// Any interlocked operation is a full memory barrier.  Older
+		// SDKs don't have MemoryBarrier (), so use one of those.
+
+		LONG	dummy;
+		::InterlockedExchange (&dummy, 0);
+	}
+
+	inline int32 EmAtomicIncrement (volatile int32* p)
+	{
+		return ::InterlockedIncrement ((LONG*) p);
+	}
+
+	inline int32 EmAtomicDecrement (volatile int32* p)
+	{
+		return ::InterlockedDecrement ((LONG*) p);
+	}
+
+	inline int32 EmAtomicExchange (volatile int32* p, int32 newValue)
+	{
+		return ::InterlockedExchange ((LONG*) p, newValue);
+	}
+
+	inline int32 EmAtomicCompareAndSwap (volatile int32* p, int32 oldValue, int32 newValue)
+	{
+		return ::InterlockedCompareExchange ((LONG*) p, newValue, oldValue);
+	}
+
+	inline void* EmAtomicExchangePtr (void* volatile* p, void* newValue)
+	{
+		return ::InterlockedExchangePointer ((PVOID*) p, newValue);
+	}
+
+	inline void* EmAtomicCompareAndSwapPtr (void* volatile* p, void* oldValue, void* newValue)
+	{
+		return ::InterlockedCompareExchangePointer ((PVOID*) p, newValue, oldValue);
+	}
+
+#else	// PLATFORM_UNIX || PLATFORM_MAC (gcc)
+
+	inline void EmMemoryBarrier (void)
+	{
+		__sync_synchronize ();
+	}
+
+	inline int32 EmAtomicIncrement (volatile int32* p)
+	{
+		return __sync_add_and_fetch (p, 1);
+	}
+
+	inline int32 EmAtomicDecrement (volatile int32* p)
+	{
+		return __sync_sub_and_fetch (p, 1);
+	}
+
+	inline int32 EmAtomicExchange (volatile int32* p, int32 newValue)
+	{
+		return __sync_lock_test_and_set (p, newValue);
+	}
+
+	inline int32 EmAtomicCompareAndSwap (volatile int32* p, int32 oldValue, int32 newValue)
+	{
+		return __sync_val_compare_and_swap (p, oldValue, newValue);
+	}
+
+	inline void* EmAtomicExchangePtr (void* volatile* p, void* newValue)
+	{
+		return __sync_lock_test_and_set (p, newValue);
+	}
+
+	inline void* EmAtomicCompareAndSwapPtr (void* volatile* p, void* oldValue, void* newValue)
+	{
+		return __sync_val_compare_and_swap (p, oldValue, newValue);
+	}
+
+#endif
+
+// EmAtomicCompareAndSwap and EmAtomicCompareAndSwapPtr store newValue only
+// if the current value is oldValue.  They return the value that was there
+// before; the swap happened if that's equal to oldValue.
+
+
+// Read a value written by another thread, making sure that anything
+// written before it was published is also visible.
+
+inline int32 EmAtomicGet (const volatile int32* p)
+{
+	int32	result = *p;
+	EmMemoryBarrier ();
+	return result;
+}
+
+
+// Publish a value to other threads, making sure that anything we wrote
+// before it is visible first.
+
+inline void EmAtomicSet (volatile int32* p, int32 newValue)
+{
+	EmMemoryBarrier ();
+	*p = newValue;
+}
+
+#endif	// EmAtomic_h
@@ -0,0 +1,696 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmBenchmark.h"
+
+#include "ChunkFile.h"			// ChunkFile, EmStreamChunk
+#include "EmApplication.h"		// gApplication, ScheduleQuit
+#include "EmCPU68K.h"			// gCPU68K, GetCycleCount
+#include "EmFileImport.h"		// EmFileImport::LoadPalmFile
+#include "EmFileRef.h"			// EmFileRef
+#include "EmPatchState.h"		// EmPatchState::EvtGetEventCalled
+#include "EmScreen.h"			// EmScreen::GetBits, EmScreenUpdateInfo
+#include "EmSession.h"			// gSession, EmSessionStopper
+#include "EmStreamFile.h"		// EmStreamFile
+#include "Hordes.h"				// Hordes::New, Hordes::IsOn
+#include "Platform.h"			// Platform::GetMilliseconds
+#include "ROMStubs.h"			// DmDeleteDatabase, MemNumCards
+#include "SessionFile.h"		// SessionFile
+
+#include <stdio.h>				// sprintf
+
+#if PLATFORM_UNIX
+#include <sys/resource.h>		// getrusage
+#endif
+
+#if PLATFORM_WINDOWS
+#include <psapi.h>				// PROCESS_MEMORY_COUNTERS
+#endif
+
+
+enum
+{
+	kPhaseBoot,
+	kPhaseGremlin,
+	kPhaseImport,
+	kPhaseSession,
+	kPhaseLCD,
+	kPhaseTraps,
+	kPhaseDone
+};
+
+struct EmBenchmarkResult
+{
+	string		fWorkload;
+	string		fMetric;
+	double		fValue;
+};
+
+typedef vector<EmBenchmarkResult>	EmBenchmarkResultList;
+
+
+// Workload sizes.  Changing any of these makes results incomparable
+// with those from earlier builds.
+
+const long		kGremlinNumber		= 0;
+const long		kGremlinEvents		= 10000;
+const long		kImportRecords		= 2000;
+const long		kImportRecordSize	= 256;
+const long		kLCDFrames			= 200;
+const long		kTrapCalls			= 10000;
+
+// Give up on a phase that runs in the background (boot, Gremlin) after
+// this long.
+
+const uint32	kPhaseTimeout		= 5 * 60 * 1000;
+
+
+static Bool		PrvBoot				(Bool starting);
+static Bool		PrvGremlin			(Bool starting);
+static Bool		PrvImport			(Bool starting);
+static Bool		PrvSession			(Bool starting);
+static Bool		PrvLCD				(Bool starting);
+static Bool		PrvTraps			(Bool starting);
+
+static void		PrvStartClock		(void);
+static uint32	PrvElapsed			(void);
+static void		PrvRecord			(const char* workload, const char* metric, double value);
+static void		PrvRecordRun		(const char* workload);
+static void		PrvRecordRate		(const char* workload, const char* metric, double amount, uint32 msecs);
+static Bool		PrvTimedOut			(const char* workload);
+static void		PrvMakeDatabaseImage(ByteList& image);
+static void		PrvPutBigEndian		(ByteList& image, uint32 value, int size);
+static long		PrvGetPeakMemoryKB	(void);
+static void		PrvWriteResults		(void);
+
+
+static Bool					gBenchmarkOn;
+static EmFileRef			gResultsRef;
+static int					gPhase;
+static Bool					gPhaseStarted;
+static uint32				gStartTime;
+static uint32				gStartCycles;
+static EmBenchmarkResultList	gResults;
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmBenchmark::Start
+ *
+ * DESCRIPTION:	Start running the benchmark suite.  The workloads are
+ *				run from subsequent calls to Idle.
+ *
+ * PARAMETERS:	results - file to receive the measurements.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmBenchmark::Start (const EmFileRef& results)
+{
+	gBenchmarkOn	= true;
+	gResultsRef		= results;
+	gPhase			= kPhaseBoot;
+	gPhaseStarted	= false;
+
+	gResults.clear ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmBenchmark::IsOn
+ *
+ * DESCRIPTION:	Return whether or not the benchmark suite is running.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmBenchmark::IsOn (void)
+{
+	return gBenchmarkOn;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmBenchmark::Idle
+ *
+ * DESCRIPTION:	Called from EmDocument::HandleIdle.  Starts the current
+ *				workload or checks to see if it's done, and moves on to
+ *				the next one when it is.  After the last one, writes
+ *				out the results and quits.
+ *
+ *				Workloads that run on the CPU thread (booting, the
+ *				Gremlin) are polled rather than waited for, so that
+ *				the UI thread is free to show any dialogs the CPU
+ *				thread asks for.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmBenchmark::Idle (void)
+{
+	if (!gBenchmarkOn)
+		return;
+
+	Bool	starting = !gPhaseStarted;
+	Bool	done = false;
+
+	gPhaseStarted = true;
+
+	switch (gPhase)
+	{
+		case kPhaseBoot:	done = ::PrvBoot (starting);		break;
+		case kPhaseGremlin:	done = ::PrvGremlin (starting);		break;
+		case kPhaseImport:	done = ::PrvImport (starting);		break;
+		case kPhaseSession:	done = ::PrvSession (starting);		break;
+		case kPhaseLCD:		done = ::PrvLCD (starting);			break;
+		case kPhaseTraps:	done = ::PrvTraps (starting);		break;
+		default:			done = true;						break;
+	}
+
+	if (!done)
+		return;
+
+	gPhase++;
+	gPhaseStarted = false;
+
+	if (gPhase >= kPhaseDone)
+	{
+		::PrvRecord ("process", "peak_rss_kb", ::PrvGetPeakMemoryKB ());
+		::PrvWriteResults ();
+
+		gBenchmarkOn = false;
+
+		EmAssert (gApplication);
+		gApplication->ScheduleQuit ();
+	}
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvBoot
+// ---------------------------------------------------------------------------
+// Soft reset, and time how long it takes to get back to the point where
+// EvtGetEvent is called (that is, the Launcher is up).
+
+Bool PrvBoot (Bool starting)
+{
+	if (starting)
+	{
+		EmSessionStopper	stopper (gSession, kStopNow);
+		gSession->Reset (kResetSoft);
+
+		::PrvStartClock ();
+		return false;
+	}
+
+	if (!EmPatchState::EvtGetEventCalled ())
+		return ::PrvTimedOut ("boot");
+
+	::PrvRecordRun ("boot");
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGremlin
+// ---------------------------------------------------------------------------
+// Run a single Gremlin with a fixed number for a fixed number of events.
+
+Bool PrvGremlin (Bool starting)
+{
+	if (starting)
+	{
+		if (!Hordes::CanNew ())
+		{
+			::PrvRecord ("gremlin", "skipped", 1);
+			return true;
+		}
+
+		HordeInfo	info;
+
+		info.fStartNumber	= kGremlinNumber;
+		info.fStopNumber	= kGremlinNumber;
+		info.fDepthStop		= kGremlinEvents;
+		info.fCanStop		= true;
+		info.NewToOld ();
+
+		EmSessionStopper	stopper (gSession, kStopOnSysCall);
+		if (!stopper.CanCall ())
+		{
+			::PrvRecord ("gremlin", "skipped", 1);
+			return true;
+		}
+
+		Hordes::New (info);
+
+		::PrvStartClock ();
+		return false;
+	}
+
+	if (Hordes::IsOn ())
+	{
+		if (!::PrvTimedOut ("gremlin"))
+			return false;
+
+		EmSessionStopper	stopper (gSession, kStopOnSysCall);
+		Hordes::Stop ();
+		return true;
+	}
+
+	uint32	msecs = ::PrvElapsed ();
+
+	::PrvRecordRun ("gremlin");
+	::PrvRecordRate ("gremlin", "events_per_sec", kGremlinEvents, msecs);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvImport
+// ---------------------------------------------------------------------------
+// Install a generated record database, then delete it again.
+
+Bool PrvImport (Bool starting)
+{
+	UNUSED_PARAM (starting)
+
+	ByteList	image;
+	::PrvMakeDatabaseImage (image);
+
+	EmSessionStopper	stopper (gSession, kStopOnSysCall);
+	if (!stopper.CanCall ())
+	{
+		::PrvRecord ("import", "skipped", 1);
+		return true;
+	}
+
+	LocalID	dbID = 0;
+
+	::PrvStartClock ();
+
+	ErrCode	err = EmFileImport::LoadPalmFile (&image[0], image.size (),
+						kMethodHomebrew, dbID);
+
+	uint32	msecs = ::PrvElapsed ();
+
+	if (err)
+	{
+		::PrvRecord ("import", "error", err);
+		return true;
+	}
+
+	::PrvRecord ("import", "ms", msecs);
+	::PrvRecordRate ("import", "mb_per_sec", image.size () / (1024.0 * 1024.0), msecs);
+	::PrvRecordRate ("import", "records_per_sec", kImportRecords, msecs);
+
+	if (dbID)
+	{
+		::DmDeleteDatabase (0, dbID);
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSession
+// ---------------------------------------------------------------------------
+// Save the session to memory and load it back again.
+
+Bool PrvSession (Bool starting)
+{
+	UNUSED_PARAM (starting)
+
+	EmSessionStopper	stopper (gSession, kStopNow);
+
+	Chunk	chunk;
+	uint32	msecs;
+
+	{
+		EmStreamChunk	stream (chunk);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		::PrvStartClock ();
+		gSession->Save (sessionFile);
+		msecs = ::PrvElapsed ();
+	}
+
+	double	mb = chunk.GetLength () / (1024.0 * 1024.0);
+
+	::PrvRecord ("session", "size_kb", chunk.GetLength () / 1024);
+	::PrvRecord ("session", "save_ms", msecs);
+	::PrvRecordRate ("session", "save_mb_per_sec", mb, msecs);
+
+	{
+		EmStreamChunk	stream (chunk);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		::PrvStartClock ();
+		gSession->Load (sessionFile);
+		msecs = ::PrvElapsed ();
+	}
+
+	::PrvRecord ("session", "load_ms", msecs);
+	::PrvRecordRate ("session", "load_mb_per_sec", mb, msecs);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvLCD
+// ---------------------------------------------------------------------------
+// Convert the whole LCD to a host pixmap, over and over.
+
+Bool PrvLCD (Bool starting)
+{
+	UNUSED_PARAM (starting)
+
+	EmSessionStopper	stopper (gSession, kStopNow);
+
+	EmScreenUpdateInfo	info;
+	double				bytes = 0;
+
+	::PrvStartClock ();
+
+	for (long ii = 0; ii < kLCDFrames; ++ii)
+	{
+		EmScreen::InvalidateAll ();
+
+		if (EmScreen::GetBits (info))
+		{
+			bytes += info.fImage.GetRowBytes () * info.fImage.GetSize ().fY;
+		}
+	}
+
+	uint32	msecs = ::PrvElapsed ();
+
+	::PrvRecord ("lcd", "ms_per_frame", (double) msecs / kLCDFrames);
+	::PrvRecordRate ("lcd", "mb_per_sec", bytes / (1024.0 * 1024.0), msecs);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvTraps
+// ---------------------------------------------------------------------------
+// Call a trivial system function from the host, over and over.  This
+// measures the cost of getting into and out of the ROM through
+// EmSubroutine and the trap patches.
+
+Bool PrvTraps (Bool starting)
+{
+	UNUSED_PARAM (starting)
+
+	EmSessionStopper	stopper (gSession, kStopOnSysCall);
+	if (!stopper.CanCall ())
+	{
+		::PrvRecord ("traps", "skipped", 1);
+		return true;
+	}
+
+	::PrvStartClock ();
+
+	for (long ii = 0; ii < kTrapCalls; ++ii)
+	{
+		::MemNumCards ();
+	}
+
+	uint32	msecs = ::PrvElapsed ();
+
+	::PrvRecord ("traps", "ns_per_trap", msecs * 1.0e6 / kTrapCalls);
+
+	return true;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvStartClock
+// ---------------------------------------------------------------------------
+
+void PrvStartClock (void)
+{
+	gStartTime		= Platform::GetMilliseconds ();
+	gStartCycles	= gCPU68K ? gCPU68K->GetCycleCount () : 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvElapsed
+// ---------------------------------------------------------------------------
+
+uint32 PrvElapsed (void)
+{
+	return Platform::GetMilliseconds () - gStartTime;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRecord
+// ---------------------------------------------------------------------------
+
+void PrvRecord (const char* workload, const char* metric, double value)
+{
+	EmBenchmarkResult	result;
+
+	result.fWorkload	= workload;
+	result.fMetric		= metric;
+	result.fValue		= value;
+
+	gResults.push_back (result);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRecordRun
+// ---------------------------------------------------------------------------
+// Record the elapsed time and emulated CPU speed of a workload that ran
+// on the CPU thread.  The CPU counts cycles, not instructions; the
+// cycle count is a uint32, so it's fine for deltas of a few minutes.
+
+void PrvRecordRun (const char* workload)
+{
+	uint32	msecs	= ::PrvElapsed ();
+	uint32	cycles	= (gCPU68K ? gCPU68K->GetCycleCount () : 0) - gStartCycles;
+
+	::PrvRecord (workload, "ms", msecs);
+	::PrvRecordRate (workload, "cycles_per_sec", cycles, msecs);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRecordRate
+// ---------------------------------------------------------------------------
+
+void PrvRecordRate (const char* workload, const char* metric, double amount, uint32 msecs)
+{
+	// Clamp to a millisecond so that very fast workloads still produce
+	// a (pessimistic) number instead of a division by zero.
+
+	if (msecs == 0)
+		msecs = 1;
+
+	::PrvRecord (workload, metric, amount * 1000.0 / msecs);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvTimedOut
+// ---------------------------------------------------------------------------
+// Called while polling a background workload.  Returns true (and records
+// the fact) if it's been running too long.
+
+Bool PrvTimedOut (const char* workload)
+{
+	uint32	msecs = ::PrvElapsed ();
+
+	if (msecs < kPhaseTimeout)
+		return false;
+
+	::PrvRecord (workload, "timeout_ms", msecs);
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvMakeDatabaseImage
+// ---------------------------------------------------------------------------
+// Generate a .pdb image with kImportRecords records of kImportRecordSize
+// bytes each.  The contents are the same every time.
+
+void PrvMakeDatabaseImage (ByteList& image)
+{
+	const char	kName[]			= "EmBenchmark";
+	const long	kHeaderSize		= 78;
+	const long	kEntrySize		= 8;
+	const long	kDataStart		= kHeaderSize + kImportRecords * kEntrySize + 2;
+
+	image.clear ();
+	image.reserve (kDataStart + kImportRecords * kImportRecordSize);
+
+	// DatabaseHdrType
+
+	for (size_t ii = 0; ii < 32; ++ii)
+	{
+		image.push_back (ii < strlen (kName) ? kName[ii] : 0);
+	}
+
+	::PrvPutBigEndian (image, 0, 2);				// attributes
+	::PrvPutBigEndian (image, 1, 2);				// version
+	::PrvPutBigEndian (image, 0xB5000000, 4);		// creationDate
+	::PrvPutBigEndian (image, 0xB5000000, 4);		// modificationDate
+	::PrvPutBigEndian (image, 0, 4);				// lastBackupDate
+	::PrvPutBigEndian (image, 0, 4);				// modificationNumber
+	::PrvPutBigEndian (image, 0, 4);				// appInfoID
+	::PrvPutBigEndian (image, 0, 4);				// sortInfoID
+	::PrvPutBigEndian (image, 'DATA', 4);			// type
+	::PrvPutBigEndian (image, 'EmBn', 4);			// creator
+	::PrvPutBigEndian (image, kImportRecords + 1, 4);	// uniqueIDSeed
+	::PrvPutBigEndian (image, 0, 4);				// nextRecordListID
+	::PrvPutBigEndian (image, kImportRecords, 2);	// numRecords
+
+	// RecordEntryTypes
+
+	for (long recordNum = 0; recordNum < kImportRecords; ++recordNum)
+	{
+		::PrvPutBigEndian (image, kDataStart + recordNum * kImportRecordSize, 4);
+		::PrvPutBigEndian (image, 0, 1);			// attributes
+		::PrvPutBigEndian (image, recordNum + 1, 3);	// uniqueID
+	}
+
+	::PrvPutBigEndian (image, 0, 2);				// placeholder
+
+	EmAssert ((long) image.size () == kDataStart);
+
+	// Record data
+
+	for (long recordNum = 0; recordNum < kImportRecords; ++recordNum)
+	{
+		for (long ii = 0; ii < kImportRecordSize; ++ii)
+		{
+			image.push_back ((uint8) (recordNum + ii));
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPutBigEndian
+// ---------------------------------------------------------------------------
+
+void PrvPutBigEndian (ByteList& image, uint32 value, int size)
+{
+	while (size--)
+	{
+		image.push_back ((uint8) (value >> (size * 8)));
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGetPeakMemoryKB
+// ---------------------------------------------------------------------------
+// Return the peak resident size of the process, or zero if we can't tell.
+
+long PrvGetPeakMemoryKB (void)
+{
+#if PLATFORM_UNIX
+
+	struct rusage	usage;
+
+	if (getrusage (RUSAGE_SELF, &usage) == 0)
+		return usage.ru_maxrss;
+
+	return 0;
+
+#elif PLATFORM_WINDOWS
+
+	// Load psapi.dll by hand rather than linking against it; it's not
+	// installed on Win95/98 by default.
+
+	typedef BOOL (WINAPI* GetProcessMemoryInfoProc) (HANDLE, PPROCESS_MEMORY_COUNTERS, DWORD);
+
+	long	result = 0;
+	HMODULE	psapi = ::LoadLibrary ("psapi.dll");
+
+	if (psapi)
+	{
+		GetProcessMemoryInfoProc	fn = (GetProcessMemoryInfoProc)
+			::GetProcAddress (psapi, "GetProcessMemoryInfo");
+
+		PROCESS_MEMORY_COUNTERS		counters;
+
+		if (fn && fn (::GetCurrentProcess (), &counters, sizeof (counters)))
+			result = counters.PeakWorkingSetSize / 1024;
+
+		::FreeLibrary (psapi);
+	}
+
+	return result;
+
+#else
+
+	return 0;
+
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvWriteResults
+// ---------------------------------------------------------------------------
+
+void PrvWriteResults (void)
+{
+	EmStreamFile	stream (gResultsRef, kCreateOrEraseForWrite | kOpenText);
+	char			buffer[256];
+
+	sprintf (buffer, "# Palm OS Emulator %s\n",
+		Platform::GetShortVersionString ().c_str ());
+	stream.PutBytes (buffer, strlen (buffer));
+
+	if (gSession)
+	{
+		sprintf (buffer, "# Device %s\n",
+			gSession->GetDevice ().GetIDString ().c_str ());
+		stream.PutBytes (buffer, strlen (buffer));
+	}
+
+	EmBenchmarkResultList::iterator	iter = gResults.begin ();
+	while (iter != gResults.end ())
+	{
+		sprintf (buffer, "%s\t%s\t%.3f\n",
+			iter->fWorkload.c_str (), iter->fMetric.c_str (), iter->fValue);
+		stream.PutBytes (buffer, strlen (buffer));
+
+		++iter;
+	}
+}
@@ -0,0 +1,49 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmBenchmark_h
+#define EmBenchmark_h
+
+class EmFileRef;
+
+/*
+	Benchmark suite for the emulator core.
+
+	Started with the -benchmark <file> command line option.  Once the
+	session has booted far enough to call EvtGetEvent, the suite runs a
+	fixed set of workloads one after the other from EmDocument's idle
+	time, writes the measurements to the given file, and quits.
+
+	The workloads are deterministic: a soft reset to the Launcher, a
+	single Gremlin with a fixed number and event count, a bulk install
+	of a generated database, a session save and load to memory, LCD
+	conversion of a full screen, and host-initiated trap calls.
+
+	The results file is plain text.  Lines starting with '#' identify
+	the build and device.  Every other line is
+
+		<workload> TAB <metric> TAB <value>
+
+	so that two runs can be compared by joining on the first two
+	columns.
+*/
+
+class EmBenchmark
+{
+	public:
+		static void				Start				(const EmFileRef& results);
+		static Bool				IsOn				(void);
+		static void				Idle				(void);
+};
+
+#endif	// EmBenchmark_h
@@ -0,0 +1,762 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmCatalog.h"
+
+#include "ChunkFile.h"			// Chunk, ChunkFile, EmStreamChunk
+#include "EmDevice.h"			// EmDevice::GetDeviceList
+#include "EmFileRef.h"			// EmFileRef
+#include "EmMapFile.h"			// EmMapFile
+#include "EmROMReader.h"		// EmROMReader
+#include "EmStreamFile.h"		// EmStreamFile
+#include "Logging.h"			// LogThreadExit
+#include "Miscellaneous.h"		// StMemory
+#include "Platform.h"			// Platform::GetShortVersionString
+#include "PreferenceMgr.h"		// gEmuPrefs
+
+#include "omnithread.h"			// omni_mutex, omni_thread
+
+#include <map>
+
+
+enum
+{
+	kCatalogVersion		= 1,
+
+	kVersionTag			= 'vers',	// kCatalogVersion
+	kEmulatorTag		= 'emul',	// Version string of the emulator that wrote the catalog
+	kROMsTag			= 'roms',	// ROM entries
+	kSkinsTag			= 'skns'	// Skin entries
+};
+
+// Most number of threads to read files on when scanning.  Reading ROMs
+// is mostly waiting for the disk, so a few threads are plenty.
+
+static const size_t		kMaxScanThreads		= 4;
+
+
+struct PrvFileStamp
+{
+	uint32					fSize;
+	uint32					fModDate;
+
+	bool					operator==	(const PrvFileStamp& other) const
+								{ return fSize == other.fSize && fModDate == other.fModDate; }
+};
+
+struct PrvROMEntry
+{
+	PrvFileStamp			fStamp;
+	EmCatalog::ROMInfo		fInfo;
+};
+
+struct PrvSkinEntry
+{
+	PrvFileStamp			fStamp;
+	StringStringMap			fEntries;
+};
+
+typedef map<string, PrvROMEntry>	PrvROMMap;
+typedef map<string, PrvSkinEntry>	PrvSkinMap;
+
+struct PrvScanJob
+{
+							PrvScanJob	(Bool roms) : fROMs (roms), fNext (0) {}
+
+	Bool					fROMs;
+	EmFileRefList			fFiles;
+	vector<PrvFileStamp>	fStamps;
+	size_t					fNext;		// Next file to read; protected by gCatalogMutex
+};
+
+
+// gCatalogMutex protects everything below it, and the fNext field of
+// any PrvScanJob in progress.
+
+static omni_mutex	gCatalogMutex;
+static Bool			gCatalogLoaded;
+static Bool			gCatalogDirty;
+static PrvROMMap	gROMs;
+static PrvSkinMap	gSkins;
+
+
+static void			PrvScan				(const EmFileRefList&, Bool roms);
+static void*		PrvScanThread		(void* arg);
+static Bool			PrvGetStamp			(const EmFileRef&, PrvFileStamp&);
+static Bool			PrvReadROMInfo		(const EmFileRef&, EmCatalog::ROMInfo&);
+static EmFileRef	PrvGetCatalogFile	(void);
+static void			PrvLoad				(void);
+static void			PrvSave				(void);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmCatalog::Startup
+ *
+ * DESCRIPTION:	Bring the catalog up to date for the ROMs in the MRU
+ *				list, so that the startup checks and the New Session
+ *				dialog find them there.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmCatalog::Startup (void)
+{
+	EmFileRefList	romList;
+	gEmuPrefs->GetROMMRU (romList);
+
+	EmCatalog::ScanROMs (romList);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmCatalog::Shutdown
+ *
+ * DESCRIPTION:	Save the catalog if anything in it has changed.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmCatalog::Shutdown (void)
+{
+	omni_mutex_lock	lock (gCatalogMutex);
+
+	if (gCatalogDirty)
+	{
+		::PrvSave ();
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmCatalog::ScanROMs, EmCatalog::ScanSkins
+ *
+ * DESCRIPTION:	Make sure the catalog has up-to-date entries for the
+ *				given files.  Any that are missing or out of date are
+ *				read in, several at a time.
+ *
+ * PARAMETERS:	files - the ROM images or skin files to check.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmCatalog::ScanROMs (const EmFileRefList& files)
+{
+	::PrvScan (files, true);
+}
+
+void
+EmCatalog::ScanSkins (const EmFileRefList& files)
+{
+	::PrvScan (files, false);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmCatalog::GetROMInfo
+ *
+ * DESCRIPTION:	Return what's known about the given ROM image, reading
+ *				it in first if the catalog doesn't have an up-to-date
+ *				entry for it.
+ *
+ * PARAMETERS:	file - the ROM image.
+ *
+ *				info - receives the information about the ROM.
+ *
+ * RETURNED:	True if the information was found.  False if the file
+ *				couldn't be read, in which case the caller should read
+ *				it itself to report the error.
+ *
+ ***********************************************************************/
+
+Bool
+EmCatalog::GetROMInfo (const EmFileRef& file, ROMInfo& info)
+{
+	::PrvScan (EmFileRefList (1, file), true);
+
+	omni_mutex_lock	lock (gCatalogMutex);
+
+	PrvROMMap::iterator	iter = gROMs.find (file.GetFullPath ());
+
+	if (iter == gROMs.end ())
+		return false;
+
+	info = iter->second.fInfo;
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmCatalog::GetSkinEntries
+ *
+ * DESCRIPTION:	Return the contents of the given skin file, reading it
+ *				in first if the catalog doesn't have an up-to-date entry
+ *				for it.
+ *
+ * PARAMETERS:	file - the skin file.
+ *
+ *				entries - receives the key/value pairs in the file, as
+ *					returned by EmMapFile::Read.
+ *
+ * RETURNED:	True if the entries were found.
+ *
+ ***********************************************************************/
+
+Bool
+EmCatalog::GetSkinEntries (const EmFileRef& file, StringStringMap& entries)
+{
+	::PrvScan (EmFileRefList (1, file), false);
+
+	omni_mutex_lock	lock (gCatalogMutex);
+
+	PrvSkinMap::iterator	iter = gSkins.find (file.GetFullPath ());
+
+	if (iter == gSkins.end ())
+		return false;
+
+	entries = iter->second.fEntries;
+
+	return true;
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvScan
+ *
+ * DESCRIPTION:	Common routine for ScanROMs and ScanSkins.  Check each
+ *				file's stamp against the catalog, and read in the ones
+ *				that have changed.  If there's more than one of those,
+ *				start up some threads to help.
+ *
+ * PARAMETERS:	files - the files to check.
+ *
+ *				roms - true if the files are ROM images, false if they
+ *					are skin files.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvScan (const EmFileRefList& files, Bool roms)
+{
+	PrvScanJob	job (roms);
+
+	{
+		omni_mutex_lock	lock (gCatalogMutex);
+
+		::PrvLoad ();
+
+		EmFileRefList::const_iterator	iter = files.begin ();
+		while (iter != files.end ())
+		{
+			string			path = iter->GetFullPath ();
+			PrvFileStamp	stamp;
+			Bool			current = false;
+
+			if (!::PrvGetStamp (*iter, stamp))
+			{
+				// It's gone; make sure we don't keep reporting it.
+
+				if (roms ? gROMs.erase (path) : gSkins.erase (path))
+					gCatalogDirty = true;
+
+				++iter;
+				continue;
+			}
+
+			if (roms)
+			{
+				PrvROMMap::iterator	entry = gROMs.find (path);
+				current = entry != gROMs.end () && entry->second.fStamp == stamp;
+			}
+			else
+			{
+				PrvSkinMap::iterator	entry = gSkins.find (path);
+				current = entry != gSkins.end () && entry->second.fStamp == stamp;
+			}
+
+			if (!current)
+			{
+				job.fFiles.push_back (*iter);
+				job.fStamps.push_back (stamp);
+			}
+
+			++iter;
+		}
+	}
+
+	if (job.fFiles.empty ())
+		return;
+
+#if HAS_OMNI_THREAD
+	// This thread reads files, too, so start one fewer than we want.
+
+	size_t					numThreads = min (job.fFiles.size (), kMaxScanThreads);
+	vector<omni_thread*>	threads;
+
+	for (size_t ii = 1; ii < numThreads; ++ii)
+	{
+		// Use the variant that takes a function returning void* so that
+		// the thread is created undetached and we can join it.
+
+		threads.push_back (omni_thread::create (&::PrvScanThread, &job,
+			omni_thread::PRIORITY_LOW));
+	}
+
+	::PrvScanThread (&job);
+
+	vector<omni_thread*>::iterator	iter = threads.begin ();
+	while (iter != threads.end ())
+	{
+		(*iter)->join (NULL);
+		++iter;
+	}
+#else
+	::PrvScanThread (&job);
+#endif
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvScanThread
+ *
+ * DESCRIPTION:	Read files from the given job until there are none
+ *				left, adding what's found to the catalog.  Files that
+ *				can't be read are left out of it.
+ *
+ * PARAMETERS:	arg - the PrvScanJob.
+ *
+ * RETURNED:	NULL.
+ *
+ ***********************************************************************/
+
+void* PrvScanThread (void* arg)
+{
+	PrvScanJob&	job = *(PrvScanJob*) arg;
+
+	while (true)
+	{
+		size_t	index;
+
+		{
+			omni_mutex_lock	lock (gCatalogMutex);
+
+			if (job.fNext >= job.fFiles.size ())
+				break;
+
+			index = job.fNext++;
+		}
+
+		const EmFileRef&	file = job.fFiles[index];
+		string				path = file.GetFullPath ();
+
+		// Read the file without holding the lock; that's the slow part.
+
+		if (job.fROMs)
+		{
+			PrvROMEntry	entry;
+			entry.fStamp = job.fStamps[index];
+
+			Bool	found = ::PrvReadROMInfo (file, entry.fInfo);
+
+			omni_mutex_lock	lock (gCatalogMutex);
+
+			if (found)
+				gROMs[path] = entry;
+			else
+				gROMs.erase (path);
+
+			gCatalogDirty = true;
+		}
+		else
+		{
+			PrvSkinEntry	entry;
+			entry.fStamp = job.fStamps[index];
+
+			Bool	found = EmMapFile::Read (file, entry.fEntries);
+
+			omni_mutex_lock	lock (gCatalogMutex);
+
+			if (found)
+				gSkins[path] = entry;
+			else
+				gSkins.erase (path);
+
+			gCatalogDirty = true;
+		}
+	}
+
+	::LogThreadExit ();
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetStamp
+ *
+ * DESCRIPTION:	Get the size and modification date of the given file.
+ *
+ * PARAMETERS:	file - the file to check.
+ *
+ *				stamp - receives the size and date.
+ *
+ * RETURNED:	True if the file exists and could be checked.
+ *
+ ***********************************************************************/
+
+Bool PrvGetStamp (const EmFileRef& file, PrvFileStamp& stamp)
+{
+	return file.GetSizeAndModDate (&stamp.fSize, &stamp.fModDate) == 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReadROMInfo
+ *
+ * DESCRIPTION:	Read in a ROM image and find out what it is and which
+ *				devices can run it.  This grovels over the ROM in the
+ *				same way that EmDevice::SupportsROM does.
+ *
+ * PARAMETERS:	file - the ROM image.
+ *
+ *				info - receives the information about the ROM.
+ *
+ * RETURNED:	True if the ROM image could be read.
+ *
+ ***********************************************************************/
+
+Bool PrvReadROMInfo (const EmFileRef& file, EmCatalog::ROMInfo& info)
+{
+	try
+	{
+		// Load the ROM image into memory.
+
+		EmStreamFile	romStream (file, kOpenExistingForRead);
+		StMemory		romImage (romStream.GetLength ());
+
+		romStream.GetBytes (romImage.Get (), romStream.GetLength ());
+
+		// Create a ROM Reader on the ROM image.
+
+		EmROMReader		reader (romImage.Get (), romStream.GetLength ());
+
+		// Grovel over the ROM.
+
+		if (reader.AcquireCardHeader ())
+		{
+			if (reader.GetCardVersion () < 5)
+			{
+				reader.AcquireROMHeap ();
+				reader.AcquireDatabases ();
+				reader.AcquireFeatures ();
+				reader.AcquireSplashDB ();
+			}
+		}
+
+		info.fCardVersion	= reader.GetCardVersion ();
+		info.fROMVersion	= reader.Version ();
+		info.fCompanyID		= reader.GetCompanyID ();
+		info.fHalID			= reader.GetHalID ();
+		info.fHasSplash		= reader.GetSplashChunk () != NULL;
+
+		info.fDevices.clear ();
+
+		EmDeviceList			devices = EmDevice::GetDeviceList ();
+		EmDeviceList::iterator	iter = devices.begin ();
+
+		while (iter != devices.end ())
+		{
+			if (iter->SupportsROM (reader))
+				info.fDevices.push_back (iter->GetIDString ());
+
+			++iter;
+		}
+	}
+	catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetCatalogFile
+ *
+ * DESCRIPTION:	Return the file the catalog is saved in.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The file reference.  The file may not exist.
+ *
+ ***********************************************************************/
+
+EmFileRef PrvGetCatalogFile (void)
+{
+	return EmFileRef (EmDirRef::GetEmulatorDirectory (), "Catalog.dat");
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvLoad
+ *
+ * DESCRIPTION:	Read in the saved catalog, the first time it's needed.
+ *				Must be called with gCatalogMutex locked.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvLoad (void)
+{
+	if (gCatalogLoaded)
+		return;
+
+	gCatalogLoaded = true;
+
+	try
+	{
+		EmFileRef	catalogFile = ::PrvGetCatalogFile ();
+
+		if (!catalogFile.Exists ())
+			return;
+
+		// Pull the whole catalog in with one read, and pick it apart in memory.
+
+		Chunk	catalogData;
+
+		{
+			EmStreamFile	fileStream (catalogFile, kOpenExistingForRead);	// Will throw if fnf
+
+			catalogData.SetLength (fileStream.GetLength ());
+			fileStream.GetBytes (catalogData.GetPointer (), catalogData.GetLength ());
+		}
+
+		EmStreamChunk	catalogStream (catalogData);
+		ChunkFile		catalogFileData (catalogStream);
+
+		uint32	version;
+		string	emulatorVersion;
+		Chunk	roms, skins;
+
+		if (!catalogFileData.ReadInt (kVersionTag, version) || version != kCatalogVersion)
+			return;
+
+		if (!catalogFileData.ReadString (kEmulatorTag, emulatorVersion) ||
+			!catalogFileData.ReadChunk (kROMsTag, roms) ||
+			!catalogFileData.ReadChunk (kSkinsTag, skins))
+			return;
+
+		// Get the ROM entries.  The list of devices a ROM runs on
+		// depends on this emulator, so skip them if it was a different
+		// one that wrote them.
+
+		if (emulatorVersion == Platform::GetShortVersionString ())
+		{
+			EmStreamChunk	s (roms);
+			uint32			count;
+
+			s >> count;
+
+			while (count--)
+			{
+				string		path;
+				PrvROMEntry	entry;
+				bool		hasSplash;
+
+				s >> path;
+				s >> entry.fStamp.fSize;
+				s >> entry.fStamp.fModDate;
+				s >> entry.fInfo.fCardVersion;
+				s >> entry.fInfo.fROMVersion;
+				s >> entry.fInfo.fCompanyID;
+				s >> entry.fInfo.fHalID;
+				s >> hasSplash;
+				s >> entry.fInfo.fDevices;
+
+				entry.fInfo.fHasSplash = hasSplash;
+
+				gROMs[path] = entry;
+			}
+		}
+
+		// Get the skin entries.
+
+		{
+			EmStreamChunk	s (skins);
+			uint32			count;
+
+			s >> count;
+
+			while (count--)
+			{
+				string			path;
+				PrvSkinEntry	entry;
+				uint32			numEntries;
+
+				s >> path;
+				s >> entry.fStamp.fSize;
+				s >> entry.fStamp.fModDate;
+				s >> numEntries;
+
+				while (numEntries--)
+				{
+					string	key, value;
+
+					s >> key;
+					s >> value;
+
+					entry.fEntries[key] = value;
+				}
+
+				gSkins[path] = entry;
+			}
+		}
+	}
+	catch (...)
+	{
+		// Start over with an empty catalog.
+
+		gROMs.clear ();
+		gSkins.clear ();
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvSave
+ *
+ * DESCRIPTION:	Write out the catalog.  Other instances of the emulator
+ *				may be reading it, so it's written with
+ *				EmFileRef::WriteSafely.  Must be called with
+ *				gCatalogMutex locked.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvSave (void)
+{
+	EmFileRef	catalogFile = ::PrvGetCatalogFile ();
+
+	try
+	{
+		// Build up the whole catalog in memory, then write it out in one go.
+
+		Chunk			catalogData;
+		EmStreamChunk	catalogStream (catalogData);
+		ChunkFile		catalogFileData (catalogStream);
+
+		catalogFileData.WriteInt (kVersionTag, (uint32) kCatalogVersion);
+		catalogFileData.WriteString (kEmulatorTag, Platform::GetShortVersionString ());
+
+		{
+			Chunk			roms;
+			EmStreamChunk	s (roms);
+
+			s << (uint32) gROMs.size ();
+
+			PrvROMMap::iterator	iter = gROMs.begin ();
+			while (iter != gROMs.end ())
+			{
+				const PrvROMEntry&	entry = iter->second;
+
+				s << iter->first;
+				s << entry.fStamp.fSize;
+				s << entry.fStamp.fModDate;
+				s << entry.fInfo.fCardVersion;
+				s << entry.fInfo.fROMVersion;
+				s << entry.fInfo.fCompanyID;
+				s << entry.fInfo.fHalID;
+				s << (bool) (entry.fInfo.fHasSplash != 0);
+				s << entry.fInfo.fDevices;
+
+				++iter;
+			}
+
+			catalogFileData.WriteChunk (kROMsTag, roms);
+		}
+
+		{
+			Chunk			skins;
+			EmStreamChunk	s (skins);
+
+			s << (uint32) gSkins.size ();
+
+			PrvSkinMap::iterator	iter = gSkins.begin ();
+			while (iter != gSkins.end ())
+			{
+				const PrvSkinEntry&	entry = iter->second;
+
+				s << iter->first;
+				s << entry.fStamp.fSize;
+				s << entry.fStamp.fModDate;
+				s << (uint32) entry.fEntries.size ();
+
+				StringStringMap::const_iterator	iter2 = entry.fEntries.begin ();
+				while (iter2 != entry.fEntries.end ())
+				{
+					s << iter2->first;
+					s << iter2->second;
+
+					++iter2;
+				}
+
+				++iter;
+			}
+
+			catalogFileData.WriteChunk (kSkinsTag, skins);
+		}
+
+		// Write it out.
+
+		if (catalogFile.WriteSafely (catalogData.GetPointer (), catalogData.GetLength ()))
+			gCatalogDirty = false;
+	}
+	catch (...)
+	{
+		// The catalog is only an optimization; if we can't write it,
+		// the files will just be read again next time.
+	}
+}
@@ -0,0 +1,70 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmCatalog_h
+#define EmCatalog_h
+
+#include "EmDirRef.h"			// EmFileRefList
+#include "EmStructs.h"			// StringList, StringStringMap
+
+class EmFileRef;
+
+/*
+	EmCatalog remembers what the emulator has found out about the ROM
+	images and skin files it has looked at, so that it doesn't have to
+	find it out again every time it starts up.  Working out which devices
+	a ROM will run on means reading the whole ROM in and groveling over
+	its databases, and the New Session dialog and the startup checks do
+	that for every ROM in the MRU list.  Skin files are small, but there
+	can be a lot of them.
+
+	Entries are keyed by the file's full path, and remember the file's
+	size and modification date.  If either of those has changed, the
+	entry is thrown away and the file is looked at again.  So once the
+	catalog is warm, all it costs to check a file is a stat call.
+
+	Files that do need looking at can be handed over in a batch with
+	ScanROMs or ScanSkins, which read them on a few threads at once.
+
+	The catalog is saved in the emulator's directory.  The device list
+	depends on the emulator as well as the ROM, so ROM entries written
+	by a different version of the emulator are discarded.  Any problems
+	reading or writing the catalog are silently ignored; the caller just
+	reads the file the slow way.
+*/
+
+class EmCatalog
+{
+	public:
+		struct ROMInfo
+		{
+			uint16				fCardVersion;
+			uint32				fROMVersion;	// As returned by EmROMReader::Version
+			uint32				fCompanyID;
+			uint32				fHalID;
+			Bool				fHasSplash;
+			StringList			fDevices;		// ID strings of the devices that can run it
+		};
+
+	public:
+		static void				Startup			(void);
+		static void				Shutdown		(void);
+
+		static void				ScanROMs		(const EmFileRefList&);
+		static void				ScanSkins		(const EmFileRefList&);
+
+		static Bool				GetROMInfo		(const EmFileRef&, ROMInfo&);
+		static Bool				GetSkinEntries	(const EmFileRef&, StringStringMap&);
+};
+
+#endif	/* EmCatalog_h */
@@ -0,0 +1,467 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmClock.h"
+
+#include "ChunkFile.h"			// Chunk, EmStreamChunk
+#include "EmCPU68K.h"			// gCPU68K, GetCycleCount
+#include "EmHAL.h"				// EmHAL::GetSystemClockFrequency
+#include "Platform.h"			// Platform::Delay, Platform::GetMilliseconds
+#include "PreferenceMgr.h"		// Preference, kPrefKeyVirtualClock
+#include "SessionFile.h"		// SessionFile
+
+#if HAS_OMNI_THREAD
+#include "omnithread.h"			// omni_thread::yield
+#endif
+
+// The virtual clock starts at midnight (UTC), January 1, 2001 when a
+// session is created.  Each time the CPU goes idle, it's moved ahead by
+// one tick of the Palm OS's 100Hz tick counter.
+
+static const time_t		kVirtualEpoch		= 978307200;
+static const uint32		kIdleMilliseconds	= 10;
+
+
+// ===========================================================================
+//		 EmClock
+// ===========================================================================
+
+Bool	EmClock::fgIsVirtual;
+uint64	EmClock::fgMilliseconds;
+uint64	EmClock::fgRemainder;
+uint32	EmClock::fgLastCycleCount;
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Initialize	[ STATIC ]
+ *
+ * DESCRIPTION: Standard initialization function.  Responsible for
+ *				initializing this sub-system when a new session is
+ *				created.  Will be followed by at least one call to
+ *				Reset or Load.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Initialize (void)
+{
+	Preference<bool>	pref (kPrefKeyVirtualClock);
+
+	fgIsVirtual			= *pref;
+	fgMilliseconds		= 0;
+	fgRemainder			= 0;
+	fgLastCycleCount	= gCPU68K ? gCPU68K->GetCycleCount () : 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Reset	[ STATIC ]
+ *
+ * DESCRIPTION:	Standard reset function.  Sets the sub-system to a
+ *				default state.  This occurs not only on a Reset (as
+ *				from the menu item), but also when the sub-system
+ *				is first initialized (Reset is called after Initialize)
+ *				as well as when the system is re-loaded from an
+ *				insufficient session file.
+ *
+ *				A device's clock keeps running across a reset, so the
+ *				time is left alone.  But the CPU's cycle counter has
+ *				just been zeroed, so start counting from there.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Reset (void)
+{
+	fgLastCycleCount = gCPU68K ? gCPU68K->GetCycleCount () : 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Save	[ STATIC ]
+ *
+ * DESCRIPTION:	Standard save function.  Saves any sub-system state to
+ *				the given session file.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Save (SessionFile& f)
+{
+	const long	kCurrentVersion = 1;
+
+	EmClock::Update ();
+
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kCurrentVersion;
+
+	s << fgMilliseconds;
+	s << fgRemainder;
+
+	f.WriteClockInfo (chunk);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Load	[ STATIC ]
+ *
+ * DESCRIPTION:	Standard load function.  Loads any sub-system state
+ *				from the given session file.  Sessions saved before
+ *				there was a virtual clock start it over again.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Load (SessionFile& f)
+{
+	EmClock::Initialize ();
+
+	Chunk	chunk;
+	if (f.ReadClockInfo (chunk))
+	{
+		long			version;
+		EmStreamChunk	s (chunk);
+
+		s >> version;
+
+		if (version >= 1)
+		{
+			s >> fgMilliseconds;
+			s >> fgRemainder;
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Dispose	[ STATIC ]
+ *
+ * DESCRIPTION:	Standard dispose function.  Completely release any
+ *				resources acquired or allocated in Initialize and/or
+ *				Load.  Without a session, it's the host's time.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Dispose (void)
+{
+	fgIsVirtual = false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Update	[ STATIC ]
+ *
+ * DESCRIPTION:	Move the virtual clock ahead by the number of CPU cycles
+ *				executed since the last time, converted at the current
+ *				system clock frequency.  The CPU calls this from
+ *				CycleSlowly, which is often enough that its 32-bit cycle
+ *				counter can't wrap around in between, and that a change
+ *				in the clock frequency makes little difference.
+ *
+ *				The fractions of a millisecond are carried over from
+ *				call to call so that no time is lost to rounding.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Update (void)
+{
+	if (!fgIsVirtual || !gCPU68K)
+		return;
+
+	uint32	cycleCount	= gCPU68K->GetCycleCount ();
+	int32	frequency	= EmHAL::GetSystemClockFrequency ();
+
+	fgRemainder += (uint64) (cycleCount - fgLastCycleCount) * 1000;
+	fgLastCycleCount = cycleCount;
+
+	if (frequency > 0)
+	{
+		fgMilliseconds += fgRemainder / frequency;
+		fgRemainder %= frequency;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::Delay	[ STATIC ]
+ *
+ * DESCRIPTION:	Called by the CPU when it's idle, in order to wait for
+ *				the next timer tick.  With the host's clock, that means
+ *				sleeping for that long.  With the virtual clock, it
+ *				means moving the clock ahead to the next tick right
+ *				now.  We still yield the rest of our time slice so that
+ *				an idle session doesn't starve the UI.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::Delay (void)
+{
+	if (!fgIsVirtual)
+	{
+		Platform::Delay ();
+		return;
+	}
+
+	EmClock::Update ();
+
+	fgMilliseconds += kIdleMilliseconds;
+
+#if HAS_OMNI_THREAD
+	omni_thread::yield ();
+#endif
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::GetMilliseconds	[ STATIC ]
+ *
+ * DESCRIPTION:	Return a millisecond counter.  Use this instead of
+ *				Platform::GetMilliseconds for anything that affects
+ *				the emulated device.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Milliseconds since some arbitrary point in time.
+ *
+ ***********************************************************************/
+
+uint32 EmClock::GetMilliseconds (void)
+{
+	if (!fgIsVirtual)
+		return Platform::GetMilliseconds ();
+
+	return (uint32) EmClock::GetVirtualMilliseconds ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::GetTime	[ STATIC ]
+ *
+ * DESCRIPTION:	Return the current time, as the standard C library's
+ *				time function does.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Seconds since 00:00:00 January 1, 1970 (UTC).
+ *
+ ***********************************************************************/
+
+time_t EmClock::GetTime (void)
+{
+	if (!fgIsVirtual)
+		return time (NULL);
+
+	return kVirtualEpoch + (time_t) (EmClock::GetVirtualMilliseconds () / 1000);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::GetClock	[ STATIC ]
+ *
+ * DESCRIPTION:	Return the processor time used, as the standard C
+ *				library's clock function does.  With the virtual clock,
+ *				that's the time since the session was created.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The processor time in CLOCKS_PER_SEC units.
+ *
+ ***********************************************************************/
+
+clock_t EmClock::GetClock (void)
+{
+	if (!fgIsVirtual)
+		return clock ();
+
+	return (clock_t) (EmClock::GetVirtualMilliseconds () * CLOCKS_PER_SEC / 1000);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::GetLocalTime	[ STATIC ]
+ *
+ * DESCRIPTION:	Return the current time broken down into its parts.
+ *				The virtual clock is always in UTC, so that the host's
+ *				time zone doesn't leak into the session.
+ *
+ * PARAMETERS:	result - receives the time.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::GetLocalTime (struct tm& result)
+{
+	EmClock::LocalTime (EmClock::GetTime (), result);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::LocalTime	[ STATIC ]
+ *
+ * DESCRIPTION:	Break the given time down into its parts, as the
+ *				standard C library's localtime function does.  When
+ *				the clock is virtual, the time is broken down in UTC,
+ *				as for GetLocalTime.
+ *
+ * PARAMETERS:	t - the time to break down.
+ *
+ *				result - receives the time.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmClock::LocalTime (time_t t, struct tm& result)
+{
+	if (!fgIsVirtual)
+		result = *localtime (&t);
+	else
+		result = *gmtime (&t);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::MakeTime	[ STATIC ]
+ *
+ * DESCRIPTION:	Turn a broken-down time back into a time_t, as the
+ *				standard C library's mktime function does.  This is the
+ *				inverse of LocalTime; when the clock is virtual, the
+ *				time is taken to be in UTC.
+ *
+ * PARAMETERS:	t - the time to convert.  As with mktime, its fields
+ *					are normalized on return.
+ *
+ * RETURNED:	Seconds since 00:00:00 January 1, 1970 (UTC), or -1
+ *				if the time can't be represented.
+ *
+ ***********************************************************************/
+
+time_t EmClock::MakeTime (struct tm& t)
+{
+	if (!fgIsVirtual)
+		return mktime (&t);
+
+	// There's no portable inverse of gmtime, so count the days since
+	// 1970 ourselves.  Years are counted from March, so that the leap
+	// day falls at the end of the year.
+
+	long	year	= t.tm_year + 1900 + t.tm_mon / 12;
+	long	month	= t.tm_mon % 12;
+
+	if (month < 0)
+	{
+		month += 12;
+		year -= 1;
+	}
+
+	if (month < 2)
+	{
+		month += 12;
+		year -= 1;
+	}
+
+	month -= 2;		// March == 0
+
+	long	era		= (year >= 0 ? year : year - 399) / 400;
+	long	yoe		= year - era * 400;
+	long	doy		= (153 * month + 2) / 5 + t.tm_mday - 1;
+	long	doe		= yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	long	days	= era * 146097 + doe - 719468;
+
+	time_t	result	= (time_t) days * 86400 +
+					  t.tm_hour * 3600 + t.tm_min * 60 + t.tm_sec;
+
+	struct tm*	normalized = gmtime (&result);
+
+	if (!normalized)
+		return (time_t) -1;
+
+	t = *normalized;
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmClock::GetVirtualMilliseconds	[ STATIC ]
+ *
+ * DESCRIPTION:	Return the virtual time, including any cycles executed
+ *				since the last call to Update.  This doesn't update
+ *				anything, so it's OK to call it from any thread.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Milliseconds since the session was created.
+ *
+ ***********************************************************************/
+
+uint64 EmClock::GetVirtualMilliseconds (void)
+{
+	uint64	result = fgMilliseconds;
+
+	if (gCPU68K)
+	{
+		int32	frequency	= EmHAL::GetSystemClockFrequency ();
+		uint64	remainder	= fgRemainder +
+			(uint64) (gCPU68K->GetCycleCount () - fgLastCycleCount) * 1000;
+
+		if (frequency > 0)
+		{
+			result += remainder / frequency;
+		}
+	}
+
+	return result;
+}
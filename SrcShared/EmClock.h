@@ -0,0 +1,74 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmClock_h
+#define EmClock_h
+
+#include <time.h>				// time_t, clock_t, struct tm
+
+class SessionFile;
+
+/*
+	EmClock is where the emulator goes to find out what time it is
+	whenever the answer can be seen by the emulated device: the RTC
+	registers and alarm, the date given to the OS when it boots, the
+	throttling of hardware button events, and the HostTime and HostClock
+	HostControl functions.
+
+	Normally, all of those are answered with the host's clock.  When the
+	VirtualClock preference is set, they're answered instead with a clock
+	that's driven by the number of CPU cycles executed, starting at a
+	fixed date when the session is created.  When the CPU is idle, that
+	clock is advanced by a timer tick rather than sleeping for one, so
+	idle time costs nothing.  With nothing on the host leaking into the
+	emulated device, a run (such as a Gremlin) depends only on its
+	starting state and its inputs, and can be reproduced exactly on any
+	machine at any speed.
+
+	The clock's mode is taken from the preference when a session is
+	created or loaded.  The virtual time is saved with the session.
+*/
+
+class EmClock
+{
+	public:
+		static void				Initialize			(void);
+		static void				Reset				(void);
+		static void				Save				(SessionFile&);
+		static void				Load				(SessionFile&);
+		static void				Dispose				(void);
+
+		static Bool				IsVirtual			(void)	{ return fgIsVirtual; }
+
+		static void				Update				(void);
+		static void				Delay				(void);
+
+		static uint32			GetMilliseconds		(void);
+		static time_t			GetTime				(void);
+		static clock_t			GetClock			(void);
+		static void				GetLocalTime		(struct tm&);
+
+		static void				LocalTime			(time_t, struct tm&);
+		static time_t			MakeTime			(struct tm&);
+
+	private:
+		static uint64			GetVirtualMilliseconds	(void);
+
+	private:
+		static Bool				fgIsVirtual;
+		static uint64			fgMilliseconds;
+		static uint64			fgRemainder;
+		static uint32			fgLastCycleCount;
+};
+
+#endif	// EmClock_h
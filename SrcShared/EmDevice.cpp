@@ -48,10 +48,13 @@
 #include "Platform.h"			// _stricmp
 
 #include "EmBankRegs.h"			// AddSubBank
+#include "EmCatalog.h"			// EmCatalog
 #include "EmROMReader.h"		// EmROMReader
 #include "EmStreamFile.h"		// EmStreamFile
 #include "Miscellaneous.h"		// StMemory
 
+#include <algorithm>			// find
+
 #include "PalmPack.h"
 #define NON_PORTABLE
 	#include "HwrMiscFlags.h"		// hwrMiscFlagIDTouchdown, etc.
@@ -108,23 +111,23 @@
 
 #ifdef SONY_ROM
 #include "EmRegsSZ.h"
-#include "SonyShared\SonyDevice.h"
-#include "SonyShared\EmRegsEZPegS500C.h"
-#include "SonyShared\EmRegsEZPegS300.h"
-#include "SonyShared\EmRegsVZPegN700C.h"
-#include "SonyShared\EmRegsVZPegNasca.h"
-#include "SonyShared\EmRegsVZPegYellowStone.h"
-#include "SonyShared\EmRegsVZPegVenice.h"
-#include "SonyShared\EmRegsVZPegModena.h"
-#include "SonyShared\EmRegsSZRedwood.h"
-#include "SonyShared\EmRegsSZNaples.h"
-#include "SonyShared\Bank_USBSony.h"
-#include "SonyShared\EmRegsLCDCtrl.h"
-#include "SonyShared\EmRegsLCDCtrlT2.h"
-#include "SonyShared\EmRegsExpCardCLIE.h"
+#include "SonyShared/SonyDevice.h"
+#include "SonyShared/EmRegsEzPegS500C.h"
+#include "SonyShared/EmRegsEzPegS300.h"
+#include "SonyShared/EmRegsVZPegN700C.h"
+#include "SonyShared/EmRegsVZPegNasca.h"
+#include "SonyShared/EmRegsVZPegYellowStone.h"
+#include "SonyShared/EmRegsVZPegVenice.h"
+#include "SonyShared/EmRegsVZPegModena.h"
+#include "SonyShared/EmRegsSZRedwood.h"
+#include "SonyShared/EmRegsSZNaples.h"
+#include "SonyShared/Bank_USBSony.h"
+#include "SonyShared/EmRegsLCDCtrl.h"
+#include "SonyShared/EmRegsLCDCtrlT2.h"
+#include "SonyShared/EmRegsExpCardCLIE.h"
 //#include "SonyShared\EmRegsCommandItf.h"
-#include "SonyShared\EmRegsFMSound.h"
-#include "SonyShared\EmRegsRAMforCLIE.h"
+#include "SonyShared/EmRegsFMSound.h"
+#include "SonyShared/EmRegsRAMforCLIE.h"
 //#include "SonyShared\EmRegsFMSoundforSZ.h"
 //#include "SonyShared\EmRegsSharedRAMforCLIE.h"
 //#include "SonyShared\EmRegsClockIRQCntrl.h"
@@ -402,7 +405,7 @@ static const DeviceInfo kDeviceInfo[] =
 	}
 
 #ifdef SONY_ROM
-#include "SonyShared\EmDeviceSony.inl"
+#include "SonyShared/EmDeviceSony.inl"
 #endif //SONY_ROM
 
 };
@@ -668,6 +671,16 @@ Bool EmDevice::EdgeHack (void) const
 
 Bool EmDevice::SupportsROM (const EmFileRef& romFileRef) const
 {
+	// See if the catalog already knows which devices can run the ROM.
+
+	EmCatalog::ROMInfo	info;
+
+	if (EmCatalog::GetROMInfo (romFileRef, info))
+	{
+		return find (info.fDevices.begin (), info.fDevices.end (),
+			this->GetIDString ()) != info.fDevices.end ();
+	}
+
 	// Load the ROM image into memory.
 
 	EmStreamFile	romStream (romFileRef, kOpenExistingForRead);
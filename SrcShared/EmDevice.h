@@ -128,7 +128,7 @@ enum	// DeviceType
 #endif //SONY_ROM
 
 #ifdef	SONY_ROM
-#include	"SonyShared\SonyDevice.h"
+#include	"SonyShared/SonyDevice.h"
 #endif	//SONY_ROM
 
 #endif	/* EmDevice_h */
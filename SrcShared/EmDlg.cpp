@@ -19,6 +19,7 @@
 #include "EmBankDRAM.h"			// EmBankDRAM::ValidAddress
 #include "EmBankROM.h"			// EmBankROM::ValidAddress
 #include "EmBankSRAM.h"			// EmBankSRAM::ValidAddress
+#include "EmCatalog.h"			// EmCatalog
 #include "EmEventPlayback.h"	// GetCurrentEvent, GetNumEvents
 #include "EmFileImport.h"		// EmFileImport
 #include "EmMinimize.h"			// EmMinimize::Stop
@@ -48,7 +49,7 @@
 #include "algorithm"			// find, remove_if, unary_function<>
 
 #ifdef SONY_ROM
-#include "SonyShared\MiscellaneousSony.h"		// MemoryTextList, GetMSSizeTextList
+#include "SonyShared/MiscellaneousSony.h"		// MemoryTextList, GetMSSizeTextList
 #endif //SONY_ROM
 
 #if !PLATFORM_UNIX
@@ -213,6 +214,11 @@ void EmDlg::PrvBuildROMMenu (const EmDlgContext& context)
 	EmFileRefList	romList;
 	gEmuPrefs->GetROMMRU (romList);
 
+	// Get the catalog up to date for all of the ROMs at once, rather
+	// than having PrvCanUseROMFile read them in one at a time.
+
+	EmCatalog::ScanROMs (romList);
+
 	if (romList.size () == 0)
 	{
 		EmDlg::AppendToMenu (dlg, kDlgItemNewROM, Platform::GetString (kStr_EmptyMRU));
@@ -286,6 +292,19 @@ private:
 };
 
 
+struct PrvNotInDeviceList : unary_function<EmDevice&, bool>
+{
+	PrvNotInDeviceList(const StringList& inIDs) : IDs(inIDs) {}
+	bool operator()(EmDevice& item)
+	{
+		return find(IDs.begin(), IDs.end(), item.GetIDString()) == IDs.end();
+	}
+
+private:
+	const StringList& IDs;
+};
+
+
 void EmDlg::PrvBuildDeviceMenu (const EmDlgContext& context)
 {
 	EmDlgRef				dlg			= context.fDlg;
@@ -455,6 +474,20 @@ void EmDlg::PrvFilterDeviceList(const EmFileRef& romFile, EmDeviceList& devices,
 
 	if (romFile.IsSpecified ())
 	{
+		// See if the catalog already knows which devices can run the ROM.
+
+		EmCatalog::ROMInfo	info;
+
+		if (EmCatalog::GetROMInfo (romFile, info))
+		{
+			version = info.fCardVersion;
+
+			devices_end = remove_if (devices.begin (), devices.end (),
+				PrvNotInDeviceList (info.fDevices));
+
+			return;
+		}
+
 		try
 		{
 			EmStreamFile	hROM(romFile, kOpenExistingForRead);
@@ -6341,7 +6374,9 @@ EmDlgFnResult EmDlg::PrvCallback (EmDlgContext& context)
 #endif
 
 #ifdef SONY_ROM
+#if PLATFORM_WINDOWS
 #include "resource.h"
+#endif
 void EmDlg::PrvBuildMSSizeMenu (const EmDlgContext& context)
 {
 	const EmDlgRef&	dlg		= context.fDlg;
@@ -6360,8 +6395,10 @@ void EmDlg::PrvBuildMSSizeMenu (const EmDlgContext& context)
 
 	if (dlg)
 	{
+#if PLATFORM_WINDOWS
 		HWND  hLabel = ::GetDlgItem((HWND)dlg, IDC_MSSIZE_LABEL);
 		::ShowWindow(hLabel, (enabled) ? SW_SHOW : SW_HIDE);
+#endif
 		ShowItem(dlg, kDlgItemNewMSSize, enabled);
 	}
 
@@ -15,6 +15,7 @@
 #include "EmDocument.h"
 
 #include "EmApplication.h"		// SetDocument
+#include "EmBenchmark.h"		// EmBenchmark::Start, Idle
 #include "EmCommands.h"			// EmCommandID, kCommandSessionClose, etc.
 #include "EmPatchState.h"		// EmPatchState::EvtGetEventCalled
 #include "EmRPC.h"				// RPC::Idle
@@ -24,7 +25,7 @@
 #include "Hordes.h"				// Hordes::PostLoad, Suspend, Step, Resume, Stop
 #include "Platform.h"			// Platform::GetBoundDevice
 #include "SocketMessaging.h"	// CSocket::IdleAll
-#include "Startup.h"			// Startup::NewHorde
+#include "Startup.h"			// Startup::NewHorde, Startup::Benchmark
 #include "Strings.r.h"			// kStr_CmdClose, etc.
 
 #if HAS_PROFILING
@@ -492,8 +493,18 @@ void EmDocument::HandleIdle (void)
 		{
 			this->ScheduleNewHorde (info);
 		}
+
+		EmFileRef	benchmarkRef;
+		if (Startup::Benchmark (&benchmarkRef))
+		{
+			EmBenchmark::Start (benchmarkRef);
+		}
 	}
 
+	// Run the next part of the benchmark suite, if it's on.
+
+	EmBenchmark::Idle ();
+
 	// Pop off deferred actions and handle them.
 
 	this->DoAll ();
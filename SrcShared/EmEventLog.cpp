@@ -0,0 +1,424 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmEventLog.h"
+
+#include "EmStreamFile.h"		// EmStreamFile
+#include "Miscellaneous.h"		// GzipEncode, GzipDecode, GzipWorstSize
+
+static const uint32		kSignature			= 'PELg';
+static const uint32		kVersion			= 1;
+
+static const long		kFileHeaderSize		= 8;
+static const long		kBlockHeaderSize	= 12;
+
+// Blocks are handed off to the writer thread when they get this big.
+// Only this many can be waiting for it; after that, Append waits.
+
+static const long		kBlockSize			= 16 * 1024;
+static const size_t		kMaxPendingBlocks	= 4;
+
+static uint32 PrvGet32 (const uint8* p);
+static void PrvPut32 (uint8* p, uint32 value);
+static uint32 PrvAdler32 (const uint8* p, long size);
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::EmEventLogWriter
+// ---------------------------------------------------------------------------
+// Create the log file (replacing any that's already there), and start up
+// the thread that writes blocks to it.  Throws if the file can't be
+// created.
+
+EmEventLogWriter::EmEventLogWriter (const EmFileRef& file) :
+	fFile (file),
+	fBlock ()
+#if HAS_OMNI_THREAD
+	,
+	fMutex (),
+	fWriterCondition (&fMutex),
+	fDoneCondition (&fMutex),
+	fWriter (NULL),
+	fWriterQuit (false),
+	fWriterBusy (false),
+	fPending ()
+#endif
+{
+	uint8			header[kFileHeaderSize];
+
+	::PrvPut32 (header, kSignature);
+	::PrvPut32 (header + 4, kVersion);
+
+	EmStreamFile	stream (fFile, kCreateOrEraseForWrite,
+						kFileCreatorEmulator, kFileTypeEvents);	// Will throw if can't create
+
+	stream.PutBytes (header, kFileHeaderSize);
+
+#if HAS_OMNI_THREAD
+	// Use the variant that takes a function returning void* so that
+	// the thread is created undetached and we can join it later.
+
+	fWriter = omni_thread::create (&EmEventLogWriter::WriterStatic, this,
+		omni_thread::PRIORITY_LOW);
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::~EmEventLogWriter
+// ---------------------------------------------------------------------------
+
+EmEventLogWriter::~EmEventLogWriter (void)
+{
+	this->Flush ();
+
+#if HAS_OMNI_THREAD
+	{
+		omni_mutex_lock	lock (fMutex);
+
+		fWriterQuit = true;
+		fWriterCondition.signal ();
+	}
+
+	fWriter->join (NULL);
+	fWriter = NULL;
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::Append
+// ---------------------------------------------------------------------------
+
+void EmEventLogWriter::Append (const void* data, long size)
+{
+	long	oldSize = fBlock.GetLength ();
+
+	fBlock.SetLength (oldSize + size);
+	memcpy ((char*) fBlock.GetPointer () + oldSize, data, size);
+
+	if (fBlock.GetLength () >= kBlockSize)
+	{
+		this->PostBlock ();
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::Flush
+// ---------------------------------------------------------------------------
+// Write out whatever's been appended so far, even if it doesn't make up a
+// full block, and wait for it to get to the file.
+
+void EmEventLogWriter::Flush (void)
+{
+	this->PostBlock ();
+
+#if HAS_OMNI_THREAD
+	omni_mutex_lock	lock (fMutex);
+
+	while (!fPending.empty () || fWriterBusy)
+	{
+		fDoneCondition.wait ();
+	}
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::PostBlock
+// ---------------------------------------------------------------------------
+// Hand the current block off to the writer thread, waiting for it to catch
+// up if it's too far behind.
+
+void EmEventLogWriter::PostBlock (void)
+{
+	if (fBlock.GetLength () == 0)
+		return;
+
+#if HAS_OMNI_THREAD
+	Chunk*	block = new Chunk (fBlock);
+	fBlock.SetLength (0);
+
+	omni_mutex_lock	lock (fMutex);
+
+	while (fPending.size () >= kMaxPendingBlocks)
+	{
+		fDoneCondition.wait ();
+	}
+
+	fPending.push_back (block);
+	fWriterCondition.signal ();
+#else
+	this->WriteBlock (fBlock);
+	fBlock.SetLength (0);
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::WriteBlock
+// ---------------------------------------------------------------------------
+// Compress the given block and append it to the file.  The file is opened
+// and closed each time so that the block is on disk when we return.
+
+void EmEventLogWriter::WriteBlock (const Chunk& block)
+{
+	long	size = block.GetLength ();
+	long	worstSize = ::GzipWorstSize (size);
+	Chunk	packed (kBlockHeaderSize + worstSize);
+
+	uint8*	header = (uint8*) packed.GetPointer ();
+	void*	src = block.GetPointer ();
+	void*	dest = header + kBlockHeaderSize;
+
+	::GzipEncode (&src, &dest, size, worstSize);
+
+	long	packedSize = (uint8*) dest - (header + kBlockHeaderSize);
+
+	::PrvPut32 (header, packedSize);
+	::PrvPut32 (header + 4, size);
+	::PrvPut32 (header + 8, ::PrvAdler32 (header + kBlockHeaderSize, packedSize));
+
+	try
+	{
+		EmStreamFile	stream (fFile, kCreateOrOpenForWrite,
+							kFileCreatorEmulator, kFileTypeEvents);
+
+		stream.PutBytes (header, kBlockHeaderSize + packedSize);
+	}
+	catch (...)
+	{
+		// Nothing we can do about it, and nobody to tell.  If only part
+		// of the block made it out, the reader stops there, as it can't
+		// tell a torn block from one that's still being written.  The
+		// blocks before it can still be read back, so at least the log
+		// isn't lost altogether.
+	}
+}
+
+
+#if HAS_OMNI_THREAD
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::WriterStatic
+// ---------------------------------------------------------------------------
+
+void* EmEventLogWriter::WriterStatic (void* data)
+{
+	((EmEventLogWriter*) data)->Writer ();
+
+	return NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogWriter::Writer
+// ---------------------------------------------------------------------------
+// Body of the writer thread.  Writes out blocks as they're posted, until
+// we're told to quit and there aren't any more.
+
+void EmEventLogWriter::Writer (void)
+{
+	omni_mutex_lock	lock (fMutex);
+
+	while (true)
+	{
+		while (fPending.empty () && !fWriterQuit)
+		{
+			fWriterCondition.wait ();
+		}
+
+		if (fPending.empty ())
+			break;
+
+		Chunk*	block = fPending.front ();
+		fPending.pop_front ();
+		fWriterBusy = true;
+
+		// Let Append carry on while we compress.
+
+		fMutex.unlock ();
+
+		this->WriteBlock (*block);
+		delete block;
+
+		fMutex.lock ();
+
+		fWriterBusy = false;
+		fDoneCondition.broadcast ();
+	}
+}
+
+#endif
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogReader::EmEventLogReader
+// ---------------------------------------------------------------------------
+
+EmEventLogReader::EmEventLogReader (const EmFileRef& file) :
+	fFile (file),
+	fOffset (0)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogReader::~EmEventLogReader
+// ---------------------------------------------------------------------------
+
+EmEventLogReader::~EmEventLogReader (void)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventLogReader::ReadBlock
+// ---------------------------------------------------------------------------
+// Read the next block from the file.  Returns false if there isn't a
+// complete one there, in which case the same block is tried again on the
+// next call.
+
+Bool EmEventLogReader::ReadBlock (Chunk& block)
+{
+	try
+	{
+		EmStreamFile	stream (fFile, kOpenExistingForRead);	// Will throw if fnf
+		long			length = stream.GetLength ();
+
+		if (fOffset == 0)
+		{
+			uint8	header[kFileHeaderSize];
+
+			if (length < kFileHeaderSize ||
+				stream.GetBytes (header, kFileHeaderSize) != errNone)
+				return false;
+
+			if (::PrvGet32 (header) != kSignature ||
+				::PrvGet32 (header + 4) != kVersion)
+				return false;
+
+			fOffset = kFileHeaderSize;
+		}
+
+		if (length - fOffset < kBlockHeaderSize)
+			return false;
+
+		uint8	header[kBlockHeaderSize];
+
+		stream.SetMarker (fOffset, kStreamFromStart);
+
+		if (stream.GetBytes (header, kBlockHeaderSize) != errNone)
+			return false;
+
+		uint32	packedSize		= ::PrvGet32 (header);
+		uint32	unpackedSize	= ::PrvGet32 (header + 4);
+		uint32	checksum		= ::PrvGet32 (header + 8);
+
+		if (packedSize == 0 ||
+			packedSize > (uint32) (length - fOffset - kBlockHeaderSize))
+			return false;
+
+		Chunk	packed (packedSize);
+
+		if (stream.GetBytes (packed.GetPointer (), packedSize) != errNone)
+			return false;
+
+		// The writer may still be in the middle of this one.
+
+		if (::PrvAdler32 ((const uint8*) packed.GetPointer (), packedSize) != checksum)
+			return false;
+
+		block.SetLength (unpackedSize);
+
+		void*	src = packed.GetPointer ();
+		void*	dest = block.GetPointer ();
+
+		::GzipDecode (&src, &dest, packedSize, unpackedSize);
+
+		fOffset += kBlockHeaderSize + packedSize;
+	}
+	catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvGet32
+// ---------------------------------------------------------------------------
+
+uint32 PrvGet32 (const uint8* p)
+{
+	return
+		((uint32) p[0] << 24) | ((uint32) p[1] << 16) |
+		((uint32) p[2] << 8) | (uint32) p[3];
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPut32
+// ---------------------------------------------------------------------------
+
+void PrvPut32 (uint8* p, uint32 value)
+{
+	p[0] = (uint8) (value >> 24);
+	p[1] = (uint8) (value >> 16);
+	p[2] = (uint8) (value >> 8);
+	p[3] = (uint8) value;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvAdler32
+// ---------------------------------------------------------------------------
+
+uint32 PrvAdler32 (const uint8* p, long size)
+{
+	const uint32	kBase = 65521;
+
+	// 5552 is the most bytes we can add up before a and b need to be
+	// reduced to keep them from overflowing.
+
+	const long		kMaxRun = 5552;
+
+	uint32	a = 1;
+	uint32	b = 0;
+
+	while (size > 0)
+	{
+		long	run = size < kMaxRun ? size : kMaxRun;
+
+		size -= run;
+
+		while (run--)
+		{
+			a += *p++;
+			b += a;
+		}
+
+		a %= kBase;
+		b %= kBase;
+	}
+
+	return (b << 16) | a;
+}
@@ -0,0 +1,108 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmEventLog_h
+#define EmEventLog_h
+
+#include "ChunkFile.h"			// Chunk
+#include "EmFileRef.h"			// EmFileRef
+
+#include "omnithread.h"			// omni_mutex, omni_condition, omni_thread
+
+#include <deque>				// deque
+
+/*
+	EmEventLogWriter and EmEventLogReader manage files holding a stream
+	of data that's added to a little at a time over a long period, such
+	as the events recorded by a Gremlin or the steps written out by
+	EmEventOutput.
+
+	Data given to the writer is collected into blocks.  When a block
+	fills up, it's handed off to a background thread, which compresses
+	it and appends it to the file.  Only a few blocks are allowed to be
+	waiting for the thread at any one time, so the amount of memory
+	used stays the same no matter how long the log gets.  The file is
+	closed after each block is written, so that if we crash, everything
+	up to the last block written is still there.
+
+	The reader returns the blocks in the file one at a time.  A block
+	that's not all there yet is treated as the end of the file, and is
+	picked up on a later call once it's been written, so a log can be
+	read while it's still being written.
+
+	The format of the file is:
+
+		signature: 4 bytes ('PELg')
+		version: 4 bytes
+		blocks...
+
+	with each block being:
+
+		packed size: 4 bytes
+		unpacked size: 4 bytes
+		checksum: 4 bytes (Adler-32 of the packed data)
+		packed data: "packed size" bytes (gzip compressed)
+
+	All integers are stored in Big Endian format.
+*/
+
+class EmEventLogWriter
+{
+	public:
+								EmEventLogWriter	(const EmFileRef&);
+								~EmEventLogWriter	(void);
+
+		void					Append				(const void*, long);
+		void					Flush				(void);
+
+		EmFileRef				GetFile				(void) const	{ return fFile; }
+
+	private:
+		void					PostBlock			(void);
+		void					WriteBlock			(const Chunk&);
+
+#if HAS_OMNI_THREAD
+		static void*			WriterStatic		(void*);
+		void					Writer				(void);
+#endif
+
+	private:
+		EmFileRef				fFile;
+		Chunk					fBlock;
+
+#if HAS_OMNI_THREAD
+		omni_mutex				fMutex;
+		omni_condition			fWriterCondition;
+		omni_condition			fDoneCondition;
+		omni_thread*			fWriter;
+		Bool					fWriterQuit;
+		Bool					fWriterBusy;
+		deque<Chunk*>			fPending;
+#endif
+};
+
+
+class EmEventLogReader
+{
+	public:
+								EmEventLogReader	(const EmFileRef&);
+								~EmEventLogReader	(void);
+
+		Bool					ReadBlock			(Chunk&);
+
+	private:
+		EmFileRef				fFile;
+		long					fOffset;
+};
+
+#endif	/* EmEventLog_h */
@@ -14,13 +14,14 @@
 #include "EmCommon.h"
 #include "EmEventOutput.h"
 
+#include "EmEventLog.h"			// EmEventLogWriter, EmEventLogReader
 #include "EmMemory.h"			// EmMem_strcpy
 #include "EmPalmOS.h"			// GenerateStackCrawl
 #include "EmPalmStructs.h"		// EmAliasControlType
 #include "EmPatchState.h"		// EmPatchState::GetCurrentAppInfo
 #include "EmSession.h"			// gSession
 #include "ErrorHandling.h"		// Errors::GetAppName, GetAppVersion
-#include "Miscellaneous.h"		// StackCrawlStrings
+#include "Miscellaneous.h"		// StackCrawlStrings, EndsWith
 #include "PreferenceMgr.h"		// Preference, gEmuPrefs
 #include "ROMStubs.h"			// FtrGet
 
@@ -73,10 +74,18 @@ static inline Bool PrvIsPenDown (const EmRecordedEvent& event)
 
 #define IS_EXTENDED(chrcode) (chrcode >= 0x0080 && chrcode <= 0x00FF)
 
+// Settled events are written out to the step log once there are at
+// least this many of them.
+
+static const size_t	kMinEventsToFlush = 64;
+
+static EmFileRef PrvGetStepLogRef (void);
+
 
 // Global state variables:
 
 EmEventInfoList	EmEventOutput::fgEventInfo;
+EmEventLogWriter*	EmEventOutput::fgStepLog;
 Bool			EmEventOutput::fgIsGatheringInfo;
 int				EmEventOutput::fgCounter;
 UInt16			EmEventOutput::fgPreviousFormID;
@@ -103,12 +112,31 @@ Bool			EmEventOutput::fgWaitForPenUp;
 void EmEventOutput::StartGatheringInfo (void)
 {
 	fgEventInfo.clear ();
-	fgCounter			= 0;
+	fgCounter			= 2;	// Step 1 is the start step, written last.
 	fgPreviousFormID	= 0;
 	fgEventAwaitingInfo	= false;
 	fgWaitForPenUp		= false;
 
 	EmEventOutput::GatherInfo (true);
+
+	// Start a new step log.  If we can't, then we just hang onto all the
+	// event info until the end, as we used to.
+
+	delete fgStepLog;
+	fgStepLog = NULL;
+
+	EmFileRef	stepLogRef = ::PrvGetStepLogRef ();
+
+	if (stepLogRef.IsSpecified ())
+	{
+		try
+		{
+			fgStepLog = new EmEventLogWriter (stepLogRef);
+		}
+		catch (...)
+		{
+		}
+	}
 }
 
 
@@ -150,6 +178,46 @@ void EmEventOutput::GatherInfo (Bool gatherInfo)
 
 #pragma mark -
 
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetStepLogRef
+ *
+ * DESCRIPTION: Return the file to write steps to as we go.  It goes
+ *				next to the session file, and is named after it in the
+ *				same way as EmMinimize names its output.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The file reference, or an unspecified one if there's
+ *				no session file.
+ *
+ ***********************************************************************/
+
+EmFileRef PrvGetStepLogRef (void)
+{
+	if (!gSession)
+		return EmFileRef ();
+
+	EmFileRef	ref = gSession->GetFile ();
+
+	if (!ref.IsSpecified ())
+		return EmFileRef ();
+
+	// Convert the name from <Foo>.pev to <Foo>_Min_Steps.pel.
+
+	string		name = ref.GetName ();
+
+	if (::EndsWith (name.c_str (), ".pev"))
+	{
+		name = name.substr (0, name.size () - 4);
+	}
+
+	name += "_Min_Steps.pel";
+
+	return EmFileRef (ref.GetParent (), name);
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	PrvGetStringFromEmuMemory
@@ -388,6 +456,60 @@ void EmEventOutput::GetEventInfo (const EmRecordedEvent& event)
 	}
 
 	fgEventInfo.push_back (eventInfo);
+
+	EmEventOutput::FlushSettledEvents ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmEventOutput::FlushSettledEvents
+ *
+ * DESCRIPTION: Write out the steps for events that we're not going to
+ *				change any more, and forget about those events.
+ *
+ *				The last event can still pick up the name of a form
+ *				that it caused to be opened, so we hang onto it.  We
+ *				also hang onto any key events leading up to it, as
+ *				they may end up being written out as a single step.
+ *				If we're waiting for information about a pen event,
+ *				we hang onto everything.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmEventOutput::FlushSettledEvents (void)
+{
+	if (!fgStepLog || fgEventAwaitingInfo || fgEventInfo.size () == 0)
+		return;
+
+	EmEventInfoList::size_type	keep = fgEventInfo.size () - 1;
+
+	while (keep > 0 &&
+		fgEventInfo[keep].event.eType == kRecordedKeyEvent &&
+		fgEventInfo[keep - 1].event.eType == kRecordedKeyEvent)
+	{
+		--keep;
+	}
+
+	if (keep < kMinEventsToFlush)
+		return;
+
+	strstream	stream;
+
+	EmEventOutput::OutputEventSteps (fgEventInfo.begin (),
+		fgEventInfo.begin () + keep, stream);
+
+	fgStepLog->Append (stream.str (), stream.pcount ());
+
+	// Unfreeze the stream, or else its storage will be leaked.
+
+	stream.freeze (false);
+
+	fgEventInfo.erase (fgEventInfo.begin (), fgEventInfo.begin () + keep);
 }
 
 
@@ -1102,27 +1224,72 @@ void EmEventOutput::GetAwaitedEventInfo (void)
 
 void EmEventOutput::OutputEvents (strstream& stream)
 {
-	// Start step counter from one. The current step number is not necessarily
-	// the same as the current event index, because multiple events can go into 
-	// a single step.
+	// Write out starting step.  It's always step one; the steps for the
+	// events were numbered starting from two as they were written out.
+	// The current step number is not necessarily the same as the current
+	// event index, because multiple events can go into a single step.
+
+	int	counter = fgCounter;
 
 	fgCounter = 1;
+	EmEventOutput::OutputStartStep (stream);
+	fgCounter = counter;
 
-	// Write out starting step.
+	// Copy over the steps that have already been written to the log.
+	// We don't need the log after that.
 
-	EmEventOutput::OutputStartStep (stream);
+	if (fgStepLog)
+	{
+		fgStepLog->Flush ();
 
-	// Iterate over all the events.
+		EmFileRef			stepLogRef = fgStepLog->GetFile ();
+		EmEventLogReader	reader (stepLogRef);
+		Chunk				block;
 
-	EmEventInfoList::iterator	iter (fgEventInfo.begin ());
+		while (reader.ReadBlock (block))
+		{
+			stream.write ((const char*) block.GetPointer (), block.GetLength ());
+		}
+
+		delete fgStepLog;
+		fgStepLog = NULL;
+
+		stepLogRef.Delete ();
+	}
+
+	// Write out the steps for the rest of the events.
+
+	EmEventOutput::OutputEventSteps (fgEventInfo.begin (), fgEventInfo.end (), stream);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmEventOutput::OutputEventSteps
+ *
+ * DESCRIPTION: Write out the steps for the given range of events.
+ *
+ * PARAMETERS:	iter - the first event to write out
+ *
+ *				end - the event after the last one to write out
+ *
+ *				stream - string stream to write output into
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
 
-	while (iter != fgEventInfo.end ())
+void EmEventOutput::OutputEventSteps (EmEventInfoList::iterator iter,
+									  EmEventInfoList::iterator end,
+									  strstream& stream)
+{
+	while (iter != end)
 	{
 		switch (iter->event.eType)
 		{
 			case kRecordedKeyEvent:
 
-				EmEventOutput::OutputKeyEventStep (iter, stream);
+				EmEventOutput::OutputKeyEventStep (iter, end, stream);
 				break;
 
 			case kRecordedPenEvent:
@@ -1426,13 +1593,17 @@ static Bool PrvIsKeyWriteable (KeyDescription* kd, uint16 chrcode, uint16 modifi
  *				iter - an iterator over the events list, currently
  *					located at a key event
  *
+ *				end - the end of the range of events being written out
+ *
  *				stream - the output stream to write into
  *
  * RETURNED:	Nothing.
  *
  ***********************************************************************/
 
-void EmEventOutput::OutputKeyEventStep (EmEventInfoList::iterator& eventInfoIter, strstream& stream)
+void EmEventOutput::OutputKeyEventStep (EmEventInfoList::iterator& eventInfoIter,
+										EmEventInfoList::iterator end,
+										strstream& stream)
 {
 	EmAssert (eventInfoIter->event.eType == kRecordedKeyEvent);
 
@@ -1476,9 +1647,9 @@ void EmEventOutput::OutputKeyEventStep (EmEventInfoList::iterator& eventInfoIter
 
 			++eventInfoIter;
 
-			// Stop if this event is not a key event.
+			// Stop if we're out of events, or if this event is not a key event.
 
-			if (eventInfoIter->event.eType != kRecordedKeyEvent) 
+			if (eventInfoIter == end || eventInfoIter->event.eType != kRecordedKeyEvent) 
 				break;
 
 			// Stop if this key event is not writeable.
@@ -1488,7 +1659,7 @@ void EmEventOutput::OutputKeyEventStep (EmEventInfoList::iterator& eventInfoIter
 			if (!::PrvIsKeyWriteable (kd, eventInfoIter->event.keyEvent.ascii, eventInfoIter->event.keyEvent.modifiers))
 				break;
 
-		} while (eventInfoIter != fgEventInfo.end ());
+		} while (eventInfoIter != end);
 
 		// Undigest the event that caused us to break.
 
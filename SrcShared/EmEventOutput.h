@@ -37,6 +37,12 @@
 	completes, and EmMinimize::MinimizationComplete calles 
 	EmEventOutput::OutputEvents.
 
+	So that we don't have to hold onto the information for every event
+	until then, steps for events that can no longer change are written
+	out as we go to a log file next to the session file (see
+	EmEventLogWriter).  OutputEvents reads them back, and then writes out
+	the steps for the events that are left.
+
 	This system is accessed from the following locations:
 
 		* EmEventPlayback	: Reports that events are being inserted into the
@@ -176,6 +182,8 @@ struct EmEventInfo
 
 typedef vector<EmEventInfo>	EmEventInfoList;
 
+class EmEventLogWriter;
+
 class EmEventOutput
 {
 	// Interface for gathering event info:
@@ -203,6 +211,7 @@ class EmEventOutput
 		static void				GetAwaitedEventInfo		(void);
 		static void				GetPenEventInfo			(EmEventInfo&);
 		static void				GetAppSwitchEventInfo	(EmEventInfo&);
+		static void				FlushSettledEvents		(void);
 
 	// Interface for outputting:
 
@@ -220,7 +229,12 @@ class EmEventOutput
 
 	private:
 		static void				OutputStartStep			(strstream&);
-		static void				OutputKeyEventStep		(EmEventInfoList::iterator&, strstream&);
+		static void				OutputEventSteps		(EmEventInfoList::iterator,
+														 EmEventInfoList::iterator,
+														 strstream&);
+		static void				OutputKeyEventStep		(EmEventInfoList::iterator&,
+														 EmEventInfoList::iterator,
+														 strstream&);
 		static void				OutputPenEventStep		(const EmEventInfo&, strstream&);
 		static void				OutputAppSwitchEventStep(const EmEventInfo&, strstream&);
 		static void				OutputErrorEvent		(const EmEventInfo&, strstream&);
@@ -229,6 +243,7 @@ class EmEventOutput
 
 	private:
 		static EmEventInfoList	fgEventInfo;
+		static EmEventLogWriter*	fgStepLog;
 		static Bool				fgIsGatheringInfo;
 		static int				fgCounter;
 		static UInt16			fgPreviousFormID;
@@ -15,6 +15,7 @@
 #include "EmEventPlayback.h"
 
 #include "CGremlinsStubs.h"		// StubAppEnqueueKey, StubAppEnqueuePt
+#include "EmEventLog.h"			// EmEventLogWriter, EmEventLogReader
 #include "EmEventOutput.h"		// GetEventInfo
 #include "EmMemory.h"			// EmMem_strlen, EmMem_strcpy
 #include "EmMinimize.h"			// EmMinimize::IsOn
@@ -48,6 +49,8 @@ Chunk								EmEventPlayback::fgEvents;
 EmRecordedEventFilter				EmEventPlayback::fgMask;
 Bool								EmEventPlayback::fgRecording;
 Bool								EmEventPlayback::fgReplaying;
+EmEventLogWriter*					EmEventPlayback::fgStream;
+long								EmEventPlayback::fgSavedNumEvents = -1;
 EmEventPlayback::EmIterationState	EmEventPlayback::fgIterationState;
 EmEventPlayback::EmIterationState	EmEventPlayback::fgPrevIterationState;
 
@@ -151,10 +154,23 @@ void EmEventPlayback::Reset (void)
 // Based on these requirements, we don't really want to unconditionally save
 // events when saving the session.  Instead, we'll save them as needed from
 // the various sub-systems that need the events.
+//
+// We do save how many events had been recorded, though.  Gremlins uses
+// that when it goes back to a saved state, to throw away the events that
+// were recorded after the state was saved.
 
-void EmEventPlayback::Save (SessionFile&)
+void EmEventPlayback::Save (SessionFile& f)
 {
 //	EmEventPlayback::SaveEvents (f, fgEvents);
+
+	const uint32	kCurrentVersion = 1;
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kCurrentVersion;
+	s << (int32) EmEventPlayback::GetNumEvents ();
+
+	f.WritePlaybackInfo (chunk);
 }
 
 
@@ -188,9 +204,25 @@ void EmEventPlayback::Save (SessionFile&)
 // events when loading the session.  Instead, we'll load them as needed from
 // the various sub-systems that need the events.
 
-void EmEventPlayback::Load (SessionFile&)
+void EmEventPlayback::Load (SessionFile& f)
 {
 //	EmEventPlayback::LoadEvents (f, fgEvents);
+
+	Chunk	chunk;
+
+	fgSavedNumEvents = -1;
+
+	if (f.ReadPlaybackInfo (chunk))
+	{
+		uint32			version;
+		int32			numEvents;
+		EmStreamChunk	s (chunk);
+
+		s >> version;
+		s >> numEvents;
+
+		fgSavedNumEvents = numEvents;
+	}
 }
 
 
@@ -261,6 +293,8 @@ void EmEventPlayback::LoadEvents (SessionFile& f)
 {
 	Chunk	chunk;
 
+	EmEventPlayback::StopStreamingEvents ();
+
 	fgEvents.SetLength (0);	// Clear the list in case of failure.
 
 	if (f.ReadGremlinHistory (chunk))
@@ -296,6 +330,87 @@ void EmEventPlayback::LoadEvents (SessionFile& f)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::StreamEvents
+// ---------------------------------------------------------------------------
+// Start writing events to the given log file as they're recorded, so that
+// they survive a crash, and so that they can be followed with ReadEventLog
+// while they're still coming in.  Any events already recorded are written
+// out first.  The stream is stopped whenever the recorded events are thrown
+// away or replaced.
+
+void EmEventPlayback::StreamEvents (const EmFileRef& ref)
+{
+	if (fgStream && fgStream->GetFile () == ref)
+		return;
+
+	EmEventPlayback::StopStreamingEvents ();
+
+	try
+	{
+		fgStream = new EmEventLogWriter (ref);
+	}
+	catch (...)
+	{
+		fgStream = NULL;
+		return;
+	}
+
+	fgStream->Append (fgEvents.GetPointer (), fgEvents.GetLength ());
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::StopStreamingEvents
+// ---------------------------------------------------------------------------
+
+void EmEventPlayback::StopStreamingEvents (void)
+{
+	delete fgStream;
+	fgStream = NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::ReadEventLog
+// ---------------------------------------------------------------------------
+// Add any events from the given log that we haven't read yet.  This can be
+// called over and over on a log that's still being written in order to pick
+// up new events as they show up.  Returns the number of events added.
+
+long EmEventPlayback::ReadEventLog (EmEventLogReader& reader)
+{
+	long	result = 0;
+	Chunk	block;
+
+	while (reader.ReadBlock (block))
+	{
+		long	oldLength = fgEvents.GetLength ();
+
+		fgEvents.SetLength (oldLength + block.GetLength ());
+		memcpy ((char*) fgEvents.GetPointer () + oldLength,
+			block.GetPointer (), block.GetLength ());
+
+		// Blocks always end on an event boundary, so we can count up
+		// the new events (and enable them) as we go.
+
+		EmRecordedEvent	event;
+		EmStreamChunk	s (fgEvents);
+		s.SetMarker (oldLength, kStreamFromStart);
+
+		while (s.GetMarker () < s.GetLength ())
+		{
+			s >> event;
+
+			fgMask.push_back (true);
+			++result;
+		}
+	}
+
+	return result;
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -417,6 +532,8 @@ void EmEventPlayback::RecordErrorEvent (void)
 
 void EmEventPlayback::Clear (void)
 {
+	EmEventPlayback::StopStreamingEvents ();
+
 	fgEvents.SetLength (0);
 	fgMask.clear ();
 	fgRecording		= false;
@@ -426,6 +543,54 @@ void EmEventPlayback::Clear (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::TruncateEvents
+// ---------------------------------------------------------------------------
+// Throw away all but the first numEvents events.  This is for going back to
+// an earlier state, so that events recorded since then don't end up in the
+// run.  If the events are being streamed to a log, the log is started over
+// with the events that are left.  A negative count leaves everything alone.
+
+void EmEventPlayback::TruncateEvents (long numEvents)
+{
+	if (numEvents < 0 || numEvents >= EmEventPlayback::GetNumEvents ())
+		return;
+
+	EmRecordedEvent	event;
+	EmStreamChunk	s (fgEvents);
+
+	for (long ii = 0; ii < numEvents && s.GetMarker () < s.GetLength (); ++ii)
+	{
+		s >> event;
+	}
+
+	fgEvents.SetLength (s.GetMarker ());
+	fgMask.resize (numEvents);
+
+	EmEventPlayback::ResetPlayback ();
+
+	if (fgStream)
+	{
+		EmFileRef	ref = fgStream->GetFile ();
+
+		EmEventPlayback::StopStreamingEvents ();
+		EmEventPlayback::StreamEvents (ref);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::GetSavedNumEvents
+// ---------------------------------------------------------------------------
+// Return how many events had been recorded when the session most recently
+// loaded was saved, or -1 if that's not known.
+
+long EmEventPlayback::GetSavedNumEvents (void)
+{
+	return fgSavedNumEvents;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmEventPlayback::CullEvents
 // ---------------------------------------------------------------------------
@@ -436,6 +601,7 @@ void EmEventPlayback::CullEvents (void)
 	Chunk			newEvents;
 	EmStreamChunk	s (newEvents);
 
+	EmEventPlayback::StopStreamingEvents ();
 	EmEventPlayback::ResetPlayback ();
 
 	EmRecordedEvent	event;
@@ -781,11 +947,18 @@ void EmEventPlayback::RecordEvent (const EmRecordedEvent& event)
 {
 	if (EmEventPlayback::RecordingEvents ())
 	{
+		long			oldLength = fgEvents.GetLength ();
 		EmStreamChunk	s (fgEvents);
 		s.SetMarker (0, kStreamFromEnd);
 		s << event;
 
 		fgMask.push_back (true);
+
+		if (fgStream)
+		{
+			fgStream->Append ((char*) fgEvents.GetPointer () + oldLength,
+				fgEvents.GetLength () - oldLength);
+		}
 	}
 }
 
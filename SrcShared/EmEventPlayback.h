@@ -27,6 +27,7 @@
 		* Recording them in a list so that they can be replayed later.
 		* Replaying them later
 		* Saving them to and loading them from a file.
+		* Streaming them to a log file as they're recorded.
 		* Logging events for debugging.
 		* Filtering the events so that not all of them get replayed.
 
@@ -43,6 +44,8 @@
 							  as Gremlins are switched.
 */
 
+class EmEventLogReader;
+class EmEventLogWriter;
 class EmFileRef;
 class SessionFile;
 
@@ -124,6 +127,10 @@ class EmEventPlayback
 		static void 			LoadEvents			(const EmFileRef&);
 		static void 			LoadEvents			(SessionFile&);
 
+		static void				StreamEvents		(const EmFileRef&);
+		static void				StopStreamingEvents	(void);
+		static long				ReadEventLog		(EmEventLogReader&);
+
 		static void				RecordEvents		(Bool);
 		static Bool				RecordingEvents		(void);
 		static void				RecordKeyEvent		(WChar		ascii,
@@ -138,6 +145,8 @@ class EmEventPlayback
 		static void				RecordErrorEvent	(void);
 
 		static void				Clear				(void);
+		static void				TruncateEvents		(long numEvents);
+		static long				GetSavedNumEvents	(void);
 		static void				CullEvents			(void);
 		static long				CountEnabledEvents	(void);
 
@@ -179,6 +188,8 @@ class EmEventPlayback
 		static EmRecordedEventFilter	fgMask;
 		static Bool						fgRecording;
 		static Bool						fgReplaying;
+		static EmEventLogWriter*		fgStream;
+		static long						fgSavedNumEvents;
 
 		struct EmIterationState
 		{
@@ -18,7 +18,8 @@
 #include "EmDlg.h"				// EmDlg::DoCommonDialog
 #include "EmErrCodes.h"			// kError_OutOfMemory, ConvertFromPalmError, etc.
 #include "EmExgMgr.h"			// EmExgMgrStream, EmExgMgrImport
-#include "EmLowMem.h"			// TrapExists
+#include "EmLowMem.h"			// TrapExists, EmLowMem_GetGlobal
+#include "EmMemory.h"			// CEnableFullAccess, EmMem_memcpy, EmMemGet32
 #include "EmPalmStructs.h"		// SysLibTblEntryType, RecordEntryType, RsrcEntryType, etc.
 #include "EmPatchState.h"		// EmPatchState::AutoAcceptBeamDialogs
 #include "EmSession.h"			// ExecuteUntilIdle, gSession
@@ -82,6 +83,13 @@ const int		kInstallMiddle	= -2;
 const int		kInstallEnd		= -3;
 const int		kInstallDone	= -4;
 
+// Databases with at least this many entries are installed with the
+// bulk variant of the homebrew installer.  Each call to BulkInstallMiddle
+// handles up to kBulkInstallBatch of them.
+
+const UInt16	kBulkInstallThreshold	= 32;
+const long		kBulkInstallBatch		= 64;
+
 #define irGotDataChr 0x01FC		// to initiate NotifyReceive
 
 const char		kHostExgLibName[]		= "HostExgLib";
@@ -103,6 +111,8 @@ static void		PrvSetResourceTypeIDParameters (UInt32 resType, UInt16 resID);
 static ErrCode	PrvValidateDatabase	(const EmAliasDatabaseHdrType<LAS>& hdr, UInt32 size);
 static void		PrvSetDate			(const char* varName, uint32 seconds);
 static void		PrvSetExgMgr		(void* mgr);
+static UInt32	PrvGetEntryDataSize	(const EmAliasDatabaseHdrType<LAS>& hdr, UInt32 fileSize, long index);
+static LocalID	PrvHandleToLocalID	(emuptr h, UInt16 cardNo);
 
 static UInt16	gHostExgLibRefNum;
 
@@ -138,7 +148,10 @@ EmFileImport::EmFileImport	(EmStream& stream, EmFileImportMethod method) :
 	fDBID (0),
 	fCardNo (0),
 	fOpenID (0),
-	fCurrentEntry (0)
+	fCurrentEntry (0),
+
+	fBulkInstall (false),
+	fBulkHandles ()
 {
 }
 
@@ -352,6 +365,10 @@ ErrCode EmFileImport::Cancel (void)
 	{
 		this->ExgMgrInstallCancel ();
 	}
+	else if (fBulkInstall)
+	{
+		this->BulkInstallCancel ();
+	}
 	else
 	{
 		this->HomeBrewInstallCancel ();
@@ -559,6 +576,16 @@ void EmFileImport::IncrementalInstall (void)
 			case kInstallDone:		break;
 		}
 	}
+	else if (fBulkInstall)
+	{
+		switch (fState)
+		{
+			case kInstallStart:		this->HomeBrewInstallStart ();	break;
+			case kInstallMiddle:	this->BulkInstallMiddle ();		break;
+			case kInstallEnd:		this->BulkInstallEnd ();		break;
+			case kInstallDone:		break;
+		}
+	}
 	else
 	{
 		switch (fState)
@@ -850,7 +877,11 @@ void EmFileImport::HomeBrewInstallStart (void)
 		}
 	}
 
-	// If there are resources/records, start installing them.
+	// If there are resources/records, start installing them.  Large
+	// databases get their entries allocated and copied in without going
+	// through DmNewRecord/DmNewResource; see BulkInstallMiddle.
+
+	fBulkInstall = hdr.recordList.numRecords >= kBulkInstallThreshold;
 
 	if (hdr.recordList.numRecords > 0)
 		fState = kInstallMiddle;
@@ -1107,6 +1138,278 @@ void EmFileImport::HomeBrewInstallCancel (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileImport::BulkInstallMiddle
+ *
+ * DESCRIPTION:	Bulk version of HomeBrewInstallMiddle.  Installing an
+ *				entry with DmNewRecord or DmNewResource costs half a
+ *				dozen emulated traps, and each one grows the database
+ *				header by one entry.  For big databases, we instead
+ *				allocate each entry with a single DmNewHandle call and
+ *				copy its contents in directly.  The handles are
+ *				remembered until BulkInstallEnd builds the record list
+ *				in one go.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmFileImport::BulkInstallMiddle (void)
+{
+	EmAssert (fFileBuffer);
+	EmAliasDatabaseHdrType<LAS>	hdr (fFileBuffer);
+
+	Bool	isResources = ::PrvIsResources (hdr);
+	long	lastEntry = fCurrentEntry + kBulkInstallBatch;
+
+	if (lastEntry > hdr.recordList.numRecords)
+		lastEntry = hdr.recordList.numRecords;
+
+	while (fCurrentEntry < lastEntry)
+	{
+		// Set the error parameters in case an error occurs.
+
+		Errors::SetParameter ("%record_number", fCurrentEntry);
+
+		if (isResources)
+		{
+			EmAliasRsrcEntryType<LAS> rsrcEntry (hdr.recordList.resources[fCurrentEntry]);
+			::PrvSetResourceTypeIDParameters (rsrcEntry.type, rsrcEntry.id);
+		}
+
+		UInt32	size = ::PrvGetEntryDataSize (hdr, fFileBufferSize, fCurrentEntry);
+
+		Errors::SetParameter ("%res_size", size);
+
+		// Only add non-nil records (see HomeBrewInstallMiddle).  Keep a
+		// place-holder for them so that fBulkHandles lines up with the
+		// entries in the file.
+
+		emuptr	h = EmMemNULL;
+
+		if (size || isResources)
+		{
+			h = (emuptr) ::DmNewHandle (fOpenID, size);
+			if (!h)
+			{
+				Err	err = ::DmGetLastErr ();
+
+				this->BulkInstallCancel ();
+
+				if (err == dmErrMemError)
+				{
+					this->SetResult (isResources
+						? kError_BadDB_ResourceMemError
+						: kError_BadDB_RecordMemError);
+				}
+				else
+				{
+					this->SetResult (err);
+				}
+
+				return;
+			}
+
+			// Copy the data in.  The new chunk is unlocked, but nothing
+			// can move it until we make another Memory Manager call.
+
+			UInt8*	srcP = (UInt8*) hdr.GetPtr () +
+				(UInt32) (isResources
+					? hdr.recordList.resources[fCurrentEntry].localChunkID
+					: hdr.recordList.records[fCurrentEntry].localChunkID);
+
+			CEnableFullAccess	munge;
+			EmMem_memcpy (EmMemGet32 (h), (const void*) srcP, size);
+		}
+
+		fBulkHandles.push_back (h);
+
+		fCurrentEntry++;
+	}
+
+	if (fCurrentEntry >= hdr.recordList.numRecords)
+	{
+		fState = kInstallEnd;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileImport::BulkInstallEnd
+ *
+ * DESCRIPTION:	Bulk version of HomeBrewInstallEnd.  Closes the
+ *				database, grows its header once to hold all of the
+ *				entries allocated by BulkInstallMiddle, fills in the
+ *				record list directly, and then sets the final database
+ *				info.
+ *
+ *				The database must be closed for this: the Data Manager
+ *				keeps the header locked and caches the number of
+ *				records while it's open.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmFileImport::BulkInstallEnd (void)
+{
+	EmAssert (fFileBuffer);
+	EmAliasDatabaseHdrType<LAS>	hdr (fFileBuffer);
+
+	EmAssert (fDBID);
+	EmAssert (fOpenID);
+
+	Bool	isResources = ::PrvIsResources (hdr);
+	UInt16	numEntries = 0;
+
+	vector<emuptr>::iterator	iter = fBulkHandles.begin ();
+	while (iter != fBulkHandles.end ())
+	{
+		if (*iter)
+			++numEntries;
+
+		++iter;
+	}
+
+	::DmCloseDatabase (fOpenID);
+	fOpenID = 0;
+
+	// Make room for the record list.  The extra UInt16 is the place-
+	// holder that the Data Manager always keeps after the list.
+
+	MemHandle	hdrH = (MemHandle) ::MemLocalIDToGlobal (fDBID, fCardNo);
+	UInt32		hdrSize =	EmAliasDatabaseHdrType<PAS>::GetSize () +
+							numEntries * ::PrvGetEntrySize (hdr) +
+							sizeof (UInt16);
+
+	Err	err = ::MemHandleResize (hdrH, hdrSize);
+	if (err)
+	{
+		this->BulkInstallCancel ();
+		this->SetResult (err);
+		return;
+	}
+
+	// Fill in the record list.
+
+	{
+		CEnableFullAccess	munge;
+
+		EmAliasDatabaseHdrType<PAS>	dbHdr (EmMemGet32 ((emuptr) hdrH));
+		UInt32						uniqueIDSeed = dbHdr.uniqueIDSeed;
+		UInt16						index = 0;
+
+		for (size_t ii = 0; ii < fBulkHandles.size (); ++ii)
+		{
+			emuptr	h = fBulkHandles[ii];
+			if (!h)
+				continue;
+
+			LocalID	chunkID = ::PrvHandleToLocalID (h, fCardNo);
+
+			if (isResources)
+			{
+				EmAliasRsrcEntryType<LAS>	src (hdr.recordList.resources[ii]);
+				EmAliasRsrcEntryType<PAS>	dst (dbHdr.recordList.resources[index]);
+
+				dst.type			= src.type;
+				dst.id				= src.id;
+				dst.localChunkID	= chunkID;
+			}
+			else
+			{
+				EmAliasRecordEntryType<LAS>	src (hdr.recordList.records[ii]);
+				EmAliasRecordEntryType<PAS>	dst (dbHdr.recordList.records[index]);
+
+				// Same result as DmSetRecordInfo followed by
+				// DmReleaseRecord (..., true).
+
+				dst.localChunkID	= chunkID;
+				dst.attributes		= (src.attributes & ~dmSysOnlyRecAttrs) | dmRecAttrDirty;
+				dst.uniqueID[0]		= src.uniqueID[0];
+				dst.uniqueID[1]		= src.uniqueID[1];
+				dst.uniqueID[2]		= src.uniqueID[2];
+
+				// Keep the seed ahead of every ID we install, as
+				// DmNewRecord would have.
+
+				UInt32	id = src.uniqueID[0];
+				id = (id << 8) | src.uniqueID[1];
+				id = (id << 8) | src.uniqueID[2];
+
+				if (id >= uniqueIDSeed)
+					uniqueIDSeed = id + 1;
+			}
+
+			++index;
+		}
+
+		dbHdr.recordList.numRecords = numEntries;
+		dbHdr.uniqueIDSeed = uniqueIDSeed;
+	}
+
+	// The handles now belong to the database.
+
+	fBulkHandles.clear ();
+
+	// Fixup the modification # to match what was in the image.
+
+	UInt32	modificationNumber = hdr.modificationNumber;
+	err = ::DmSetDatabaseInfo (fCardNo, fDBID, NULL, NULL, NULL, NULL,
+				NULL, NULL, &modificationNumber, NULL, NULL, NULL, NULL);
+
+	if (err)
+	{
+		this->SetResult (err);
+		return;
+	}
+
+	// Drop our reference.
+
+	fDBID = 0;
+
+	fState = kInstallDone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileImport::BulkInstallCancel
+ *
+ * DESCRIPTION:	Cancels a bulk install.  Entries allocated by
+ *				BulkInstallMiddle aren't in the database's record list
+ *				yet, so deleting the database won't get rid of them.
+ *				Free them first.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmFileImport::BulkInstallCancel (void)
+{
+	vector<emuptr>::iterator	iter = fBulkHandles.begin ();
+	while (iter != fBulkHandles.end ())
+	{
+		if (*iter)
+			::MemHandleFree ((MemHandle) *iter);
+
+		++iter;
+	}
+
+	fBulkHandles.clear ();
+
+	this->DeleteCurrentDatabase ();
+}
+
+
 #pragma mark -
 
 /***********************************************************************
@@ -1373,6 +1676,75 @@ UInt32 PrvGetEntrySize (const EmAliasDatabaseHdrType<LAS>& hdr)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetEntryDataSize
+ *
+ * DESCRIPTION:	Return the size of the data for the given resource or
+ *				record in a database image.  Entries are laid out in
+ *				order, so this is the distance to the next one (or to
+ *				the end of the file).
+ *
+ * PARAMETERS:	hdr - header of the database image.
+ *
+ *				fileSize - size of the database image.
+ *
+ *				index - index of the entry.
+ *
+ * RETURNED:	The size in bytes.
+ *
+ ***********************************************************************/
+
+UInt32 PrvGetEntryDataSize (const EmAliasDatabaseHdrType<LAS>& hdr, UInt32 fileSize, long index)
+{
+	UInt32	thisID;
+	UInt32	nextID = fileSize;
+
+	if (::PrvIsResources (hdr))
+	{
+		EmAliasRsrcEntryType<LAS> rsrcEntry (hdr.recordList.resources[index]);
+
+		thisID = rsrcEntry.localChunkID;
+		if (index < hdr.recordList.numRecords - 1)
+			nextID = rsrcEntry[1].localChunkID;
+	}
+	else
+	{
+		EmAliasRecordEntryType<LAS> recordEntry (hdr.recordList.records[index]);
+
+		thisID = recordEntry.localChunkID;
+		if (index < hdr.recordList.numRecords - 1)
+			nextID = recordEntry[1].localChunkID;
+	}
+
+	return nextID - thisID;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvHandleToLocalID
+ *
+ * DESCRIPTION:	Local/native version of MemHandleToLocalID.  Saves a
+ *				trap per entry during bulk installs.
+ *
+ * PARAMETERS:	h - handle to convert.
+ *
+ *				cardNo - card the handle lives on.
+ *
+ * RETURNED:	The LocalID for the handle.
+ *
+ ***********************************************************************/
+
+LocalID PrvHandleToLocalID (emuptr h, UInt16 cardNo)
+{
+	emuptr						memCardInfoP = EmLowMem_GetGlobal (memCardInfoP);
+	EmAliasCardInfoType<PAS>	cardInfo (memCardInfoP);
+
+	return (h - cardInfo[cardNo].baseP) | 0x01;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	PrvSetResourceTypeIDParameters
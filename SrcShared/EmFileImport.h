@@ -69,6 +69,10 @@ class EmFileImport
 		void					HomeBrewInstallEnd		(void);
 		void					HomeBrewInstallCancel	(void);
 
+		void					BulkInstallMiddle		(void);
+		void					BulkInstallEnd			(void);
+		void					BulkInstallCancel		(void);
+
 		void					ValidateStream			(void);
 		void					DeleteCurrentDatabase	(void);
 
@@ -91,6 +95,10 @@ class EmFileImport
 		UInt16					fCardNo;
 		DmOpenRef				fOpenID;
 		long					fCurrentEntry;
+
+		// Fields for bulk variant of homebrew installer
+		Bool					fBulkInstall;
+		vector<emuptr>			fBulkHandles;
 };
 
 #endif /* EMFILEIMPORT_H */
@@ -14,6 +14,11 @@
 #include "EmCommon.h"
 #include "EmFileRef.h"
 
+#include "EmStreamFile.h"		// EmStreamFile
+#include "Platform.h"			// Platform::GetMilliseconds
+
+#include <stdio.h>				// rename, sprintf
+
 static EmFileRef	gEmulatorRef;
 
 /***********************************************************************
@@ -55,3 +60,78 @@ EmFileRef EmFileRef::GetEmulatorRef	(void)
 
 	return gEmulatorRef;
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::WriteSafely
+ *
+ * DESCRIPTION:	Replace the contents of the file with the given data.
+ *				Other instances of the emulator may be reading the
+ *				file, so the data is written to a temporary file that
+ *				is then renamed into place.  If the data can't be
+ *				written, the temporary file is removed and the old
+ *				file is left alone.  The file's directory is created
+ *				if needed.
+ *
+ * PARAMETERS:	data, size - the new contents of the file.
+ *
+ *				creator, fileType - passed on to EmStreamFile.
+ *
+ * RETURNED:	True if the file now holds the data.
+ *
+ ***********************************************************************/
+
+Bool EmFileRef::WriteSafely (const void* data, uint32 size,
+							 EmFileCreator creator, EmFileType fileType) const
+{
+	EmDirRef	parent = this->GetParent ();
+
+	// Give the temporary file a name that other instances doing the same
+	// thing at the same time are unlikely to use.
+
+	char	suffix[16];
+	sprintf (suffix, ".%08lX", (unsigned long) Platform::GetMilliseconds ());
+
+	EmFileRef	tempFile (parent, this->GetName () + suffix);
+
+	Bool	written = false;
+
+	try
+	{
+		if (!parent.Exists ())
+			parent.Create ();
+
+		EmStreamFile	fileStream (tempFile, kCreateOrEraseForWrite,
+								creator, fileType);	// Will throw if can't create
+
+		written = fileStream.PutBytes (data, size) == errNone;
+	}
+	catch (...)
+	{
+	}
+
+	if (!written)
+	{
+		if (tempFile.Exists ())
+			tempFile.Delete ();
+
+		return false;
+	}
+
+	if (::rename (tempFile.GetFullPath ().c_str (), this->GetFullPath ().c_str ()) != 0)
+	{
+		// Windows won't rename over an existing file.
+
+		if (this->Exists ())
+			this->Delete ();
+
+		if (::rename (tempFile.GetFullPath ().c_str (), this->GetFullPath ().c_str ()) != 0)
+		{
+			tempFile.Delete ();
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -89,6 +89,11 @@ class EmFileRef
 												 EmFileType fileType) const;
 		int						GetAttr			(int * attr) const;
 		int						SetAttr			(int attr) const;
+		int						GetSizeAndModDate (uint32* size, uint32* modDate) const;
+
+		Bool					WriteSafely		(const void* data, uint32 size,
+												 EmFileCreator creator = kFileCreatorNone,
+												 EmFileType fileType = kFileTypeNone) const;
 
 		string					GetName			(void) const;
 		EmDirRef				GetParent		(void) const;
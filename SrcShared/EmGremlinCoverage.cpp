@@ -0,0 +1,481 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmGremlinCoverage.h"
+
+#include "CGremlins.h"			// gGremlinNext
+#include "EmBankSRAM.h"			// gMemoryStart, gRAMBank_Size
+#include "EmEventPlayback.h"	// EmEventPlayback::TruncateEvents
+#include "EmSession.h"			// gSession, ScheduleSaveCoverageState
+#include "Hordes.h"				// Hordes::GremlinNumber, SaveCoverageState
+#include "Logging.h"			// LogAppendMsg, LogGremlins
+#include "PreferenceMgr.h"		// Preference
+
+
+static uint8	PrvBucket			(uint8 hits);
+
+// Number of Gremlin events between looks at the hit counters.
+
+const long		kSegmentEvents		= 500;
+
+// Number of segments in a row that can go by without finding anything
+// new before we jump back to a corpus entry.
+
+const long		kStaleSegments		= 4;
+
+// Maximum number of saved states.  These are full session files, so
+// don't let them pile up.
+
+const long		kMaxCorpus			= 32;
+
+
+Bool			gCoverageEnabled;
+emuptr			gCoverageStart;
+uint32			gCoverageSize;
+uint32			gCoveragePrevious;
+uint8			gCoverageHits[kCoverageMapSize];
+
+// For each edge, the hit count buckets (see PrvBucket) seen so far.
+
+static uint8	gCoverageSeen[kCoverageMapSize];
+
+
+EmGremlinCoverage::CorpusList	EmGremlinCoverage::fgCorpus;
+long			EmGremlinCoverage::fgCorpusGremlin;
+long			EmGremlinCoverage::fgEventsRun;
+long			EmGremlinCoverage::fgBudget;
+long			EmGremlinCoverage::fgSegmentEvents;
+long			EmGremlinCoverage::fgStaleSegments;
+long			EmGremlinCoverage::fgPendingEdges;
+long			EmGremlinCoverage::fgTotalEdges;
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::Start
+ *
+ * DESCRIPTION:	Called when a new Horde starts.  Clears out everything
+ *				learned by the previous one and, if the GremlinCoverage
+ *				preference is on, starts collecting edge hits.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmGremlinCoverage::Start (void)
+{
+	gCoverageEnabled	= false;
+	gCoveragePrevious	= 0;
+
+	memset (gCoverageHits, 0, sizeof (gCoverageHits));
+	memset (gCoverageSeen, 0, sizeof (gCoverageSeen));
+
+	fgTotalEdges		= 0;
+	fgCorpusGremlin		= -1;
+
+	EmGremlinCoverage::ResetCorpus ();
+
+	Preference<bool>	prefOn (kPrefKeyGremlinCoverage);
+
+	if (!*prefOn)
+		return;
+
+	Preference<long>	prefStart (kPrefKeyGremlinCoverageStart);
+	Preference<long>	prefEnd (kPrefKeyGremlinCoverageEnd);
+
+	emuptr	start	= (emuptr) *prefStart;
+	emuptr	end		= (emuptr) *prefEnd;
+
+	if (end == 0)
+	{
+		start	= gMemoryStart;
+		end		= gMemoryStart + gRAMBank_Size;
+	}
+
+	if (end <= start)
+		return;
+
+	gCoverageStart		= start;
+	gCoverageSize		= end - start;
+	gCoverageEnabled	= true;
+
+	LogAppendMsg ("Coverage-guided Gremlins: recording edges in 0x%08lX - 0x%08lX",
+		start, end);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::Stop
+ *
+ * DESCRIPTION:	Called when a Horde ends.  Stops collecting edge hits
+ *				and logs how far we got.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmGremlinCoverage::Stop (void)
+{
+	if (!gCoverageEnabled)
+		return;
+
+	EmGremlinCoverage::MergeSegment ();
+
+	gCoverageEnabled = false;
+
+	LogAppendMsg ("Coverage-guided Gremlins: %ld edges reached",
+		fgTotalEdges);
+
+	EmGremlinCoverage::ResetCorpus ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::EventPosted
+ *
+ * DESCRIPTION:	Called after every Gremlin event.  At the end of each
+ *				segment, checks whether the segment reached anything
+ *				new, and schedules a save or a jump back into the
+ *				corpus as appropriate.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmGremlinCoverage::EventPosted (void)
+{
+	if (!gCoverageEnabled)
+		return;
+
+	// Corpus entries belong to the Gremlin that saved them; loading one
+	// would switch Gremlins on us.  So start a new corpus (but keep the
+	// edges seen) whenever the Horde moves on to the next Gremlin.
+
+	if (Hordes::GremlinNumber () != fgCorpusGremlin)
+	{
+		EmGremlinCoverage::ResetCorpus ();
+
+		// The budget is what's left of the Gremlin's events, counting
+		// the one just posted.  (A Horde may be resuming a Gremlin part
+		// of the way through.)
+
+		fgCorpusGremlin	= Hordes::GremlinNumber ();
+		fgBudget		= Hordes::EventLimit () > 0 ?
+							Hordes::EventLimit () - Hordes::EventCounter () + 1 : 0;
+	}
+
+	++fgEventsRun;
+
+	if (++fgSegmentEvents < kSegmentEvents)
+		return;
+
+	fgSegmentEvents = 0;
+
+	long	newEdges = EmGremlinCoverage::MergeSegment ();
+
+	// If the Gremlin has reached its limit, Hordes is about to save the
+	// suspended state and move on.  Leave the emulator state alone.
+
+	if (Hordes::EventLimit () > 0 && Hordes::EventCounter () >= Hordes::EventLimit ())
+		return;
+
+	EmAssert (gSession);
+
+	if (newEdges > 0)
+	{
+		fgStaleSegments	= 0;
+		fgPendingEdges	= newEdges;
+
+		gSession->ScheduleSaveCoverageState ();
+	}
+	else if (++fgStaleSegments >= kStaleSegments &&
+		EmGremlinCoverage::PickEntry () >= 0)
+	{
+		fgStaleSegments = 0;
+
+		gSession->ScheduleLoadCoverageState ();
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::SaveState
+ *
+ * DESCRIPTION:	Save the current state as a corpus entry.  Called at
+ *				the end of a CPU cycle after ScheduleSaveCoverageState.
+ *				When the corpus is full, the entry that found the
+ *				fewest new edges is replaced.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmGremlinCoverage::SaveState (void)
+{
+	CorpusEntry	entry;
+
+	entry.fSeed			= gGremlinNext;
+	entry.fEventCounter	= Hordes::EventCounter ();
+	entry.fNewEdges		= fgPendingEdges;
+	entry.fPicks		= 0;
+
+	long	index;
+
+	if ((long) fgCorpus.size () < kMaxCorpus)
+	{
+		index = fgCorpus.size ();
+		fgCorpus.push_back (entry);
+	}
+	else
+	{
+		index = 0;
+
+		for (long ii = 1; ii < (long) fgCorpus.size (); ++ii)
+		{
+			if (fgCorpus[ii].fNewEdges < fgCorpus[index].fNewEdges)
+				index = ii;
+		}
+
+		if (fgCorpus[index].fNewEdges > entry.fNewEdges)
+			return;
+
+		fgCorpus[index] = entry;
+	}
+
+	Hordes::SaveCoverageState (index);
+
+	if (LogGremlins ())
+	{
+		LogAppendMsg ("--- Gremlin #%ld: %ld new edges by event %ld; saved coverage state %ld",
+			Hordes::GremlinNumber (), fgPendingEdges, Hordes::EventCounter (), index);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::LoadState
+ *
+ * DESCRIPTION:	Jump back to a corpus entry.  Called at the end of a
+ *				CPU cycle after ScheduleLoadCoverageState.  Loads the
+ *				entry picked by PickEntry, throws away the events
+ *				recorded since it was saved, and perturbs the random
+ *				number generator so that we don't just replay the same
+ *				events from there.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmGremlinCoverage::LoadState (void)
+{
+	long	index = EmGremlinCoverage::PickEntry ();
+
+	if (index < 0)
+		return;
+
+	CorpusEntry&	entry = fgCorpus[index];
+
+	++entry.fPicks;
+
+	if (Hordes::LoadCoverageState (index) != errNone)
+	{
+		// Hordes::LoadCoverageState has already reported the error
+		// and turned Hordes off.
+
+		EmGremlinCoverage::ResetCorpus ();
+		return;
+	}
+
+	// The session file doesn't carry the events (they're kept in the
+	// Gremlin's event file), just how many there were.  Drop the ones
+	// from the branch we're abandoning.  fgEventsRun isn't part of the
+	// session, so it still counts them against the budget.
+
+	EmEventPlayback::TruncateEvents (EmEventPlayback::GetSavedNumEvents ());
+
+	gGremlinNext		= entry.fSeed ^ (entry.fPicks * 0x9E3779B9);
+	gCoveragePrevious	= 0;
+
+	memset (gCoverageHits, 0, sizeof (gCoverageHits));
+
+	if (LogGremlins ())
+	{
+		LogAppendMsg ("--- Gremlin #%ld: no new edges; resuming from coverage state %ld at event %ld",
+			Hordes::GremlinNumber (), index, Hordes::EventCounter ());
+	}
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::MergeSegment
+ *
+ * DESCRIPTION:	Fold the hit counters collected since the last call
+ *				into the map of everything seen so far, and clear them.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The number of edges that were either hit for the first
+ *				time or hit a new number of times (as bucketed by
+ *				PrvBucket).
+ *
+ ***********************************************************************/
+
+long EmGremlinCoverage::MergeSegment (void)
+{
+	long	newEdges = 0;
+
+	for (long ii = 0; ii < kCoverageMapSize; ++ii)
+	{
+		uint8	hits = gCoverageHits[ii];
+
+		if (hits == 0)
+			continue;
+
+		uint8	bucket = ::PrvBucket (hits);
+
+		if ((bucket & ~gCoverageSeen[ii]) != 0)
+		{
+			if (gCoverageSeen[ii] == 0)
+				++fgTotalEdges;
+
+			gCoverageSeen[ii] |= bucket;
+			++newEdges;
+		}
+	}
+
+	memset (gCoverageHits, 0, sizeof (gCoverageHits));
+
+	return newEdges;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::PickEntry
+ *
+ * DESCRIPTION:	Choose the corpus entry to jump back to.  Picks the
+ *				entry we've jumped to the least (and of those, the one
+ *				that found the most).  Entries from which the rest of
+ *				the Gremlin's run would go over its budget are skipped.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The index of the entry, or -1 if there's none we can
+ *				jump to.
+ *
+ ***********************************************************************/
+
+long EmGremlinCoverage::PickEntry (void)
+{
+	long	index = -1;
+
+	for (long ii = 0; ii < (long) fgCorpus.size (); ++ii)
+	{
+		const CorpusEntry&	entry = fgCorpus[ii];
+
+		// After the jump, the Gremlin goes on from the entry's event
+		// counter up to its limit.
+
+		if (fgBudget > 0 &&
+			fgEventsRun + (Hordes::EventLimit () - entry.fEventCounter) > fgBudget)
+		{
+			continue;
+		}
+
+		if (index < 0)
+		{
+			index = ii;
+			continue;
+		}
+
+		const CorpusEntry&	best = fgCorpus[index];
+
+		if (entry.fPicks < best.fPicks ||
+			(entry.fPicks == best.fPicks && entry.fNewEdges > best.fNewEdges))
+		{
+			index = ii;
+		}
+	}
+
+	return index;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmGremlinCoverage::ResetCorpus
+ *
+ * DESCRIPTION:	Forget the corpus and the per-Gremlin counters.  The
+ *				saved state files are left in the Gremlin directory.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmGremlinCoverage::ResetCorpus (void)
+{
+	fgCorpus.clear ();
+
+	fgEventsRun		= 0;
+	fgBudget		= 0;
+	fgSegmentEvents	= 0;
+	fgStaleSegments	= 0;
+	fgPendingEdges	= 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvBucket
+ *
+ * DESCRIPTION:	Map a hit count to one of eight buckets, so that going
+ *				around a loop a few more times than before counts as
+ *				new behavior, but one more time doesn't.
+ *
+ * PARAMETERS:	hits - hit count for an edge.
+ *
+ * RETURNED:	A single bit representing the bucket.
+ *
+ ***********************************************************************/
+
+uint8 PrvBucket (uint8 hits)
+{
+	if (hits < 3)	return hits;	// 1 -> 1, 2 -> 2
+	if (hits < 4)	return 4;
+	if (hits < 8)	return 8;
+	if (hits < 16)	return 16;
+	if (hits < 32)	return 32;
+	if (hits < 128)	return 64;
+
+	return 128;
+}
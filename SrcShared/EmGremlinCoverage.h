@@ -0,0 +1,116 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmGremlinCoverage_h
+#define EmGremlinCoverage_h
+
+#include <vector>				// vector
+
+/*
+	Coverage-guided Gremlins.
+
+	Plain Gremlins picks every event from a fixed probability table, so
+	a long run keeps revisiting the screens it's already seen.  When the
+	GremlinCoverage preference is on, the CPU loop also records which
+	PC-to-PC transitions ("edges") were taken inside a range of code,
+	into a small bitmap of hit counters.
+
+	Every kSegmentEvents Gremlin events, the bitmap is merged into a map
+	of everything seen so far.  If the segment reached anything new, the
+	emulator state is saved as a corpus entry.  If several segments in a
+	row find nothing new, the Gremlin jumps back to one of the corpus
+	entries and carries on from there with a different random number
+	stream.  Loading an entry rewinds the Gremlin's event counter, and
+	the events recorded since the entry was saved are thrown away, so
+	that the recorded run replays.
+
+	A Gremlin's event limit still bounds the number of events it posts
+	in total.  That total is kept here, outside of the saved states, and
+	a jump is only made to an entry from which the rest of the run fits
+	in what's left.
+
+	The code range comes from the GremlinCoverageStart and
+	GremlinCoverageEnd preferences.  If the end is zero, all of RAM is
+	covered, which is where the applications being tested live.
+*/
+
+const long		kCoverageMapSize	= 0x10000;	// Must be a power of two
+
+
+// Globals accessed by the CPU loop.  They're globals rather than
+// class members so that the check in EmCPU68K::Execute stays cheap.
+
+extern Bool		gCoverageEnabled;
+extern emuptr	gCoverageStart;
+extern uint32	gCoverageSize;
+extern uint32	gCoveragePrevious;
+extern uint8	gCoverageHits[kCoverageMapSize];
+
+
+// Called by the CPU loop before each instruction when gCoverageEnabled
+// is true.  Hashes the PC and combines it with the previous one (as in
+// AFL), so that the counter records the transition, not just the
+// instruction.  The previous location is shifted so that A->B and B->A
+// are different edges.
+
+inline void EmCoverageRecordPC (emuptr pc)
+{
+	if (pc - gCoverageStart < gCoverageSize)
+	{
+		uint32	location = (pc >> 1) * 0x9E3779B1;
+		location ^= location >> 16;
+
+		++gCoverageHits[(location ^ gCoveragePrevious) & (kCoverageMapSize - 1)];
+
+		gCoveragePrevious = location >> 1;
+	}
+}
+
+
+class EmGremlinCoverage
+{
+	public:
+		static void				Start				(void);
+		static void				Stop				(void);
+
+		static void				EventPosted			(void);
+
+		static void				SaveState			(void);
+		static void				LoadState			(void);
+
+	private:
+		struct CorpusEntry
+		{
+			uint32				fSeed;			// gGremlinNext when saved
+			int32				fEventCounter;	// Hordes::EventCounter when saved
+			uint32				fNewEdges;		// New edges found by the segment
+			uint32				fPicks;			// Times we've jumped back here
+		};
+
+		typedef vector<CorpusEntry>	CorpusList;
+
+		static long				MergeSegment		(void);
+		static long				PickEntry			(void);
+		static void				ResetCorpus			(void);
+
+		static CorpusList		fgCorpus;
+		static long				fgCorpusGremlin;	// Gremlin the corpus belongs to
+		static long				fgEventsRun;		// Events posted since then, in all branches
+		static long				fgBudget;			// Most events fgEventsRun may reach
+		static long				fgSegmentEvents;
+		static long				fgStaleSegments;
+		static long				fgPendingEdges;
+		static long				fgTotalEdges;
+};
+
+#endif	// EmGremlinCoverage_h
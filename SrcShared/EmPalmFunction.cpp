@@ -14,20 +14,24 @@
 #include "EmCommon.h"
 #include "EmPalmFunction.h"
 
+#include "EmBankDRAM.h"			// EmBankDRAM::GetLong
 #include "EmBankROM.h"			// EmBankROM::GetMemoryStart
+#include "EmBankSRAM.h"			// EmBankSRAM::GetLong
 #include "EmLowMem.h"			// LowMem_GetGlobal
 #include "EmMemory.h"			// CEnableFullAccess, EmMem_strcpy, EmMem_memcmp
 #include "EmPalmHeap.h"			// EmPalmHeap
 #include "EmPatchState.h"		// EmPatchState::OSMajorVersion
+#include "MetaMemory.h"			// MetaMemory::MarkSymbolIndex
 #include "Miscellaneous.h"		// FindFunctionName
 #include "Platform.h"			// Platform::GetString
 #include "Strings.r.h"			// kStr_INetLibTrapBase
 
 #ifdef SONY_ROM
 #include "SonyShared/ExpansionMgr.h"
-#include "SonyShared/VfsMgr.h"
+#include "SonyShared/VFSMgr.h"
 #endif //SONY_ROM
 
+#include <algorithm>			// lower_bound
 #include <ctype.h>				// isalnum, toupper
 
 const UInt16	kMagicRefNum	= 0x666;	// See comments in HtalLibSendReply.
@@ -120,6 +124,32 @@ FOR_EACH_FUNCTION(DEFINE_FUNCTION)
 
 static string	PrvGetShortName (const char*, int len);
 
+// Index of end-of-function sequences, used to speed up FindFunctionStart,
+// FindFunctionEnd, and FindFunctionName.  See the comments above
+// PrvGetSymbolSegment.
+
+const emuptr	kSymbolSegmentSize	= 0x01000;
+const emuptr	kSymbolLookBehind	= 6;		// EndOfFunctionSequence checks for ADD.L at addr - 6.
+const emuptr	kSymbolLookAhead	= 0x0110;	// Length bytes + longest Macsbug name + constant data size.
+
+struct EmSymbolEntry
+{
+	emuptr	fEOF;			// Address of the RTS (or whatever)
+	emuptr	fNextStart;		// Start of the following function, per GetMacsbugInfo
+	string	fName;			// Validated Macsbug name; empty if none
+};
+
+typedef vector<EmSymbolEntry>			EmSymbolEntryList;
+typedef map<emuptr, EmSymbolEntryList>	EmSymbolSegmentMap;
+
+static EmSymbolSegmentMap	gSymbolSegments;
+
+static void						PrvMarkSymbolSegment	(emuptr segStart, Bool mark);
+static const EmSymbolEntryList*	PrvGetSymbolSegment		(emuptr segStart);
+static Bool						PrvIndexedFunctionStart	(emuptr addr, emuptr beginAddr, emuptr& result);
+static Bool						PrvIndexedFunctionEnd	(emuptr addr, emuptr endAddr, emuptr& result);
+static Bool						PrvIndexedMacsbugName	(emuptr eof, char* name, long nameCapacity);
+
 
 /***********************************************************************
  *
@@ -140,6 +170,84 @@ void EmPalmFunctionInit (void)
 	g##fn_name.Reset ();
 
 FOR_EACH_FUNCTION(RESET_OBJECT)
+
+	EmPalmFunctionReset ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmFunctionReset
+ *
+ * DESCRIPTION:	Forget everything in the symbol index used by
+ *				FindFunctionName.  Called when RAM and meta-memory have
+ *				been wiped or reloaded out from under us, so there's
+ *				no need to clear the meta-memory bits we'd set.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmFunctionReset (void)
+{
+	gSymbolSegments.clear ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmFunctionMemoryChanged
+ *
+ * DESCRIPTION:	Called by the RAM banks when they write to memory that
+ *				has been marked as being covered by the symbol index.
+ *				Forget the parts of the index that depend on that
+ *				memory; they'll be rebuilt the next time someone asks.
+ *
+ * PARAMETERS:	address - start of the memory that changed.
+ *
+ *				size - number of bytes that changed.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmFunctionMemoryChanged (emuptr address, uint32 size)
+{
+	// A segment depends on the bytes from kSymbolLookBehind before it
+	// to kSymbolLookAhead after it, so look for segments starting in
+	// (first, last).
+
+	emuptr	first	= address - kSymbolSegmentSize - kSymbolLookAhead;
+	emuptr	last	= address + size + kSymbolLookBehind;
+
+	if (first > address)
+		first = 0;
+
+	while (1)
+	{
+		EmSymbolSegmentMap::iterator	iter = gSymbolSegments.upper_bound (first);
+
+		if (iter == gSymbolSegments.end () || iter->first >= last)
+			break;
+
+		emuptr	segStart = iter->first;
+
+		gSymbolSegments.erase (iter);
+
+		// Clear the marks for the segment we just dropped.  Its
+		// neighbors depend on some of the same bytes, so put their
+		// marks back.
+
+		::PrvMarkSymbolSegment (segStart, false);
+
+		if (gSymbolSegments.find (segStart - kSymbolSegmentSize) != gSymbolSegments.end ())
+			::PrvMarkSymbolSegment (segStart - kSymbolSegmentSize, true);
+
+		if (gSymbolSegments.find (segStart + kSymbolSegmentSize) != gSymbolSegments.end ())
+			::PrvMarkSymbolSegment (segStart + kSymbolSegmentSize, true);
+	}
 }
 
 
@@ -318,6 +426,362 @@ void EmFunctionRange::GetRange (emuptr addr)
 }
 
 
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvIndexableBank
+ *
+ * DESCRIPTION:	Determine whether or not the given address is in memory
+ *				that we can index.  ROM and Flash are treated as
+ *				immutable, as they are by EmFunctionRange::InRange.
+ *				Changes to RAM are reported by the SRAM and DRAM banks
+ *				through meta-memory.
+ *
+ * PARAMETERS:	addr - address to test.
+ *
+ *				isRAM - receives whether or not the address is in RAM.
+ *
+ * RETURNED:	True if the address can be indexed.
+ *
+ ***********************************************************************/
+
+static Bool PrvIndexableBank (emuptr addr, Bool& isRAM)
+{
+	EmMemGetFunc	func = EmMemGetBank(addr).lget;
+
+	if ((func == &EmBankROM::GetLong) || (func == &EmBankFlash::GetLong))
+	{
+		isRAM = false;
+		return true;
+	}
+
+	if ((func == &EmBankSRAM::GetLong) || (func == &EmBankDRAM::GetLong))
+	{
+		isRAM = true;
+		return true;
+	}
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvMarkSymbolSegment
+ *
+ * DESCRIPTION:	Mark or unmark the meta-memory for all the bytes the
+ *				given segment depends on.  Has no effect on ROM.
+ *
+ * PARAMETERS:	segStart - start of the segment.
+ *
+ *				mark - true to mark, false to unmark.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void PrvMarkSymbolSegment (emuptr segStart, Bool mark)
+{
+	Bool	isRAM;
+
+	if (!::PrvIndexableBank (segStart, isRAM) || !isRAM)
+		return;
+
+	emuptr	begin	= segStart - kSymbolLookBehind;
+	emuptr	end		= segStart + kSymbolSegmentSize + kSymbolLookAhead;
+
+	if (mark)
+		MetaMemory::MarkSymbolIndex (begin, end);
+	else
+		MetaMemory::UnmarkSymbolIndex (begin, end);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetSymbolSegment
+ *
+ * DESCRIPTION:	Return the index for the given segment of memory,
+ *				building it if needed.
+ *
+ *				FindFunctionStart and FindFunctionEnd look for function
+ *				boundaries by walking memory a word at a time, looking
+ *				for end-of-function sequences.  The profiler,
+ *				LOG_FUNCTION_CALLS, EmFunctionRange, and the stack
+ *				crawls in error reports do that over and over for the
+ *				same code.  So the first time a segment is asked
+ *				about, we record every end-of-function sequence in it
+ *				along with the Macsbug name and the start of the
+ *				following function.  After that, finding the functions
+ *				around an address is a binary search.
+ *
+ *				The results depend on the six bytes before the segment
+ *				(see EndOfFunctionSequence) and on the Macsbug names
+ *				after it.  Segments for which all of that memory can't
+ *				be read, or isn't all ROM or all RAM, aren't indexed.
+ *
+ * PARAMETERS:	segStart - start of the segment; a multiple of
+ *					kSymbolSegmentSize.
+ *
+ * RETURNED:	The sorted list of end-of-function sequences in the
+ *				segment.  NULL if the segment can't be indexed.
+ *
+ ***********************************************************************/
+
+const EmSymbolEntryList* PrvGetSymbolSegment (emuptr segStart)
+{
+	EmSymbolSegmentMap::iterator	iter = gSymbolSegments.find (segStart);
+
+	if (iter != gSymbolSegments.end ())
+		return &iter->second;
+
+	emuptr	begin	= segStart - kSymbolLookBehind;
+	emuptr	end		= segStart + kSymbolSegmentSize + kSymbolLookAhead;
+
+	if (begin > segStart || end < segStart)
+		return NULL;
+
+	Bool	beginIsRAM;
+	Bool	endIsRAM;
+
+	if (!::PrvIndexableBank (begin, beginIsRAM) ||
+		!::PrvIndexableBank (end - 1, endIsRAM) ||
+		beginIsRAM != endIsRAM)
+	{
+		return NULL;
+	}
+
+	if (!EmMemCheckAddress (begin, end - begin))
+		return NULL;
+
+	// We read a lot more than a single search would, so don't let
+	// any of that be reported as an access error.
+
+	CEnableFullAccess	munge;
+
+	EmSymbolEntryList	entries;
+	char				name[256];
+
+	for (emuptr addr = segStart; addr < segStart + kSymbolSegmentSize; addr += 2)
+	{
+		if (::EndOfFunctionSequence (addr))
+		{
+			EmSymbolEntry	entry;
+
+			entry.fEOF = addr;
+			::GetMacsbugInfo (addr + 2, name, sizeof (name), &entry.fNextStart);
+			entry.fName = name;
+
+			entries.push_back (entry);
+		}
+	}
+
+	EmSymbolEntryList&	result = gSymbolSegments[segStart];
+	result.swap (entries);
+
+	::PrvMarkSymbolSegment (segStart, true);
+
+	return &result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvEOFBefore
+ *
+ * DESCRIPTION:	Predicate for lower_bound over an EmSymbolEntryList.
+ *
+ * PARAMETERS:	entry - entry to test.
+ *
+ *				addr - probe address.
+ *
+ * RETURNED:	True if the entry's end-of-function sequence is before
+ *				the probe address.
+ *
+ ***********************************************************************/
+
+static bool PrvEOFBefore (const EmSymbolEntry& entry, emuptr addr)
+{
+	return entry.fEOF < addr;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvIndexedFunctionStart
+ *
+ * DESCRIPTION:	Indexed version of the search in FindFunctionStart.
+ *				Find the last end-of-function sequence before addr,
+ *				but not before beginAddr, and return the start of the
+ *				function following it.
+ *
+ * PARAMETERS:	addr - the probe address.
+ *
+ *				beginAddr - lowest address to consider.
+ *
+ *				result - receives the start of the function, or
+ *					EmMemNULL if not found.
+ *
+ * RETURNED:	True if the index could answer the question.  False
+ *				if the caller should search memory itself.
+ *
+ ***********************************************************************/
+
+Bool PrvIndexedFunctionStart (emuptr addr, emuptr beginAddr, emuptr& result)
+{
+	if ((addr & 1) != 0 || addr < 2)
+		return false;
+
+	if (addr - 2 < beginAddr)
+	{
+		result = EmMemNULL;
+		return true;
+	}
+
+	emuptr	segStart = (addr - 2) & ~(kSymbolSegmentSize - 1);
+
+	while (1)
+	{
+		const EmSymbolEntryList*	entries = ::PrvGetSymbolSegment (segStart);
+
+		if (!entries)
+			return false;
+
+		EmSymbolEntryList::const_iterator	iter =
+			lower_bound (entries->begin (), entries->end (), addr, PrvEOFBefore);
+
+		if (iter != entries->begin ())
+		{
+			--iter;
+
+			result = (iter->fEOF >= beginAddr) ? iter->fNextStart : EmMemNULL;
+			return true;
+		}
+
+		if (segStart <= beginAddr || segStart == 0)
+			break;
+
+		segStart -= kSymbolSegmentSize;
+	}
+
+	result = EmMemNULL;
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvIndexedFunctionEnd
+ *
+ * DESCRIPTION:	Indexed version of the search in FindFunctionEnd.
+ *				Find the first end-of-function sequence at or after
+ *				addr and before endAddr.
+ *
+ * PARAMETERS:	addr - the probe address.
+ *
+ *				endAddr - end of the range to search.
+ *
+ *				result - receives the address following the end-of-
+ *					function sequence, or EmMemNULL if not found.
+ *
+ * RETURNED:	True if the index could answer the question.  False
+ *				if the caller should search memory itself.
+ *
+ ***********************************************************************/
+
+Bool PrvIndexedFunctionEnd (emuptr addr, emuptr endAddr, emuptr& result)
+{
+	if ((addr & 1) != 0)
+		return false;
+
+	if (endAddr <= addr)
+	{
+		result = EmMemNULL;
+		return true;
+	}
+
+	emuptr	segStart = addr & ~(kSymbolSegmentSize - 1);
+
+	while (segStart < endAddr)
+	{
+		const EmSymbolEntryList*	entries = ::PrvGetSymbolSegment (segStart);
+
+		if (!entries)
+			return false;
+
+		EmSymbolEntryList::const_iterator	iter =
+			lower_bound (entries->begin (), entries->end (), addr, PrvEOFBefore);
+
+		if (iter != entries->end ())
+		{
+			result = (iter->fEOF < endAddr) ? iter->fEOF + 2 : EmMemNULL;
+			return true;
+		}
+
+		segStart += kSymbolSegmentSize;
+
+		if (segStart == 0)
+			break;
+	}
+
+	result = EmMemNULL;
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvIndexedMacsbugName
+ *
+ * DESCRIPTION:	Indexed version of GetMacsbugInfo, for when only the
+ *				name is needed.
+ *
+ * PARAMETERS:	eof - pointer to the end of the function (that is, the
+ *					byte after the eof sequence).
+ *
+ *				name - pointer to buffer to receive the name.
+ *
+ *				nameCapacity - size of buffer pointed to by "name".
+ *
+ * RETURNED:	True if the name was found in the index.  False if
+ *				the caller should call GetMacsbugInfo.
+ *
+ ***********************************************************************/
+
+Bool PrvIndexedMacsbugName (emuptr eof, char* name, long nameCapacity)
+{
+	if ((eof & 1) != 0 || eof < 2)
+		return false;
+
+	emuptr						addr = eof - 2;
+	const EmSymbolEntryList*	entries = ::PrvGetSymbolSegment (addr & ~(kSymbolSegmentSize - 1));
+
+	if (!entries)
+		return false;
+
+	EmSymbolEntryList::const_iterator	iter =
+		lower_bound (entries->begin (), entries->end (), addr, PrvEOFBefore);
+
+	if (iter == entries->end () || iter->fEOF != addr)
+		return false;
+
+	// Truncate the same way GetMacsbugInfo does.
+
+	long	length = iter->fName.size ();
+
+	if (length > nameCapacity - 1)
+		length = nameCapacity - 1;
+
+	if (length < 0)
+		length = 0;
+
+	memcpy (name, iter->fName.c_str (), length);
+	name[length] = 0;
+
+	return true;
+}
+
 
 
 /***********************************************************************
@@ -1596,9 +2060,14 @@ void FindFunctionName (emuptr addr, char* nameP,
 		if (nameP)
 		{
 			if (endAddr)
-				::GetMacsbugInfo (endAddr, nameP, nameCapacity, NULL);
+			{
+				if (!::PrvIndexedMacsbugName (endAddr, nameP, nameCapacity))
+					::GetMacsbugInfo (endAddr, nameP, nameCapacity, NULL);
+			}
 			else
+			{
 				nameP[0] = '\0';
+			}
 		}
 	}
 }
@@ -1637,6 +2106,15 @@ emuptr FindFunctionStart (emuptr addr)
 		}
 	}
 
+	// See if the symbol index can answer the question without
+	// our having to walk memory.
+
+	emuptr	result;
+	if (::PrvIndexedFunctionStart (addr, beginAddr, result))
+	{
+		return result;
+	}
+
 	while ((addr -= 2) >= beginAddr)
 	{
 		// Make sure the address is valid.
@@ -1703,6 +2181,12 @@ emuptr FindFunctionEnd (emuptr addr)
 		}
 	}
 
+	emuptr	result;
+	if (::PrvIndexedFunctionEnd (addr, endAddr, result))
+	{
+		return result;
+	}
+
 	while (addr < endAddr)
 	{
 		// Make sure the address is valid.
@@ -19,6 +19,8 @@
 struct SystemCallContext;
 
 void	EmPalmFunctionInit					(void);
+void	EmPalmFunctionReset					(void);
+void	EmPalmFunctionMemoryChanged			(emuptr address, uint32 size);
 
 #define FOR_EACH_FUNCTION(DO_TO_FUNCTION)	\
 	DO_TO_FUNCTION(cj_kptkdelete)			\
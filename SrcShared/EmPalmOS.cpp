@@ -38,23 +38,30 @@
 #include "ROMStubs.h"			// IntlSetStrictChecks
 #include "UAE.h"				// CHECK_STACK_POINTER_DECREMENT
 
+#include "EmClock.h"			// EmClock::Initialize ();
 #include "EmEventPlayback.h"	// EmEventPlayback::Initialize ();
 #include "EmLowMem.h"			// EmLowMem::Initialize ();
-#include "EmPalmFunction.h"		// EmPalmFunctionInit ();
+#include "EmPalmFunction.h"		// EmPalmFunctionInit (), EmPalmFunctionReset ()
 #include "EmPalmHeap.h"			// EmPalmHeap::Initialize ();
 #include "EmPatchMgr.h"			// EmPatchMgr::Initialize ();
 #include "Hordes.h"				// Hordes::Initialize ();
 #include "Platform_NetLib.h"	// Platform_NetLib::Initialize();
 
 #ifdef SONY_ROM
-#include "SonyWin\Platform_MsfsLib.h"
-#include "SonyWin\Platform_ExpMgrLib.h"
+#include "SonyShared/Platform_MsfsLib.h"
+#include "SonyShared/Platform_ExpMgrLib.h"
+#if PLATFORM_WINDOWS
 void	LCD_InitStateJogButton();		// LCDSony.inl
+#endif
 #endif //SONY_ROM
 
 #define LOG_FUNCTION_CALLS 0
 
+// The stacks we know about, kept sorted by fBottom so that the one
+// containing a given address can be found with a binary search.
+
 static StackList			gStackList;
+static StackRange			gCurrentStack;
 static StackRange			gBootStack;
 static StackRange			gKernelStack;
 static StackRange			gInterruptStack;
@@ -78,6 +85,56 @@ static const uint32			CJ_TAGFENCE	= 0x55555555;
 static const int	kInterruptOverhead = 34;
 static emuptr		gStackLowWaterMark = 0;
 
+// Shadow call stacks.  HandleJSR records each return address as it's
+// pushed, and HandleRTS and HandleRTE drop them as they're popped, so
+// that GenerateStackCrawl can copy out the active calls instead of
+// following the A6 chain through emulated memory.  There's one shadow
+// per Palm OS stack, keyed by the stack's bottom, so that switching
+// tasks or taking an interrupt doesn't lose the calls on the stack
+// we're leaving.
+
+struct EmShadowFrame
+{
+	emuptr	fReturnAddress;		// Where the callee will return to
+	emuptr	fReturnSlot;		// Where on the stack that address is
+};
+
+typedef vector<EmShadowFrame>	EmShadowFrameList;
+
+struct EmShadowStack
+{
+	EmShadowStack () :
+		fFrames (),
+		fTruncatedAt (EmMemNULL)
+		{}
+
+	EmShadowFrameList	fFrames;
+
+	// If the shadow got too deep and we had to throw away its oldest
+	// frames, this is the highest return slot thrown away.  Until the
+	// stack unwinds past it, the shadow is missing calls.
+
+	emuptr				fTruncatedAt;
+};
+
+typedef map<emuptr, EmShadowStack>	EmShadowStackMap;
+
+static EmShadowStackMap		gShadowStacks;
+static EmShadowStack*		gShadowStack;
+static emuptr				gShadowStackBottom;
+
+static const size_t			kMaxShadowDepth = 512;
+
+static StackList::iterator	PrvFindStack			(emuptr stackBottom);
+static StackList::iterator	PrvFindStackContaining	(emuptr addr);
+
+static void		PrvSelectShadowStack	(emuptr stackBottom);
+static void		PrvForgetShadowStacks	(void);
+static void		PrvPushShadowFrame		(emuptr returnAddress, emuptr returnSlot);
+static void		PrvPopShadowFrames		(emuptr sp);
+static Bool		PrvShadowStackCrawl		(EmStackFrameList& frameList);
+static void		PrvA6StackCrawl			(EmStackFrameList& frameList);
+
 
 /***********************************************************************
  *
@@ -121,6 +178,7 @@ void EmPalmOS::Initialize (void)
 	Platform_NetLib::Initialize ();
 	EmPalmHeap::Initialize ();
 	EmLowMem::Initialize ();
+	EmClock::Initialize ();
 	EmPalmFunctionInit ();
 }
 
@@ -153,18 +211,23 @@ void EmPalmOS::Reset (void)
 
 	gStackList.clear ();
 
+	gCurrentStack	= StackRange ();
 	gBootStack		= StackRange ();
 	gKernelStack	= StackRange ();
 	gInterruptStack	= StackRange ();
 
 	gKernelStackOverflowed = 0;
 
+	::PrvForgetShadowStacks ();
+
 	Hordes::Reset ();
 	EmEventPlayback::Reset ();
 	EmPatchMgr::Reset ();
 	Platform_NetLib::Reset ();
 	EmPalmHeap::Reset ();
 	EmLowMem::Reset ();
+	EmClock::Reset ();
+	EmPalmFunctionReset ();
 
 #ifdef SONY_ROM
 	Platform_MsfsLib::Reset();
@@ -214,6 +277,7 @@ void EmPalmOS::Save (SessionFile& f)
 	Platform_NetLib::Save (f);
 	EmPalmHeap::Save (f);
 	EmLowMem::Save (f);
+	EmClock::Save (f);
 
 #ifdef SONY_ROM
 	Platform_MsfsLib::Save(f);
@@ -264,6 +328,13 @@ void EmPalmOS::Load (SessionFile& f)
 	Platform_NetLib::Load (f);
 	EmPalmHeap::Load (f);
 	EmLowMem::Load (f);
+	EmClock::Load (f);
+	EmPalmFunctionReset ();
+
+	// Shadow call stacks aren't saved; they'll fill back in as calls are
+	// made, and GenerateStackCrawl walks A6 for anything older.
+
+	::PrvForgetShadowStacks ();
 
 #ifdef SONY_ROM
 	Platform_MsfsLib::Load(f);
@@ -289,6 +360,32 @@ void EmPalmOS::Load (SessionFile& f)
 			s >> gStackLowWaterMark;
 			s >> gStackLowWarn;
 			s >> gStackLow;
+
+			// Older versions kept the list in the order the stacks were
+			// found.  Sort it, and find the current stack again.
+
+			sort (gStackList.begin (), gStackList.end ());
+
+			gCurrentStack = StackRange ();
+
+			StackList::iterator	iter = gStackList.begin ();
+
+			while (iter != gStackList.end ())
+			{
+				if (iter->fTop == gStackHigh)
+				{
+					gCurrentStack = *iter;
+					break;
+				}
+
+				++iter;
+			}
+
+			// CheckStackPointerAssignment won't switch stacks while A7
+			// stays in this one, so start recording its shadow now.
+
+			if (gCurrentStack.fBottom != EmMemNULL)
+				::PrvSelectShadowStack (gCurrentStack.fBottom);
 		}
 
 		if (version >= 2)
@@ -319,6 +416,7 @@ void EmPalmOS::Load (SessionFile& f)
 
 void EmPalmOS::Dispose (void)
 {
+	EmClock::Dispose ();
 	EmLowMem::Dispose ();
 	EmPalmHeap::Dispose ();
 	Platform_NetLib::Dispose ();
@@ -353,21 +451,26 @@ void EmPalmOS::CheckStackPointerAssignment (void)
 	// stack pointer to a new stack.  Scarf up information about that
 	// block of memory and treat that block as a stack.
 
-	// See if we already know about this stack.
+	// Most assignments leave A7 in the stack it was already in (LINK,
+	// UNLK, and the like).  There's nothing to do for those.
 
-	emuptr				curA7 = gCPU->GetSP ();
-	StackList::iterator iter = gStackList.begin ();
+	emuptr	curA7 = gCPU->GetSP ();
 
-	while (iter != gStackList.end ())
+	if (gCurrentStack.fBottom != EmMemNULL &&
+		curA7 >= gCurrentStack.fBottom && curA7 <= gCurrentStack.fTop)
 	{
-		if ((curA7 >= (*iter).fBottom) && (curA7 <= (*iter).fTop))
-		{
-			// If so, switch to it.
-			SetCurrentStack (*iter);
-			return;
-		}
+		return;
+	}
 
-		++iter;
+	// See if we already know about this stack.
+
+	StackList::iterator iter = ::PrvFindStackContaining (curA7);
+
+	if (iter != gStackList.end ())
+	{
+		// If so, switch to it.
+		SetCurrentStack (*iter);
+		return;
 	}
 
 	// If not, get some information about it and save it off.
@@ -643,26 +746,29 @@ void EmPalmOS::RememberKernelStack (void)
 
 void EmPalmOS::RememberStackRange (const StackRange& range)
 {
-#if _DEBUG
-	// Make sure this range doesn't overlap any other stack in our list.
+	// Find where the range goes in the list.
 
-	StackList::iterator iter = gStackList.begin ();
+	StackList::iterator iter = lower_bound (gStackList.begin (), gStackList.end (), range);
 
-	while (iter != gStackList.end ())
+#if _DEBUG
+	// Make sure this range doesn't overlap the stacks on either side of it.
+
+	if (iter != gStackList.end ())
 	{
-		if (range.fBottom >= iter->fBottom && range.fBottom < iter->fTop)
+		if (range.fTop > iter->fBottom)
 			EmAssert (false);
+	}
 
-		if (range.fTop > iter->fBottom && range.fTop <= iter->fTop)
+	if (iter != gStackList.begin ())
+	{
+		if (range.fBottom < (iter - 1)->fTop)
 			EmAssert (false);
-
-		++iter;
 	}
 #endif
 
 	// Add the range to the list.
 
-	gStackList.push_back (range);
+	gStackList.insert (iter, range);
 }
 
 
@@ -682,27 +788,20 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 {
 	// Record the low-water mark of the previous stack.
 
-	StackList::iterator iter = gStackList.begin ();
+	StackList::iterator iter = ::PrvFindStack (gCurrentStack.fBottom);
 
-	while (iter != gStackList.end ())
+	if (iter != gStackList.end ())
 	{
-		if (gStackHigh == iter->fTop)
-		{
-			iter->fLowWaterMark = gStackLowWaterMark;
+		iter->fLowWaterMark = gStackLowWaterMark;
 
-			if (gStackHigh == gBootStack.fTop)
-				gBootStack.fLowWaterMark = gStackLowWaterMark;
+		if (gStackHigh == gBootStack.fTop)
+			gBootStack.fLowWaterMark = gStackLowWaterMark;
 
-			if (gStackHigh == gKernelStack.fTop)
-				gKernelStack.fLowWaterMark = gStackLowWaterMark;
+		if (gStackHigh == gKernelStack.fTop)
+			gKernelStack.fLowWaterMark = gStackLowWaterMark;
 
-			if (gStackHigh == gInterruptStack.fTop)
-				gInterruptStack.fLowWaterMark = gStackLowWaterMark;
-
-			break;
-		}
-
-		++iter;
+		if (gStackHigh == gInterruptStack.fTop)
+			gInterruptStack.fLowWaterMark = gStackLowWaterMark;
 	}
 
 	// Determine the amount to test against when determining if we are
@@ -719,10 +818,13 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 	if (range == gKernelStack)
 		stackSlush = kKernelStackSlush;
 
+	gCurrentStack		= range;
 	gStackHigh			= range.fTop;
 	gStackLowWaterMark	= range.fLowWaterMark;
 	gStackLowWarn		= range.fBottom + kInterruptOverhead + stackSlush;
 	gStackLow			= range.fBottom + kInterruptOverhead;
+
+	::PrvSelectShadowStack (range.fBottom);
 }
 
 
@@ -740,39 +842,43 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 
 void EmPalmOS::ForgetStack (emuptr stackBottom)
 {
-	StackList::iterator iter = gStackList.begin ();
-
-	while (iter != gStackList.end ())
-	{
-		// If the pointer is in the *middle* of a stack, that's not good.
+	// If the pointer is in the *middle* of a stack, that's not good.
 
 #ifndef SONY_ROM
-		if (stackBottom > iter->fBottom && stackBottom < iter->fTop)
-			EmAssert (false);
+	StackList::iterator	container = ::PrvFindStackContaining (stackBottom);
+
+	if (container != gStackList.end () &&
+		stackBottom > container->fBottom && stackBottom < container->fTop)
+		EmAssert (false);
 #endif //!SONY_ROM
 
-		// If the pointer is to the beginning of the stack, we've found
-		// the one we want to remove.
+	// If the pointer is to the beginning of the stack, we've found
+	// the one we want to remove.
 
-		if (stackBottom == iter->fBottom)
-		{
-			gStackList.erase (iter);
+	StackList::iterator iter = ::PrvFindStack (stackBottom);
 
-			if (stackBottom == gBootStack.fBottom)
-			{
+	if (iter != gStackList.end ())
+	{
+		gStackList.erase (iter);
+
+		if (stackBottom == gCurrentStack.fBottom)
+			gCurrentStack = StackRange ();
+
+		if (stackBottom == gShadowStackBottom)
+			gShadowStack = NULL;
+
+		gShadowStacks.erase (stackBottom);
+
+		if (stackBottom == gBootStack.fBottom)
+		{
 #define TRACK_BOOT_ALLOCATION 0
 #if TRACK_BOOT_ALLOCATION
-				LogAppendMsg ("===== Forgetting Boot Stack, top = 0x%08X, low water mark: 0x%08X =====",
-					gBootStack.fTop, gBootStack.fLowWaterMark);
+			LogAppendMsg ("===== Forgetting Boot Stack, top = 0x%08X, low water mark: 0x%08X =====",
+				gBootStack.fTop, gBootStack.fLowWaterMark);
 #endif
 
-				gBootStack = StackRange ();
-			}
-
-			return;
+			gBootStack = StackRange ();
 		}
-
-		++iter;
 	}
 }
 
@@ -791,13 +897,25 @@ void EmPalmOS::ForgetStack (emuptr stackBottom)
 
 void EmPalmOS::ForgetStacksIn (emuptr start, uint32 range)
 {
-	StackList::iterator iter = gStackList.begin ();
+	// The list is sorted, so the stacks in the range are all together,
+	// starting with the first one whose bottom is at or after "start".
 
-	while (iter != gStackList.end ())
+	StackList::iterator iter = lower_bound (gStackList.begin (), gStackList.end (),
+								StackRange (start, start));
+
+	while (iter != gStackList.end () && iter->fBottom < start + range)
 	{
-		if ((iter->fBottom >= start) && (iter->fTop <= (start + range)))
+		if (iter->fTop <= (start + range))
 		{
-			gStackList.erase (iter);
+			if (iter->fBottom == gCurrentStack.fBottom)
+				gCurrentStack = StackRange ();
+
+			if (iter->fBottom == gShadowStackBottom)
+				gShadowStack = NULL;
+
+			gShadowStacks.erase (iter->fBottom);
+
+			iter = gStackList.erase (iter);
 
 			if (start == gBootStack.fBottom)
 			{
@@ -810,9 +928,6 @@ void EmPalmOS::ForgetStacksIn (emuptr start, uint32 range)
 				gBootStack = StackRange ();
 			}
 
-			// We munged the collection; start over.
-
-			iter = gStackList.begin ();
 			continue;
 		}
 
@@ -880,7 +995,9 @@ Bool EmPalmOS::IsInStackBlock (emuptr addr)
  * FUNCTION:    EmPalmOS::GenerateStackCrawl
  *
  * DESCRIPTION: Starting with the current PC and A6, generate a list
- *				of active functions.
+ *				of active functions.  The list comes from the shadow
+ *				call stack when that's in step with the real one;
+ *				otherwise, we follow the chain of A6 frames.
  *
  * PARAMETERS:  frameList - reference to the collection to receive
  *					the results.
@@ -910,6 +1027,234 @@ void EmPalmOS::GenerateStackCrawl (EmStackFrameList& frameList)
 
 	frameList.push_back (frame);
 
+	if (!::PrvShadowStackCrawl (frameList))
+	{
+		::PrvA6StackCrawl (frameList);
+	}
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvFindStack
+// ---------------------------------------------------------------------------
+// Return the stack in gStackList with the given bottom, or end () if there
+// isn't one.
+
+StackList::iterator PrvFindStack (emuptr stackBottom)
+{
+	StackList::iterator	iter = lower_bound (gStackList.begin (), gStackList.end (),
+								StackRange (stackBottom, stackBottom));
+
+	if (iter != gStackList.end () && iter->fBottom == stackBottom)
+		return iter;
+
+	return gStackList.end ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvFindStackContaining
+// ---------------------------------------------------------------------------
+// Return the stack in gStackList that the given address is in, or end ()
+// if there isn't one.  Stacks shouldn't overlap, in which case it can only
+// be the last one starting at or below the address.  But only _DEBUG
+// builds check that in RememberStackRange, so if that one doesn't contain
+// the address, keep looking at the ones before it.
+
+StackList::iterator PrvFindStackContaining (emuptr addr)
+{
+	StackList::iterator	iter = upper_bound (gStackList.begin (), gStackList.end (),
+								StackRange (addr, addr));
+
+	while (iter != gStackList.begin ())
+	{
+		--iter;
+
+		if (addr >= iter->fBottom && addr <= iter->fTop)
+			return iter;
+	}
+
+	return gStackList.end ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSelectShadowStack
+// ---------------------------------------------------------------------------
+// Make the shadow for the given stack the one that calls and returns are
+// recorded in.  Called whenever A7 moves to a different stack, and after
+// a session is loaded.  Don't go looking it up again if it's the one we
+// already have.
+
+void PrvSelectShadowStack (emuptr stackBottom)
+{
+	if (gShadowStack && stackBottom == gShadowStackBottom)
+		return;
+
+	gShadowStack		= &gShadowStacks[stackBottom];
+	gShadowStackBottom	= stackBottom;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvForgetShadowStacks
+// ---------------------------------------------------------------------------
+
+void PrvForgetShadowStacks (void)
+{
+	gShadowStacks.clear ();
+
+	gShadowStack		= NULL;
+	gShadowStackBottom	= EmMemNULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPushShadowFrame
+// ---------------------------------------------------------------------------
+
+void PrvPushShadowFrame (emuptr returnAddress, emuptr returnSlot)
+{
+	if (!gShadowStack)
+		return;
+
+	// Anything recorded at or below the slot we're pushing to is dead;
+	// the stack was cut back without an RTS or RTE (ErrLongJump, for
+	// instance).
+
+	::PrvPopShadowFrames (returnSlot);
+
+	EmShadowFrameList&	frames = gShadowStack->fFrames;
+
+	// Runaway recursion shouldn't make the shadow grow without bound.
+	// Throw away the oldest half and remember that we did.
+
+	if (frames.size () >= kMaxShadowDepth)
+	{
+		EmShadowFrameList::iterator	keep = frames.begin () + kMaxShadowDepth / 2;
+
+		if (gShadowStack->fTruncatedAt < frames.front ().fReturnSlot)
+			gShadowStack->fTruncatedAt = frames.front ().fReturnSlot;
+
+		frames.erase (frames.begin (), keep);
+	}
+
+	EmShadowFrame	frame;
+
+	frame.fReturnAddress	= returnAddress;
+	frame.fReturnSlot		= returnSlot;
+
+	frames.push_back (frame);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPopShadowFrames
+// ---------------------------------------------------------------------------
+// Drop every call whose return address is at or below the given stack
+// location.  Stacks grow down, so these are all at the end of the list.
+
+void PrvPopShadowFrames (emuptr sp)
+{
+	if (!gShadowStack)
+		return;
+
+	EmShadowFrameList&	frames = gShadowStack->fFrames;
+
+	while (!frames.empty () && frames.back ().fReturnSlot <= sp)
+	{
+		frames.pop_back ();
+	}
+
+	if (gShadowStack->fTruncatedAt != EmMemNULL && gShadowStack->fTruncatedAt <= sp)
+	{
+		gShadowStack->fTruncatedAt = EmMemNULL;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvShadowStackCrawl
+// ---------------------------------------------------------------------------
+// Add the calls recorded in the current shadow stack to the stack crawl.
+// Returns false if the shadow can't be trusted, in which case nothing is
+// added and the caller should walk the A6 chain instead.
+
+Bool PrvShadowStackCrawl (EmStackFrameList& frameList)
+{
+	if (!gShadowStack || gShadowStack->fTruncatedAt != EmMemNULL)
+		return false;
+
+	const EmShadowFrameList&	frames = gShadowStack->fFrames;
+
+	if (frames.empty ())
+		return false;
+
+	// The newest call must still be live: at or above the stack pointer,
+	// in the current stack, and with the return address we recorded still
+	// sitting where it was pushed.  If not, the stack was switched or cut
+	// back behind our backs.
+
+	const EmShadowFrame&	newest = frames.back ();
+
+	if (newest.fReturnSlot < m68k_areg (regs, 7) ||
+		!EmPalmOS::IsInStack (newest.fReturnSlot) ||
+		EmMemGet32 (newest.fReturnSlot) != newest.fReturnAddress)
+	{
+		return false;
+	}
+
+	// Copy out the calls, newest first.  If a function set up an A6
+	// frame, its A6 is just below its own return address.
+
+	EmShadowFrameList::const_reverse_iterator	iter = frames.rbegin ();
+
+	while (iter != frames.rend ())
+	{
+		EmShadowFrameList::const_reverse_iterator	caller = iter + 1;
+		EmStackFrame								frame;
+
+		frame.fAddressInFunction	= iter->fReturnAddress;
+		frame.fA6					= caller != frames.rend ()
+										? caller->fReturnSlot - 4
+										: gStackHigh;
+
+		frameList.push_back (frame);
+
+		++iter;
+	}
+
+	// The oldest call we know about may not be the oldest one on the
+	// stack (we don't save shadows with sessions, for instance).  If the
+	// function it called saved a plausible A6 just below the return
+	// address, pick up the A6 chain from there.
+
+	emuptr	oldestSlot	= frames.front ().fReturnSlot;
+	emuptr	callerA6	= EmMemGet32 (oldestSlot - 4);
+
+	if (!::IsOdd (callerA6) && EmPalmOS::IsInStack (callerA6) && callerA6 > oldestSlot)
+	{
+		frameList.back ().fA6 = callerA6;
+
+		::PrvA6StackCrawl (frameList);
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvA6StackCrawl
+// ---------------------------------------------------------------------------
+// Add to the stack crawl by following the A6 chain up from the last frame
+// in it.
+
+void PrvA6StackCrawl (EmStackFrameList& frameList)
+{
+	EmStackFrame	frame = frameList.back ();
+
 	// If A6 is odd or not in the current stack, stop the stack crawl.
 
 	if (::IsOdd (frame.fA6) || !EmPalmOS::IsInStack (frame.fA6))
@@ -1093,6 +1438,11 @@ Bool EmPalmOS::HandleJSR (emuptr oldpc, emuptr dest)
 	}
 #endif
 
+	// The return address is about to be pushed onto the stack; remember
+	// where it's going.
+
+	::PrvPushShadowFrame (oldpc, m68k_areg (regs, 7) - 4);
+
 #if LOG_FUNCTION_CALLS
 //	char	fromName[80];
 	char	toName[80];
@@ -1256,6 +1606,10 @@ Bool EmPalmOS::HandleRTS (emuptr dest)
 {
 	UNUSED_PARAM (dest);
 
+	// A7 points to the return address that's about to be popped.
+
+	::PrvPopShadowFrames (m68k_areg (regs, 7));
+
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 	{
@@ -1355,6 +1709,14 @@ Bool EmPalmOS::HandleRTE (emuptr dest)
 {
 	UNUSED_PARAM (dest);
 
+	// The RTE opcode has already popped the 6-byte exception frame (SR
+	// and PC), so A7 points just above it.  Any calls made since that
+	// frame was pushed have their return addresses below it and are being
+	// abandoned.  The interrupted function's own return address may be
+	// right at A7, and is still live, so stop short of the frame.
+
+	::PrvPopShadowFrames (m68k_areg (regs, 7) - 7);
+
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 	{
@@ -0,0 +1,537 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmPrefStore.h"
+
+#include "EmStreamFile.h"		// EmStreamFile
+
+static const uint32		kSignature			= 'PPrf';
+static const uint32		kVersion			= 1;
+
+static const long		kHeaderSize			= 8;
+static const long		kRecordHeaderSize	= 7;
+
+enum
+{
+	kRecordValue		= 1,	// Key and its value.
+	kRecordDelete		= 2		// Key that's been removed; no value.
+};
+
+// Don't bother compacting the file until superseded records take up at
+// least this much of it, and then only if they're over half of it.
+
+static const long		kCompactThreshold	= 16 * 1024;
+
+static uint32 PrvGet16 (const uint8* p);
+static uint32 PrvGet32 (const uint8* p);
+static void PrvPutRecord (EmStream&, uint8 type, const string& key, const string& value);
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::EmPrefStore
+// ---------------------------------------------------------------------------
+
+EmPrefStore::EmPrefStore (void) :
+	fFile (),
+	fIsOpen (false),
+	fNeedsRewrite (true),
+	fImage (),
+	fIndex (),
+	fDeadBytes (0)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::~EmPrefStore
+// ---------------------------------------------------------------------------
+
+EmPrefStore::~EmPrefStore (void)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Open
+// ---------------------------------------------------------------------------
+// Read the given file and index the keys in it.  Returns false if the file
+// doesn't exist or isn't one of ours, in which case a later Update will
+// create it from scratch.  If the file was written by a version of the
+// Emulator that uses a format we don't understand, we leave it alone: we
+// forget the file altogether, so that Update fails and the caller falls
+// back to some other way of saving its settings.
+
+Bool EmPrefStore::Open (const EmFileRef& file)
+{
+	fFile = file;
+	fIsOpen = false;
+	fNeedsRewrite = true;
+	fImage.SetLength (0);
+	fIndex.clear ();
+	fDeadBytes = 0;
+
+	if (!fFile.Exists ())
+		return false;
+
+	try
+	{
+		EmStreamFile	stream (fFile, kOpenExistingForRead);	// Will throw if fnf
+		long			length = stream.GetLength ();
+
+		fImage.SetLength (length);
+
+		if (length < kHeaderSize ||
+			stream.GetBytes (fImage.GetPointer (), length) != errNone)
+		{
+			fImage.SetLength (0);
+			return false;
+		}
+	}
+	catch (...)
+	{
+		fImage.SetLength (0);
+		return false;
+	}
+
+	const uint8*	image = (const uint8*) fImage.GetPointer ();
+
+	if (::PrvGet32 (image) != kSignature)
+	{
+		fImage.SetLength (0);
+		return false;
+	}
+
+	if (::PrvGet32 (image + 4) != kVersion)
+	{
+		fImage.SetLength (0);
+		fFile = EmFileRef ();
+		return false;
+	}
+
+	fIsOpen = true;
+	fNeedsRewrite = false;
+
+	this->Index (kHeaderSize, false);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Take
+// ---------------------------------------------------------------------------
+// Return the value of the given key, and note that the caller is now the
+// one holding it.  Returns false if the key isn't in the file, or if it's
+// already been taken.
+
+Bool EmPrefStore::Take (const string& key, string& value)
+{
+	IndexMap::iterator	iter = fIndex.find (key);
+
+	if (iter == fIndex.end () || iter->second.fTaken)
+		return false;
+
+	value = this->GetValue (iter->second);
+	iter->second.fTaken = true;
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::TakeAll
+// ---------------------------------------------------------------------------
+// Take all the keys starting with the given prefix (all of them if the
+// prefix is empty), and add them to the given collection.  Keys already in
+// the collection are left alone: after Reload picks up records written by
+// another instance, the collection's value is this instance's own, and may
+// have been changed since.
+
+void EmPrefStore::TakeAll (const string& prefix, StringStringMap& values)
+{
+	IndexMap::iterator	iter = fIndex.lower_bound (prefix);
+
+	while (iter != fIndex.end () &&
+		iter->first.size () >= prefix.size () &&
+		memcmp (iter->first.c_str (), prefix.c_str (), prefix.size ()) == 0)
+	{
+		if (!iter->second.fTaken)
+		{
+			if (values.find (iter->first) == values.end ())
+				values.insert (make_pair (iter->first, this->GetValue (iter->second)));
+
+			iter->second.fTaken = true;
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::GetKeys
+// ---------------------------------------------------------------------------
+// Return the keys that haven't been taken yet.
+
+void EmPrefStore::GetKeys (StringList& keys) const
+{
+	IndexMap::const_iterator	iter;
+
+	for (iter = fIndex.begin (); iter != fIndex.end (); ++iter)
+	{
+		if (!iter->second.fTaken)
+			keys.push_back (iter->first);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Update
+// ---------------------------------------------------------------------------
+// Bring the file up to date with the given collection, which must hold
+// every key that's to be kept (that is, anything not yet taken from the
+// store should have been taken and added to it).  Records are appended
+// for keys that are new or changed and for keys that have gone away, and
+// the file is compacted if that leaves too much dead weight in it.
+//
+// Returns false if the file couldn't be written.
+
+Bool EmPrefStore::Update (const StringStringMap& values)
+{
+	if (!fFile.IsSpecified ())
+		return false;
+
+	if (fNeedsRewrite)
+		return this->Rewrite (values);
+
+	Chunk			records;
+	EmStreamChunk	stream (records);
+
+	StringStringMap::const_iterator	value;
+	for (value = values.begin (); value != values.end (); ++value)
+	{
+		IndexMap::iterator	iter = fIndex.find (value->first);
+
+		if (iter == fIndex.end () || !this->ValueEquals (iter->second, value->second))
+			::PrvPutRecord (stream, kRecordValue, value->first, value->second);
+	}
+
+	IndexMap::iterator	iter;
+	for (iter = fIndex.begin (); iter != fIndex.end (); ++iter)
+	{
+		if (values.find (iter->first) == values.end ())
+			::PrvPutRecord (stream, kRecordDelete, iter->first, string ());
+	}
+
+	if (records.GetLength () == 0)
+		return true;
+
+	if (!this->Append (records))
+	{
+		// If what's there now can't be added to, replace it -- unless
+		// it's gone over to a format we don't understand.
+
+		if (fNeedsRewrite && fFile.IsSpecified ())
+			return this->Rewrite (values);
+
+		return false;
+	}
+
+	if (fDeadBytes >= kCompactThreshold && fDeadBytes * 2 > fImage.GetLength ())
+		return this->Rewrite (values);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Index
+// ---------------------------------------------------------------------------
+// Add the records starting at the given offset in our copy of the file to
+// the index, keeping track of how many bytes of the file are taken up by
+// records that have been superseded.
+
+void EmPrefStore::Index (long offset, Bool taken)
+{
+	const uint8*	image = (const uint8*) fImage.GetPointer ();
+	long			length = fImage.GetLength ();
+
+	while (length - offset >= kRecordHeaderSize)
+	{
+		uint8	type		= image[offset];
+		uint32	keySize		= ::PrvGet16 (image + offset + 1);
+		uint32	valueSize	= ::PrvGet32 (image + offset + 3);
+
+		uint32	space		= length - offset - kRecordHeaderSize;
+
+		if (keySize > space || valueSize > space - keySize)
+			break;
+
+		long	recordSize = kRecordHeaderSize + keySize + valueSize;
+
+		if (type == kRecordValue || type == kRecordDelete)
+		{
+			string				key ((const char*) image + offset + kRecordHeaderSize, keySize);
+			IndexMap::iterator	iter = fIndex.find (key);
+
+			if (iter != fIndex.end ())
+			{
+				fDeadBytes += iter->second.fRecordSize;
+			}
+
+			if (type == kRecordDelete)
+			{
+				fDeadBytes += recordSize;
+
+				if (iter != fIndex.end ())
+					fIndex.erase (iter);
+			}
+			else
+			{
+				IndexEntry&	entry = fIndex[key];
+
+				entry.fRecordOffset	= offset;
+				entry.fRecordSize	= recordSize;
+				entry.fValueOffset	= offset + kRecordHeaderSize + keySize;
+				entry.fValueSize	= valueSize;
+				entry.fTaken		= taken;
+			}
+		}
+		else
+		{
+			// A record type added by a later version.  We don't know what
+			// to do with it, so it won't survive compaction.
+
+			fDeadBytes += recordSize;
+		}
+
+		offset += recordSize;
+	}
+
+	// If there's anything left over, it's a record that didn't get written
+	// out completely.  Ignore it, and make sure that we don't add anything
+	// after it.
+
+	if (offset < length)
+	{
+		fImage.SetLength (offset);
+		fNeedsRewrite = true;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Append
+// ---------------------------------------------------------------------------
+// Add the given records to the end of the file.  If the file isn't the
+// length we left it at, someone else (say, another copy of the Emulator)
+// has written to it since we last looked, so pick up what they wrote
+// first.  The records were worked out against what we knew before, so
+// they replace only what we changed.
+
+Bool EmPrefStore::Append (const Chunk& records)
+{
+	long	offset;
+
+	try
+	{
+		EmStreamFile	stream (fFile, kOpenExistingForUpdate);	// Will throw if fnf
+
+		offset = stream.GetLength ();
+
+		if (offset != fImage.GetLength () && !this->Reload (stream, offset))
+		{
+			fNeedsRewrite = true;
+			return false;
+		}
+
+		stream.SetMarker (offset, kStreamFromStart);
+
+		if (stream.PutBytes (records.GetPointer (), records.GetLength ()) != errNone)
+		{
+			fNeedsRewrite = true;
+			return false;
+		}
+	}
+	catch (...)
+	{
+		fNeedsRewrite = true;
+		return false;
+	}
+
+	fImage.SetLength (offset + records.GetLength ());
+	memcpy ((char*) fImage.GetPointer () + offset, records.GetPointer (), records.GetLength ());
+
+	this->Index (offset, true);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Reload
+// ---------------------------------------------------------------------------
+// Bring our copy of the file up to date with the given stream, which is
+// "length" bytes long.  If all that's happened is that records were added
+// to the end, just those are indexed; otherwise the file has been
+// rewritten, and the whole thing is indexed again.  The keys in the new
+// records haven't been taken, so that the next Update picks them up.
+//
+// Returns false if the file's no longer something we can add to.
+
+Bool EmPrefStore::Reload (EmStream& stream, long length)
+{
+	Chunk	image (length);
+
+	stream.SetMarker (0, kStreamFromStart);
+
+	if (length < kHeaderSize ||
+		stream.GetBytes (image.GetPointer (), length) != errNone)
+	{
+		return false;
+	}
+
+	const uint8*	p = (const uint8*) image.GetPointer ();
+
+	if (::PrvGet32 (p) != kSignature)
+		return false;
+
+	if (::PrvGet32 (p + 4) != kVersion)
+	{
+		// Leave it alone, as in Open.
+
+		fIsOpen = false;
+		fFile = EmFileRef ();
+		return false;
+	}
+
+	long	offset = fImage.GetLength ();
+
+	if (length < offset || memcmp (p, fImage.GetPointer (), offset) != 0)
+	{
+		fIndex.clear ();
+		fDeadBytes = 0;
+		offset = kHeaderSize;
+	}
+
+	fImage = image;
+
+	this->Index (offset, false);
+
+	// A record that's still being written is no place to add ours after.
+
+	return !fNeedsRewrite;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::Rewrite
+// ---------------------------------------------------------------------------
+// Write out a new file holding just the given key/value pairs.  The file
+// is written with EmFileRef::WriteSafely, so that the old one survives if
+// we're interrupted part way through.
+
+Bool EmPrefStore::Rewrite (const StringStringMap& values)
+{
+	Chunk			image;
+	EmStreamChunk	stream (image);
+
+	stream << kSignature;
+	stream << kVersion;
+
+	StringStringMap::const_iterator	value;
+	for (value = values.begin (); value != values.end (); ++value)
+	{
+		::PrvPutRecord (stream, kRecordValue, value->first, value->second);
+	}
+
+	if (!fFile.WriteSafely (image.GetPointer (), image.GetLength (),
+							kFileCreatorEmulator, kFileTypePreference))
+	{
+		return false;
+	}
+
+	fIsOpen = true;
+	fNeedsRewrite = false;
+	fImage = image;
+	fIndex.clear ();
+	fDeadBytes = 0;
+
+	this->Index (kHeaderSize, true);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::ValueEquals
+// ---------------------------------------------------------------------------
+
+Bool EmPrefStore::ValueEquals (const IndexEntry& entry, const string& value) const
+{
+	return
+		(long) value.size () == entry.fValueSize &&
+		memcmp ((const char*) fImage.GetPointer () + entry.fValueOffset,
+			value.data (), entry.fValueSize) == 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmPrefStore::GetValue
+// ---------------------------------------------------------------------------
+
+string EmPrefStore::GetValue (const IndexEntry& entry) const
+{
+	return string ((const char*) fImage.GetPointer () + entry.fValueOffset,
+		entry.fValueSize);
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvGet16
+// ---------------------------------------------------------------------------
+
+uint32 PrvGet16 (const uint8* p)
+{
+	return ((uint32) p[0] << 8) | (uint32) p[1];
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGet32
+// ---------------------------------------------------------------------------
+
+uint32 PrvGet32 (const uint8* p)
+{
+	return
+		((uint32) p[0] << 24) | ((uint32) p[1] << 16) |
+		((uint32) p[2] << 8) | (uint32) p[3];
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPutRecord
+// ---------------------------------------------------------------------------
+
+void PrvPutRecord (EmStream& stream, uint8 type, const string& key, const string& value)
+{
+	stream << type;
+	stream << (uint16) key.size ();
+	stream << (uint32) value.size ();
+
+	stream.PutBytes (key.data (), key.size ());
+	stream.PutBytes (value.data (), value.size ());
+}
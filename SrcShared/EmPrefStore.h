@@ -0,0 +1,108 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmPrefStore_h
+#define EmPrefStore_h
+
+#include "ChunkFile.h"			// Chunk
+#include "EmFileRef.h"			// EmFileRef
+#include "EmStructs.h"			// StringStringMap
+
+#include <map>
+#include <string>
+
+/*
+	EmPrefStore is a class for managing the binary form of the
+	preferences file.  Preferences loads it in place of parsing the
+	text file, which it now reads only when there's no binary file
+	yet (or the binary file is from a newer, incompatible Emulator).
+
+	When the file is opened, it's read into memory in one go and an
+	index of the keys in it is built.  A value isn't turned into a
+	string until Preferences asks for it, at which point it's "taken":
+	Preferences holds the current value from then on, and the store
+	only remembers what's in the file.
+
+	When the preferences are saved, the store compares them against
+	what's in the file and appends records for just the keys that
+	changed or went away.  When too much of the file is taken up by
+	records that have been superseded, the whole file is rewritten.
+	Anything someone else has added to the file in the meantime is
+	picked up before our records go after it.
+
+	The format of the file is:
+
+		signature: 4 bytes ('PPrf')
+		version: 4 bytes
+		records...
+
+	with each record being:
+
+		type: 1 byte
+		key size: 2 bytes
+		value size: 4 bytes
+		key: "key size" bytes
+		value: "value size" bytes
+
+	Integers are stored in Big Endian format, and strings are stored
+	without their NULL terminators.  The version is bumped only when
+	the format changes in a way older Emulators can't cope with; new
+	record types can be added without bumping it, as readers skip
+	types they don't recognize.  A record cut short at the end of the
+	file (as happens if we crash while appending) is ignored.
+*/
+
+class EmPrefStore
+{
+	public:
+								EmPrefStore			(void);
+								~EmPrefStore		(void);
+
+		Bool					Open				(const EmFileRef&);
+		Bool					IsOpen				(void) const	{ return fIsOpen; }
+
+		Bool					Take				(const string& key, string& value);
+		void					TakeAll				(const string& prefix, StringStringMap&);
+		void					GetKeys				(StringList&) const;
+
+		Bool					Update				(const StringStringMap&);
+
+	private:
+		struct IndexEntry
+		{
+			long				fRecordOffset;
+			long				fRecordSize;
+			long				fValueOffset;
+			long				fValueSize;
+			Bool				fTaken;
+		};
+
+		typedef map<string, IndexEntry>	IndexMap;
+
+		void					Index				(long offset, Bool taken);
+		Bool					Append				(const Chunk&);
+		Bool					Reload				(EmStream&, long length);
+		Bool					Rewrite				(const StringStringMap&);
+		Bool					ValueEquals			(const IndexEntry&, const string&) const;
+		string					GetValue			(const IndexEntry&) const;
+
+	private:
+		EmFileRef				fFile;
+		Bool					fIsOpen;
+		Bool					fNeedsRewrite;
+		Chunk					fImage;
+		IndexMap				fIndex;
+		long					fDeadBytes;
+};
+
+#endif	/* EmPrefStore_h */
@@ -43,7 +43,7 @@
 #endif
 
 #ifdef	SONY_ROM 
-#include	"SonyShared\SonyDevice.h"
+#include	"SonyShared/SonyDevice.h"
 #include	"EmSession.h"
 #endif	//SONY_ROM
 
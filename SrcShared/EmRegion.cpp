@@ -526,6 +526,22 @@ EmRegion::GetRects (EmRect* rp) const
 }
 
 
+// ---------------------------------------------------------------------------
+//		* GetShape
+// ---------------------------------------------------------------------------
+
+long
+EmRegion::GetShape (EmCoord* s) const
+{
+	EmAssert (fImpl.get ());
+
+	if (s && fImpl->fCapacity > 0)
+		memcpy (s, fImpl->fBuf, fImpl->fCapacity * sizeof (EmCoord));
+
+	return fImpl->fCapacity;
+}
+
+
 // ---------------------------------------------------------------------------
 //		* IsEmpty
 // ---------------------------------------------------------------------------
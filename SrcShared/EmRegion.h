@@ -92,6 +92,13 @@ class EmRegion
 			// Assignment operator. Similar to copy constructor. There is also
 			// a version that takes an EmRect as an r-value.
 
+								EmRegion	(const EmCoord* s, long len);
+		long					GetShape	(EmCoord* s) const;
+			// Create a region from, or copy out, the internal shape buffer.
+			// GetShape returns the number of EmCoords in the buffer; pass
+			// NULL to just get the count. Used to save a region to disk and
+			// restore it later without rebuilding it from rectangles.
+
 		void					BeEmpty		(void);
 			// Quickly empty out a region so that you don't have to do anything
 			// goofy like assigning a NULL rectangle to it.
@@ -158,7 +165,6 @@ class EmRegion
 			eIntersection    = 3
 		};
 
-								EmRegion	(const EmCoord* s, long len);
 		EmCoord*				GetBuf		(void) const;
 		long					Length		(void) const;
 
@@ -16,6 +16,7 @@
 
 #include "EmHAL.h"				// EmHAL:: GetLCDBeginEnd
 #include "EmMemory.h"			// CEnableFullAccess
+#include "EmSession.h"			// EmSessionCommand, gSession
 #include "MetaMemory.h"			// MetaMemory::MarkScreen
 
 
@@ -286,3 +287,48 @@ Bool EmScreen::GetBits (EmScreenUpdateInfo& info)
 
 	return true;
 }
+
+
+class EmScreenGrabCommand : public EmSessionCommand
+{
+	public:
+								EmScreenGrabCommand	(EmScreenUpdateInfo& info) :
+									fInfo (info)
+								{
+								}
+
+		virtual void			Do					(void)
+								{
+									EmScreen::InvalidateAll ();
+									EmScreen::GetBits (fInfo);
+									EmScreen::InvalidateAll ();
+								}
+
+	private:
+		EmScreenUpdateInfo&		fInfo;
+};
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::GetAllBits
+ *
+ * DESCRIPTION: Get the full contents of the LCD, for screenshots.
+ *				Can be called from any thread.  Reading the LCD
+ *				doesn't change anything the CPU cares about, so the
+ *				CPU thread does it between instructions rather than
+ *				being stopped.
+ *
+ * PARAMETERS:	info - receives the LCD image.
+ *
+ * RETURNED:	False if the CPU thread couldn't get to it.
+ *
+ ***********************************************************************/
+
+Bool EmScreen::GetAllBits (EmScreenUpdateInfo& info)
+{
+	EmScreenGrabCommand	command (info);
+
+	EmAssert (gSession);
+	return gSession->RunCommand (command);
+}
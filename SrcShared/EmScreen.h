@@ -53,6 +53,7 @@ class EmScreen
 		static void 			InvalidateAll		(void);
 
 		static Bool 			GetBits 			(EmScreenUpdateInfo&);
+		static Bool 			GetAllBits			(EmScreenUpdateInfo&);
 };
 
 #endif	// EmScreen_h
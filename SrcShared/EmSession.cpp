@@ -16,18 +16,21 @@
 
 #include "ChunkFile.h"			// ChunkFile
 #include "EmApplication.h"		// gApplication, GetBoundDevice, etc.
+#include "EmAtomic.h"			// EmAtomicCompareAndSwapPtr, EmAtomicExchangePtr
+#include "EmClock.h"			// EmClock::GetMilliseconds
 #include "EmCPU.h"				// EmCPU::Execute
 #include "EmDocument.h"			// gDocument
 #include "EmErrCodes.h"			// kError_InvalidSessionFile
 #include "EmEventPlayback.h"	// EmEventPlayback::ReplayingEvents
 #include "EmException.h"		// EmExceptionTopLevelAction
+#include "EmGremlinCoverage.h"	// EmGremlinCoverage::SaveState, LoadState
 #include "EmHAL.h"				// EmHAL::ButtonEvent
 #include "EmMemory.h"			// Memory::ResetBankHandlers
 #include "EmMinimize.h"			// EmMinimize::RealLoadInitialState
 #include "EmStreamFile.h"		// EmStreamFile
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Hordes.h"				// Hordes::AutoSaveState, etc.
-#include "Logging.h"			// LogAppendMsg
+#include "Logging.h"			// LogAppendMsg, LogThreadExit
 #include "Miscellaneous.h"		// EmValueChanger
 #include "PreferenceMgr.h"		// Preference
 #include "ROMStubs.h"			// EvtWakeup
@@ -43,8 +46,10 @@
 #include "EmPalmOS.h"			// EmPalmOS::Initialize
 
 #ifdef SONY_ROM
-#include "SonyWin\Platform_MsfsLib.h"
+#include "SonyShared/Platform_MsfsLib.h"
+#if PLATFORM_WINDOWS
 void	LCD_InitStateJogButton();		// LCDSony.inl
+#endif
 #endif //SONY_ROM
 
 EmSession*	gSession;
@@ -52,12 +57,18 @@ EmSession*	gSession;
 static uint32	gLastButtonEvent;
 const uint32	kButtonEventThreshold = 100;
 
+// Number of delta checkpoints written before SaveCheckpoint starts over
+// with a full image.
+
+const long		kMaxCheckpointChain = 16;
+
 #ifndef NDEBUG
 Bool	gIterating = false;
 #endif
 
 Bool	PrvCanBotherCPU	(void);
 void	PrvWakeUpCPU	(long strID);
+Bool	PrvCheckpointChainIntact (const EmCheckpoint&, const EmFileRef&);
 
 
 /*
@@ -120,6 +131,8 @@ EmSession::EmSession (void) :
 	fReset (false),
 	fResetBanks (false),
 	fHordeAutoSaveState (false),
+	fHordeSaveCoverageState (false),
+	fHordeLoadCoverageState (false),
 	fHordeSaveRootState (false),
 	fHordeSaveSuspendState (false),
 	fHordeLoadRootState (false),
@@ -132,7 +145,9 @@ EmSession::EmSession (void) :
 	fKeyQueue (),
 	fPenQueue (),
 	fLastPenEvent (EmPoint (-1, -1), false),
-	fBootKeys (0)
+	fBootKeys (0),
+	fCheckpoint (NULL),
+	fCommands (NULL)
 {
 	fSuspendState.fAllCounters = 0;
 
@@ -151,6 +166,12 @@ EmSession::EmSession (void) :
 EmSession::~EmSession (void)
 {
 	this->DestroyThread ();
+
+	// Don't leave anyone waiting on a command that was posted too late
+	// for the CPU thread to see it.
+
+	this->DoPendingCommands ();
+
 	this->Dispose ();
 
 	// Delete the CPU object here instead of in Dispose.  When reloading a
@@ -164,6 +185,9 @@ EmSession::~EmSession (void)
 	delete fCPU;
 	fCPU = NULL;
 
+	delete fCheckpoint;
+	fCheckpoint = NULL;
+
 	EmAssert (gSession == this);
 	gSession = NULL;
 }
@@ -326,7 +350,9 @@ void EmSession::Initialize (const Configuration& cfg)
 
 #ifdef SONY_ROM
 	Platform_MsfsLib::Initialize(cfg);
+#if PLATFORM_WINDOWS
 	::LCD_InitStateJogButton();
+#endif
 #endif //SONY_ROM
 
 	EmPalmOS::Initialize ();
@@ -490,6 +516,8 @@ void EmSession::Reset (EmResetType resetType)
 	fReset = false;
 	fResetBanks = false;
 	fHordeAutoSaveState = false;
+	fHordeSaveCoverageState = false;
+	fHordeLoadCoverageState = false;
 	fHordeSaveRootState = false;
 	fHordeSaveSuspendState = false;
 	fHordeLoadRootState = false;
@@ -719,6 +747,81 @@ void EmSession::Load (const EmFileRef& ref)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmSession::SaveCheckpoint
+// ---------------------------------------------------------------------------
+
+void EmSession::SaveCheckpoint (const EmFileRef& ref)
+{
+	if (!fCheckpoint)
+	{
+		fCheckpoint = new EmCheckpoint;
+	}
+
+	// Decide whether this one can be a delta.  We need every checkpoint
+	// in the chain to still be around and unchanged, and we mustn't be
+	// about to overwrite any of them.  (Hordes names checkpoints after
+	// the event counter, which goes backwards when a Gremlin jumps back
+	// to an earlier state.)  Otherwise -- or if the chain is getting
+	// long enough that loading it would start to hurt -- write a full
+	// image.
+
+	if (fCheckpoint->fChainLength >= kMaxCheckpointChain ||
+		!::PrvCheckpointChainIntact (*fCheckpoint, ref))
+	{
+		fCheckpoint->fParent = EmFileRef ();
+		fCheckpoint->fChain.clear ();
+	}
+
+	try
+	{
+		EmStreamFile	stream (ref, kCreateOrEraseForUpdate,
+							kFileCreatorEmulator, kFileTypeSession);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		sessionFile.SetCheckpoint (fCheckpoint);
+
+		this->Save (sessionFile);
+
+		if (sessionFile.WroteCheckpointDelta ())
+		{
+			++fCheckpoint->fChainLength;
+		}
+		else
+		{
+			fCheckpoint->fChainLength = 0;
+			fCheckpoint->fChain.clear ();
+		}
+	}
+	catch (...)
+	{
+		// The images we hold may no longer match any file on disk.
+		// Start over with a full image next time.
+
+		delete fCheckpoint;
+		fCheckpoint = NULL;
+
+		throw;
+	}
+
+	// Remember the file as it is now, now that it's been closed.
+
+	EmCheckpointFile	file;
+	file.fRef = ref;
+
+	if (ref.GetSizeAndModDate (&file.fSize, &file.fModDate) != 0)
+	{
+		delete fCheckpoint;
+		fCheckpoint = NULL;
+		return;
+	}
+
+	fCheckpoint->fParent = ref;
+	fCheckpoint->fChain.push_back (file);
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -1067,6 +1170,157 @@ Bool EmSession::InCPUThread (void) const
 #endif
 
 
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmSession::PostCommand
+// ---------------------------------------------------------------------------
+// Add the command to the mailbox and make sure the CPU thread looks at it
+// soon.  The CPU thread checks for commands in CycleSlowly; if it's asleep
+// waiting for something to do, wake it up so that it gets there.
+
+void EmSession::PostCommand (EmSessionCommand& command)
+{
+	command.fDone = false;
+	command.fSucceeded = false;
+
+	EmSessionCommand*	head;
+
+	do
+	{
+		head = fCommands;
+		command.fNext = head;
+	}
+	while (EmAtomicCompareAndSwapPtr ((void* volatile*) &fCommands, head, &command) != head);
+
+#if HAS_OMNI_THREAD
+	fSleepLock.lock ();
+	fSleepCondition.broadcast ();
+	fSleepLock.unlock ();
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSession::WaitForCommand
+// ---------------------------------------------------------------------------
+// Wait for a posted command to be carried out.  If the CPU thread isn't
+// running, it won't be emptying the mailbox, so stop it the usual way and
+// do that here.  Returns true if the command's Do method didn't throw.
+
+Bool EmSession::WaitForCommand (EmSessionCommand& command)
+{
+#if HAS_OMNI_THREAD
+	const unsigned long	kWaitPeriod = 10;	// msecs
+
+	while (!command.IsDone ())
+	{
+		if (!fThread)
+		{
+			this->DoPendingCommands ();
+		}
+		else if (this->GetSessionState () != kRunning)
+		{
+			EmSessionStopper	stopper (this, kStopNow);
+
+			if (stopper.Stopped ())
+				this->DoPendingCommands ();
+		}
+		else
+		{
+			command.TimedWait (kWaitPeriod);
+		}
+	}
+#else
+	if (!command.IsDone ())
+	{
+		EmSessionStopper	stopper (this, kStopNow);
+
+		this->DoPendingCommands ();
+	}
+#endif
+
+	return command.Succeeded ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSession::RunCommand
+// ---------------------------------------------------------------------------
+
+Bool EmSession::RunCommand (EmSessionCommand& command)
+{
+#if HAS_OMNI_THREAD
+	if (this->InCPUThread ())
+	{
+		command.Do ();
+		return true;
+	}
+#endif
+
+	this->PostCommand (command);
+
+	return this->WaitForCommand (command);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSession::HasPendingCommands
+// ---------------------------------------------------------------------------
+
+Bool EmSession::HasPendingCommands (void)
+{
+	return fCommands != NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSession::DoPendingCommands
+// ---------------------------------------------------------------------------
+// Empty the mailbox and carry out the commands that were in it, oldest
+// first.  Commands posted while we're doing that are left for next time.
+
+void EmSession::DoPendingCommands (void)
+{
+	EmSessionCommand*	list = (EmSessionCommand*)
+		EmAtomicExchangePtr ((void* volatile*) &fCommands, NULL);
+
+	// The mailbox is a stack; turn it around.
+
+	EmSessionCommand*	oldest = NULL;
+
+	while (list)
+	{
+		EmSessionCommand*	next = list->fNext;
+
+		list->fNext = oldest;
+		oldest = list;
+		list = next;
+	}
+
+	while (oldest)
+	{
+		// Get the next one before completing this one; the poster is
+		// free to delete it as soon as it's marked as done.
+
+		EmSessionCommand*	next = oldest->fNext;
+		Bool				succeeded = true;
+
+		try
+		{
+			oldest->Do ();
+		}
+		catch (...)
+		{
+			succeeded = false;
+		}
+
+		oldest->Complete (succeeded);
+		oldest = next;
+	}
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -1391,6 +1645,15 @@ Bool EmSession::ExecuteSpecial (Bool checkForResetOnly)
 	if (checkForResetOnly)
 		return false;
 
+	// Commands can't run while we're nested; whatever's being called in
+	// the emulated OS hasn't finished, and the state they look at could be
+	// half-changed.  They'll be picked up once we're back at the top.
+
+	if (this->HasPendingCommands () && !this->IsNested ())
+	{
+		this->DoPendingCommands ();
+	}
+
 	if (fHordeAutoSaveState)
 	{
 		fHordeAutoSaveState = false;
@@ -1398,6 +1661,28 @@ Bool EmSession::ExecuteSpecial (Bool checkForResetOnly)
 		Hordes::AutoSaveState ();
 	}
 
+	if (fHordeSaveCoverageState)
+	{
+		fHordeSaveCoverageState = false;
+
+		EmGremlinCoverage::SaveState ();
+	}
+
+	if (fHordeLoadCoverageState)
+	{
+		fHordeLoadCoverageState = false;
+
+		// Don't jump away from the state that one of the actions
+		// below is about to save or replace.
+
+		if (!fHordeSaveRootState && !fHordeSaveSuspendState &&
+			!fHordeLoadRootState && !fHordeNextGremlinFromRootState &&
+			!fHordeNextGremlinFromSuspendState)
+		{
+			EmGremlinCoverage::LoadState ();
+		}
+	}
+
 	if (fHordeSaveRootState)
 	{
 		EmAssert (!fHordeSaveSuspendState);
@@ -1666,7 +1951,7 @@ void EmSession::PostButtonEvent (const EmButtonEvent& event, Bool postNow)
 
 	if (postNow)
 	{
-		gLastButtonEvent = Platform::GetMilliseconds () - kButtonEventThreshold;
+		gLastButtonEvent = EmClock::GetMilliseconds () - kButtonEventThreshold;
 	}
 }
 
@@ -1676,7 +1961,7 @@ Bool EmSession::HasButtonEvent (void)
 	// Don't feed hardware events out too quickly.  Otherwise, the OS
 	// may not have time to react to the register changes.
 
-	uint32	now = Platform::GetMilliseconds ();
+	uint32	now = EmClock::GetMilliseconds ();
 
 	if (now - gLastButtonEvent < kButtonEventThreshold)
 	{
@@ -1698,7 +1983,7 @@ EmButtonEvent EmSession::GetButtonEvent (void)
 	// Don't feed hardware events out too quickly.  Otherwise, the OS
 	// may not have time to react to the register changes.
 
-	gLastButtonEvent = Platform::GetMilliseconds ();
+	gLastButtonEvent = EmClock::GetMilliseconds ();
 
 	return fButtonQueue.Get ();
 }
@@ -1858,6 +2143,41 @@ void PrvWakeUpCPU (long strID)
 	}
 }
 
+
+// ---------------------------------------------------------------------------
+//		 PrvCheckpointChainIntact
+// ---------------------------------------------------------------------------
+// Return whether a delta checkpoint written to "ref" could be loaded back:
+// there's a chain to hang it on, "ref" isn't one of the files in it, and
+// none of them has been deleted or replaced since we wrote it.
+
+Bool PrvCheckpointChainIntact (const EmCheckpoint& checkpoint, const EmFileRef& ref)
+{
+	if (checkpoint.fChain.empty ())
+		return false;
+
+	EmCheckpointFileList::const_iterator	iter = checkpoint.fChain.begin ();
+	while (iter != checkpoint.fChain.end ())
+	{
+		uint32	size;
+		uint32	modDate;
+
+		if (iter->fRef == ref)
+			return false;
+
+		if (iter->fRef.GetSizeAndModDate (&size, &modDate) != 0 ||
+			size != iter->fSize ||
+			modDate != iter->fModDate)
+		{
+			return false;
+		}
+
+		++iter;
+	}
+
+	return true;
+}
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -2048,6 +2368,8 @@ void EmSession::ScheduleResumeExternal (void)
 //		 EmSession::ScheduleReset
 //		 EmSession::ScheduleResetBanks
 //		 EmSession::ScheduleAutoSaveState
+//		 EmSession::ScheduleSaveCoverageState
+//		 EmSession::ScheduleLoadCoverageState
 //		 EmSession::ScheduleSaveRootState
 //		 EmSession::ScheduleSaveSuspendedState
 //		 EmSession::ScheduleLoadRootState
@@ -2083,6 +2405,24 @@ void EmSession::ScheduleAutoSaveState (void)
 }
 
 
+void EmSession::ScheduleSaveCoverageState (void)
+{
+	fHordeSaveCoverageState = 1;
+
+	EmAssert (fCPU);
+	fCPU->CheckAfterCycle ();
+}
+
+
+void EmSession::ScheduleLoadCoverageState (void)
+{
+	fHordeLoadCoverageState = 1;
+
+	EmAssert (fCPU);
+	fCPU->CheckAfterCycle ();
+}
+
+
 void EmSession::ScheduleSaveRootState (void)
 {
 	fHordeSaveRootState = 1;
@@ -2315,6 +2655,11 @@ void EmSession::RunStatic (void* arg)
 {
 	EmAssert (arg);
 	((EmSession*) arg)->Run ();
+
+	// Each session gets its own thread, so let the log reuse this one's
+	// record ring.
+
+	::LogThreadExit ();
 }
 
 #endif
@@ -2496,3 +2841,102 @@ Bool EmSessionStopper::CanCall (void)
 			(fHow == kStopOnSysCall) &&
 			(fStopped /*== true*/);
 }
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmSessionCommand::EmSessionCommand
+// ---------------------------------------------------------------------------
+
+EmSessionCommand::EmSessionCommand (void) :
+	fNext (NULL),
+	fDone (false),
+	fSucceeded (false)
+#if HAS_OMNI_THREAD
+	,
+	fMutex (),
+	fCondition (&fMutex)
+#endif
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSessionCommand::~EmSessionCommand
+// ---------------------------------------------------------------------------
+
+EmSessionCommand::~EmSessionCommand (void)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSessionCommand::IsDone
+// ---------------------------------------------------------------------------
+
+Bool EmSessionCommand::IsDone (void)
+{
+	return EmAtomicGet (&fDone) != 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSessionCommand::Succeeded
+// ---------------------------------------------------------------------------
+
+Bool EmSessionCommand::Succeeded (void)
+{
+	return this->IsDone () && fSucceeded;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSessionCommand::Complete
+// ---------------------------------------------------------------------------
+// Mark the command as done and wake up anyone waiting on it.  This must be
+// the last thing done with the command; its owner may delete it right away.
+
+void EmSessionCommand::Complete (Bool succeeded)
+{
+	fSucceeded = succeeded;
+
+#if HAS_OMNI_THREAD
+	omni_mutex_lock	lock (fMutex);
+#endif
+
+	EmAtomicSet (&fDone, true);
+
+#if HAS_OMNI_THREAD
+	fCondition.broadcast ();
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmSessionCommand::TimedWait
+// ---------------------------------------------------------------------------
+// Wait for the command to be completed, but not for longer than the given
+// number of milliseconds.
+
+void EmSessionCommand::TimedWait (unsigned long msecs)
+{
+#if HAS_OMNI_THREAD
+	const unsigned long	kMillisecondsPerSecond = 1000;
+	const unsigned long	kNanosecondsPerMillisecond = 1000000;
+
+	unsigned long	secs;
+	unsigned long	nsecs;
+
+	omni_thread::get_time (&secs, &nsecs,
+		msecs / kMillisecondsPerSecond,
+		(msecs % kMillisecondsPerSecond) * kNanosecondsPerMillisecond);
+
+	omni_mutex_lock	lock (fMutex);
+
+	if (!fDone)
+		fCondition.timedwait (secs, nsecs);
+#else
+	UNUSED_PARAM (msecs)
+#endif
+}
@@ -289,6 +289,55 @@ struct DataBreakFuncs
 typedef vector<DataBreakFuncs>	DataBreakFuncList;
 
 
+// ---------------------------------------------------------------------------
+#pragma mark EmSessionCommand
+// ---------------------------------------------------------------------------
+
+/*
+**	A unit of work that needs to run in the CPU thread, or at least while it
+**	isn't executing instructions.  Clients subclass this, override Do, and
+**	hand an instance to EmSession::RunCommand (or PostCommand followed later
+**	by WaitForCommand).
+**
+**	Posted commands go into a lock-free mailbox that the CPU thread empties
+**	between instructions, so a client that only needs to look at the
+**	emulated state doesn't have to stop and restart the CPU the way
+**	EmSessionStopper does.  Several commands can be posted before waiting
+**	on any of them; they're carried out in the order they were posted.
+**
+**	Do must not suspend the CPU or call into the Palm OS; use
+**	EmSessionStopper for that.  If Do throws, the exception is swallowed
+**	and Succeeded returns false.
+*/
+
+class EmSessionCommand
+{
+	public:
+								EmSessionCommand	(void);
+		virtual					~EmSessionCommand	(void);
+
+		virtual void			Do					(void) = 0;
+
+		Bool					IsDone				(void);
+		Bool					Succeeded			(void);
+
+	private:
+		friend class EmSession;
+
+		void					Complete			(Bool succeeded);
+		void					TimedWait			(unsigned long msecs);
+
+		EmSessionCommand*		fNext;
+		volatile int32			fDone;
+		Bool					fSucceeded;
+
+#if HAS_OMNI_THREAD
+		omni_mutex				fMutex;
+		omni_condition			fCondition;
+#endif
+};
+
+
 // ---------------------------------------------------------------------------
 #pragma mark EmSession
 // ---------------------------------------------------------------------------
@@ -296,6 +345,7 @@ typedef vector<DataBreakFuncs>	DataBreakFuncList;
 class EmCPU;
 class EmDeferredErr;
 class SessionFile;
+struct EmCheckpoint;
 struct Configuration;
 
 typedef vector<EmDeferredErr*>	EmDeferredErrList;
@@ -350,6 +400,14 @@ class EmSession
 													 Bool updateFileRef);
 		void 					Load				(const EmFileRef&);
 
+		// Save a checkpoint.  Where possible, only the RAM pages changed
+		// since the previous checkpoint are written, along with a reference
+		// to the file holding that checkpoint; loading such a file with Load
+		// follows the chain back automatically.  A full image is written
+		// every kMaxCheckpointChain checkpoints to keep chains short.
+
+		void					SaveCheckpoint		(const EmFileRef&);
+
 		// Called by external thread to create and destroy the thread.  CreateThread
 		// is called after the EmSession is created.  If "suspended" is true, the
 		// client should also call ResumeThread.  If "suspended" is false, the
@@ -367,6 +425,24 @@ class EmSession
 		Bool					SuspendThread		(EmStopMethod how);
 		void					ResumeThread		(void);
 
+		// Called by external thread to have the CPU thread carry out the
+		// given command.  PostCommand returns right away; WaitForCommand
+		// returns once the command has been carried out.  RunCommand does
+		// both.  If the CPU thread isn't running, the command is carried
+		// out in the calling thread after stopping the CPU as
+		// EmSessionStopper would.  Called in the CPU thread, RunCommand
+		// just calls the command's Do method.
+
+		void					PostCommand			(EmSessionCommand&);
+		Bool					WaitForCommand		(EmSessionCommand&);
+		Bool					RunCommand			(EmSessionCommand&);
+
+		// Called by the CPU thread between instructions to carry out any
+		// posted commands.
+
+		Bool					HasPendingCommands	(void);
+		void					DoPendingCommands	(void);
+
 #if HAS_OMNI_THREAD
 		// Pause the thread by the given number of milliseconds.
 
@@ -536,6 +612,8 @@ class EmSession
 		void					ScheduleReset							(EmResetType);
 		void					ScheduleResetBanks						(void);
 		void					ScheduleAutoSaveState					(void);
+		void					ScheduleSaveCoverageState				(void);
+		void					ScheduleLoadCoverageState				(void);
 		void					ScheduleSaveRootState					(void);
 		void					ScheduleSaveSuspendedState				(void);
 		void					ScheduleLoadRootState					(void);
@@ -669,6 +747,8 @@ class EmSession
 		Bool					fReset;
 		Bool					fResetBanks;
 		Bool					fHordeAutoSaveState;
+		Bool					fHordeSaveCoverageState;
+		Bool					fHordeLoadCoverageState;
 		Bool					fHordeSaveRootState;
 		Bool					fHordeSaveSuspendState;
 		Bool					fHordeLoadRootState;
@@ -688,6 +768,14 @@ class EmSession
 		EmPenEvent				fLastPenEvent;
 		uint32					fBootKeys;
 
+		EmCheckpoint*			fCheckpoint;
+
+		// Commands posted by PostCommand, most recent first.  Pushed onto
+		// by any thread with EmAtomicCompareAndSwapPtr; DoPendingCommands
+		// takes the whole list at once with EmAtomicExchangePtr.
+
+		EmSessionCommand* volatile	fCommands;
+
 	private:
 		InstructionBreakFuncList	fInstructionBreakFuncs;
 		DataBreakFuncList			fDataBreakFuncs;
@@ -0,0 +1,776 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmSkinCache.h"
+
+#include "ChunkFile.h"			// Chunk, ChunkFile, EmStreamChunk
+#include "EmDirRef.h"			// EmDirRef
+#include "EmFileRef.h"			// EmFileRef
+#include "EmPixMap.h"			// EmPixMap
+#include "EmRegion.h"			// EmRegion
+#include "EmStreamFile.h"		// EmStreamFile
+
+#include <algorithm>			// sort
+
+
+enum
+{
+	kCacheVersion		= 2,
+
+	kMaxCacheEntries	= 32,
+
+	kVersionTag			= 'vers',	// kCacheVersion
+	kSourceSizeTag		= 'ssiz',	// Size of the JPEG data the entry was made from
+	kSourceHashTag		= 'shsh',	// Second hash of that data, for verification
+	kWidthTag			= 'wdth',	// Skin pixmap width
+	kHeightTag			= 'hght',	// Skin pixmap height
+	kFormatTag			= 'fmt ',	// Skin pixmap EmPixMapFormat
+	kRowBytesTag		= 'rowb',	// Skin pixmap rowBytes
+	kPixMapColorsTag	= 'pclr',	// Skin pixmap color table
+	kPixelsTag			= 'pixl',	// Skin pixmap bits
+	kRegionTag			= 'rgn ',	// Skin outline, as EmRegion shape data
+	kColorSetsTag		= 'csts'	// Quantized skin color tables, one set per caller's key
+};
+
+// The skin pixmap and the region and colors are kept separately, as
+// the pixmap is left out of entries keyed by the pixmap itself.
+
+static Bool			PrvRead				(const Chunk& key, EmPixMap* skin,
+										 EmRegion& region, RGBList* colors,
+										 int numColors, uint32 colorsKey);
+static void			PrvWrite			(const Chunk& key, const EmPixMap* skin,
+										 const EmRegion& region, const RGBList* colors,
+										 int numColors, uint32 colorsKey);
+static Bool			PrvReadEntry		(const Chunk& key, Chunk& cacheData);
+static void			PrvWriteEntry		(const Chunk& key, const Chunk& cacheData);
+static void			PrvPruneCache		(void);
+static void			PrvGetPixMapKey		(const EmPixMap& skin, Chunk& key);
+
+static uint32		PrvHash				(const Chunk& data, uint32 seed);
+static EmDirRef		PrvGetCacheDir		(void);
+static EmFileRef	PrvGetCacheFile		(const Chunk& key);
+static void			PrvWriteColors		(EmStream&, const RGBList&);
+static void			PrvReadColors		(EmStream&, RGBList&);
+static void			PrvWriteColorSet	(EmStream&, uint32 colorsKey,
+										 const RGBList* colors, int numColors);
+static void			PrvReadColorSet		(EmStream&, uint32& colorsKey,
+										 vector<RGBList>& colors);
+
+
+struct EmSkinCacheFileInfo
+{
+	bool operator< (const EmSkinCacheFileInfo& other) const
+		{ return fModDate > other.fModDate; }	// Newest first
+
+	EmFileRef	fRef;
+	uint32		fModDate;
+};
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmSkinCache::Read
+ *
+ * DESCRIPTION:	Look for a cache entry for the given skin image data.
+ *				If one is found, return the decoded skin, its outline
+ *				region, and any quantized color tables saved with it.
+ *
+ * PARAMETERS:	skinData - the undecoded (JPEG) skin image.
+ *
+ *				skin - receives the decoded skin.
+ *
+ *				region - receives the skin's outline region.
+ *
+ *				colors, numColors - array receiving the quantized color
+ *					tables.  Tables not found in the cache are cleared.
+ *
+ *				colorsKey - caller-defined value describing anything
+ *					else the color tables depend on.  Only the tables
+ *					saved with the same value are restored; if there
+ *					are none, all of the color tables are cleared.
+ *
+ * RETURNED:	True if the cache entry was found and read.  If false,
+ *				none of the output parameters have been changed.
+ *
+ ***********************************************************************/
+
+Bool
+EmSkinCache::Read (const Chunk& skinData, EmPixMap& skin, EmRegion& region,
+				   RGBList* colors, int numColors, uint32 colorsKey)
+{
+	return ::PrvRead (skinData, &skin, region, colors, numColors, colorsKey);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmSkinCache::Read
+ *
+ * DESCRIPTION:	Look for a cache entry for the given decoded skin (for
+ *				instance, the built-in default skin).  If one is found,
+ *				return its outline region and any quantized color tables
+ *				saved with it.
+ *
+ * PARAMETERS:	skin - the decoded skin.
+ *
+ *				Others as above.
+ *
+ * RETURNED:	As above.
+ *
+ ***********************************************************************/
+
+Bool
+EmSkinCache::Read (const EmPixMap& skin, EmRegion& region,
+				   RGBList* colors, int numColors, uint32 colorsKey)
+{
+	Chunk	key;
+	::PrvGetPixMapKey (skin, key);
+
+	return ::PrvRead (key, NULL, region, colors, numColors, colorsKey);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmSkinCache::Write
+ *
+ * DESCRIPTION:	Create or replace the cache entry for the given skin
+ *				image data.
+ *
+ * PARAMETERS:	skinData - the undecoded (JPEG) skin image.
+ *
+ *				skin - the decoded skin.
+ *
+ *				region - the skin's outline region.
+ *
+ *				colors, numColors - the quantized color tables computed
+ *					so far.  Empty tables are saved as such.
+ *
+ *				colorsKey - caller-defined value describing anything
+ *					else the color tables depend on.  Tables saved
+ *					earlier with other values are kept.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmSkinCache::Write (const Chunk& skinData, const EmPixMap& skin, const EmRegion& region,
+					const RGBList* colors, int numColors, uint32 colorsKey)
+{
+	::PrvWrite (skinData, &skin, region, colors, numColors, colorsKey);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmSkinCache::Write
+ *
+ * DESCRIPTION:	Create or replace the cache entry for the given decoded
+ *				skin.  The skin itself is not saved; only its region
+ *				and colors are.
+ *
+ * PARAMETERS:	skin - the decoded skin.
+ *
+ *				Others as above.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmSkinCache::Write (const EmPixMap& skin, const EmRegion& region,
+					const RGBList* colors, int numColors, uint32 colorsKey)
+{
+	Chunk	key;
+	::PrvGetPixMapKey (skin, key);
+
+	::PrvWrite (key, NULL, region, colors, numColors, colorsKey);
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvRead
+ *
+ * DESCRIPTION:	Common code for the EmSkinCache::Read functions.
+ *
+ * PARAMETERS:	key - the data the entry is keyed by.
+ *
+ *				skin - receives the decoded skin, or NULL if the entry
+ *					is keyed by the skin and doesn't hold it.
+ *
+ *				Others as for EmSkinCache::Read.
+ *
+ * RETURNED:	As for EmSkinCache::Read.
+ *
+ ***********************************************************************/
+
+Bool PrvRead (const Chunk& key, EmPixMap* skin, EmRegion& region,
+			  RGBList* colors, int numColors, uint32 colorsKey)
+{
+	try
+	{
+		Chunk	cacheData;
+
+		if (!::PrvReadEntry (key, cacheData))
+			return false;
+
+		EmStreamChunk	cacheStream (cacheData);
+		ChunkFile		cacheFileData (cacheStream);
+
+		// Get the pixmap.
+
+		EmPixMap	newSkin;
+
+		if (skin)
+		{
+			int32	width, height, format, rowBytes;
+			Chunk	pixMapColors, pixels;
+
+			if (!cacheFileData.ReadInt (kWidthTag, width) ||
+				!cacheFileData.ReadInt (kHeightTag, height) ||
+				!cacheFileData.ReadInt (kFormatTag, format) ||
+				!cacheFileData.ReadInt (kRowBytesTag, rowBytes) ||
+				!cacheFileData.ReadChunk (kPixMapColorsTag, pixMapColors) ||
+				!cacheFileData.ReadChunk (kPixelsTag, pixels))
+				return false;
+
+			if (format < 0 || format >= kPixMapFormatLast ||
+				rowBytes <= 0 || height <= 0 ||
+				pixels.GetLength () != rowBytes * height)
+				return false;
+
+			RGBList			newColors;
+			EmStreamChunk	pixMapColorsStream (pixMapColors);
+			::PrvReadColors (pixMapColorsStream, newColors);
+
+			newSkin.SetSize (EmPoint (width, height));
+			newSkin.SetFormat ((EmPixMapFormat) format);
+			newSkin.SetRowBytes (rowBytes);
+			newSkin.SetColorTable (newColors);
+
+			memcpy (newSkin.GetBits (), pixels.GetPointer (), pixels.GetLength ());
+		}
+
+		// Get the region and the color tables.  Look for the set of tables
+		// saved with the caller's key.  Entries that weren't computed when
+		// the cache entry was written are saved as empty tables.
+
+		Chunk	shape, colorSets;
+
+		if (!cacheFileData.ReadChunk (kRegionTag, shape) ||
+			!cacheFileData.ReadChunk (kColorSetsTag, colorSets))
+			return false;
+
+		EmStreamChunk	colorSetsStream (colorSets);
+		uint32			numSets;
+		vector<RGBList>	savedColors;
+
+		colorSetsStream >> numSets;
+
+		while (numSets--)
+		{
+			uint32	savedColorsKey;
+
+			::PrvReadColorSet (colorSetsStream, savedColorsKey, savedColors);
+
+			if (savedColorsKey == colorsKey)
+				break;
+
+			savedColors.clear ();
+		}
+
+		for (int ii = 0; ii < numColors; ++ii)
+		{
+			colors[ii].clear ();
+
+			if ((size_t) ii < savedColors.size ())
+				colors[ii] = savedColors[ii];
+		}
+
+		// Everything checks out; hand it all back.
+
+		if (skin)
+			*skin = newSkin;
+
+		region	= EmRegion ((const EmCoord*) shape.GetPointer (),
+							shape.GetLength () / sizeof (EmCoord));
+	}
+	catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWrite
+ *
+ * DESCRIPTION:	Common code for the EmSkinCache::Write functions.
+ *
+ * PARAMETERS:	key - the data the entry is keyed by.
+ *
+ *				skin - the decoded skin, or NULL if the entry is keyed
+ *					by the skin and shouldn't hold it.
+ *
+ *				Others as for EmSkinCache::Write.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWrite (const Chunk& key, const EmPixMap* skin, const EmRegion& region,
+			   const RGBList* colors, int numColors, uint32 colorsKey)
+{
+	try
+	{
+		// Build up the whole entry in memory, then write it out in one go.
+
+		Chunk			cacheData;
+		EmStreamChunk	cacheStream (cacheData);
+		ChunkFile		cacheFileData (cacheStream);
+
+		cacheFileData.WriteInt (kVersionTag, (uint32) kCacheVersion);
+		cacheFileData.WriteInt (kSourceSizeTag, (uint32) key.GetLength ());
+		cacheFileData.WriteInt (kSourceHashTag, ::PrvHash (key, 0x5A5A5A5A));
+
+		if (skin)
+		{
+			EmPoint	size		= skin->GetSize ();
+			int32	rowBytes	= skin->GetRowBytes ();
+
+			if (rowBytes <= 0 || size.fY <= 0)
+				return;
+
+			cacheFileData.WriteInt (kWidthTag, (int32) size.fX);
+			cacheFileData.WriteInt (kHeightTag, (int32) size.fY);
+			cacheFileData.WriteInt (kFormatTag, (int32) skin->GetFormat ());
+			cacheFileData.WriteInt (kRowBytesTag, rowBytes);
+
+			{
+				Chunk			pixMapColors;
+				EmStreamChunk	pixMapColorsStream (pixMapColors);
+
+				::PrvWriteColors (pixMapColorsStream, skin->GetColorTable ());
+				cacheFileData.WriteChunk (kPixMapColorsTag, pixMapColors);
+			}
+
+			cacheFileData.WriteChunk (kPixelsTag, rowBytes * size.fY, skin->GetBits ());
+		}
+
+		{
+			long	len = region.GetShape (NULL);
+			Chunk	shape (len * sizeof (EmCoord));
+
+			region.GetShape ((EmCoord*) shape.GetPointer ());
+			cacheFileData.WriteChunk (kRegionTag, shape);
+		}
+
+		{
+			// Save the caller's color tables, followed by any sets saved
+			// earlier with other keys.
+
+			Chunk			colorSets;
+			EmStreamChunk	colorSetsStream (colorSets);
+			uint32			numSets = 1;
+
+			colorSetsStream << numSets;
+			::PrvWriteColorSet (colorSetsStream, colorsKey, colors, numColors);
+
+			Chunk	oldData;
+
+			if (::PrvReadEntry (key, oldData))
+			{
+				EmStreamChunk	oldStream (oldData);
+				ChunkFile		oldFileData (oldStream);
+				Chunk			oldColorSets;
+
+				if (oldFileData.ReadChunk (kColorSetsTag, oldColorSets))
+				{
+					EmStreamChunk	oldColorSetsStream (oldColorSets);
+					uint32			numOldSets;
+
+					oldColorSetsStream >> numOldSets;
+
+					while (numOldSets--)
+					{
+						uint32			oldColorsKey;
+						vector<RGBList>	oldColors;
+
+						::PrvReadColorSet (oldColorSetsStream, oldColorsKey, oldColors);
+
+						if (oldColorsKey != colorsKey)
+						{
+							::PrvWriteColorSet (colorSetsStream, oldColorsKey,
+								oldColors.empty () ? NULL : &oldColors[0],
+								oldColors.size ());
+							++numSets;
+						}
+					}
+				}
+			}
+
+			colorSetsStream.SetMarker (0, kStreamFromStart);
+			colorSetsStream << numSets;
+
+			cacheFileData.WriteChunk (kColorSetsTag, colorSets);
+		}
+
+		::PrvWriteEntry (key, cacheData);
+	}
+	catch (...)
+	{
+		// The cache is only an optimization; if we can't write it, the
+		// skin will just be decoded again next time.
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReadEntry
+ *
+ * DESCRIPTION:	Read in the cache entry for the given key, and make
+ *				sure it's one we understand and was made from that key.
+ *
+ * PARAMETERS:	key - the data the entry is keyed by.
+ *
+ *				cacheData - receives the contents of the entry.
+ *
+ * RETURNED:	True if the entry was found and checks out.
+ *
+ ***********************************************************************/
+
+Bool PrvReadEntry (const Chunk& key, Chunk& cacheData)
+{
+	try
+	{
+		EmFileRef	cacheFile = ::PrvGetCacheFile (key);
+
+		if (!cacheFile.Exists ())
+			return false;
+
+		// Pull the whole entry in with one read, and pick it apart in memory.
+
+		{
+			EmStreamFile	fileStream (cacheFile, kOpenExistingForRead);	// Will throw if fnf
+
+			cacheData.SetLength (fileStream.GetLength ());
+			fileStream.GetBytes (cacheData.GetPointer (), cacheData.GetLength ());
+		}
+
+		EmStreamChunk	cacheStream (cacheData);
+		ChunkFile		cacheFileData (cacheStream);
+
+		// The file name already encodes one hash of the key; check its
+		// size and a second hash, too.
+
+		uint32	version, sourceSize, sourceHash;
+
+		if (!cacheFileData.ReadInt (kVersionTag, version) || version != kCacheVersion)
+			return false;
+
+		if (!cacheFileData.ReadInt (kSourceSizeTag, sourceSize) ||
+			sourceSize != (uint32) key.GetLength ())
+			return false;
+
+		if (!cacheFileData.ReadInt (kSourceHashTag, sourceHash) ||
+			sourceHash != ::PrvHash (key, 0x5A5A5A5A))
+			return false;
+	}
+	catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWriteEntry
+ *
+ * DESCRIPTION:	Write out the cache entry for the given key.  Another
+ *				emulator may be reading the entry, so the data is
+ *				written with EmFileRef::WriteSafely.  Old entries are
+ *				then pruned from the cache.
+ *
+ * PARAMETERS:	key - the data the entry is keyed by.
+ *
+ *				cacheData - the contents of the entry.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWriteEntry (const Chunk& key, const Chunk& cacheData)
+{
+	EmFileRef	cacheFile = ::PrvGetCacheFile (key);
+
+	cacheFile.WriteSafely (cacheData.GetPointer (), cacheData.GetLength ());
+
+	::PrvPruneCache ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvPruneCache
+ *
+ * DESCRIPTION:	Keep the cache from growing without bound by deleting
+ *				all but the kMaxCacheEntries most recently written
+ *				files.  This includes any temporary files left behind
+ *				by an emulator that quit before it could rename them.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvPruneCache (void)
+{
+	try
+	{
+		EmFileRefList	files;
+		::PrvGetCacheDir ().GetChildren (&files, NULL);
+
+		if (files.size () <= kMaxCacheEntries)
+			return;
+
+		vector<EmSkinCacheFileInfo>	infos;
+
+		EmFileRefList::iterator	iter = files.begin ();
+		while (iter != files.end ())
+		{
+			EmSkinCacheFileInfo	info;
+			uint32			size;
+
+			info.fRef = *iter;
+
+			if (iter->GetSizeAndModDate (&size, &info.fModDate) == 0)
+				infos.push_back (info);
+
+			++iter;
+		}
+
+		sort (infos.begin (), infos.end ());
+
+		while (infos.size () > kMaxCacheEntries)
+		{
+			infos.back ().fRef.Delete ();
+			infos.pop_back ();
+		}
+	}
+	catch (...)
+	{
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetPixMapKey
+ *
+ * DESCRIPTION:	Make the data that a cache entry for a decoded skin is
+ *				keyed by: its size, format, color table, and bits.
+ *
+ * PARAMETERS:	skin - the decoded skin.
+ *
+ *				key - receives the key data.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvGetPixMapKey (const EmPixMap& skin, Chunk& key)
+{
+	EmPoint			size		= skin.GetSize ();
+	int32			rowBytes	= skin.GetRowBytes ();
+	EmStreamChunk	keyStream (key);
+
+	keyStream << (int32) size.fX << (int32) size.fY;
+	keyStream << (int32) skin.GetFormat () << rowBytes;
+
+	::PrvWriteColors (keyStream, skin.GetColorTable ());
+
+	if (rowBytes > 0 && size.fY > 0)
+		keyStream.PutBytes (skin.GetBits (), rowBytes * size.fY);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvHash
+ *
+ * DESCRIPTION:	Compute a 32-bit FNV-1a hash over the given data.
+ *
+ * PARAMETERS:	data - data to hash.
+ *
+ *				seed - initial hash value.  Different seeds give
+ *					(practically) independent hashes of the same data.
+ *
+ * RETURNED:	The hash value.
+ *
+ ***********************************************************************/
+
+uint32 PrvHash (const Chunk& data, uint32 seed)
+{
+	const uint8*	p		= (const uint8*) data.GetPointer ();
+	long			len		= data.GetLength ();
+	uint32			hash	= 0x811C9DC5 ^ seed;
+
+	while (len--)
+	{
+		hash ^= *p++;
+		hash *= 0x01000193;
+	}
+
+	return hash;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetCacheDir
+ *
+ * DESCRIPTION:	Return the directory holding the cache entries.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The directory reference.  The directory may not exist.
+ *
+ ***********************************************************************/
+
+EmDirRef PrvGetCacheDir (void)
+{
+	return EmDirRef (EmDirRef::GetEmulatorDirectory (), "Skin Cache");
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetCacheFile
+ *
+ * DESCRIPTION:	Return the file holding the cache entry for the given
+ *				key.
+ *
+ * PARAMETERS:	key - the data the entry is keyed by.
+ *
+ * RETURNED:	The file reference.  The file may not exist.
+ *
+ ***********************************************************************/
+
+EmFileRef PrvGetCacheFile (const Chunk& key)
+{
+	char	name[32];
+	sprintf (name, "%08lX%08lX.dat",
+		(unsigned long) ::PrvHash (key, 0),
+		(unsigned long) key.GetLength ());
+
+	return EmFileRef (::PrvGetCacheDir (), name);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWriteColors, PrvReadColors
+ *
+ * DESCRIPTION:	Save and restore a color table as a count followed by
+ *				RGB triples.
+ *
+ * PARAMETERS:	s - stream to write to or read from.
+ *
+ *				colors - color table to save or restore.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWriteColors (EmStream& s, const RGBList& colors)
+{
+	s << (uint32) colors.size ();
+
+	RGBList::const_iterator	iter = colors.begin ();
+	while (iter != colors.end ())
+	{
+		s << iter->fRed << iter->fGreen << iter->fBlue;
+		++iter;
+	}
+}
+
+void PrvReadColors (EmStream& s, RGBList& colors)
+{
+	uint32	count;
+	s >> count;
+
+	colors.resize (count);
+
+	RGBList::iterator	iter = colors.begin ();
+	while (iter != colors.end ())
+	{
+		s >> iter->fRed >> iter->fGreen >> iter->fBlue;
+		++iter;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWriteColorSet, PrvReadColorSet
+ *
+ * DESCRIPTION:	Save and restore a set of color tables as the caller's
+ *				key, a count, and the tables.
+ *
+ * PARAMETERS:	s - stream to write to or read from.
+ *
+ *				colorsKey - caller-defined value the tables depend on.
+ *
+ *				colors, numColors - color tables to save or restore.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWriteColorSet (EmStream& s, uint32 colorsKey, const RGBList* colors, int numColors)
+{
+	s << colorsKey << (uint32) numColors;
+
+	for (int ii = 0; ii < numColors; ++ii)
+	{
+		::PrvWriteColors (s, colors[ii]);
+	}
+}
+
+void PrvReadColorSet (EmStream& s, uint32& colorsKey, vector<RGBList>& colors)
+{
+	uint32	numColors;
+	s >> colorsKey >> numColors;
+
+	colors.resize (numColors);
+
+	vector<RGBList>::iterator	iter = colors.begin ();
+	while (iter != colors.end ())
+	{
+		::PrvReadColors (s, *iter);
+		++iter;
+	}
+}
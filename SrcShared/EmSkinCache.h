@@ -0,0 +1,84 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmSkinCache_h
+#define EmSkinCache_h
+
+#include "EmStructs.h"		// RGBList
+
+class Chunk;
+class EmPixMap;
+class EmRegion;
+
+/*
+	EmSkinCache saves the results of decoding a skin so that they don't
+	have to be recreated every time a window is opened or the skin or
+	scale is changed.  Decoding the JPEG, building the outline region,
+	and quantizing the skin's colors are all expensive, especially for
+	the larger 2x skins.
+
+	Cache entries are keyed by the contents of the skin image, not by
+	its name or location, so editing a skin file (or switching to a new
+	one with the same name) automatically misses the cache.  Each entry
+	is a single ChunkFile in the "Skin Cache" subdirectory of the
+	emulator's directory, and is read in with a single read.  Entries
+	are written to a temporary file and renamed into place, so a reader
+	never sees a partly written one.  Only the most recently written
+	entries are kept; older ones are deleted as new ones are added.
+
+	Skins read from a skin file are keyed by their undecoded (JPEG)
+	image.  The built-in default skin has no such image, so its entry is
+	keyed by the decoded pixmap instead, and holds only the region and
+	colors.
+
+	The quantized colors depend on more than the skin image (for instance,
+	the preferences for dimming or tinting the skin), so the caller
+	supplies a key describing those.  An entry holds a set of colors for
+	each key it has been written with, and only the set matching the
+	caller's key is restored.
+
+	Any problems reading or writing the cache are silently ignored; the
+	caller just decodes the skin the slow way.
+*/
+
+class EmSkinCache
+{
+	public:
+		static Bool		Read		(	const Chunk& skinData,
+										EmPixMap& skin,
+										EmRegion& region,
+										RGBList* colors,
+										int numColors,
+										uint32 colorsKey );
+
+		static Bool		Read		(	const EmPixMap& skin,
+										EmRegion& region,
+										RGBList* colors,
+										int numColors,
+										uint32 colorsKey );
+
+		static void		Write		(	const Chunk& skinData,
+										const EmPixMap& skin,
+										const EmRegion& region,
+										const RGBList* colors,
+										int numColors,
+										uint32 colorsKey );
+
+		static void		Write		(	const EmPixMap& skin,
+										const EmRegion& region,
+										const RGBList* colors,
+										int numColors,
+										uint32 colorsKey );
+};
+
+#endif	/* EmSkinCache_h */
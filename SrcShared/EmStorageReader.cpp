@@ -0,0 +1,790 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmStorageReader.h"
+
+#include "Byteswapping.h"		// ByteswapWords
+#include "ChunkFile.h"			// ChunkFile
+#include "EmBankSRAM.h"			// gRAM_Memory, gRAMBank_Size
+#include "EmSession.h"			// gSession, EmSessionStopper
+#include "EmStreamFile.h"		// EmStreamFile
+#include "Platform.h"			// Platform::AllocateMemory
+#include "SessionFile.h"		// SessionFile
+
+#include <map>
+
+// On the original 68328, RAM starts here instead of at zero.  Low memory
+// is still at the start of the RAM image, but the pointers in it are
+// relative to this.
+
+static const emuptr		kRAMStart328 = 0x10000000;
+
+// A directory or record list that goes on longer than this is taken to
+// be corrupt (most likely it loops back on itself).
+
+static const int		kMaxListLinks = 256;
+
+typedef map<string, const EmStorageReader::DatabaseType*>					PrvDatabaseMap;
+typedef map<pair<UInt32, UInt32>, const EmStorageReader::DatabaseItemType*>	PrvItemMap;
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageImage::EmStorageImage
+// ---------------------------------------------------------------------------
+
+EmStorageImage::EmStorageImage (void) :
+	fImage (),
+	fSize (0)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageImage::~EmStorageImage
+// ---------------------------------------------------------------------------
+
+EmStorageImage::~EmStorageImage (void)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageImage::AcquireFromSession
+// ---------------------------------------------------------------------------
+// Take a copy of the running session's RAM.  The CPU has to be stopped
+// while we do that so that we don't catch the storage heap half-way
+// through being changed; if it can't be stopped, return false.
+
+Bool EmStorageImage::AcquireFromSession (void)
+{
+	if (!gSession || !gRAM_Memory)
+		return false;
+
+#if HAS_OMNI_THREAD
+	if (gSession->InCPUThread ())
+	{
+		fImage.Adopt ((char*) Platform::AllocateMemory (gRAMBank_Size));
+		memcpy (fImage.Get (), gRAM_Memory, gRAMBank_Size);
+	}
+	else
+#endif
+	{
+		EmSessionStopper	stopper (gSession, kStopNow);
+
+		if (!stopper.Stopped ())
+			return false;
+
+		fImage.Adopt ((char*) Platform::AllocateMemory (gRAMBank_Size));
+		memcpy (fImage.Get (), gRAM_Memory, gRAMBank_Size);
+	}
+
+	fSize = gRAMBank_Size;
+
+	::ByteswapWords (fImage.Get (), fSize);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageImage::AcquireFromFile
+// ---------------------------------------------------------------------------
+// Read the RAM image out of a saved session file.  It's already in the
+// byte order we want.
+
+Bool EmStorageImage::AcquireFromFile (const EmFileRef& ref)
+{
+	EmStreamFile	stream (ref, kOpenExistingForRead);
+	ChunkFile		chunkFile (stream);
+	SessionFile		sessionFile (chunkFile);
+
+	long	size = sessionFile.GetRAMImageSize ();
+
+	if (size == ChunkFile::kChunkNotFound)
+		return false;
+
+	fImage.Adopt ((char*) Platform::AllocateMemory (size));
+	fSize = size;
+
+	if (!sessionFile.ReadRAMImage (fImage.Get ()))
+	{
+		fImage.Dispose ();
+		fSize = 0;
+
+		return false;
+	}
+
+	return true;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 ChunkType::operator==
+// ---------------------------------------------------------------------------
+// Two chunks are the same if they hold the same bytes.  The chunks can be
+// in different snapshots, so don't compare the pointers.
+
+bool EmStorageReader::ChunkType::operator== (const ChunkType& other) const
+{
+	if ((fPtr == NULL) != (other.fPtr == NULL))
+		return false;
+
+	if (fSize != other.fSize)
+		return false;
+
+	return fSize == 0 || memcmp (fPtr, other.fPtr, fSize) == 0;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::EmStorageReader
+// ---------------------------------------------------------------------------
+
+EmStorageReader::EmStorageReader (const EmStorageImage& image) :
+	fPtr (image.GetPtr ()),
+	fSize (image.GetSize ()),
+	fCardBase (EmMemNULL),
+	fChunkHdrSize (0),
+	fDatabases ()
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::EmStorageReader
+// ---------------------------------------------------------------------------
+
+EmStorageReader::EmStorageReader (ptr_type image, size_t size) :
+	fPtr (image),
+	fSize (size),
+	fCardBase (EmMemNULL),
+	fChunkHdrSize (0),
+	fDatabases ()
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::~EmStorageReader
+// ---------------------------------------------------------------------------
+
+EmStorageReader::~EmStorageReader (void)
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::AcquireDatabases
+// ---------------------------------------------------------------------------
+// Find the RAM store through the card info in low memory, and read every
+// database in its database directory.  Returns false if the image doesn't
+// look like it holds an initialized storage heap.
+
+bool EmStorageReader::AcquireDatabases (void)
+{
+	fDatabases.clear ();
+
+	fCardBase		= EmMemNULL;
+	fChunkHdrSize	= 0;
+
+	if (fPtr == NULL || fSize < EmAliasLowMemHdrType<LAS>::GetSize ())
+		return false;
+
+	// Find the card info.  We don't know the card's base address yet,
+	// so allow for the 68328's RAM being somewhere other than at zero.
+
+	EmAliasLowMemHdrType<LAS>	lowMem (fPtr);
+	emuptr						cardInfoP = lowMem.globals.memCardInfoP;
+	UInt32						cardInfoSize = EmAliasCardInfoType<LAS>::GetSize ();
+
+	ptr_type	cardInfoPtr = this->GetHostPtr (cardInfoP, cardInfoSize);
+
+	if (!cardInfoPtr && cardInfoP >= kRAMStart328)
+		cardInfoPtr = this->GetHostPtr (cardInfoP - kRAMStart328, cardInfoSize);
+
+	if (!cardInfoPtr)
+		return false;
+
+	EmAliasCardInfoType<LAS>	cardInfo (cardInfoPtr);
+
+	fCardBase = cardInfo.baseP;
+
+	// Get the RAM store header.
+
+	ptr_type	storePtr = this->GetHostPtr (cardInfo.ramStoreP,
+								EmAliasStorageHeaderType<LAS>::GetSize ());
+
+	if (!storePtr)
+		return false;
+
+	EmAliasStorageHeaderType<LAS>	store (storePtr);
+
+	if (store.signature != sysStoreSignature)
+		return false;
+
+	// Look at the first heap to find out what version of the Memory
+	// Manager we're dealing with.  Version 1 heaps have 6-byte chunk
+	// headers; everything later has 8-byte ones.
+
+	ptr_type	heapListPtr = this->GetHostPtr (fCardBase + store.heapListOffset, 2 + 4);
+
+	if (!heapListPtr)
+		return false;
+
+	EmAliasUInt16<LAS>	numHeaps (heapListPtr);
+	EmAliasUInt32<LAS>	heapOffset (LAS::add (heapListPtr, 2));
+
+	if (numHeaps == 0)
+		return false;
+
+	ptr_type	heapPtr = this->GetHostPtr (fCardBase + heapOffset, 2);
+
+	if (!heapPtr)
+		return false;
+
+	EmAliasUInt16<LAS>	heapFlags (heapPtr);
+
+	fChunkHdrSize = (heapFlags & 0xE000) != 0
+					? EmAliasROMHeapChunkHdr2Type<LAS>::GetSize ()
+					: EmAliasROMHeapChunkHdr1Type<LAS>::GetSize ();
+
+	// Walk the database directory.
+
+	LocalID		dirID = store.databaseDirID;
+	int			links = 0;
+
+	while (dirID)
+	{
+		if (++links > kMaxListLinks)
+			return false;
+
+		ChunkType	dir = this->GetChunk (dirID);
+
+		if (!dir.GetPtr () || dir.Size () < EmAliasDatabaseDirType<LAS>::GetSize ())
+			return false;
+
+		EmAliasDatabaseDirType<LAS>	dirHdr (dir.GetPtr ());
+		UInt16						numDatabases = dirHdr.numDatabases;
+		UInt32						entrySize = EmAliasDatabaseDirEntryType<LAS>::GetSize ();
+
+		if (dir.Size () < EmAliasDatabaseDirType<LAS>::GetSize () + numDatabases * entrySize)
+			return false;
+
+		for (UInt16 ii = 0; ii < numDatabases; ++ii)
+		{
+			EmAliasDatabaseDirEntryType<LAS>	entry (dirHdr.databaseID[ii]);
+			ChunkType							hdr = this->GetChunk (entry.baseID);
+
+			if (hdr.GetPtr ())
+			{
+				this->AcquireDatabase (hdr);
+			}
+		}
+
+		dirID = dirHdr.nextDatabaseListID;
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::FindDatabase
+// ---------------------------------------------------------------------------
+
+const EmStorageReader::DatabaseType* EmStorageReader::FindDatabase (const char* name) const
+{
+	DatabaseList::const_iterator	iter = fDatabases.begin ();
+
+	while (iter != fDatabases.end ())
+	{
+		if (iter->fName == name)
+			return &*iter;
+
+		++iter;
+	}
+
+	return NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::ExportDatabase
+// ---------------------------------------------------------------------------
+// Write the database to the stream as a .prc or .pdb file.  The layout is
+// the same as the one SavePalmFile produces through the Data Manager,
+// except that the header has the database's real unique ID seed (the Data
+// Manager doesn't report it, so that path writes zero).  Keeping the seed
+// stops a re-imported database from handing out IDs its records already use.
+
+void EmStorageReader::ExportDatabase (const DatabaseType& db, EmStream& stream) const
+{
+	const int	kGapSize	= 2;
+	Bool		resources	= db.IsResources ();
+	size_t		numItems	= db.fItems.size ();
+	UInt32		entrySize	= resources
+							? EmAliasRsrcEntryType<LAS>::GetSize ()
+							: EmAliasRecordEntryType<LAS>::GetSize ();
+	UInt32		size		= EmAliasDatabaseHdrType<LAS>::GetSize () + numItems * entrySize + kGapSize;
+
+	StMemory	outP (size, true);
+
+	// Fill in the header.
+
+	EmAliasDatabaseHdrType<LAS>	hdr (outP.Get ());
+
+	strncpy ((char*) hdr.name.GetPtr (), db.fName.c_str (), dmDBNameLength - 1);
+	hdr.attributes			= db.fAttributes;
+	hdr.version				= db.fVersion;
+	hdr.creationDate		= db.fCreationDate;
+	hdr.modificationDate	= db.fModificationDate;
+	hdr.lastBackupDate		= db.fLastBackupDate;
+	hdr.modificationNumber	= db.fModificationNumber;
+	hdr.appInfoID			= 0;
+	hdr.sortInfoID			= 0;
+	hdr.type				= db.fType;
+	hdr.creator				= db.fCreator;
+	hdr.uniqueIDSeed		= db.fUniqueIDSeed;
+
+	hdr.recordList.nextRecordListID	= 0;
+	hdr.recordList.numRecords		= numItems;
+
+	// The app info and sort info blocks come right after the header,
+	// followed by the records or resources.
+
+	UInt32		offset = size;
+
+	if (db.fAppInfo.GetPtr ())
+	{
+		hdr.appInfoID = offset;
+		offset += db.fAppInfo.Size ();
+	}
+
+	if (db.fSortInfo.GetPtr ())
+	{
+		hdr.sortInfoID = offset;
+		offset += db.fSortInfo.Size ();
+	}
+
+	for (size_t ii = 0; ii < numItems; ++ii)
+	{
+		const DatabaseItemType&	item = db.fItems[ii];
+
+		if (resources)
+		{
+			EmAliasRsrcEntryType<LAS>	entry (hdr.recordList.resources[ii]);
+
+			entry.type			= item.fType;
+			entry.id			= item.fID;
+			entry.localChunkID	= offset;
+		}
+		else
+		{
+			EmAliasRecordEntryType<LAS>	entry (hdr.recordList.records[ii]);
+
+			entry.localChunkID	= offset;
+			entry.attributes	= item.fAttributes;
+			entry.uniqueID[0]	= (item.fUniqueID >> 16) & 0x00FF;
+			entry.uniqueID[1]	= (item.fUniqueID >> 8) & 0x00FF;
+			entry.uniqueID[2]	= item.fUniqueID & 0x00FF;
+		}
+
+		if (item.fHasChunk)
+			offset += item.fChunk.Size ();
+	}
+
+	stream.PutBytes (outP.Get (), size);
+
+	if (db.fAppInfo.Size ())
+		stream.PutBytes (db.fAppInfo.GetPtr (), db.fAppInfo.Size ());
+
+	if (db.fSortInfo.Size ())
+		stream.PutBytes (db.fSortInfo.GetPtr (), db.fSortInfo.Size ());
+
+	for (size_t jj = 0; jj < numItems; ++jj)
+	{
+		const DatabaseItemType&	item = db.fItems[jj];
+
+		if (item.fHasChunk && item.fChunk.Size ())
+			stream.PutBytes (item.fChunk.GetPtr (), item.fChunk.Size ());
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvMapDatabases
+// ---------------------------------------------------------------------------
+
+static void PrvMapDatabases (const EmStorageReader::DatabaseList& databases, PrvDatabaseMap& result)
+{
+	EmStorageReader::DatabaseList::const_iterator	iter = databases.begin ();
+
+	while (iter != databases.end ())
+	{
+		result[iter->fName] = &*iter;
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvMapItems
+// ---------------------------------------------------------------------------
+
+static void PrvMapItems (const EmStorageReader::DatabaseType& db, PrvItemMap& result)
+{
+	EmStorageReader::DatabaseItemList::const_iterator	iter = db.fItems.begin ();
+
+	while (iter != db.fItems.end ())
+	{
+		if (db.IsResources ())
+			result[make_pair (iter->fType, (UInt32) iter->fID)] = &*iter;
+		else
+			result[make_pair ((UInt32) 0, iter->fUniqueID)] = &*iter;
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvItemsDiffer
+// ---------------------------------------------------------------------------
+
+static Bool PrvItemsDiffer (const EmStorageReader::DatabaseItemType& a,
+							const EmStorageReader::DatabaseItemType& b)
+{
+	return	a.fAttributes != b.fAttributes ||
+			a.fHasChunk != b.fHasChunk ||
+			a.fChunk != b.fChunk;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHeadersDiffer
+// ---------------------------------------------------------------------------
+
+static Bool PrvHeadersDiffer (const EmStorageReader::DatabaseType& a,
+							  const EmStorageReader::DatabaseType& b)
+{
+	return	a.fAttributes != b.fAttributes ||
+			a.fVersion != b.fVersion ||
+			a.fCreationDate != b.fCreationDate ||
+			a.fModificationDate != b.fModificationDate ||
+			a.fLastBackupDate != b.fLastBackupDate ||
+			a.fModificationNumber != b.fModificationNumber ||
+			a.fType != b.fType ||
+			a.fCreator != b.fCreator ||
+			a.fUniqueIDSeed != b.fUniqueIDSeed;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::Diff
+// ---------------------------------------------------------------------------
+// Compare the databases in two snapshots of the storage heap, adding a
+// line to "differences" for each database that was added, removed, or
+// changed.  Records are matched up by unique ID, and resources by type
+// and ID.
+
+void EmStorageReader::Diff (const EmStorageReader& oldStore,
+							const EmStorageReader& newStore,
+							StringList& differences)
+{
+	PrvDatabaseMap	oldDatabases;
+	PrvDatabaseMap	newDatabases;
+
+	::PrvMapDatabases (oldStore.fDatabases, oldDatabases);
+	::PrvMapDatabases (newStore.fDatabases, newDatabases);
+
+	PrvDatabaseMap::iterator	iter;
+
+	for (iter = oldDatabases.begin (); iter != oldDatabases.end (); ++iter)
+	{
+		if (newDatabases.find (iter->first) == newDatabases.end ())
+			differences.push_back ("- " + iter->first);
+	}
+
+	for (iter = newDatabases.begin (); iter != newDatabases.end (); ++iter)
+	{
+		PrvDatabaseMap::iterator	oldIter = oldDatabases.find (iter->first);
+
+		if (oldIter == oldDatabases.end ())
+		{
+			differences.push_back ("+ " + iter->first);
+			continue;
+		}
+
+		const DatabaseType&	oldDB = *oldIter->second;
+		const DatabaseType&	newDB = *iter->second;
+
+		StringList	changes;
+
+		if (::PrvHeadersDiffer (oldDB, newDB))
+			changes.push_back ("header");
+
+		if (oldDB.fAppInfo != newDB.fAppInfo)
+			changes.push_back ("app info");
+
+		if (oldDB.fSortInfo != newDB.fSortInfo)
+			changes.push_back ("sort info");
+
+		PrvItemMap	oldItems;
+		PrvItemMap	newItems;
+
+		::PrvMapItems (oldDB, oldItems);
+		::PrvMapItems (newDB, newItems);
+
+		long	added = 0;
+		long	removed = 0;
+		long	changed = 0;
+
+		PrvItemMap::iterator	itemIter;
+
+		for (itemIter = oldItems.begin (); itemIter != oldItems.end (); ++itemIter)
+		{
+			if (newItems.find (itemIter->first) == newItems.end ())
+				++removed;
+		}
+
+		for (itemIter = newItems.begin (); itemIter != newItems.end (); ++itemIter)
+		{
+			PrvItemMap::iterator	oldItemIter = oldItems.find (itemIter->first);
+
+			if (oldItemIter == oldItems.end ())
+				++added;
+			else if (::PrvItemsDiffer (*oldItemIter->second, *itemIter->second))
+				++changed;
+		}
+
+		char	buffer[40];
+
+		if (added)
+		{
+			sprintf (buffer, "%ld added", added);
+			changes.push_back (buffer);
+		}
+
+		if (removed)
+		{
+			sprintf (buffer, "%ld removed", removed);
+			changes.push_back (buffer);
+		}
+
+		if (changed)
+		{
+			sprintf (buffer, "%ld changed", changed);
+			changes.push_back (buffer);
+		}
+
+		if (!changes.empty ())
+		{
+			string	line ("* " + iter->first + ": ");
+
+			for (StringList::iterator change = changes.begin (); change != changes.end (); ++change)
+			{
+				if (change != changes.begin ())
+					line += ", ";
+
+				line += *change;
+			}
+
+			differences.push_back (line);
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::GetHostPtr
+// ---------------------------------------------------------------------------
+// Return where the given range of emulated memory is in the image, or NULL
+// if it's not all in there.
+
+EmStorageReader::ptr_type EmStorageReader::GetHostPtr (emuptr p, UInt32 size) const
+{
+	UInt32	offset = p >= fCardBase ? p - fCardBase : p;
+
+	if (offset > fSize || size > fSize - offset)
+		return NULL;
+
+	return LAS::add (fPtr, offset);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::GetChunk
+// ---------------------------------------------------------------------------
+// Local/host version of MemLocalIDToPtr followed by MemPtrSize.  Returns
+// an empty ChunkType if the local ID doesn't lead to a chunk in the image.
+
+EmStorageReader::ChunkType EmStorageReader::GetChunk (LocalID local) const
+{
+	if (local == 0)
+		return ChunkType ();
+
+	emuptr	p = (local & 0xFFFFFFFE) + fCardBase;
+
+	// If it's a handle, dereference it.
+
+	if (local & 0x01)
+	{
+		ptr_type	masterPtr = this->GetHostPtr (p, 4);
+
+		if (!masterPtr)
+			return ChunkType ();
+
+		p = LAS::GetLong (masterPtr);
+	}
+
+	ptr_type	hdrPtr = this->GetHostPtr (p - fChunkHdrSize, fChunkHdrSize);
+
+	if (!hdrPtr)
+		return ChunkType ();
+
+	UInt32	totalSize;
+	UInt32	sizeAdj;
+
+	if (fChunkHdrSize == EmAliasROMHeapChunkHdr2Type<LAS>::GetSize ())
+	{
+		EmAliasROMHeapChunkHdr2Type<LAS>	chunkHdr (hdrPtr);
+		UInt32								long1 = chunkHdr.long1;
+
+		totalSize	= long1 & 0x00FFFFFFU;
+		sizeAdj		= (long1 >> 24) & 0x000F;
+	}
+	else
+	{
+		EmAliasROMHeapChunkHdr1Type<LAS>	chunkHdr (hdrPtr);
+
+		totalSize	= chunkHdr.size;
+		sizeAdj		= chunkHdr.flags & 0x0F;
+	}
+
+	if (totalSize < fChunkHdrSize + sizeAdj)
+		return ChunkType ();
+
+	UInt32		size	= totalSize - fChunkHdrSize - sizeAdj;
+	ptr_type	dataPtr	= this->GetHostPtr (p, size);
+
+	if (!dataPtr)
+		return ChunkType ();
+
+	return ChunkType (dataPtr, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmStorageReader::AcquireDatabase
+// ---------------------------------------------------------------------------
+// Read the database whose header is in the given chunk and add it to our
+// list.  Returns false if the header doesn't make sense.
+
+bool EmStorageReader::AcquireDatabase (const ChunkType& hdrChunk)
+{
+	if (hdrChunk.Size () < EmAliasDatabaseHdrType<LAS>::GetSize ())
+		return false;
+
+	EmAliasDatabaseHdrType<LAS>	hdr (hdrChunk.GetPtr ());
+	DatabaseType				db;
+
+	char	name[dmDBNameLength];
+	LAS::BlockCopy (name, hdr.name.GetPtr (), dmDBNameLength);
+	name[dmDBNameLength - 1] = '\0';
+
+	db.fName				= name;
+	db.fAttributes			= hdr.attributes;
+	db.fVersion				= hdr.version;
+	db.fCreationDate		= hdr.creationDate;
+	db.fModificationDate	= hdr.modificationDate;
+	db.fLastBackupDate		= hdr.lastBackupDate;
+	db.fModificationNumber	= hdr.modificationNumber;
+	db.fType				= hdr.type;
+	db.fCreator				= hdr.creator;
+	db.fUniqueIDSeed		= hdr.uniqueIDSeed;
+	db.fAppInfo				= this->GetChunk (hdr.appInfoID);
+	db.fSortInfo			= this->GetChunk (hdr.sortInfoID);
+
+	// Read the record list, following it into any continuation lists.
+
+	Bool		resources	= db.IsResources ();
+	UInt32		entrySize	= resources
+							? EmAliasRsrcEntryType<LAS>::GetSize ()
+							: EmAliasRecordEntryType<LAS>::GetSize ();
+	ptr_type	listPtr		= hdr.recordList.GetPtr ();
+	UInt32		listSize	= hdrChunk.Size () - (EmAliasDatabaseHdrType<LAS>::GetSize () -
+								EmAliasRecordListType<LAS>::GetSize ());
+
+	int			links		= 0;
+
+	while (listPtr)
+	{
+		if (++links > kMaxListLinks)
+			return false;
+
+		EmAliasRecordListType<LAS>	list (listPtr);
+		UInt16						numRecords = list.numRecords;
+
+		if (listSize < EmAliasRecordListType<LAS>::GetSize () + numRecords * entrySize)
+			return false;
+
+		for (UInt16 ii = 0; ii < numRecords; ++ii)
+		{
+			DatabaseItemType	item;
+			LocalID				chunkID;
+
+			if (resources)
+			{
+				EmAliasRsrcEntryType<LAS>	entry (list.resources[ii]);
+
+				item.fType			= entry.type;
+				item.fID			= entry.id;
+				item.fAttributes	= 0;
+				item.fUniqueID		= 0;
+				chunkID				= entry.localChunkID;
+			}
+			else
+			{
+				EmAliasRecordEntryType<LAS>	entry (list.records[ii]);
+
+				item.fType			= 0;
+				item.fID			= 0;
+				item.fAttributes	= entry.attributes;
+				item.fUniqueID		= (((UInt32) entry.uniqueID[0]) << 16) |
+									  (((UInt32) entry.uniqueID[1]) << 8) |
+									  ((UInt32) entry.uniqueID[2]);
+				chunkID				= entry.localChunkID;
+			}
+
+			item.fChunk		= this->GetChunk (chunkID);
+			item.fHasChunk	= item.fChunk.GetPtr () != NULL;
+
+			db.fItems.push_back (item);
+		}
+
+		LocalID		nextID = list.nextRecordListID;
+		ChunkType	next = this->GetChunk (nextID);
+
+		listPtr		= next.GetPtr ();
+		listSize	= next.Size ();
+	}
+
+	fDatabases.push_back (db);
+
+	return true;
+}
@@ -0,0 +1,150 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmStorageReader_h
+#define EmStorageReader_h
+
+/*
+	This file defines EmStorageReader, a class used to parse up the RAM
+	storage heap in a copy of the emulated RAM and return information
+	about the databases in it.  It's the RAM counterpart of EmROMReader.
+
+	Because it works on a copy of RAM rather than through the Data
+	Manager, it can export databases and compare two snapshots of the
+	storage heap without calling into the ROM.  That makes it quick, and
+	it means that it works on sessions that aren't running at all (such
+	as ones saved to disk).
+
+	The copy of RAM is held by an EmStorageImage.  It's in the same byte
+	order as a RAM image in a session file (that is, big-endian), so that
+	EmStorageReader can use the LAS accessors on it.
+*/
+
+#include "EmPalmStructs.h"		// LAS
+#include "EmStructs.h"			// StringList
+#include "Miscellaneous.h"		// StMemory
+
+#include <vector>
+#include <string>
+
+class EmFileRef;
+class EmStream;
+
+class EmStorageImage
+{
+	public:
+								EmStorageImage		(void);
+								~EmStorageImage		(void);
+
+		Bool					AcquireFromSession	(void);
+		Bool					AcquireFromFile		(const EmFileRef&);
+
+		void*					GetPtr				(void) const	{ return fImage.Get (); }
+		size_t					GetSize				(void) const	{ return fSize; }
+
+	private:
+		StMemory				fImage;
+		size_t					fSize;
+};
+
+
+class EmStorageReader
+{
+	public:
+		typedef LAS::ptr_type ptr_type;
+
+		class ChunkType
+		{
+			public:
+								ChunkType	(void) : fPtr (NULL), fSize (0) {}
+								ChunkType	(ptr_type p, UInt32 size) : fPtr (p), fSize (size) {}
+
+				ptr_type		GetPtr		(void) const	{ return fPtr; }
+				UInt32			Size		(void) const	{ return fSize; }
+
+				bool			operator==	(const ChunkType&) const;
+				bool			operator!=	(const ChunkType& other) const
+												{ return !(*this == other); }
+
+			private:
+				ptr_type		fPtr;
+				UInt32			fSize;
+		};
+
+		struct DatabaseItemType
+		{
+			UInt32				fType;			// Resources only
+			UInt16				fID;			// Resources only
+			UInt8				fAttributes;	// Records only
+			UInt32				fUniqueID;		// Records only
+			Bool				fHasChunk;
+			ChunkType			fChunk;
+		};
+
+		typedef vector<DatabaseItemType>	DatabaseItemList;
+
+		struct DatabaseType
+		{
+			string				fName;
+			UInt16				fAttributes;
+			UInt16				fVersion;
+			UInt32				fCreationDate;
+			UInt32				fModificationDate;
+			UInt32				fLastBackupDate;
+			UInt32				fModificationNumber;
+			UInt32				fType;
+			UInt32				fCreator;
+			UInt32				fUniqueIDSeed;
+			ChunkType			fAppInfo;
+			ChunkType			fSortInfo;
+			DatabaseItemList	fItems;
+
+			Bool				IsResources (void) const
+									{ return (fAttributes & dmHdrAttrResDB) != 0; }
+		};
+
+		typedef vector<DatabaseType>	DatabaseList;
+
+	public:
+								EmStorageReader		(const EmStorageImage&);
+								EmStorageReader		(ptr_type image, size_t size);
+								~EmStorageReader	(void);
+
+		bool					AcquireDatabases	(void);
+
+		DatabaseList&			Databases			(void)	{ return fDatabases; }
+		const DatabaseType*		FindDatabase		(const char* name) const;
+
+		void					ExportDatabase		(const DatabaseType&, EmStream&) const;
+
+		static void				Diff				(const EmStorageReader& oldStore,
+													 const EmStorageReader& newStore,
+													 StringList& differences);
+
+	private:
+		ptr_type				GetHostPtr			(emuptr, UInt32 size) const;
+		ChunkType				GetChunk			(LocalID) const;
+
+		bool					AcquireDatabase		(const ChunkType& hdr);
+
+	private:
+		ptr_type				fPtr;
+		size_t					fSize;
+
+		emuptr					fCardBase;
+		int						fChunkHdrSize;
+
+		DatabaseList			fDatabases;
+};
+
+#endif	// EmStorageReader_h
@@ -408,9 +408,10 @@ EmTransportDescriptor::EmTransportDescriptor (const string& s) :
 
 			fDescriptor = this->GetSchemePrefix (kTransportNull) + ":";
 		}
-		else if (s[0] == '/')
+		else if (s[0] == '/' || s == "pty" || s.find ("pty:") == 0)
 		{
-			// It looks like a device name -- turn into a Serial descriptor.
+			// It looks like a device name or a request for a pseudo-
+			// terminal -- turn into a Serial descriptor.
 
 			fDescriptor = this->GetSchemePrefix (kTransportSerial) + ":" + fDescriptor;
 		}
@@ -21,14 +21,17 @@
 #include "EmRegion.h"			// EmRegion
 #include "EmScreen.h"			// EmScreenUpdateInfo
 #include "EmSession.h"			// PostPenEvent, PostButtonEvent, etc.
+#include "EmSkinCache.h"		// EmSkinCache
 #include "EmStream.h"			// delete imageStream
 #include "Platform.h"			// Platform::PinToScreen
 
 #ifdef SONY_ROM
 #include "ROMStubs.h"
+#include "SonyShared/Platform_ExpMgrLib.h"
+#if PLATFORM_WINDOWS
 #include "EmWindowWin.h"
-#include "SonyWin/Platform_ExpMgrLib.h"
 #include "SonyWin/SonyButtonProc.h"
+#endif
 #include "SonyShared/SonyChars.h"
 extern	ScaleType		gCurrentScale;
 #endif //SONY_ROM
@@ -180,28 +183,55 @@ void EmWindow::WindowReset (void)
 
 	::SkinSetSkin ();
 
-	// Get the specified skin, or the default skin if the specified
-	// one cannot be found.
+	// Get the image data for the specified skin.  If we've decoded it
+	// before, get the skin, its region, and any colors computed for it
+	// from the skin cache.
+
+	Bool	haveSkinData = this->GetSkinData (fSkinData);
+	Bool	haveRegion = false;
 
-	if (!this->GetSkin (fSkinBase))
+	if (haveSkinData &&
+		EmSkinCache::Read (fSkinData, fSkinBase, fSkinRegion,
+			fSkinColors, countof (fSkinColors), this->GetSkinColorsKey ()))
+	{
+		haveRegion = true;
+	}
+
+	// Otherwise, get the specified skin, or the default skin if the
+	// specified one cannot be found.  The default skin has no image
+	// data, but its region and colors can still be cached.
+
+	else if (!this->GetSkin (fSkinBase))
 	{
 		this->GetDefaultSkin (fSkinBase);
+
+		fSkinData.SetLength (0);
+
+		haveRegion = EmSkinCache::Read (fSkinBase, fSkinRegion,
+			fSkinColors, countof (fSkinColors), this->GetSkinColorsKey ());
 	}
 
-	// Create a one-bpp mask of the skin.
+	if (!haveRegion)
+	{
+		// Create a one-bpp mask of the skin.
 
-	EmPixMap	mask;
-	fSkinBase.CreateMask (mask);
+		EmPixMap	mask;
+		fSkinBase.CreateMask (mask);
 
-	// Convert it to a region.
+		// Convert it to a region.
 
-	fSkinRegion = mask.CreateRegion ();
+		fSkinRegion = mask.CreateRegion ();
 
-	// Clear our color caches.  They'll get filled again on demand.
+		// Clear our color caches.  They'll get filled again on demand.
 
-	for (int ii = 0; ii < (long) countof (fSkinColors); ++ii)
-	{
-		fSkinColors[ii].clear ();
+		for (int ii = 0; ii < (long) countof (fSkinColors); ++ii)
+		{
+			fSkinColors[ii].clear ();
+		}
+
+		// Remember all this for next time.
+
+		this->WriteSkinCache ();
 	}
 
 	// Clear the image of the skin, altered for its mode.  This image
@@ -232,7 +262,7 @@ void EmWindow::HandlePenEvent (const EmPoint& where, Bool down)
 
 	SkinElementType	what;
 
-#ifdef SONY_ROM
+#if defined (SONY_ROM) && PLATFORM_WINDOWS
 
 #ifdef SONY_ROM
 	if ( gSession->GetDevice().GetDeviceType() == kDeviceYSX1230
@@ -415,6 +445,23 @@ void EmWindow::HandleGremlinMode (Bool gremlinMode)
 }
 
 
+class EmVibrateOnCommand : public EmSessionCommand
+{
+	public:
+								EmVibrateOnCommand	(void) :
+									fVibrateOn (false)
+								{
+								}
+
+		virtual void			Do					(void)
+								{
+									fVibrateOn = EmHAL::GetVibrateOn ();
+								}
+
+		Bool					fVibrateOn;
+};
+
+
 // ---------------------------------------------------------------------------
 //		 EmWindow::HandleIdle
 // ---------------------------------------------------------------------------
@@ -457,16 +504,17 @@ void EmWindow::HandleIdle (void)
 	this->HostDrawingEnd ();
 
 
-	// Do the Wiggle Walk.
+	// Do the Wiggle Walk.  All we need from the CPU side is the state of
+	// the vibrator, so ask for it through the command mailbox.
 
 	{
 		const int	kWiggleOffset = 2;
 
-		EmSessionStopper	stopper (gSession, kStopNow);
+		EmVibrateOnCommand	command;
 
-		if (stopper.Stopped ())
+		if (gSession->RunCommand (command))
 		{
-			if (EmHAL::GetVibrateOn ())
+			if (command.fVibrateOn)
 			{
 				if (!fWiggled)
 				{
@@ -500,14 +548,7 @@ void EmWindow::HandleIdle (void)
 
 void EmWindow::GetLCDContents (EmScreenUpdateInfo& info)
 {
-	EmSessionStopper	stopper (gSession, kStopNow);
-
-	if (stopper.Stopped ())
-	{
-		EmScreen::InvalidateAll ();
-		EmScreen::GetBits (info);
-		EmScreen::InvalidateAll ();
-	}
+	EmScreen::GetAllBits (info);
 }
 
 
@@ -968,20 +1009,21 @@ EmRect EmWindow::GetLEDBounds (void)
 
 
 // ---------------------------------------------------------------------------
-//		 EmWindow::GetSkin
+//		 EmWindow::GetSkinData
 // ---------------------------------------------------------------------------
-// Get the currently selected skin as a PixMap.
+// Get the currently selected skin's (JPEG) image data.
 
-Bool EmWindow::GetSkin (EmPixMap& pixMap)
+Bool EmWindow::GetSkinData (Chunk& skinData)
 {
+	skinData.SetLength (0);
+
 	EmStream*	imageStream = ::SkinGetSkinStream ();
 
 	if (!imageStream)
 		return false;
 
-	// Turn the JPEG image into BMP format.
-
-	::JPEGToPixMap (*imageStream, pixMap);
+	skinData.SetLength (imageStream->GetLength ());
+	imageStream->GetBytes (skinData.GetPointer (), skinData.GetLength ());
 
 	// Free up the resource info.
 
@@ -992,6 +1034,27 @@ Bool EmWindow::GetSkin (EmPixMap& pixMap)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmWindow::GetSkin
+// ---------------------------------------------------------------------------
+// Get the currently selected skin as a PixMap.  The image data must
+// already have been read by GetSkinData.
+
+Bool EmWindow::GetSkin (EmPixMap& pixMap)
+{
+	if (fSkinData.GetLength () == 0)
+		return false;
+
+	// Turn the JPEG image into BMP format.
+
+	EmStreamChunk	imageStream (fSkinData);
+
+	::JPEGToPixMap (imageStream, pixMap);
+
+	return true;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmWindow::GetDefaultSkin
 // ---------------------------------------------------------------------------
@@ -1007,6 +1070,47 @@ void EmWindow::GetDefaultSkin (EmPixMap& pixMap)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmWindow::GetSkinColorsKey
+// ---------------------------------------------------------------------------
+// Return a value describing the preferences that GetCurrentSkin uses to
+// alter the skin.  The skin cache uses it to tell if previously computed
+// skin colors can be reused.
+
+uint32 EmWindow::GetSkinColorsKey (void)
+{
+	Preference<bool>	prefDimWhenInactive (kPrefKeyDimWhenInactive);
+	Preference<bool>	prefShowDebugMode (kPrefKeyShowDebugMode);
+	Preference<bool>	prefShowGremlinMode (kPrefKeyShowGremlinMode);
+
+	return	(*prefDimWhenInactive	? 0x0001 : 0) |
+			(*prefShowDebugMode		? 0x0002 : 0) |
+			(*prefShowGremlinMode	? 0x0004 : 0);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWindow::WriteSkinCache
+// ---------------------------------------------------------------------------
+// Save the current skin, its region, and its colors in the skin cache.  A
+// skin read from a skin file is keyed by its image data; the default skin
+// (which has none) is keyed by the skin itself.
+
+void EmWindow::WriteSkinCache (void)
+{
+	if (fSkinData.GetLength () > 0)
+	{
+		EmSkinCache::Write (fSkinData, fSkinBase, fSkinRegion,
+			fSkinColors, countof (fSkinColors), this->GetSkinColorsKey ());
+	}
+	else
+	{
+		EmSkinCache::Write (fSkinBase, fSkinRegion,
+			fSkinColors, countof (fSkinColors), this->GetSkinColorsKey ());
+	}
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -1204,6 +1308,10 @@ const RGBList& EmWindow::GetCurrentSkinColors (Bool polite)
 		const EmPixMap&	skin = this->GetCurrentSkin ();
 
 		this->QuantizeSkinColors (skin, result, polite);
+
+		// Update the skin cache so that we don't have to do this again.
+
+		this->WriteSkinCache ();
 	}
 
 	return result;
@@ -14,6 +14,7 @@
 #ifndef EmWindow_h
 #define EmWindow_h
 
+#include "ChunkFile.h"			// Chunk
 #include "EmPixMap.h"			// EmPixMap
 #include "EmRegion.h"			// EmRegion
 #include "EmStructs.h"			// RGBList
@@ -90,8 +91,11 @@ class EmWindow
 		EmRect					GetLCDBounds		(void);
 		EmRect					GetLEDBounds		(void);
 
+		Bool					GetSkinData			(Chunk&);
 		Bool					GetSkin				(EmPixMap&);
 		void					GetDefaultSkin		(EmPixMap&);
+		uint32					GetSkinColorsKey	(void);
+		void					WriteSkinCache		(void);
 
 	protected:
 		void					PreDestroy			(void);
@@ -148,6 +152,7 @@ class EmWindow
 	private:
 		static EmWindow*		fgWindow;
 
+		Chunk					fSkinData;
 		EmPixMap				fSkinBase;
 		EmPixMap				fSkinCurrent;
 
@@ -24,7 +24,7 @@
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// Memory::InitializeBanks, IsPCInRAM (implicitly, through META_CHECK)
-#include "EmPalmFunction.h"		// InSysLaunch
+#include "EmPalmFunction.h"		// InSysLaunch, EmPalmFunctionMemoryChanged
 #include "EmPalmOS.h"			// EmPalmOS::GetBootStack
 #include "EmPatchState.h"		// META_CHECK calls EmPatchState::IsPCInMemMgr
 #include "EmScreen.h"			// EmScreen::MarkDirty
@@ -179,6 +179,15 @@ static inline void PrvScreenCheck (uint8* metaAddress, emuptr address, size_t si
 }
 
 
+static inline void PrvSymbolCheck (uint8* metaAddress, emuptr address, size_t size)
+{
+	if (MetaMemory::IsSymbolIndex (metaAddress, size))
+	{
+		::EmPalmFunctionMemoryChanged (address, size);
+	}
+}
+
+
 #pragma mark -
 
 // ===========================================================================
@@ -312,6 +321,21 @@ void EmBankDRAM::SetBankHandlers (void)
 	Memory::InitializeBanks (	gAddressBank,
 								EmMemBankIndex (kMemoryStart),
 								numBanks);
+
+	// Accesses past the end of the dynamic heap are passed on to EmBankSRAM,
+	// but they end up in the same place in gRAM_Memory, so the whole range
+	// can be accessed directly.  Writes can't, on the PEG-T400; see
+	// EmBankSRAM::SetBankHandlers.
+
+#ifdef SONY_ROM
+	Bool	writable = gSession->GetDevice().GetDeviceType() != kDevicePEGT400;
+#else
+	Bool	writable = true;
+#endif //SONY_ROM
+
+	Memory::InitializeFastBanks (	gAddressBank,
+									EmMemBankIndex (kMemoryStart),
+									numBanks, writable);
 }
 
 
@@ -464,6 +488,7 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 	}
 
 	::PrvScreenCheck (metaAddress, address, sizeof (uint32));
+	::PrvSymbolCheck (metaAddress, address, sizeof (uint32));
 
 #if (HAS_PROFILING)
 	CYCLE_PUTLONG (WAITSTATES_DRAM);
@@ -518,6 +543,7 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 	}
 
 	::PrvScreenCheck (metaAddress, address, sizeof (uint16));
+	::PrvSymbolCheck (metaAddress, address, sizeof (uint16));
 
 #if (HAS_PROFILING)
 	CYCLE_PUTWORD (WAITSTATES_DRAM);
@@ -585,6 +611,7 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 	}
 
 	::PrvScreenCheck (metaAddress, address, sizeof (uint8));
+	::PrvSymbolCheck (metaAddress, address, sizeof (uint8));
 
 #if (HAS_PROFILING)
 	CYCLE_PUTBYTE (WAITSTATES_DRAM);
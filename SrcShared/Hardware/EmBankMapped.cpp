@@ -18,7 +18,7 @@
 #include "EmMemory.h"			// Memory::InitializeBanks
 #include "Profiling.h"			// WAITSTATES_DUMMYBANK
 
-#include <vector>
+#include <map>
 
 
 // ===========================================================================
@@ -43,7 +43,7 @@ static EmAddressBank	gAddressBank =
 
 struct MapRange
 {
-	Bool		Contains (const void* addr)
+	Bool		Contains (const void* addr) const
 	{
 		const char*	begin = (const char*) this->realAddress;
 		const char*	end = begin + this->size;
@@ -51,7 +51,7 @@ struct MapRange
 		return ((addr >= begin) && (addr < end));
 	}
 
-	Bool		Contains (emuptr addr)
+	Bool		Contains (emuptr addr) const
 	{
 		emuptr	begin = this->mappedAddress;
 		emuptr	end = begin + this->size;
@@ -62,11 +62,33 @@ struct MapRange
 	const void*	realAddress;		// Address in host's space
 	emuptr		mappedAddress;		// Address that emulated code sees
 	uint32		size;
+	Bool		readOnly;			// Writes from emulated code are bus errors
 };
-typedef vector<MapRange>		MapRangeList;
+
+// Mapped ranges are kept in a map keyed on the address emulated code sees,
+// with a second index keyed on the host address, so that translating in
+// either direction is a tree lookup instead of a walk over every range.
+// Unused parts of our address window are tracked in two more indexes: by
+// address (so that neighbors can be merged when a range is unmapped) and
+// by size (so that we can quickly find a hole big enough for a new range).
+
+typedef map<emuptr, MapRange>			MapRangeList;
+typedef multimap<const char*, emuptr>	RealAddressList;
+typedef map<emuptr, uint32>				FreeByAddressList;
+typedef multimap<uint32, emuptr>		FreeBySizeList;
 
 static MapRangeList				gMappedRanges;
-static MapRangeList::iterator	gLastIter;
+static RealAddressList			gRealAddresses;
+static FreeByAddressList		gFreeByAddress;
+static FreeBySizeList			gFreeBySize;
+
+// A few recently used ranges are checked before going to the trees.
+// EmSubroutine calls, for instance, bounce between a mapped stack and a
+// mapped parameter block.
+
+const int						kLookasideSize	= 4;
+static MapRangeList::iterator	gLookaside[kLookasideSize];
+static int						gLookasideNext;
 
 // Map in blocks starting at this address.  I used to have it way out of
 // the way at 0x60000000.  However, there's a check in SysGetAppInfo to
@@ -87,6 +109,10 @@ const int32						kMemorySize		= kMemoryFinish - kMemoryStart;	// 80MB
 static MapRangeList::iterator	PrvGetMappingInfo (const void* addr);
 static MapRangeList::iterator	PrvGetMappingInfo (emuptr addr);
 static emuptr					PrvEnsureAligned (emuptr candidate, const void* addr);
+static void						PrvResetFreeSpace (void);
+static void						PrvAddFreeSpace (emuptr start, uint32 size);
+static void						PrvRemoveFreeSpace (FreeByAddressList::iterator iter);
+static void						PrvRememberRange (MapRangeList::iterator iter);
 static void						PrvInvalidateCache (void);
 static void						PrvCheckRanges (void);
 
@@ -109,6 +135,8 @@ static void						PrvCheckRanges (void);
 void EmBankMapped::Initialize (void)
 {
 	gMappedRanges.clear ();
+	gRealAddresses.clear ();
+	::PrvResetFreeSpace ();
 	::PrvInvalidateCache ();
 }
 
@@ -208,6 +236,8 @@ void EmBankMapped::Load (SessionFile&)
 void EmBankMapped::Dispose (void)
 {
 	gMappedRanges.clear ();
+	gRealAddresses.clear ();
+	::PrvResetFreeSpace ();
 	::PrvInvalidateCache ();
 }
 
@@ -319,7 +349,7 @@ void EmBankMapped::SetLong (emuptr address, uint32 value)
 	CYCLE_PUTLONG (WAITSTATES_DUMMYBANK);
 #endif
 
-	uint8*	p = GetRealAddress (address);
+	uint8*	p = GetWritableAddress (address, sizeof (uint32));
 
 	if (p == NULL)
 	{
@@ -348,7 +378,7 @@ void EmBankMapped::SetWord (emuptr address, uint32 value)
 	CYCLE_PUTWORD (WAITSTATES_DUMMYBANK);
 #endif
 
-	uint8*	p = GetRealAddress (address);
+	uint8*	p = GetWritableAddress (address, sizeof (uint16));
 
 	if (p == NULL)
 	{
@@ -370,7 +400,7 @@ void EmBankMapped::SetByte (emuptr address, uint32 value)
 	CYCLE_PUTBYTE (WAITSTATES_DUMMYBANK);
 #endif
 
-	uint8*	p = GetRealAddress (address);
+	uint8*	p = GetWritableAddress (address, sizeof (uint8));
 
 	if (p == NULL)
 	{
@@ -405,7 +435,30 @@ uint8* EmBankMapped::GetRealAddress (emuptr address)
 	if (iter == gMappedRanges.end ())
 		return NULL;
 
-	return ((uint8*) iter->realAddress) + (address - iter->mappedAddress);
+	return ((uint8*) iter->second.realAddress) + (address - iter->first);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBankMapped::GetWritableAddress
+// ---------------------------------------------------------------------------
+// Like GetRealAddress, but for the Set functions.  Ranges mapped read-only
+// (host files, for instance) raise a bus error instead.
+
+uint8* EmBankMapped::GetWritableAddress (emuptr address, long size)
+{
+	MapRangeList::iterator	iter = ::PrvGetMappingInfo (address);
+
+	if (iter == gMappedRanges.end ())
+		return NULL;
+
+	if (iter->second.readOnly)
+	{
+		InvalidAccess (address, size, false);
+		return NULL;
+	}
+
+	return ((uint8*) iter->second.realAddress) + (address - iter->first);
 }
 
 
@@ -437,7 +490,7 @@ emuptr EmBankMapped::GetEmulatedAddress (const void* address)
 		return EmMemNULL;
 	}
 
-	return iter->mappedAddress + ((char*) address - (char*) iter->realAddress);
+	return iter->first + ((char*) address - (char*) iter->second.realAddress);
 }
 
 
@@ -473,83 +526,91 @@ void EmBankMapped::InvalidAccess (emuptr address, long size, Bool forRead)
 
 
 // ---------------------------------------------------------------------------
-//		 EmBankMapped::MapPhysicalMemory
+//		 EmBankMapped::CanMapPhysicalMemory
 // ---------------------------------------------------------------------------
-// Maps a range of physical memory to appear at the same location of the
-// emulated Palm OS's virtual memory.
+// Returns whether a range of the given size would fit in what's left of the
+// area set aside for mapped ranges.  Callers that map ranges whose size is
+// out of their control (such as HostMapFile) check this first, as
+// MapPhysicalMemory treats running out of room as an internal error.
 
-void EmBankMapped::MapPhysicalMemory (const void* addr, uint32 size)
+Bool EmBankMapped::CanMapPhysicalMemory (uint32 size)
 {
-	if (addr == NULL)
-		return;
+	if (size == 0)
+		size = 1;
 
-	emuptr	candidate = ::PrvEnsureAligned (kMemoryStart, addr);
+	if (size > (uint32) kMemorySize)
+		return false;
 
-	// If the list is empty, add the item
+	if (gMappedRanges.empty ())
+		::PrvResetFreeSpace ();
 
-	if (gMappedRanges.size () == 0)
-	{
-		MapRange	range;
+	// Same test as in MapPhysicalMemory.
 
-		range.realAddress	= addr;
-		range.mappedAddress	= candidate;
-		range.size			= size;
+	return gFreeBySize.lower_bound (size + 3) != gFreeBySize.end ();
+}
 
-		gLastIter = gMappedRanges.insert (gMappedRanges.begin (), range);
-		::PrvCheckRanges ();
 
-//		::PrvInvalidateCache ();
+// ---------------------------------------------------------------------------
+//		 EmBankMapped::MapPhysicalMemory
+// ---------------------------------------------------------------------------
+// Maps a range of physical memory to appear at the same location of the
+// emulated Palm OS's virtual memory.  If readOnly is true, emulated code
+// gets a bus error if it tries to write to the range.
 
+void EmBankMapped::MapPhysicalMemory (const void* addr, uint32 size, Bool readOnly)
+{
+	if (addr == NULL)
 		return;
-	}
 
-	// Find an available space for the range.
+	// Zero-length ranges still need an address of their own so that
+	// they can be found again and unmapped.
 
-	MapRangeList::iterator	iter	= gMappedRanges.begin ();
+	if (size == 0)
+		size = 1;
 
-	while (iter != gMappedRanges.end ())
-	{
-		// If there's room in front of the current block...
+	if (gMappedRanges.empty ())
+		::PrvResetFreeSpace ();
 
-		if (iter->mappedAddress >= candidate + size)
-		{
-			// ...insert a map record in front of the current block.
+	// Find the smallest hole that's big enough, leaving enough slop
+	// for PrvEnsureAligned to bump the start by up to three bytes.
 
-			MapRange	range;
+	FreeBySizeList::iterator	hole = gFreeBySize.lower_bound (size + 3);
 
-			range.realAddress	= addr;
-			range.mappedAddress	= candidate;
-			range.size			= size;
-
-			gLastIter = gMappedRanges.insert (iter, range);
-			::PrvCheckRanges ();
+	if (hole == gFreeBySize.end ())
+	{
+		// No room at the inn.  Anything past kMemoryFinish wouldn't
+		// be accessible through this bank anyway.
 
-//			::PrvInvalidateCache ();
+		EmAssert (false);
+		return;
+	}
 
-			return;
-		}
+	emuptr	holeStart	= hole->second;
+	uint32	holeSize	= hole->first;
+	emuptr	candidate	= ::PrvEnsureAligned (holeStart, addr);
 
-		// No room at the inn...move onto the next block.
+	::PrvRemoveFreeSpace (gFreeByAddress.find (holeStart));
 
-		candidate =  ::PrvEnsureAligned (iter->mappedAddress + iter->size, addr);
-		++iter;
-	}
+	// Give back whatever's left over on either side.
 
-	// Couldn't find room at the beginning or the middle of the list. Add to the end.
+	if (candidate > holeStart)
+		::PrvAddFreeSpace (holeStart, candidate - holeStart);
 
-	MapRangeList::iterator	last = gMappedRanges.end ();
-	iter = last - 1;
+	if (candidate + size < holeStart + holeSize)
+		::PrvAddFreeSpace (candidate + size, (holeStart + holeSize) - (candidate + size));
 
 	MapRange	range;
 
 	range.realAddress	= addr;
-	range.mappedAddress	= ::PrvEnsureAligned (iter->mappedAddress + iter->size, addr);
+	range.mappedAddress	= candidate;
 	range.size			= size;
+	range.readOnly		= readOnly;
 
-	gLastIter = gMappedRanges.insert (last, range);
-	::PrvCheckRanges ();
+	MapRangeList::iterator	iter = gMappedRanges.insert (MapRangeList::value_type (candidate, range)).first;
+	gRealAddresses.insert (RealAddressList::value_type ((const char*) addr, candidate));
 
-//	::PrvInvalidateCache ();
+	::PrvRememberRange (iter);
+	::PrvCheckRanges ();
 }
 
 
@@ -573,6 +634,22 @@ void EmBankMapped::UnmapPhysicalMemory (const void* addr)
 
 	if (iter != gMappedRanges.end ())
 	{
+		// Remove the range from the host address index.
+
+		RealAddressList::iterator	realIter = gRealAddresses.lower_bound ((const char*) iter->second.realAddress);
+
+		while (realIter != gRealAddresses.end () && realIter->second != iter->first)
+			++realIter;
+
+		EmAssert (realIter != gRealAddresses.end ());
+
+		if (realIter != gRealAddresses.end ())
+			gRealAddresses.erase (realIter);
+
+		// Return the emulated address range to the free space.
+
+		::PrvAddFreeSpace (iter->first, iter->second.size);
+
 		gMappedRanges.erase (iter);
 		::PrvCheckRanges ();
 
@@ -592,10 +669,10 @@ void EmBankMapped::GetMappingInfo	(emuptr addr, void** start, uint32* len)
 	if (iter != gMappedRanges.end ())
 	{
 		if (start)
-			*start = (void*) iter->realAddress;
+			*start = (void*) iter->second.realAddress;
 
 		if (len)
-			*len = iter->size;
+			*len = iter->second.size;
 	}
 	else
 	{
@@ -614,19 +691,31 @@ void EmBankMapped::GetMappingInfo	(emuptr addr, void** start, uint32* len)
 
 MapRangeList::iterator PrvGetMappingInfo (const void* addr)
 {
-	if (gLastIter != gMappedRanges.end () && gLastIter->Contains (addr))
-		return gLastIter;
+	int	ii;
 
-	MapRangeList::iterator	iter = gMappedRanges.begin ();
-	while (iter != gMappedRanges.end ())
+	for (ii = 0; ii < kLookasideSize; ++ii)
 	{
-		if (iter->Contains (addr))
-			break;
-
-		++iter;
+		if (gLookaside[ii] != gMappedRanges.end () && gLookaside[ii]->second.Contains (addr))
+			return gLookaside[ii];
 	}
 
-	gLastIter = iter;
+	// Find the last range starting at or before the given address.
+	// Ranges in host space don't overlap (see PrvCheckRanges), so
+	// that's the only one that can contain it.
+
+	RealAddressList::iterator	realIter = gRealAddresses.upper_bound ((const char*) addr);
+
+	if (realIter == gRealAddresses.begin ())
+		return gMappedRanges.end ();
+
+	--realIter;
+
+	MapRangeList::iterator	iter = gMappedRanges.find (realIter->second);
+
+	if (iter == gMappedRanges.end () || !iter->second.Contains (addr))
+		return gMappedRanges.end ();
+
+	::PrvRememberRange (iter);
 
 	return iter;
 }
@@ -634,19 +723,25 @@ MapRangeList::iterator PrvGetMappingInfo (const void* addr)
 
 MapRangeList::iterator PrvGetMappingInfo (emuptr addr)
 {
-	if (gLastIter != gMappedRanges.end () && gLastIter->Contains (addr))
-		return gLastIter;
+	int	ii;
 
-	MapRangeList::iterator	iter = gMappedRanges.begin ();
-	while (iter != gMappedRanges.end ())
+	for (ii = 0; ii < kLookasideSize; ++ii)
 	{
-		if (iter->Contains (addr))
-			break;
-
-		++iter;
+		if (gLookaside[ii] != gMappedRanges.end () && gLookaside[ii]->second.Contains (addr))
+			return gLookaside[ii];
 	}
 
-	gLastIter = iter;
+	MapRangeList::iterator	iter = gMappedRanges.upper_bound (addr);
+
+	if (iter == gMappedRanges.begin ())
+		return gMappedRanges.end ();
+
+	--iter;
+
+	if (!iter->second.Contains (addr))
+		return gMappedRanges.end ();
+
+	::PrvRememberRange (iter);
 
 	return iter;
 }
@@ -664,9 +759,75 @@ emuptr PrvEnsureAligned (emuptr candidate, const void* addr)
 	return candidate;
 }
 
+void PrvResetFreeSpace (void)
+{
+	gFreeByAddress.clear ();
+	gFreeBySize.clear ();
+
+	::PrvAddFreeSpace (kMemoryStart, kMemorySize);
+}
+
+void PrvAddFreeSpace (emuptr start, uint32 size)
+{
+	// Merge with the hole after this one, if they touch.
+
+	FreeByAddressList::iterator	next = gFreeByAddress.lower_bound (start);
+
+	if (next != gFreeByAddress.end () && next->first == start + size)
+	{
+		size += next->second;
+		::PrvRemoveFreeSpace (next);
+	}
+
+	// Merge with the hole before this one, if they touch.
+
+	FreeByAddressList::iterator	prev = gFreeByAddress.lower_bound (start);
+
+	if (prev != gFreeByAddress.begin ())
+	{
+		--prev;
+
+		if (prev->first + prev->second == start)
+		{
+			start = prev->first;
+			size += prev->second;
+			::PrvRemoveFreeSpace (prev);
+		}
+	}
+
+	gFreeByAddress.insert (FreeByAddressList::value_type (start, size));
+	gFreeBySize.insert (FreeBySizeList::value_type (size, start));
+}
+
+void PrvRemoveFreeSpace (FreeByAddressList::iterator iter)
+{
+	EmAssert (iter != gFreeByAddress.end ());
+
+	FreeBySizeList::iterator	sizeIter = gFreeBySize.lower_bound (iter->second);
+
+	while (sizeIter != gFreeBySize.end () && sizeIter->second != iter->first)
+		++sizeIter;
+
+	EmAssert (sizeIter != gFreeBySize.end ());
+
+	if (sizeIter != gFreeBySize.end ())
+		gFreeBySize.erase (sizeIter);
+
+	gFreeByAddress.erase (iter);
+}
+
+void PrvRememberRange (MapRangeList::iterator iter)
+{
+	gLookaside[gLookasideNext] = iter;
+	gLookasideNext = (gLookasideNext + 1) % kLookasideSize;
+}
+
 void PrvInvalidateCache (void)
 {
-	gLastIter = gMappedRanges.end ();
+	for (int ii = 0; ii < kLookasideSize; ++ii)
+		gLookaside[ii] = gMappedRanges.end ();
+
+	gLookasideNext = 0;
 }
 
 void PrvCheckRanges (void)
@@ -699,14 +860,16 @@ void PrvCheckRanges (void)
 	MapRangeList::iterator	outerIter = gMappedRanges.begin ();
 	while (outerIter != gMappedRanges.end ())
 	{
-		MapRangeList::iterator	innerIter = outerIter + 1;
+		MapRangeList::iterator	innerIter = outerIter;
+		++innerIter;
+
 		while (innerIter != gMappedRanges.end ())
 		{
-			char*	outerStart = (char*) outerIter->realAddress;
-			char*	innerStart = (char*) innerIter->realAddress;
+			char*	outerStart = (char*) outerIter->second.realAddress;
+			char*	innerStart = (char*) innerIter->second.realAddress;
 
-			char*	outerEnd = outerStart + outerIter->size;
-			char*	innerEnd = innerStart + innerIter->size;
+			char*	outerEnd = outerStart + outerIter->second.size;
+			char*	innerEnd = innerStart + innerIter->second.size;
 
 			if (innerEnd > outerStart && innerStart < outerEnd)
 			{
@@ -718,6 +881,8 @@ void PrvCheckRanges (void)
 
 		++outerIter;
 	}
+
+	EmAssert (gRealAddresses.size () == gMappedRanges.size ());
+	EmAssert (gFreeBySize.size () == gFreeByAddress.size ());
 #endif
 }
-
@@ -40,13 +40,15 @@ class EmBankMapped
 		static emuptr			GetEmulatedAddress	(const void* address);
 		static void				AddOpcodeCycles		(void);
 
-		static void				MapPhysicalMemory	(const void*, uint32);
+		static Bool				CanMapPhysicalMemory(uint32);
+		static void				MapPhysicalMemory	(const void*, uint32, Bool readOnly = false);
 		static void				UnmapPhysicalMemory	(const void*);
 
 		static void				GetMappingInfo		(emuptr addr, void** start, uint32* len);
 
 
 	private:
+		static uint8*			GetWritableAddress	(emuptr address, long size);
 		static void				AddressError		(emuptr address, long size, Bool forRead);
 		static void				InvalidAccess		(emuptr address, long size, Bool forRead);
 };
@@ -16,13 +16,16 @@
 
 #include "Byteswapping.h"		// ByteswapWords
 #include "EmCPU68K.h"			// gCPU68K
+#include "EmDirRef.h"			// EmDirRef
 #include "EmErrCodes.h"			// kError_UnsupportedROM
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// Memory::InitializeBanks, EmMem_memset
 #include "EmPalmStructs.h"		// EmProxyCardHeaderType
 #include "EmSession.h"			// GetDevice, ScheduleDeferredError
+#include "EmStreamFile.h"		// EmStreamFile
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Miscellaneous.h"		// StWordSwapper, NextPowerOf2
+#include "Platform.h"			// Platform::MapFile
 #include "Profiling.h"			// WAITSTATES_ROM
 #include "SessionFile.h"		// WriteROMFileReference
 #include "Strings.r.h"			// kStr_BadChecksum
@@ -30,6 +33,12 @@
 
 // Private function declarations
 
+static EmFileRef	PrvGetROMCacheFile		(EmStream& hROM, const EmProxyCardHeaderType& cardHeader);
+static EmFileRef	PrvGetROMCacheKeyFile	(EmStream& hROM, const EmProxyCardHeaderType& cardHeader);
+static string		PrvHashROMContents		(EmStream& hROM);
+static void			PrvHashBytes			(uint32& hash1, uint32& hash2, const void* p, int32 count);
+static void			PrvWriteROMCacheFile	(const EmFileRef& cacheFile, const void* image, uint32 size);
+
 
 class Card
 {
@@ -73,6 +82,7 @@ static uint32	gROMImage_Size;
 static uint32	gROMBank_Mask;
 static uint8*	gROM_Memory;
 static uint8*	gROM_MetaMemory;
+static Bool		gROM_Mapped;		// True if gROM_Memory came from Platform::MapFile
 
 
 /***********************************************************************
@@ -198,7 +208,17 @@ void EmBankROM::Load (SessionFile& f)
 
 void EmBankROM::Dispose (void)
 {
-	Platform::DisposeMemory (gROM_Memory);
+	if (gROM_Mapped)
+	{
+		Platform::UnmapFile (gROM_Memory, gROMImage_Size);
+		gROM_Memory = NULL;
+		gROM_Mapped = false;
+	}
+	else
+	{
+		Platform::DisposeMemory (gROM_Memory);
+	}
+
 	Platform::DisposeMemory (gROM_MetaMemory);
 }
 
@@ -233,6 +253,12 @@ void EmBankROM::SetBankHandlers (void)
 
 	Memory::InitializeBanks (	gROMAddressBank, first_bank,
 								last_bank - first_bank + 1);
+
+	// Reads can go straight to gROM_Memory.  Writes always need to be
+	// reported, so they go through SetLong, etc.
+
+	Memory::InitializeFastBanks (	gROMAddressBank, first_bank,
+									last_bank - first_bank + 1, false);
 }
 
 
@@ -697,46 +723,12 @@ void EmBankROM::LoadROM (EmStream& hROM)
 	gROMImage_Size	= hROM.GetLength() + bufferOffset;
 	gROMBank_Size	= ::NextPowerOf2 (gROMImage_Size);
 
-	// Read in the ROM image.
-
-	StMemory	romImage (gROMImage_Size);
-	StMemory	romMetaImage (gROMImage_Size);
-
-	hROM.SetMarker (0, kStreamFromStart);
-	hROM.GetBytes (romImage.Get () + bufferOffset, hROM.GetLength());
-	
-	
-
-	// See if the big ROM checksum looks OK.
-
-	Card::CheckChecksum (romImage.Get () + bigROMOffset, gROMImage_Size - bigROMOffset);
-
-	// If we only had a Big ROM, dummy up the Small ROM.  All we really
-	// need to do here is copy the Big ROM's card header to the Small
-	// ROM area.
-	//
-	// Also, clear out this area to 0xFF to look like new Flash RAM.
-
-	if (bufferOffset)
-	{
-		memset (romImage, 0xFF, bigROMOffset);
-		memcpy (romImage.Get (), romImage.Get () + bigROMOffset, EmProxyCardHeaderType::GetSize ());
-	}
-	else
-	{
-		// See if the small ROM checksum looks OK.
-		// Note that checksumBytes is invalid for v1 card headers,
-		// but in those cases, it's not really used anyway.
-
-		EmAliasCardHeaderType<LAS>	cardHdr (romImage.Get ());
-		uint32 smallROMSize = cardHdr.checksumBytes;
-		Card::CheckChecksum (romImage.Get (), smallROMSize);
-	}
+	// Check that the ROM can be run on this device.  The image in memory
+	// starts with the card header at the start of the file, whether it's
+	// the Small ROM's or (after we dummy up a Small ROM below) the Big
+	// ROM's, so we can check it before loading the rest.
 
-
-	// Check that the ROM we just loaded can be run on this device.
-
-	EmAliasCardHeaderType<LAS>	cardHdr (romImage.Get ());
+	EmAliasCardHeaderType<LAS>	cardHdr (cardHeader.GetPtr ());
 
 	EmAssert (gSession);
 	if (Card::SupportsEZ (cardHdr))
@@ -774,10 +766,74 @@ void EmBankROM::LoadROM (EmStream& hROM)
 		}
 	}
 
-	// Byteswap all the words in the ROM (if necessary). Most accesses
-	// are 16-bit accesses, so we optimize for that case.
+	StMemory	romMetaImage (gROMImage_Size);
+
+	// If we've loaded this ROM before, the ROM cache has a copy of the
+	// fully prepared (validated, relocated, and byteswapped) image.  Map
+	// that instead of building the image again.  The mapping is
+	// copy-on-write, so the flash emulation can still write to it, but
+	// otherwise all sessions using this ROM share the same memory.
+
+	EmFileRef	cacheFile	= ::PrvGetROMCacheFile (hROM, cardHeader);
+	uint8*		romMemory	= (uint8*) Platform::MapFile (cacheFile, gROMImage_Size);
+
+	if (romMemory)
+	{
+		gROM_Mapped = true;
+	}
+	else
+	{
+		// Read in the ROM image.
+
+		StMemory	romImage (gROMImage_Size);
+
+		hROM.SetMarker (0, kStreamFromStart);
+		hROM.GetBytes (romImage.Get () + bufferOffset, hROM.GetLength());
+
+		// See if the big ROM checksum looks OK.
+
+		Bool	checksumsOK = Card::CheckChecksum (romImage.Get () + bigROMOffset,
+			gROMImage_Size - bigROMOffset);
+
+		// If we only had a Big ROM, dummy up the Small ROM.  All we really
+		// need to do here is copy the Big ROM's card header to the Small
+		// ROM area.
+		//
+		// Also, clear out this area to 0xFF to look like new Flash RAM.
+
+		if (bufferOffset)
+		{
+			memset (romImage, 0xFF, bigROMOffset);
+			memcpy (romImage.Get (), romImage.Get () + bigROMOffset, EmProxyCardHeaderType::GetSize ());
+		}
+		else
+		{
+			// See if the small ROM checksum looks OK.
+			// Note that checksumBytes is invalid for v1 card headers,
+			// but in those cases, it's not really used anyway.
+
+			EmAliasCardHeaderType<LAS>	smallCardHdr (romImage.Get ());
+			uint32 smallROMSize = smallCardHdr.checksumBytes;
+			if (!Card::CheckChecksum (romImage.Get (), smallROMSize))
+				checksumsOK = false;
+		}
+
+		// Byteswap all the words in the ROM (if necessary). Most accesses
+		// are 16-bit accesses, so we optimize for that case.
+
+		ByteswapWords (romImage.Get (), gROMImage_Size);
+
+		// Save the prepared image for next time.  Don't cache ROMs with
+		// bad checksums; we want to keep warning about those.
+
+		if (checksumsOK)
+		{
+			::PrvWriteROMCacheFile (cacheFile, romImage.Get (), gROMImage_Size);
+		}
 
-	ByteswapWords (romImage.Get (), gROMImage_Size);
+		romMemory	= (uint8*) romImage.Release ();
+		gROM_Mapped	= false;
+	}
 
 	// Everything seems to be OK.  Save the ROM data in some global
 	// variables for the CPU emulator to access.  Make sure that
@@ -787,7 +843,7 @@ void EmBankROM::LoadROM (EmStream& hROM)
 	EmAssert (gROM_Memory == NULL);
 	EmAssert (gROM_MetaMemory == NULL);
 
-	gROM_Memory 	= (uint8*) romImage.Release ();
+	gROM_Memory 	= romMemory;
 	gROM_MetaMemory = (uint8*) romMetaImage.Release ();
 	gROMBank_Mask	= gROMBank_Size - 1;
 
@@ -1656,3 +1712,183 @@ Bool Card::SupportsSZ (const EmAliasCardHeaderType<LAS>& cardHdr)
 
 	return szMode;
 }
+
+
+#pragma mark -
+
+// ===========================================================================
+//		 ROM Cache
+// ===========================================================================
+// The ROM cache holds ROM images exactly as they appear in gROM_Memory
+// after LoadROM has prepared them.  Entries are named after the contents
+// of the ROM file, so a changed ROM with the same name gets a new entry,
+// and the same ROM under different names shares one.
+//
+// Hashing the contents means reading the whole ROM, which is most of what
+// the cache is there to save.  So each ROM file also gets a small key file,
+// named after the file's path, size, modification date, and card header,
+// which holds the name of its entry.  The contents are hashed only when
+// there's no key file for the ROM, or its entry has gone away.
+
+// ---------------------------------------------------------------------------
+//		 PrvGetROMCacheFile
+// ---------------------------------------------------------------------------
+// Return the cache file for the ROM in the given stream.  The file may not
+// exist.
+
+EmFileRef PrvGetROMCacheFile (EmStream& hROM, const EmProxyCardHeaderType& cardHeader)
+{
+	EmDirRef	cacheDir (EmDirRef::GetEmulatorDirectory (), "ROM Cache");
+	EmFileRef	keyFile = ::PrvGetROMCacheKeyFile (hROM, cardHeader);
+
+	// See if we've been here before.
+
+	if (keyFile.IsSpecified () && keyFile.Exists ())
+	{
+		try
+		{
+			EmStreamFile	stream (keyFile, kOpenExistingForRead);
+			char			name[48];
+			int32			length = stream.GetLength ();
+
+			if (length > 0 && length < (int32) sizeof (name) &&
+				stream.GetBytes (name, length) == errNone)
+			{
+				EmFileRef	cacheFile (cacheDir, string (name, length));
+
+				if (cacheFile.Exists ())
+					return cacheFile;
+			}
+		}
+		catch (...)
+		{
+		}
+	}
+
+	// Nope.  Work out the entry from the contents, and remember it for
+	// next time.
+
+	string		name = ::PrvHashROMContents (hROM);
+
+	if (keyFile.IsSpecified ())
+	{
+		keyFile.WriteSafely (name.c_str (), name.size ());
+	}
+
+	return EmFileRef (cacheDir, name);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGetROMCacheKeyFile
+// ---------------------------------------------------------------------------
+// Return the key file for the ROM in the given stream.  The name is made
+// from two 32-bit FNV-1a hashes of the full path of the ROM file, its size
+// and modification date, and its card header.  Returns an unspecified
+// EmFileRef if the ROM isn't in a file we can look at (for instance, if
+// it's bound into the Emulator).
+
+EmFileRef PrvGetROMCacheKeyFile (EmStream& hROM, const EmProxyCardHeaderType& cardHeader)
+{
+	EmStreamFile*	fileStream = dynamic_cast<EmStreamFile*> (&hROM);
+
+	if (!fileStream)
+		return EmFileRef ();
+
+	EmFileRef	romFile = fileStream->GetFileRef ();
+	uint32		stamp[2];
+
+	if (romFile.GetSizeAndModDate (&stamp[0], &stamp[1]) != 0)
+		return EmFileRef ();
+
+	string		path	= romFile.GetFullPath ();
+	uint32		hash1	= 0x811C9DC5;
+	uint32		hash2	= 0x811C9DC5 ^ 0x5A5A5A5A;
+
+	::PrvHashBytes (hash1, hash2, path.c_str (), path.size ());
+	::PrvHashBytes (hash1, hash2, stamp, sizeof (stamp));
+	::PrvHashBytes (hash1, hash2, cardHeader.GetPtr (), cardHeader.GetSize ());
+
+	char	name[48];
+	sprintf (name, "%08lX%08lX%s.key",
+		(unsigned long) hash1, (unsigned long) hash2,
+		WORDSWAP_MEMORY ? "s" : "");
+
+	EmDirRef	cacheDir (EmDirRef::GetEmulatorDirectory (), "ROM Cache");
+
+	return EmFileRef (cacheDir, name);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHashROMContents
+// ---------------------------------------------------------------------------
+// Return the name of the cache entry for the ROM in the given stream.  The
+// name is made from two 32-bit FNV-1a hashes of the contents and the
+// length of the ROM.  Images are byteswapped on some hosts and not others,
+// so that's recorded in the name, too.
+
+string PrvHashROMContents (EmStream& hROM)
+{
+	uint32	hash1	= 0x811C9DC5;
+	uint32	hash2	= 0x811C9DC5 ^ 0x5A5A5A5A;
+	int32	length	= hROM.GetLength ();
+	int32	offset	= 0;
+
+	StMemory	buffer (64 * 1024);
+
+	hROM.SetMarker (0, kStreamFromStart);
+
+	while (offset < length)
+	{
+		int32	count = length - offset;
+
+		if (count > 64 * 1024)
+			count = 64 * 1024;
+
+		hROM.GetBytes (buffer.Get (), count);
+
+		::PrvHashBytes (hash1, hash2, buffer.Get (), count);
+
+		offset += count;
+	}
+
+	char	name[48];
+	sprintf (name, "%08lX%08lX%08lX%s.rom",
+		(unsigned long) hash1, (unsigned long) hash2, (unsigned long) length,
+		WORDSWAP_MEMORY ? "s" : "");
+
+	return string (name);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHashBytes
+// ---------------------------------------------------------------------------
+// Add the given bytes to the pair of hashes used to name cache files.
+
+void PrvHashBytes (uint32& hash1, uint32& hash2, const void* p, int32 count)
+{
+	const uint8*	bytes = (const uint8*) p;
+
+	for (int32 ii = 0; ii < count; ++ii)
+	{
+		hash1 = (hash1 ^ bytes[ii]) * 0x01000193;
+		hash2 = (hash2 ^ bytes[ii]) * 0x01000193;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvWriteROMCacheFile
+// ---------------------------------------------------------------------------
+// Save a prepared ROM image to the ROM cache, unless another session got
+// there first.  Failing to write the cache is not an error.
+
+void PrvWriteROMCacheFile (const EmFileRef& cacheFile, const void* image, uint32 size)
+{
+	if (cacheFile.Exists ())
+		return;
+
+	cacheFile.WriteSafely (image, size);
+}
@@ -55,10 +55,20 @@
 	queried as to the memory start and length it is responsible for).
 
 	Later, when a memory access is made to any of the 64K banks
-	EmBankRegs registered for, it again iterates over the EmRegs objects
-	installed into it, looking for one that takes responsibility for the
-	memory address being accessed.  When it finds one, it passes off the
-	request to that object.  Otherwise, it signals a bus error.
+	EmBankRegs registered for, it looks for the EmRegs object that takes
+	responsibility for the memory address being accessed.  When it finds
+	one, it passes off the request to that object.  Otherwise, it
+	signals a bus error.
+
+	Finding that object used to mean walking the list of EmRegs objects
+	behind a one-entry cache.  On devices with several register blocks
+	that get accessed in an interleaved fashion (the CLIE models, with
+	their LCD controller, sound, USB, and ExpCard registers), that cache
+	missed a lot.  So now EmBankRegs keeps a page table: each 64K bank
+	it's responsible for is split into kPageSize-byte pages, and each
+	page records the (almost always single) EmRegs object overlapping
+	it, along with that object's range.  The table is rebuilt whenever
+	the set of EmRegs objects or their addresses could have changed.
 */
 
 
@@ -80,9 +90,23 @@ static EmAddressBank	gAddressBank =
 EmRegsList		EmBankRegs::fgSubBanks;
 EmRegsList		EmBankRegs::fgDisabledSubBanks;
 
-static EmRegs*	gLastSubBank;
-static uint64	gLastStart;
-static uint32	gLastRange;
+struct EmRegsPageEntry
+{
+	EmRegs*		fBank;
+	uint64		fStart;		// 64-bit so that start + range can't overflow
+	uint32		fRange;
+};
+
+typedef vector<EmRegsPageEntry>	EmRegsPage;
+
+const int		kPageShift		= 8;
+const int		kPageSize		= 1 << kPageShift;
+const int		kPagesPerBank	= 0x10000 / kPageSize;
+
+// Indexed by EmMemBankIndex.  Each entry is either NULL (no EmRegs
+// objects in that 64K bank) or an array of kPagesPerBank pages.
+
+static vector<EmRegsPage*>	gPageTable;
 
 static void PrvSwitchBanks (EmRegsList& fromList, EmRegsList& toList, emuptr address);
 
@@ -196,7 +220,7 @@ void EmBankRegs::Load (SessionFile& f)
 		++iter;
 	}
 
-	gLastSubBank = NULL;
+	EmBankRegs::RebuildPageTable ();
 }
 
 
@@ -230,7 +254,7 @@ void EmBankRegs::Dispose (void)
 		delete bank;
 	}
 
-	gLastSubBank = NULL;
+	EmBankRegs::RebuildPageTable ();
 }
 
 
@@ -255,6 +279,12 @@ void EmBankRegs::SetBankHandlers (void)
 		(*iter)->SetBankHandlers (gAddressBank);
 		++iter;
 	}
+
+	// Some sub-banks (the Handspring USB registers, for instance) get
+	// their base address from the hardware configuration, which may have
+	// changed since we last looked.
+
+	EmBankRegs::RebuildPageTable ();
 }
 
 
@@ -567,7 +597,7 @@ uint8* EmBankRegs::GetRealAddress (emuptr address)
 void EmBankRegs::AddSubBank (EmRegs* bank)
 {
 	fgSubBanks.push_back (bank);
-	gLastSubBank = NULL;
+	EmBankRegs::RebuildPageTable ();
 }
 
 
@@ -578,6 +608,7 @@ void EmBankRegs::AddSubBank (EmRegs* bank)
 void EmBankRegs::EnableSubBank (emuptr address)
 {
 	PrvSwitchBanks (fgDisabledSubBanks, fgSubBanks, address);
+	EmBankRegs::RebuildPageTable ();
 }
 
 
@@ -588,6 +619,7 @@ void EmBankRegs::EnableSubBank (emuptr address)
 void EmBankRegs::DisableSubBank (emuptr address)
 {
 	PrvSwitchBanks (fgSubBanks, fgDisabledSubBanks, address);
+	EmBankRegs::RebuildPageTable ();
 }
 
 
@@ -602,38 +634,85 @@ EmRegs* EmBankRegs::GetSubBank (emuptr address, long size)
 	uint64	addrStart64	= address;
 	uint64	addrEnd64	= addrStart64 + size;
 
-	// This cache is a big win.  When emulating a Palm IIIc (which uses
-	// three EmRegs-based objects: EmRegsEZPalmIIIc, EmRegsSED1375, and
-	// EmRegsFrameBuffer) and doing a Gremlins run, the cache was hit
-	// 2,356,670 times and missed 19456 times.  When doing the same run
-	// on a Palm V, the cache was missed only the first time.
+	uint32	bankIndex	= EmMemBankIndex (address);
+
+	if (bankIndex >= gPageTable.size () || gPageTable[bankIndex] == NULL)
+		return NULL;
+
+	const EmRegsPage&	page = gPageTable[bankIndex][(address & 0xFFFF) >> kPageShift];
+
+	// If more than one object overlaps this page, they're in the same
+	// order as in fgSubBanks, so the first match wins just as it did
+	// when we walked that list.
+
+	EmRegsPage::const_iterator	iter = page.begin ();
+	while (iter != page.end ())
+	{
+		if ((addrStart64 >= iter->fStart) && (addrEnd64 <= iter->fStart + iter->fRange))
+		{
+			return iter->fBank;
+		}
+
+		++iter;
+	}
+
+	return NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBankRegs::RebuildPageTable
+// ---------------------------------------------------------------------------
 
-	if (gLastSubBank &&
-		(addrStart64 >= gLastStart) &&
-		(addrEnd64 <= gLastStart + gLastRange))
+void EmBankRegs::RebuildPageTable (void)
+{
+	vector<EmRegsPage*>::iterator	tableIter = gPageTable.begin ();
+	while (tableIter != gPageTable.end ())
 	{
-		return gLastSubBank;
+		delete [] *tableIter;
+		++tableIter;
 	}
 
+	gPageTable.clear ();
+
+	if (fgSubBanks.size () == 0)
+		return;
+
+	gPageTable.resize (0x10000, NULL);
+
 	EmRegsList::iterator	iter = fgSubBanks.begin ();
 	while (iter != fgSubBanks.end ())
 	{
-		uint64	start	= (*iter)->GetAddressStart ();
-		uint32	range	= (*iter)->GetAddressRange ();
+		EmRegsPageEntry	entry;
+
+		entry.fBank		= *iter;
+		entry.fStart	= (*iter)->GetAddressStart ();
+		entry.fRange	= (*iter)->GetAddressRange ();
+
+		// Add the entry to every page the object overlaps.  An empty
+		// range still gets the page it starts in, since GetRealAddress
+		// looks things up with a size of zero.
+
+		uint64	last = entry.fStart + (entry.fRange ? entry.fRange - 1 : 0);
 
-		if ((addrStart64 >= start) && (addrEnd64 <= start + range))
+		if (last > 0xFFFFFFFF)
+			last = 0xFFFFFFFF;
+
+		uint32	firstPage	= (uint32) (entry.fStart >> kPageShift);
+		uint32	lastPage	= (uint32) (last >> kPageShift);
+
+		for (uint32 pageIndex = firstPage; pageIndex <= lastPage; ++pageIndex)
 		{
-			gLastSubBank = *iter;
-			gLastStart = start;
-			gLastRange = range;
+			uint32	bankIndex = pageIndex / kPagesPerBank;
+
+			if (gPageTable[bankIndex] == NULL)
+				gPageTable[bankIndex] = new EmRegsPage[kPagesPerBank];
 
-			return *iter;
+			gPageTable[bankIndex][pageIndex % kPagesPerBank].push_back (entry);
 		}
 
 		++iter;
 	}
-
-	return NULL;
 }
 
 
@@ -43,6 +43,7 @@ class EmBankRegs
 
 	private:
 		static EmRegs*			GetSubBank			(emuptr address, long size);
+		static void				RebuildPageTable	(void);
 		static void				AddressError		(emuptr address, long size, Bool forRead);
 		static void				InvalidAccess		(emuptr address, long size, Bool forRead);
 		static void				PreventedAccess		(emuptr address, long size, Bool forRead);
@@ -18,6 +18,7 @@
 #include "DebugMgr.h"			// Debug::CheckStepSpy
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmMemory.h"			// gRAMBank_Size, gRAM_Memory, gMemoryAccess
+#include "EmPalmFunction.h"		// EmPalmFunctionMemoryChanged
 #include "EmScreen.h"			// EmScreen::MarkDirty
 #include "EmSession.h"			// GetDevice
 #include "MetaMemory.h"			// MetaMemory::
@@ -111,6 +112,18 @@ static inline void PrvScreenCheck (uint8* metaAddress, emuptr address, size_t si
 }
 
 
+static inline void PrvSymbolCheck (uint8* metaAddress, emuptr address, size_t size)
+{
+	// If code covered by FindFunctionName's symbol index is changing,
+	// make sure that part of the index is rebuilt.
+
+	if (MetaMemory::IsSymbolIndex (metaAddress, size))
+	{
+		::EmPalmFunctionMemoryChanged (address, size);
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmBankSRAM::Initialize
@@ -296,6 +309,24 @@ void EmBankSRAM::SetBankHandlers (void)
 	long	numBanks = EmMemBankIndex (gMemoryStart + gRAMBank_Size - 1) -
 									EmMemBankIndex (gMemoryStart) + 1;
 	Memory::InitializeBanks (gAddressBank, EmMemBankIndex (gMemoryStart), numBanks);
+
+	// Writes to the PEG-T400's LCD buffer are caught by address rather than
+	// by meta-memory bits (see SetLong), so they can't skip the handlers.
+	// Neither can writes to write-protected RAM.  The chip select handlers
+	// that change fProtect_SRAMSet reset the banks so that this is
+	// re-evaluated.
+
+	Bool	writable = true;
+
+#ifdef SONY_ROM
+	writable = gSession->GetDevice().GetDeviceType() != kDevicePEGT400;
+#else
+#if (PREVENT_USER_SRAM_SET)
+	writable = !gMemAccessFlags.fProtect_SRAMSet;
+#endif
+#endif //SONY_ROM
+
+	Memory::InitializeFastBanks (gAddressBank, EmMemBankIndex (gMemoryStart), numBanks, writable);
 }
 
 
@@ -462,6 +493,7 @@ void EmBankSRAM::SetLong (emuptr address, uint32 value)
 	register uint8*	metaAddress = InlineGetMetaAddress (phyAddress);
 //	META_CHECK (metaAddress, address, SetLong, uint32, false);
 	::PrvScreenCheck (metaAddress, address, sizeof (uint32));
+	::PrvSymbolCheck (metaAddress, address, sizeof (uint32));
 
 	EmMemDoPut32 (gRAM_Memory + phyAddress, value);
 
@@ -525,6 +557,7 @@ void EmBankSRAM::SetWord (emuptr address, uint32 value)
 	register uint8*	metaAddress = InlineGetMetaAddress (phyAddress);
 //	META_CHECK (metaAddress, address, SetLong, uint16, false);
 	::PrvScreenCheck (metaAddress, address, sizeof (uint16));
+	::PrvSymbolCheck (metaAddress, address, sizeof (uint16));
 
 	EmMemDoPut16 (gRAM_Memory + phyAddress, value);
 
@@ -581,6 +614,7 @@ void EmBankSRAM::SetByte (emuptr address, uint32 value)
 	register uint8*	metaAddress = InlineGetMetaAddress (phyAddress);
 //	META_CHECK (metaAddress, address, SetLong, uint8, false);
 	::PrvScreenCheck (metaAddress, address, sizeof (uint8));
+	::PrvSymbolCheck (metaAddress, address, sizeof (uint8));
 
 	EmMemDoPut8 (gRAM_Memory + phyAddress, value);
 
@@ -15,9 +15,11 @@
 #include "EmCPU68K.h"
 
 #include "Byteswapping.h"		// Canonical
-#include "DebugMgr.h"			// gExceptionAddress, gExceptionSize, gExceptionForRead
+#include "DebugMgr.h"			// gExceptionAddress, gExceptionSize, gExceptionForRead, gDebuggerGlobals
 #include "EmBankROM.h"			// EmBankROM::GetMemoryStart
+#include "EmClock.h"			// EmClock::Delay, EmClock::Update
 #include "EmEventPlayback.h"	// EmEventPlayback::ReplayingEvents
+#include "EmGremlinCoverage.h"	// gCoverageEnabled, EmCoverageRecordPC
 #include "EmHAL.h"				// EmHAL::GetInterruptLevel
 #include "EmMemory.h"			// CEnableFullAccess
 #include "EmMinimize.h"			// IsOn
@@ -25,6 +27,7 @@
 #include "Logging.h"			// LogAppendMsg
 #include "MetaMemory.h"			// IsCPUBreak
 #include "Platform.h"			// GetMilliseconds
+#include "PreferenceMgr.h"		// gPrefs, Preference
 #include "SessionFile.h"		// WriteDBallRegs, etc.
 #include "StringData.h"			// kExceptionNames
 #include "UAE.h"				// cpuop_func, etc.
@@ -64,6 +67,21 @@ int	movem_next[256];						// (normally in newcpu.c)
 
 cpuop_func*	cpufunctbl[65536];				// (normally in newcpu.c)
 
+// cpufunctbl is filled in from one of these.  The checked handlers go
+// through the memory bank handlers for every access; the direct-access
+// handlers (op_smalltbl_5, in cpuemufast.c) read and write plain RAM and
+// ROM themselves.  See EmCPU68K::UpdateHandlerTable.
+
+static cpuop_func*	gCheckedFuncTable[65536];
+static cpuop_func*	gFastFuncTable[65536];
+static Bool			gFastFuncTableInstalled;
+static Bool			gAccessCheckingOn;
+
+static void			PrvBuildFuncTable		(struct cputbl* tbl, cpuop_func** functbl);
+static void			PrvGetAccessCheckPrefs	(PrefKeyList&);
+static Bool			PrvAccessCheckingOn		(void);
+static void			PrvPrefsChanged			(PrefKeyType, PrefRefCon);
+
 uint16	last_op_for_exception_3;			/* Opcode of faulting instruction */
 emuptr	last_addr_for_exception_3;			/* PC at fault time */
 emuptr	last_fault_for_exception_3; 		/* Address that generated the exception */
@@ -170,6 +188,13 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 
 	EmAssert (gCPU68K == NULL);
 	gCPU68K = this;
+
+	PrefKeyList	keys;
+	::PrvGetAccessCheckPrefs (keys);
+	gPrefs->AddNotification (&::PrvPrefsChanged, keys);
+
+	gAccessCheckingOn = ::PrvAccessCheckingOn ();
+	EmCPU68K::UpdateHandlerTable ();
 }
 
 
@@ -179,6 +204,8 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 
 EmCPU68K::~EmCPU68K (void)
 {
+	gPrefs->RemoveNotification (&::PrvPrefsChanged);
+
 	EmAssert (gCPU68K == this);
 	gCPU68K = NULL;
 }
@@ -351,6 +378,13 @@ void EmCPU68K::Execute (void)
 	// mode, and we need to wind our way back down to that spot.
 	// -----------------------------------------------------------------------
 
+	// -----------------------------------------------------------------------
+	// The debugger may have set a step spy or watchpoint while we were
+	// stopped.  If so, switch back to the checked opcode handlers.
+	// -----------------------------------------------------------------------
+
+	EmCPU68K::UpdateHandlerTable ();
+
 	if ((spcflags & SPCFLAG_STOP) != 0)
 		goto StoppedLoop;
 
@@ -397,6 +431,11 @@ void EmCPU68K::Execute (void)
 			session->HandleInstructionBreak ();
 		}
 
+		if (gCoverageEnabled)
+		{
+			EmCoverageRecordPC (m68k_getpc ());
+		}
+
 #if HAS_PROFILING
 		emuptr	pcStart;
 		pcStart = m68k_getpc ();
@@ -844,6 +883,8 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 		// -----------------------------------------------------------------------
 		// Slow down processing so that the timer used
 		// to increment the tickcount doesn't run too quickly.
+		// (With the virtual clock, the clock is moved ahead
+		// to the next tick instead.)
 		// -----------------------------------------------------------------------
 
 #if __profile__
@@ -851,7 +892,7 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 	ProfilerSetStatus (false);
 #endif
 
-		Platform::Delay ();
+		EmClock::Delay ();
 
 #if __profile__
 	ProfilerSetStatus (oldStatus);
@@ -861,6 +902,15 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 
 		CYCLE (true);
 
+		// Carry out any commands posted while we're dozing.  We'd get to
+		// them on the next interrupt anyway, but there's no reason to
+		// make the poster wait for it.
+
+		if (session->HasPendingCommands () && !session->IsNested ())
+		{
+			session->DoPendingCommands ();
+		}
+
 		// Process an interrupt (see if it's time to wake up).
 
 		if (regs.spcflags & (SPCFLAG_INT | SPCFLAG_DOINT))
@@ -893,16 +943,33 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 
 void EmCPU68K::CycleSlowly (Bool sleeping)
 {
+	// Bring the clock up to date before the hardware looks at it.
+
+	EmClock::Update ();
+
 	EmHAL::CycleSlowly (sleeping);
 
 	// Do some platform-specific stuff.
 
 	Platform::CycleSlowly ();
 
+	// Pick up profiling being turned on or off.
+
+	EmCPU68K::UpdateHandlerTable ();
+
 #if HAS_OMNI_THREAD
-	// Check to see if some external thread has asked us to quit.
+	// Check to see if some external thread has posted a command for us
+	// to carry out.  EmSession::ExecuteSpecial picks it up.
 
 	EmAssert (fSession);
+
+	if (fSession->HasPendingCommands ())
+	{
+		this->CheckAfterCycle ();
+	}
+
+	// Check to see if some external thread has asked us to quit.
+
 	omni_mutex_lock	lock (fSession->fSharedLock);
 
 	if (fSession->fSuspendState.fAllCounters)
@@ -913,6 +980,38 @@ void EmCPU68K::CycleSlowly (Bool sleeping)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::UpdateHandlerTable
+// ---------------------------------------------------------------------------
+// Install the direct-access opcode handlers when nothing needs to see every
+// memory access: no access checking preferences are on, the profiler isn't
+// running, and the debugger has no step spy or watchpoint set.  Otherwise,
+// install the checked ones.
+//
+// This can be called from outside the CPU thread (by way of PrvPrefsChanged)
+// while Execute is running.  That's OK: each entry is swapped atomically,
+// and both versions of every handler do the same thing to the emulated
+// state, so it doesn't matter which one the CPU picks up in the meantime.
+
+void EmCPU68K::UpdateHandlerTable (void)
+{
+	Bool	needChecks =	gAccessCheckingOn ||
+#if HAS_PROFILING
+							gProfilingEnabled ||
+#endif
+							gDebuggerGlobals.stepSpy ||
+							gDebuggerGlobals.watchEnabled;
+
+	if (needChecks == !gFastFuncTableInstalled)
+		return;
+
+	memcpy (cpufunctbl, needChecks ? gCheckedFuncTable : gFastFuncTable,
+		sizeof (cpufunctbl));
+
+	gFastFuncTableInstalled = !needChecks;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmCPU68K::CheckAfterCycle
 // ---------------------------------------------------------------------------
@@ -1786,21 +1885,45 @@ void EmCPU68K::InitializeUAETables (void)
 	read_table68k ();
 	do_merges ();
 
-	// The rest of this code is based on build_cpufunctbl in newcpu.c.
+	// Build both sets of opcode handlers.  Start with the checked ones
+	// until UpdateHandlerTable says otherwise.
 
+	::PrvBuildFuncTable (op_smalltbl_3, gCheckedFuncTable);
+	::PrvBuildFuncTable (op_smalltbl_5, gFastFuncTable);
+
+	memcpy (cpufunctbl, gCheckedFuncTable, sizeof (cpufunctbl));
+	gFastFuncTableInstalled = false;
+
+	// (hey readcpu doesn't free this guy!)
+
+	Platform::DisposeMemory (table68k);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvBuildFuncTable
+// ---------------------------------------------------------------------------
+// Fill in a 64K-entry opcode handler table from one of the tables generated
+// by gencpu.  Must be called before table68k is disposed of.
+//
+// This code is based on build_cpufunctbl in newcpu.c.  The profiling table
+// gets the same values no matter which handler table we're building.
+
+void PrvBuildFuncTable (struct cputbl* tbl, cpuop_func** functbl)
+{
 	unsigned long	opcode;
-	struct cputbl*	tbl = op_smalltbl_3;
+	int				i;
 
 	for (opcode = 0; opcode < 65536; opcode++)
 	{
-		cpufunctbl[opcode] = op_illg;
+		functbl[opcode] = op_illg;
 	}
 
 	for (i = 0; tbl[i].handler != NULL; i++)
 	{
 		if (!tbl[i].specific)
 		{
-			cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+			functbl[tbl[i].opcode] = tbl[i].handler;
 #if HAS_PROFILING
 			perftbl[tbl[i].opcode] = tbl[i].perf;
 #endif
@@ -1818,13 +1941,13 @@ void EmCPU68K::InitializeUAETables (void)
 
 		if (table68k[opcode].handler != -1)
 		{
-			f = cpufunctbl[table68k[opcode].handler];
+			f = functbl[table68k[opcode].handler];
 			if (f == op_illg)
 			{
 				abort ();
 			}
 
-			cpufunctbl[opcode] = f;
+			functbl[opcode] = f;
 #if HAS_PROFILING
 			perftbl[opcode] = perftbl[table68k[opcode].handler];
 #endif
@@ -1836,14 +1959,65 @@ void EmCPU68K::InitializeUAETables (void)
 	{
 		if (tbl[i].specific)
 		{
-			cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+			functbl[tbl[i].opcode] = tbl[i].handler;
 #if HAS_PROFILING
 			perftbl[tbl[i].opcode] = tbl[i].perf;
 #endif
 		}
 	}
+}
 
-	// (hey readcpu doesn't free this guy!)
 
-	Platform::DisposeMemory (table68k);
+// ---------------------------------------------------------------------------
+//		 PrvGetAccessCheckPrefs
+// ---------------------------------------------------------------------------
+// Any of these being on means that we need the checked opcode handlers.
+
+void PrvGetAccessCheckPrefs (PrefKeyList& keys)
+{
+	keys.push_back (kPrefKeyReportFreeChunkAccess);
+	keys.push_back (kPrefKeyReportLowMemoryAccess);
+	keys.push_back (kPrefKeyReportLowStackAccess);
+	keys.push_back (kPrefKeyReportMemMgrDataAccess);
+	keys.push_back (kPrefKeyReportMemMgrSemaphore);
+	keys.push_back (kPrefKeyReportROMAccess);
+	keys.push_back (kPrefKeyReportScreenAccess);
+	keys.push_back (kPrefKeyReportSystemGlobalAccess);
+	keys.push_back (kPrefKeyReportUIMgrDataAccess);
+	keys.push_back (kPrefKeyReportUnlockedChunkAccess);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvAccessCheckingOn
+// ---------------------------------------------------------------------------
+
+Bool PrvAccessCheckingOn (void)
+{
+	PrefKeyList	keys;
+	::PrvGetAccessCheckPrefs (keys);
+
+	PrefKeyList::iterator	iter = keys.begin ();
+	while (iter != keys.end ())
+	{
+		Preference<bool>	pref (iter->c_str ());
+
+		if (*pref)
+			return true;
+
+		++iter;
+	}
+
+	return false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPrefsChanged
+// ---------------------------------------------------------------------------
+
+void PrvPrefsChanged (PrefKeyType, PrefRefCon)
+{
+	gAccessCheckingOn = ::PrvAccessCheckingOn ();
+	EmCPU68K::UpdateHandlerTable ();
 }
@@ -232,6 +232,11 @@ class EmCPU68K : public EmCPU
 		virtual void 			Execute 			(void);
 		virtual void 			CheckAfterCycle		(void);
 
+		// Switch between the checked and direct-access opcode handlers
+		// if anything that needs the checked ones has come or gone.
+
+		static void				UpdateHandlerTable	(void);
+
 		// Low-level access to CPU state.
 
 		virtual emuptr			GetPC				(void);
@@ -181,6 +181,8 @@
 #pragma mark Globals
 
 EmAddressBank*	gEmMemBanks[65536];		// (normally defined in memory.c)
+uint8*			gEmMemFastBase[65536];
+uint8*			gEmMemFastMeta[65536];
 
 Bool			gPCInRAM;
 Bool			gPCInROM;
@@ -341,6 +343,8 @@ void Memory::Initialize (	EmStream&		hROM,
 	// Clear everything out.
 	
 	memset (gEmMemBanks, 0, sizeof (gEmMemBanks));
+	memset (gEmMemFastBase, 0, sizeof (gEmMemFastBase));
+	memset (gEmMemFastMeta, 0, sizeof (gEmMemFastMeta));
 
 	// Initialize the valid memory banks.
 
@@ -530,6 +534,39 @@ void Memory::InitializeBanks (	EmAddressBank&	iBankInitializer,
 		aBankIndex++)
 	{
 		gEmMemBanks[aBankIndex] = &iBankInitializer;
+
+		// The new owner has to ask for direct access all over again.
+
+		gEmMemFastBase[aBankIndex] = NULL;
+		gEmMemFastMeta[aBankIndex] = NULL;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 Memory::InitializeFastBanks
+// ---------------------------------------------------------------------------
+// Allows the direct-access opcode handlers to bypass the given bank's
+// handlers for reads (and, if iWritable, writes) when access checking is
+// off.  Only for banks that are plain memory, where the handlers do nothing
+// but checks before reading or writing the address returned by their
+// xlateaddr function.  Call right after InitializeBanks.
+
+void Memory::InitializeFastBanks (	EmAddressBank&	iBankInitializer,
+									int32			iStartingBankIndex,
+									int32			iNumberOfBanks,
+									Bool			iWritable)
+{
+	for (int32 aBankIndex = iStartingBankIndex;
+		aBankIndex < iStartingBankIndex + iNumberOfBanks;
+		aBankIndex++)
+	{
+		EmAssert (gEmMemBanks[aBankIndex] == &iBankInitializer);
+
+		emuptr	bankStart = ((emuptr) aBankIndex) << 16;
+
+		gEmMemFastBase[aBankIndex] = iBankInitializer.xlateaddr (bankStart);
+		gEmMemFastMeta[aBankIndex] = iWritable ? iBankInitializer.xlatemetaaddr (bankStart) : NULL;
 	}
 }
 
@@ -73,6 +73,23 @@ typedef struct EmAddressBank
 
 #endif // ECM_DYNAMIC_PATCH
 
+// Host addresses of the start of each 64K bank of plain RAM or ROM, for the
+// direct-access opcode handlers in cpuemufast.c.  gEmMemFastBase is NULL if
+// reads from the bank must go through its handlers; gEmMemFastMeta (the
+// bank's meta-memory) is NULL if writes must.  Filled in by the owners of
+// those banks via Memory::InitializeFastBanks, and cleared by
+// Memory::InitializeBanks whenever a bank changes hands.
+
+extern uint8*			gEmMemFastBase[65536];
+extern uint8*			gEmMemFastMeta[65536];
+
+// Meta-memory bits that must send a write through the bank handlers even
+// when there's no access checking: screen updates, symbol index flushes,
+// and data breakpoints (MetaMemory::kScreenBuffer | kSymbolIndex |
+// kDataBreak; checked in MetaMemory::Initialize).
+
+#define kEmMemFastPutMetaBits	0xA8
+
 
 // ---------------------------------------------------------------------------
 //		 Support macros
@@ -263,6 +280,102 @@ STATIC_INLINE void EmMemDoPut8 (void* a, uint8 v)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmMemFastGet32, EmMemFastGet16, EmMemFastGet8
+// ---------------------------------------------------------------------------
+// Used instead of EmMemGet32, etc., by the direct-access opcode handlers.
+// Read plain RAM or ROM straight from host memory, skipping the access
+// checks in the bank handlers.  Odd addresses and accesses that would run
+// off the end of a bank still go through the handlers so that they raise
+// address errors and get masked as before.
+
+STATIC_INLINE uint32 EmMemFastGet32 (emuptr addr)
+{
+	uint8*	base	= gEmMemFastBase[EmMemBankIndex (addr)];
+	uint32	offset	= addr & 0xFFFF;
+
+	if (base && (offset & 1) == 0 && offset != 0xFFFE)
+		return EmMemDoGet32 (base + offset);
+
+	return EmMemGet32 (addr);
+}
+
+STATIC_INLINE uint32 EmMemFastGet16 (emuptr addr)
+{
+	uint8*	base	= gEmMemFastBase[EmMemBankIndex (addr)];
+	uint32	offset	= addr & 0xFFFF;
+
+	if (base && (offset & 1) == 0)
+		return EmMemDoGet16 (base + offset);
+
+	return EmMemGet16 (addr);
+}
+
+STATIC_INLINE uint32 EmMemFastGet8 (emuptr addr)
+{
+	uint8*	base	= gEmMemFastBase[EmMemBankIndex (addr)];
+
+	if (base)
+		return EmMemDoGet8 (base + (addr & 0xFFFF));
+
+	return EmMemGet8 (addr);
+}
+
+// ---------------------------------------------------------------------------
+//		 EmMemFastPut32, EmMemFastPut16, EmMemFastPut8
+// ---------------------------------------------------------------------------
+// As above, but for writes.  Writes that touch any of the bytes marked with
+// kEmMemFastPutMetaBits take the slow path.  The meta-memory is checked a
+// whole 68K word at a time so that it doesn't matter whether it's been
+// byteswapped along with the memory it describes.
+
+STATIC_INLINE void EmMemFastPut32 (emuptr addr, uint32 l)
+{
+	uint8*	meta	= gEmMemFastMeta[EmMemBankIndex (addr)];
+	uint32	offset	= addr & 0xFFFF;
+
+	if (meta && (offset & 1) == 0 && offset != 0xFFFE &&
+		((meta[offset] | meta[offset + 1] | meta[offset + 2] | meta[offset + 3]) &
+			kEmMemFastPutMetaBits) == 0)
+	{
+		EmMemDoPut32 (gEmMemFastBase[EmMemBankIndex (addr)] + offset, l);
+		return;
+	}
+
+	EmMemPut32 (addr, l);
+}
+
+STATIC_INLINE void EmMemFastPut16 (emuptr addr, uint32 w)
+{
+	uint8*	meta	= gEmMemFastMeta[EmMemBankIndex (addr)];
+	uint32	offset	= addr & 0xFFFF;
+
+	if (meta && (offset & 1) == 0 &&
+		((meta[offset] | meta[offset + 1]) & kEmMemFastPutMetaBits) == 0)
+	{
+		EmMemDoPut16 (gEmMemFastBase[EmMemBankIndex (addr)] + offset, (uint16) w);
+		return;
+	}
+
+	EmMemPut16 (addr, w);
+}
+
+STATIC_INLINE void EmMemFastPut8 (emuptr addr, uint32 b)
+{
+	uint8*	meta	= gEmMemFastMeta[EmMemBankIndex (addr)];
+	uint32	offset	= addr & 0xFFFF;
+
+	if (meta &&
+		((meta[offset & ~1] | meta[offset | 1]) & kEmMemFastPutMetaBits) == 0)
+	{
+		EmMemDoPut8 (gEmMemFastBase[EmMemBankIndex (addr)] + offset, (uint8) b);
+		return;
+	}
+
+	EmMemPut8 (addr, b);
+}
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -372,6 +485,11 @@ class Memory
 													 int32 iStartingBankIndex,
 													 int32 iNumberOfBanks);
 
+		static void				InitializeFastBanks	(EmAddressBank& iBankInitializer,
+													 int32 iStartingBankIndex,
+													 int32 iNumberOfBanks,
+													 Bool iWritable);
+
 		static void				ResetBankHandlers	(void);
 
 		static void				MapPhysicalMemory	(const void*, uint32);
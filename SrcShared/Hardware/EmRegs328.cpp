@@ -16,6 +16,7 @@
 #include "EmRegs328Prv.h"
 
 #include "Byteswapping.h"		// Canonical
+#include "EmClock.h"			// EmClock::IsVirtual
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
 #include "EmPixMap.h"			// SetSize, SetRowBytes, etc.
@@ -24,7 +25,7 @@
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// GetHostTime
-#include "PreferenceMgr.h"		// Preference
+#include "PreferenceMgr.h"		// gPrefs, PrefSnapshot
 #include "SessionFile.h"		// WriteHwrDBallType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
 
@@ -141,13 +142,13 @@ const HwrM68328Type	kInitial68328RegisterValues =
 	0x2400,		//	Word		pllControl;					// $200: PLL Control Register
 	0x0123,		//	Word		pllFreqSel;					// $202: PLL Frequency Select Register
 	0x0000,		//	Word		pllTest;					// $204: PLL Test Register
-	{ 0 },		//	Byte										__filler44;
+	0x00,		//	Byte										__filler44;
 	0x1F,		//	Byte		pwrControl;					// $207: Power Control Register
 
 	{ 0 },		//	Byte										___filler3[0x300-0x208];
 
 	0x00,		//	Byte		intVector;					// $300: Interrupt Vector Register
-	{ 0 },		//	Byte										___filler4;
+	0x00,		//	Byte										___filler4;
 	0x0000,		//	Word		intControl;					// $302: Interrupt Control Register
 	0x00FF,		//	Word		intMaskHi;					// $304: Interrupt Mask Register/HIGH word
 	0xFFFF,		//	Word		intMaskLo;					// $306: Interrupt Mask Register/LOW word
@@ -162,21 +163,21 @@ const HwrM68328Type	kInitial68328RegisterValues =
 
 	0x00,		//	Byte		portADir;					// $400: Port A Direction Register
 	0x00,		//	Byte		portAData;					// $401: Port A Data Register
-	{ 0 },		//	Byte										___filler5;
+	0x00,		//	Byte										___filler5;
 	0x00,		//	Byte		portASelect;				// $403: Port A Select Register
 
 	{ 0 },		//	Byte										___filler6[4];
 
 	0x00,		//	Byte		portBDir;					// $408: Port B Direction Register
 	0x00,		//	Byte		portBData;					// $409: Port B Data Register
-	{ 0 },		//	Byte										___filler7;
+	0x00,		//	Byte										___filler7;
 	0x00,		//	Byte		portBSelect;				// $40B: Port B Select Register
 
 	{ 0 },		//	Byte										___filler8[4];
 
 	0x00,		//	Byte		portCDir;					// $410: Port C Direction Register
 	0x00,		//	Byte		portCData;					// $411: Port C Data Register
-	{ 0 },		//	Byte										___filler9;
+	0x00,		//	Byte										___filler9;
 	0x00,		//	Byte		portCSelect;				// $413: Port C Select Register
 
 	{ 0 },		//	Byte										___filler10[4];
@@ -184,10 +185,10 @@ const HwrM68328Type	kInitial68328RegisterValues =
 	0x00,		//	Byte		portDDir;					// $418: Port D Direction Register
 	0x00,		//	Byte		portDData;					// $419: Port D Data Register
 	0xFF,		//	Byte		portDPullupEn;				// $41A: Port D Pull-up Enable
-	{ 0 },		//	Byte										___filler11;
+	0x00,		//	Byte										___filler11;
 	0x00,		//	Byte		portDPolarity;				// $41C: Port D Polarity Register
 	0x00,		//	Byte		portDIntReqEn;				// $41D: Port D Interrupt Request Enable
-	{ 0 },		//	Byte										___filler12;
+	0x00,		//	Byte										___filler12;
 	0x00,		//	Byte		portDIntEdge;				// $41F: Port D IRQ Edge Register
 
 	0x00,		//	Byte		portEDir;					// $420: Port E Direction Register
@@ -213,7 +214,7 @@ const HwrM68328Type	kInitial68328RegisterValues =
 
 	0x00,		//	Byte		portJDir;					// $438: Port J Direction Register
 	0x00,		//	Byte		portJData;					// $439: Port J Data Register
-	{ 0 },		//	Byte										___filler19;
+	0x00,		//	Byte										___filler19;
 	0x00,		//	Byte		portJSelect;				// $43B: Port J Select Register
 
 	{ 0 },		//	Byte										___filler19a[4];
@@ -279,7 +280,7 @@ const HwrM68328Type	kInitial68328RegisterValues =
 	{ 0 },		//	Byte										___filler28[0xA00-0x90A];
 
 	0x00000000,	//	DWord		lcdStartAddr;				// $A00: Screen Starting Address Register
-	{ 0 },		//	Byte										___filler29;
+	0x00,		//	Byte										___filler29;
 	0xFF,		//	Byte		lcdPageWidth;				// $A05: Virtual Page Width Register
 	{ 0 },		//	Byte										___filler30[2];
 	0x03FF,		//	Word		lcdScreenWidth;				// $A08: Screen Width Register
@@ -288,7 +289,7 @@ const HwrM68328Type	kInitial68328RegisterValues =
 	0x0000,		//	Word		lcdCursorXPos;				// $A18: Cursor X Position
 	0x0000,		//	Word		lcdCursorYPos;				// $A1A:	Cursor Y Position
 	0x0101,		//	Word		lcdCursorWidthHeight;		// $A1C: Cursor Width and Height
-	{ 0 },		//	Byte										___filler32;
+	0x00,		//	Byte										___filler32;
 	0x7F,		//	Byte		lcdBlinkControl;			// $A1F: Blink Control Register
 	0x00,		//	Byte		lcdPanelControl;			// $A20: Panel Interface Control Register
 	0x00,		//	Byte		lcdPolarity;				// $A21: Polarity Config Register
@@ -1614,7 +1615,7 @@ uint32 EmRegs328::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () && !EmClock::IsVirtual ())
 	{
 		hour = fHour;
 		min = fMin;
@@ -1643,6 +1644,10 @@ uint32 EmRegs328::rtcHourMinSecRead (emuptr address, int size)
 
 void EmRegs328::csASelect1Write (emuptr address, int size, uint32 value)
 {
+	// Get the current value.
+
+	uint16	csASelect1 = READ_REGISTER (csASelect1);
+
 	// Do a standard update of the register.
 
 	EmRegs328::StdWrite (address, size, value);
@@ -1650,6 +1655,16 @@ void EmRegs328::csASelect1Write (emuptr address, int size, uint32 value)
 	// Check its new state and update our ram-protect flag.
 
 	gMemAccessFlags.fProtect_SRAMSet = (READ_REGISTER (csASelect1) & 0x0008) != 0;
+
+	// EmBankSRAM only lets writes skip its handlers when RAM isn't
+	// write-protected, so have it look again if the protection changed.
+
+	if ((csASelect1 & 0x0008) != (READ_REGISTER (csASelect1) & 0x0008))
+	{
+		EmAssert (gSession);
+
+		gSession->ScheduleResetBanks ();
+	}
 }
 
 
@@ -2763,23 +2778,22 @@ int EmRegs328::GetPort (emuptr address)
 void EmRegs328::PrvGetPalette (RGBList& thePalette)
 {
 	// !!! TBD
-	Preference<RGBType> pref1 (kPrefKeyBackgroundColor);
-	Preference<RGBType> pref2 (kPrefKeyHighlightColor);
+	const PrefSnapshot*	prefs = gPrefs->GetSnapshot ();
 
 	RGBType foreground (0, 0, 0);
 	RGBType background;
 
 	if (this->GetLCDBacklightOn ())
 	{
-		if (pref2.Loaded ())
-			background = *pref2;
+		if (prefs->fHighlightColorLoaded)
+			background = prefs->fHighlightColor;
 		else
 			background = ::SkinGetHighlightColor ();
 	}
 	else
 	{
-		if (pref1.Loaded ())
-			background = *pref1;
+		if (prefs->fBackgroundColorLoaded)
+			background = prefs->fBackgroundColor;
 		else
 			background = ::SkinGetBackgroundColor ();
 	}
@@ -16,6 +16,7 @@
 #include "EmRegsEZPrv.h"
 
 #include "Byteswapping.h"		// Canonical
+#include "EmClock.h"			// EmClock::IsVirtual
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
 #include "EmPixMap.h"			// SetSize, SetRowBytes, etc.
@@ -25,7 +26,7 @@
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// GetHostTime
-#include "PreferenceMgr.h"		// Preference
+#include "PreferenceMgr.h"		// gPrefs, PrefSnapshot
 #include "SessionFile.h"		// WriteHwrDBallEZType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
 
@@ -84,13 +85,13 @@ static const HwrM68EZ328Type	kInitial68EZ328RegisterValues =
 	0x2430,		// Word		pllControl;						// $200: PLL Control Register
 	0x0123,		// Word		pllFreqSel;						// $202: PLL Frequency Select Register
 	0,		// !!! ---> Marked as reserved in 1.4 Word		pllTest;						// $204: PLL Test Register (do not access)
-	{ 0 },		// Byte											___filler44;
+	0x00,		// Byte											___filler44;
 	0x1F,		// Byte		pwrControl;						// $207: Power Control Register
 
 	{ 0 },		// Byte											___filler3[0x300-0x208];
 
 	0x00,		// Byte		intVector;						// $300: Interrupt Vector Register
-	{ 0 },		// Byte											___filler4;
+	0x00,		// Byte											___filler4;
 	0x0000,		// Word		intControl;						// $302: Interrupt Control Register
 	0x00FF,		// Word		intMaskHi;						// $304: Interrupt Mask Register/HIGH word
 	0xFFFF,		// Word		intMaskLo;						// $306: Interrupt Mask Register/LOW word
@@ -183,7 +184,7 @@ static const HwrM68EZ328Type	kInitial68EZ328RegisterValues =
 	{ 0 },		// Byte											___filler28[0xA00-0x90C];
 
 	0x00000000,	// DWord	lcdStartAddr;					// $A00: Screen Starting Address Register
-	{ 0 },		// Byte											___filler29;
+	0x00,		// Byte											___filler29;
 	0xFF,		// Byte		lcdPageWidth;					// $A05: Virtual Page Width Register
 	{ 0 },		// Byte											___filler30[2];
 	0x03FF,		// Word		lcdScreenWidth;					// $A08: Screen Width Register
@@ -192,17 +193,17 @@ static const HwrM68EZ328Type	kInitial68EZ328RegisterValues =
 	0x0000,		// Word		lcdCursorXPos;					// $A18: Cursor X Position
 	0x0000,		// Word		lcdCursorYPos;					// $A1A:	Cursor Y Position
 	0x0101,		// Word		lcdCursorWidthHeight;			// $A1C: Cursor Width and Height
-	{ 0 },		// Byte											___filler32;
+	0x00,		// Byte											___filler32;
 	0x7F,		// Byte		lcdBlinkControl;				// $A1F: Blink Control Register
 	0x00,		// Byte		lcdPanelControl;				// $A20: Panel Interface Control Register
 	0x00,		// Byte		lcdPolarity;					// $A21: Polarity Config Register
-	{ 0 },		// Byte											___filler33;						
+	0x00,		// Byte											___filler33;						
 	0x00,		// Byte		lcdACDRate;						// $A23: ACD (M) Rate Control Register
-	{ 0 },		// Byte											___filler34;
+	0x00,		// Byte											___filler34;
 	0x00,		// Byte		lcdPixelClock;					// $A25: Pixel Clock Divider Register
-	{ 0 },		// Byte											___filler35;
+	0x00,		// Byte											___filler35;
 	0x40,		// Byte		lcdClockControl;				// $A27: Clocking Control Register
-	{ 0 },		// Byte											___filler36;
+	0x00,		// Byte											___filler36;
 	0xFF,		// Byte		lcdRefreshRateAdj;				// $A29: Refresh Rate Adjustment Register
 	{ 0 },		// Byte											___filler2003[0xA2D-0xA2A];
 	0x00,		// Byte		lcdPanningOffset;				// $A2D: Panning Offset Register
@@ -210,10 +211,10 @@ static const HwrM68EZ328Type	kInitial68EZ328RegisterValues =
 	{ 0 },		// Byte											___filler37[0xA31-0xA2E];
 
 	0xB9,		// Byte		lcdFrameRate;					// $A31: Frame Rate Control Modulation Register
-	{ 0 },		// Byte											___filler2004;
+	0x00,		// Byte											___filler2004;
 	0x84,		// Byte		lcdGrayPalette;					// $A33: Gray Palette Mapping Register
 	0x00,		// Byte		lcdReserved;					// $A34: Reserved
-	{ 0 },		// Byte											___filler2005;
+	0x00,		// Byte											___filler2005;
 	0x0000,		// Word		lcdContrastControlPWM;			// $A36: Contrast Control
 
 	{ 0 },		// Byte											___filler40[0xB00-0xA38];
@@ -1440,7 +1441,7 @@ uint32 EmRegsEZ::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () && !EmClock::IsVirtual ())
 	{
 		hour = fHour;
 		min = fMin;
@@ -1505,9 +1506,12 @@ void EmRegsEZ::csDSelectWrite (emuptr address, int size, uint32 value)
 
 	gMemAccessFlags.fProtect_SRAMSet = (READ_REGISTER (csDSelect) & 0x2000) != 0;
 
-	// Check to see if the unprotected memory range changed.
+	// Check to see if the unprotected memory range or the protection
+	// changed.  EmBankSRAM only lets writes skip its handlers when RAM
+	// isn't write-protected.
 
-	if ((csDSelect & UPSIZ) != (READ_REGISTER (csDSelect) & UPSIZ))
+	if ((csDSelect & UPSIZ) != (READ_REGISTER (csDSelect) & UPSIZ) ||
+		(csDSelect & 0x2000) != (READ_REGISTER (csDSelect) & 0x2000))
 	{
 		EmAssert (gSession);
 		gSession->ScheduleResetBanks ();
@@ -2613,23 +2617,22 @@ int EmRegsEZ::GetPort (emuptr address)
 void EmRegsEZ::PrvGetPalette (RGBList& thePalette)
 {
 	// !!! TBD
-	Preference<RGBType> pref1 (kPrefKeyBackgroundColor);
-	Preference<RGBType> pref2 (kPrefKeyHighlightColor);
+	const PrefSnapshot*	prefs = gPrefs->GetSnapshot ();
 
 	RGBType foreground (0, 0, 0);
 	RGBType background;
 
 	if (this->GetLCDBacklightOn ())
 	{
-		if (pref2.Loaded ())
-			background = *pref2;
+		if (prefs->fHighlightColorLoaded)
+			background = prefs->fHighlightColor;
 		else
 			background = ::SkinGetHighlightColor ();
 	}
 	else
 	{
-		if (pref1.Loaded ())
-			background = *pref1;
+		if (prefs->fBackgroundColorLoaded)
+			background = prefs->fBackgroundColor;
 		else
 			background = ::SkinGetBackgroundColor ();
 	}
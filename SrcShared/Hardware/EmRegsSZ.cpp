@@ -18,6 +18,7 @@
 #if INCLUDE_SECRET_STUFF
 
 #include "Byteswapping.h"		// Canonical
+#include "EmClock.h"			// EmClock::IsVirtual
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
 #include "EmPixMap.h"			// SetSize, SetRowBytes, etc.
@@ -27,7 +28,7 @@
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// GetHostTime
-#include "PreferenceMgr.h"		// Preference
+#include "PreferenceMgr.h"		// gPrefs, PrefSnapshot
 #include "SessionFile.h"		// WriteHwrDBallSZType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
 
@@ -389,7 +390,7 @@ static const HwrM68SZ328Type	kInitial68SZ328RegisterValues =
 	0x3CE8,		// UInt16	pllFreqSel0;				// $10202: MCU PLL Frequency Select Register 0
 	0x0900,		// UInt16	pllFreqSel1;				// $10204: MCU PLL Frequency Select Register 1
 
-	{ 0 },		// UInt8									___filler47;
+	0x00,		// UInt8									___filler47;
 
 	0x1F,		// UInt8	pwrControl;					// $10207: CPU Power Control Register
 
@@ -2354,7 +2355,7 @@ uint32 EmRegsSZ::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () && !EmClock::IsVirtual ())
 	{
 		hour = fHour;
 		min = fMin;
@@ -2447,9 +2448,12 @@ void EmRegsSZ::csESelectWrite (emuptr address, int size, uint32 value)
 
 	gMemAccessFlags.fProtect_SRAMSet = (READ_REGISTER (csESelect) & ROPMask) != 0;
 
-	// Check to see if the unprotected memory range changed.
+	// Check to see if the unprotected memory range or the protection
+	// changed.  EmBankSRAM only lets writes skip its handlers when RAM
+	// isn't write-protected.
 
-	if ((csESelect & UPSIZMask) != (READ_REGISTER (csESelect) & UPSIZMask))
+	if ((csESelect & UPSIZMask) != (READ_REGISTER (csESelect) & UPSIZMask) ||
+		(csESelect & ROPMask) != (READ_REGISTER (csESelect) & ROPMask))
 	{
 		EmAssert (gSession);
 
@@ -3729,23 +3733,22 @@ emuptr EmRegsSZ::GetAddressFromPort (int port)
 void EmRegsSZ::PrvGetPalette (RGBList& thePalette)
 {
 	// !!! TBD
-	Preference<RGBType> pref1 (kPrefKeyBackgroundColor);
-	Preference<RGBType> pref2 (kPrefKeyHighlightColor);
+	const PrefSnapshot*	prefs = gPrefs->GetSnapshot ();
 
 	RGBType foreground (0, 0, 0);
 	RGBType background;
 
 	if (this->GetLCDBacklightOn ())
 	{
-		if (pref2.Loaded ())
-			background = *pref2;
+		if (prefs->fHighlightColorLoaded)
+			background = prefs->fHighlightColor;
 		else
 			background = ::SkinGetHighlightColor ();
 	}
 	else
 	{
-		if (pref1.Loaded ())
-			background = *pref1;
+		if (prefs->fBackgroundColorLoaded)
+			background = prefs->fBackgroundColor;
 		else
 			background = ::SkinGetBackgroundColor ();
 	}
@@ -16,6 +16,7 @@
 #include "EmRegsVZPrv.h"
 
 #include "Byteswapping.h"		// Canonical
+#include "EmClock.h"			// EmClock::IsVirtual
 #include "EmDevice.h"
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// gMemAccessFlags, EmMem_memcpy
@@ -26,7 +27,7 @@
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// GetHostTime
-#include "PreferenceMgr.h"		// Preference
+#include "PreferenceMgr.h"		// gPrefs, PrefSnapshot
 #include "SessionFile.h"		// WriteHwrDBallVZType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
 
@@ -270,7 +271,7 @@ static const HwrM68VZ328Type	kInitial68VZ328RegisterValues =
 	{ 0 },		// UInt8									___filler28a[0xA00-0x91E];
 
 	0x00000000,	// UInt32	lcdStartAddr;				// $A00: Screen Starting Address Register
-	{ 0 },		// UInt8									___filler29;
+	0x00,		// UInt8									___filler29;
 	0xFF,		// UInt8	lcdPageWidth;				// $A05: Virtual Page Width Register
 	{ 0 },		// UInt8									___filler30[2];
 	0x03F0,		// UInt16	lcdScreenWidth;				// $A08: Screen Width Register
@@ -279,29 +280,29 @@ static const HwrM68VZ328Type	kInitial68VZ328RegisterValues =
 	0x0000,		// UInt16	lcdCursorXPos;				// $A18: Cursor X Position
 	0x0000,		// UInt16	lcdCursorYPos;				// $A1A: Cursor Y Position
 	0x0101,		// UInt16	lcdCursorWidthHeight;		// $A1C: Cursor Width and Height
-	{ 0 },		// UInt8									___filler32;
+	0x00,		// UInt8									___filler32;
 	0x7F,		// UInt8	lcdBlinkControl;			// $A1F: Blink Control Register
 	0x00,		// UInt8	lcdPanelControl;			// $A20: Panel Interface Configuration Register
 	0x00,		// UInt8	lcdPolarity;				// $A21: Polarity Config Register
-	{ 0 },		// UInt8									___filler33;						
+	0x00,		// UInt8									___filler33;						
 	0x00,		// UInt8	lcdACDRate;					// $A23: ACD (M) Rate Control Register
-	{ 0 },		// UInt8									___filler34;
+	0x00,		// UInt8									___filler34;
 	0x00,		// UInt8	lcdPixelClock;				// $A25: Pixel Clock Divider Register
-	{ 0 },		// UInt8									___filler35;
+	0x00,		// UInt8									___filler35;
 	0x00,		// UInt8	lcdClockControl;			// $A27: Clocking Control Register
 	0x00FF,		// UInt16	lcdRefreshRateAdj;			// $A28: Refresh Rate Adjustment Register
-	{ 0 },		// UInt8									___filler37;
+	0x00,		// UInt8									___filler37;
 	0x00,		// UInt8	lcdReserved1;				// $A2B: Reserved
-	{ 0 },		// UInt8									___filler38;
+	0x00,		// UInt8									___filler38;
 	0x00,		// UInt8    lcdPanningOffset;			// $A2D: Panning Offset Register
 
 	{ 0 },		// UInt8									___filler39[0xA31-0xA2E];
 
 	0x00,		// UInt8	lcdFrameRate;				// $A31: Frame Rate Control Modulation Register
-	{ 0 },		// UInt8									___filler2004;
+	0x00,		// UInt8									___filler2004;
 	0x84,		// UInt8	lcdGrayPalette;				// $A33: Gray Palette Mapping Register
 	0x00,		// UInt8	lcdReserved2;				// $A34: Reserved
-	{ 0 },		// UInt8									___filler2005;
+	0x00,		// UInt8									___filler2005;
 	0x0000,		// UInt16	lcdContrastControlPWM;		// $A36: Contrast Control
 	0x00,		// UInt8	lcdRefreshModeControl;		// $A38: Refresh Mode Control Register
 	0x62,		// UInt8	lcdDMAControl;				// $A39: DMA Control Register
@@ -1736,7 +1737,7 @@ uint32 EmRegsVZ::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () && !EmClock::IsVirtual ())
 	{
 		hour = fHour;
 		min = fMin;
@@ -1829,9 +1830,12 @@ void EmRegsVZ::csDSelectWrite (emuptr address, int size, uint32 value)
 
 	gMemAccessFlags.fProtect_SRAMSet = (READ_REGISTER (csDSelect) & 0x2000) != 0;
 
-	// Check to see if the unprotected memory range changed.
+	// Check to see if the unprotected memory range or the protection
+	// changed.  EmBankSRAM only lets writes skip its handlers when RAM
+	// isn't write-protected.
 
-	if ((csDSelect & UPSIZMask) != (READ_REGISTER (csDSelect) & UPSIZMask))
+	if ((csDSelect & UPSIZMask) != (READ_REGISTER (csDSelect) & UPSIZMask) ||
+		(csDSelect & 0x2000) != (READ_REGISTER (csDSelect) & 0x2000))
 	{
 		EmAssert (gSession);
 
@@ -3089,23 +3093,22 @@ int EmRegsVZ::GetPort (emuptr address)
 void EmRegsVZ::PrvGetPalette (RGBList& thePalette)
 {
 	// !!! TBD
-	Preference<RGBType> pref1 (kPrefKeyBackgroundColor);
-	Preference<RGBType> pref2 (kPrefKeyHighlightColor);
+	const PrefSnapshot*	prefs = gPrefs->GetSnapshot ();
 
 	RGBType foreground (0, 0, 0);
 	RGBType background;
 
 	if (this->GetLCDBacklightOn ())
 	{
-		if (pref2.Loaded ())
-			background = *pref2;
+		if (prefs->fHighlightColorLoaded)
+			background = prefs->fHighlightColor;
 		else
 			background = ::SkinGetHighlightColor ();
 	}
 	else
 	{
-		if (pref1.Loaded ())
-			background = *pref1;
+		if (prefs->fBackgroundColorLoaded)
+			background = prefs->fBackgroundColor;
 		else
 			background = ::SkinGetBackgroundColor ();
 	}
@@ -17,7 +17,9 @@
 #include "CGremlins.h"			// Gremlins
 #include "CGremlinsStubs.h"		// StubAppGremlinsOff
 #include "EmApplication.h"		// ScheduleQuit
+#include "EmEventLog.h"			// EmEventLogReader
 #include "EmEventPlayback.h"	// SaveEvents, LoadEvents, Clear, RecordEvents
+#include "EmGremlinCoverage.h"	// EmGremlinCoverage::Start, EventPosted
 #include "EmMapFile.h"			// EmMapFile::Write, etc.
 #include "EmMinimize.h"			// EmMinimize::IsDone
 #include "EmPatchState.h"		// EmPatchState::UIInitialized
@@ -113,6 +115,7 @@ void Hordes::Reset (void)
 {
 	EmDlg::GremlinControlClose ();
 	Hordes::Stop ();
+	EmGremlinCoverage::Stop ();
 	gTheGremlin.Reset ();
 }
 
@@ -249,6 +252,8 @@ Hordes::New(const HordeInfo& info)
 
 	Hordes::StartLog ();
 
+	EmGremlinCoverage::Start ();
+
 	LogAppendMsg ("New Gremlin #%ld started anew to %ld events",
 					gremInfo.fNumber, gremInfo.fSteps);
 
@@ -468,6 +473,16 @@ Hordes::TurnOn (Bool hordesOn)
 {
 	gIsOn = (hordesOn != false);
 	EmEventPlayback::RecordEvents (gIsOn);
+
+	// Stream the events to disk as they're recorded, so that they're not
+	// lost if we crash before they get saved.  This stays on while Hordes
+	// is turned off for a moment (as when posting button events); it's
+	// turned off when the recorded events are cleared or replaced.
+
+	if (gIsOn)
+	{
+		EmEventPlayback::StreamEvents (Hordes::SuggestFileRef (kHordeEventLogFile));
+	}
 }
 
 
@@ -612,6 +627,8 @@ Hordes::EndHordes (void)
 		LogAppendMsg ("No Gremlins found errors.\n");
 	}
 
+	EmGremlinCoverage::Stop ();
+
 	LogDump ();
 
 	Hordes::TurnOn (false);
@@ -1122,6 +1139,7 @@ Hordes::Stop (void)
  *					kHordeRootFile
  *					kHordeSuspendFile
  *					kHordeAutoCurrentFile
+ *					kHordeCoverageFile
  *
  *					kHordeSuspendFile	-	last file in a gremlin thread
  *
@@ -1140,6 +1158,8 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 	static const char kStrAutoSaveFile[]		= "Gremlin_%03ld_Event_%08ld.psf";
 	static const char kStrEventFile[]			= "Gremlin_%03ld_Events.pev";
 	static const char kStrMinimalEventFile []	= "Gremlin_%03ld_Interim_Event_File_%08ld.pev";
+	static const char kStrCoverageFile[]		= "Gremlin_%03ld_Coverage_%03ld.psf";
+	static const char kStrEventLogFile[]		= "Gremlin_%03ld_Events.pel";
 
 	char fileName[64];
 
@@ -1194,6 +1214,18 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 			sprintf (fileName, kStrMinimalEventFile, gremlinNumber, time);
 			break;
 
+		case kHordeCoverageFile:
+
+			gremlinNumber = Hordes::GremlinNumber ();
+			sprintf (fileName, kStrCoverageFile, gremlinNumber, num);
+			break;
+
+		case kHordeEventLogFile:
+
+			gremlinNumber = Hordes::GremlinNumber ();
+			sprintf (fileName, kStrEventLogFile, gremlinNumber);
+			break;
+
 		default:
 
 			*fileName = '\0';
@@ -1219,6 +1251,7 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
  *					kHordeRootFile
  *					kHordeSuspendFile
  *					kHordeAutoCurrentFile
+ *					kHordeCoverageFile
  *
  *					kHordeSuspendFile	-	last file in a gremlin thread
  *
@@ -1397,6 +1430,8 @@ Hordes::BumpCounter (void)
 {
 	gTheGremlin.BumpCounter ();
 
+	EmGremlinCoverage::EventPosted ();
+
 	if (gGremlinSaveFrequency != 0 &&
 		(Hordes::EventCounter () % gGremlinSaveFrequency) == 0)
 	{
@@ -1528,8 +1563,7 @@ Hordes::GetGremlinsHome (EmDirRef& outPath)
  * FUNCTION:	Hordes::AutoSaveState
  *
  * DESCRIPTION: Creates a file reference to where the auto-saved state
- *				should be saved.  Then calls a platform-specific
- *				routine to do the actual saving.
+ *				should be saved.  Then saves it as a checkpoint.
  *
  * PARAMETERS:	None.
  *
@@ -1542,8 +1576,11 @@ Hordes::AutoSaveState (void)
 {
 	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeAutoCurrentFile);
 
+	// Each auto-save goes to its own file, so save them as a chain of
+	// checkpoints; most only need the handful of pages that changed.
+
 	EmAssert (gSession);
-	gSession->Save (fileRef, false);
+	gSession->SaveCheckpoint (fileRef);
 }
 
 
@@ -1703,6 +1740,54 @@ Hordes::LoadSuspendedState (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::SaveCoverageState
+ *
+ * DESCRIPTION: Saves the current state as the given entry in the
+ *				coverage-guided Gremlins corpus.
+ *
+ * PARAMETERS:	index - the corpus entry.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+Hordes::SaveCoverageState (uint32 index)
+{
+	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeCoverageFile, index);
+
+	EmAssert (gSession);
+	gSession->Save (fileRef, false);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::LoadCoverageState
+ *
+ * DESCRIPTION: Loads a state saved by SaveCoverageState.  The session
+ *				file records how many events had been recorded when it
+ *				was saved, but not the events themselves; the caller
+ *				is responsible for throwing away the ones after that
+ *				(see EmEventPlayback::TruncateEvents).
+ *
+ * PARAMETERS:	index - the corpus entry.
+ *
+ * RETURNED:	Any error from loading the file.
+ *
+ ***********************************************************************/
+
+ErrCode
+Hordes::LoadCoverageState (uint32 index)
+{
+	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeCoverageFile, index);
+
+	return Hordes::LoadState (fileRef);
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Hordes::SaveEvents
@@ -1763,6 +1848,22 @@ Hordes::LoadEvents (void)
 {
 	EmFileRef		eventRef = Hordes::SuggestFileRef (kHordeEventFile);
 
+	// If we crashed before the events were saved, get back what we can
+	// from the log they were streamed to.  The Gremlin may have gone on
+	// past the suspended state before crashing, so stop at the number of
+	// events that had been recorded when the state was saved.
+
+	if (!eventRef.Exists ())
+	{
+		long				numEvents = EmEventPlayback::GetSavedNumEvents ();
+		EmEventLogReader	reader (Hordes::SuggestFileRef (kHordeEventLogFile));
+
+		EmEventPlayback::Clear ();
+		EmEventPlayback::ReadEventLog (reader);
+		EmEventPlayback::TruncateEvents (numEvents);
+		return;
+	}
+
 	EmStreamFile	stream (eventRef, kOpenExistingForRead,
 						kFileCreatorEmulator, kFileTypeEvents);
 	ChunkFile		chunkFile (stream);
@@ -2410,6 +2511,10 @@ string Hordes::TranslateErrorCode (UInt32 errCode)
 			return "UserNameTooLong";
 			break;
 
+		case kStr_MappedFileTooBig:
+			return "MappedFileTooBig";
+			break;
+
 		default:
 			EmAssert (false);
 	}
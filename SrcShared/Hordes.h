@@ -26,7 +26,9 @@ enum HordeFileType
 	kHordeSuspendFile		= 0x02,
 	kHordeEventFile			= 0x03,
 	kHordeMinimalEventFile	= 0x04,
-	kHordeAutoCurrentFile	= 0x05
+	kHordeAutoCurrentFile	= 0x05,
+	kHordeCoverageFile		= 0x06,
+	kHordeEventLogFile		= 0x07
 };
 
 
@@ -114,6 +116,8 @@ class Hordes
 		static void				SaveRootState			(void);
 		static ErrCode			LoadRootState			(void);
 		static ErrCode			LoadSuspendedState		(void);
+		static void				SaveCoverageState		(uint32 index);
+		static ErrCode			LoadCoverageState		(uint32 index);
 
 		static void				LoadEvents				(void);
 		static void				SaveEvents				(void);
@@ -17,10 +17,11 @@
 
 #include "DebugMgr.h"			// gDebuggerGlobals
 #include "EmApplication.h"		// gApplication, ScheduleQuit
-#include "EmBankMapped.h"		// EmBankMapped::GetEmulatedAddress
-#include "EmCPU68K.h"			// gCPU68K, gStackHigh, etc.
+#include "EmBankMapped.h"		// EmBankMapped::GetEmulatedAddress, CanMapPhysicalMemory
+#include "EmClock.h"			// EmClock::GetClock, EmClock::GetTime, EmClock::LocalTime
+#include "EmCPU68K.h"			// gCPU68K, gStackHigh, UpdateHandlerTable, etc.
 #include "EmDirRef.h"			// EmDirRefList
-#include "EmDlg.h"				// DoGetFile, DoPutFile, DoGetDirectory
+#include "EmDlg.h"				// DoGetFile, DoPutFile, DoGetDirectory, DoCommonDialog
 #include "EmDocument.h"			// gDocument, HostSaveScreen, ScheduleNewHorde
 #include "EmErrCodes.h"			// kError_NoError
 #include "EmExgMgr.h"			// EmExgMgr::GetExgMgr
@@ -40,7 +41,7 @@
 #include "Platform.h"			// Platform::GetShortVersionString
 #include "Profiling.h"			// ProfileInit, ProfileStart, ProfileStop, etc.
 #include "ROMStubs.h"			// EvtWakeup
-#include "Strings.r.h"			// kStr_ProfileResults
+#include "Strings.r.h"			// kStr_ProfileResults, kStr_MappedFileTooBig
 
 #include <ctype.h>				// isdigit
 
@@ -138,6 +139,12 @@ struct MyDIR
 	int				fState;		// 0 = new, 1 = iterating dirs, 2 = iterating files, 3 = done
 };
 
+struct MyMappedFile
+{
+	void*			fData;		// As returned by Platform::MapFile
+	size_t			fSize;
+};
+
 
 typedef void		(*HostHandler) (void);
 
@@ -153,6 +160,7 @@ static void 		PrvPushString			(EmSubroutine& sub, ByteList& stackData,
 											 StringList& stringData);
 
 static FILE*		PrvToFILE				(emuptr);
+static uint8*		PrvGetDirectRange		(emuptr p, uint32 len);
 
 static void			PrvTmFromHostTm			(struct tm& dest, const HostTmType& src);
 static void			PrvHostTmFromTm			(EmProxyHostTmType& dest, const struct tm& src);
@@ -332,6 +340,7 @@ HostHandler			gHandlerTable [hostSelectorLastTrapNumber];
 vector<FILE*>		gOpenFiles;
 vector<MyDIR*>		gOpenDirs;
 vector<void*>		gAllocatedBlocks;
+vector<MyMappedFile>	gMappedFiles;
 HostDirEntType		gHostDirEnt;
 string				gResultString;
 EmProxyHostTmType	gGMTime;
@@ -1218,27 +1227,60 @@ static void _HostFRead (void)
 
 	CALLED_GET_PARAM_VAL (long, size);
 	CALLED_GET_PARAM_VAL (long, count);
-	CALLED_GET_PARAM_PTR (void, buffer, size * count, Marshal::kOutput);
+	CALLED_GET_PARAM_VAL (emuptr, buffer);
 	CALLED_GET_PARAM_FILE (fileP);
 
 	// Check the parameters.
 
-	if (!fh || buffer == EmMemNULL)
+	if (!fh || buffer == EmMemNULL || size < 0 || count < 0)
 	{
 		PUT_RESULT_VAL (long, 0);
 		errno = hostErrInvalidParameter;
 		return;
 	}
 
-	// Call the function.
+	// The caller supplies both size and count, so make sure the buffer's
+	// length doesn't overflow and the buffer doesn't wrap around the end
+	// of the address space.
 
-	size_t	result = x_fread (buffer, size, count, fh);
+	if ((count != 0 && (uint32) size > 0xFFFFFFFF / (uint32) count) ||
+		(uint32) size * (uint32) count > 0xFFFFFFFE - buffer)
+	{
+		PUT_RESULT_VAL (long, 0);
+		errno = hostErrInvalidParameter;
+		return;
+	}
 
-	// If the read succeeded, copy the data into the user's buffer.
+	// If the buffer is in plain RAM, read straight into it.  Otherwise,
+	// read into a copy and write that out a byte at a time.
 
-	if (result)
+	size_t	result;
+	uint32	len		= (uint32) size * (uint32) count;
+	emuptr	first	= buffer & ~1;
+	uint32	span	= ((buffer + len + 1) & ~1) - first;
+	uint8*	range	= ::PrvGetDirectRange (first, span);
+
+	if (range)
 	{
-		CALLED_PUT_PARAM_REF (buffer);
+		// On little-endian hosts, put the range in 68K byte order while
+		// the C library writes to it.  Swapping whole words this way
+		// leaves any bytes around the buffer that share its first or
+		// last word intact.
+
+		StWordSwapper	swapper (range, span);
+
+		result = x_fread (range + (buffer - first), size, count, fh);
+	}
+	else
+	{
+		StMemory	temp (len);
+
+		result = x_fread (temp.Get (), size, count, fh);
+
+		if (result)
+		{
+			EmMem_memcpy (buffer, (const void*) temp.Get (), result * size);
+		}
 	}
 
 	// Return the result.
@@ -1385,21 +1427,52 @@ static void _HostFWrite (void)
 
 	CALLED_GET_PARAM_VAL (long, size);
 	CALLED_GET_PARAM_VAL (long, count);
-	CALLED_GET_PARAM_PTR (void, buffer, size * count, Marshal::kInput);
+	CALLED_GET_PARAM_VAL (emuptr, buffer);
 	CALLED_GET_PARAM_FILE (fileP);
 
 	// Check the parameters.
 
-	if (!fh || buffer == EmMemNULL)
+	if (!fh || buffer == EmMemNULL || size < 0 || count < 0)
 	{
 		PUT_RESULT_VAL (long, 0);
 		errno = hostErrInvalidParameter;
 		return;
 	}
 
-	// Call the function.
+	// The caller supplies both size and count, so make sure the buffer's
+	// length doesn't overflow and the buffer doesn't wrap around the end
+	// of the address space.
 
-	size_t	result = x_fwrite (buffer, size, count, fh);
+	if ((count != 0 && (uint32) size > 0xFFFFFFFF / (uint32) count) ||
+		(uint32) size * (uint32) count > 0xFFFFFFFE - buffer)
+	{
+		PUT_RESULT_VAL (long, 0);
+		errno = hostErrInvalidParameter;
+		return;
+	}
+
+	// As with _HostFRead, hand plain RAM straight to the C library.
+
+	size_t	result;
+	uint32	len		= (uint32) size * (uint32) count;
+	emuptr	first	= buffer & ~1;
+	uint32	span	= ((buffer + len + 1) & ~1) - first;
+	uint8*	range	= ::PrvGetDirectRange (first, span);
+
+	if (range)
+	{
+		StWordSwapper	swapper (range, span);
+
+		result = x_fwrite (range + (buffer - first), size, count, fh);
+	}
+	else
+	{
+		StMemory	temp (len);
+
+		EmMem_memcpy ((void*) temp.Get (), buffer, len);
+
+		result = x_fwrite (temp.Get (), size, count, fh);
+	}
 
 	// Return the result.
 
@@ -1683,6 +1756,150 @@ static void _HostFree (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 _HostMapFile
+// ---------------------------------------------------------------------------
+
+static void _HostMapFile (void)
+{
+	// const void* HostMapFile(const char* nameP, long* sizeP)
+
+	CALLED_SETUP_HC ("void*", "const char* nameP, long* sizeP");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_STR (char, nameP);
+	CALLED_GET_PARAM_REF (long, sizeP, Marshal::kOutput);
+
+	// Check the parameters.
+
+	if (nameP == NULL)
+	{
+		PUT_RESULT_VAL (emuptr, EmMemNULL);
+		errno = hostErrInvalidParameter;
+		return;
+	}
+
+	EmFileRef	ref ((char*) nameP);
+
+	if (!ref.Exists ())
+	{
+		PUT_RESULT_VAL (emuptr, EmMemNULL);
+		errno = hostErrFileNotFound;
+		return;
+	}
+
+	// Get the file's size, and then map it.  Empty files can't be mapped.
+
+	int32	fileSize = 0;
+
+	try
+	{
+		EmStreamFile	stream (ref, kOpenExistingForRead);
+		fileSize = stream.GetLength ();
+	}
+	catch (...)
+	{
+	}
+
+	// Only so much of the emulated address space is set aside for mapped
+	// memory.  Tell the user about files that won't fit in it, as the
+	// error code alone doesn't say much.
+
+	if (fileSize > 0 && !EmBankMapped::CanMapPhysicalMemory (fileSize))
+	{
+		string		formatStr = Platform::GetString (kStr_MappedFileTooBig);
+		string		name = ref.GetName ();
+		StMemory	text (formatStr.size () + name.size () + 1);
+
+		sprintf (text.Get (), formatStr.c_str (), name.c_str ());
+		EmDlg::DoCommonDialog (text.Get (), kDlgFlags_OK);
+
+		PUT_RESULT_VAL (emuptr, EmMemNULL);
+		errno = hostErrFileTooBig;
+		return;
+	}
+
+	void*	data = fileSize > 0 ? Platform::MapFile (ref, fileSize) : NULL;
+
+	if (data == NULL)
+	{
+		PUT_RESULT_VAL (emuptr, EmMemNULL);
+		errno = fileSize > 0 ? hostErrPermissions : hostErrInvalidParameter;
+		return;
+	}
+
+	// Make it visible to emulated code.  Writes to it are bus errors, so
+	// the copy-on-write side of the mapping never comes into play.
+
+	EmBankMapped::MapPhysicalMemory (data, fileSize, true);
+
+	emuptr	result = EmBankMapped::GetEmulatedAddress (data);
+
+	if (result == EmMemNULL)
+	{
+		Platform::UnmapFile (data, fileSize);
+
+		PUT_RESULT_VAL (emuptr, EmMemNULL);
+		errno = hostErrOutOfMemory;
+		return;
+	}
+
+	MyMappedFile	mapped;
+	mapped.fData = data;
+	mapped.fSize = fileSize;
+	gMappedFiles.push_back (mapped);
+
+	// Return the result.
+
+	if (sizeP != EmMemNULL)
+	{
+		*sizeP = fileSize;
+		CALLED_PUT_PARAM_REF (sizeP);
+	}
+
+	PUT_RESULT_VAL (emuptr, result);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostUnmapFile
+// ---------------------------------------------------------------------------
+
+static void _HostUnmapFile (void)
+{
+	// HostErr HostUnmapFile(const void* p)
+
+	CALLED_SETUP_HC ("HostErr", "const void* p");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (emuptr, p);
+
+	// Find the mapping that starts at the given address.
+
+	void*	data = EmBankMapped::GetRealAddress (p);
+
+	vector<MyMappedFile>::iterator	iter = gMappedFiles.begin ();
+	while (iter != gMappedFiles.end ())
+	{
+		if (data != NULL && iter->fData == data)
+		{
+			EmBankMapped::UnmapPhysicalMemory (iter->fData);
+			Platform::UnmapFile (iter->fData, iter->fSize);
+			gMappedFiles.erase (iter);
+
+			PUT_RESULT_VAL (HostErr, hostErrNone);
+			return;
+		}
+
+		++iter;
+	}
+
+	PUT_RESULT_VAL (HostErr, hostErrInvalidParameter);
+}
+
+
 // ---------------------------------------------------------------------------
 //		 _HostAscTime
 // ---------------------------------------------------------------------------
@@ -1725,7 +1942,7 @@ static void _HostClock (void)
 
 	// Call the function.
 
-	clock_t	result = clock ();
+	clock_t	result = EmClock::GetClock ();
 
 	// Return the result.
 
@@ -1814,11 +2031,14 @@ static void _HostLocalTime (void)
 
 	time_t	myTime = *timeP;
 
-	// Call the function.
+	// Call the function.  Go through EmClock so that the host's time
+	// zone isn't used when the clock is virtual.
+
+	struct tm	result;
 
-	struct tm*	result = localtime (&myTime);
+	EmClock::LocalTime (myTime, result);
 
-	::PrvHostTmFromTm (gLocalTime, *result);
+	::PrvHostTmFromTm (gLocalTime, result);
 
 	// Return the result.
 
@@ -1844,9 +2064,10 @@ static void _HostMkTime (void)
 
 	::PrvTmFromHostTm (myTm, *timeP);
 
-	// Call the function.
+	// Call the function.  This is the inverse of HostLocalTime, so it,
+	// too, goes through EmClock.
 
-	time_t	result = mktime (&myTm);
+	time_t	result = EmClock::MakeTime (myTm);
 
 	// Return the result.
 
@@ -1911,7 +2132,7 @@ static void _HostTime (void)
 	// Call the function.
 
 	time_t	result2;
-	time_t	result = time (&result2);
+	time_t	result = result2 = EmClock::GetTime ();
 
 	if (timeP)
 	{
@@ -3945,6 +4166,10 @@ static void _HostDbgSetDataBreak (void)
 		gDebuggerGlobals.watchBytes = size;
 	}
 
+	// Make sure the CPU sees the writes to the watched range.
+
+	EmCPU68K::UpdateHandlerTable ();
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostErrType, errNone);
@@ -3975,6 +4200,8 @@ static void _HostDbgClearDataBreak (void)
 		gDebuggerGlobals.watchBytes = 0;
 	}
 
+	EmCPU68K::UpdateHandlerTable ();
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostErrType, errNone);
@@ -4490,6 +4717,51 @@ FILE* PrvToFILE (emuptr f)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 PrvGetDirectRange
+// ---------------------------------------------------------------------------
+// Return the host address of a word-aligned range of emulated memory if
+// HostFRead and HostFWrite can hand it to the C library directly.  It has
+// to be plain RAM that's contiguous on the host, with no meta-memory bits
+// set anywhere in it; if there were any, the bank handlers would have to
+// see the access (for access checks, screen updates, data breakpoints,
+// and so on).  Otherwise, return NULL.
+
+uint8* PrvGetDirectRange (emuptr p, uint32 len)
+{
+	EmAssert ((p & 1) == 0 && (len & 1) == 0);
+
+	if (len == 0 || p + len < p)
+		return NULL;
+
+	uint32	firstBank	= EmMemBankIndex (p);
+	uint32	lastBank	= EmMemBankIndex (p + len - 1);
+	uint8*	base		= gEmMemFastBase[firstBank];
+	uint8*	meta		= gEmMemFastMeta[firstBank];
+
+	if (base == NULL || meta == NULL)
+		return NULL;
+
+	for (uint32 bank = firstBank + 1; bank <= lastBank; ++bank)
+	{
+		uint32	delta = (bank - firstBank) << 16;
+
+		if (gEmMemFastBase[bank] != base + delta || gEmMemFastMeta[bank] != meta + delta)
+			return NULL;
+	}
+
+	uint32	offset = p & 0xFFFF;
+
+	for (uint32 ii = 0; ii < len; ++ii)
+	{
+		if (meta[offset + ii] != 0)
+			return NULL;
+	}
+
+	return base + offset;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 PrvTmFromHostTm
 // ---------------------------------------------------------------------------
@@ -4645,6 +4917,8 @@ void Host::Initialize	(void)
 	gHandlerTable [hostSelectorMalloc]					= _HostMalloc;
 	gHandlerTable [hostSelectorRealloc]					= _HostRealloc;
 	gHandlerTable [hostSelectorFree]					= _HostFree;
+	gHandlerTable [hostSelectorMapFile]					= _HostMapFile;
+	gHandlerTable [hostSelectorUnmapFile]				= _HostUnmapFile;
 
 	gHandlerTable [hostSelectorAscTime]					= _HostAscTime;
 	gHandlerTable [hostSelectorClock]					= _HostClock;
@@ -4825,6 +5099,20 @@ void PrvReleaseAllResources (void)
 		gAllocatedBlocks.clear ();
 	}
 
+	// Release all mapped files.
+
+	{
+		vector<MyMappedFile>::iterator	iter = gMappedFiles.begin ();
+		while (iter != gMappedFiles.end ())
+		{
+			EmBankMapped::UnmapPhysicalMemory (iter->fData);
+			Platform::UnmapFile (iter->fData, iter->fSize);
+			++iter;
+		}
+
+		gMappedFiles.clear ();
+	}
+
 	// Unmap misc memory.
 
 	EmBankMapped::UnmapPhysicalMemory (gResultString.c_str ());
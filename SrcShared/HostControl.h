@@ -106,6 +106,9 @@ extern "C" {
 #define hostSelectorRealloc					0x0319
 #define hostSelectorFree					0x031A
 
+#define hostSelectorMapFile					0x031B
+#define hostSelectorUnmapFile				0x031C
+
 	// time.h wrappers
 #define hostSelectorAscTime					0x0370
 #define hostSelectorClock					0x0371
@@ -671,6 +674,16 @@ void				HostFree(void* p)
 						HOST_TRAP(hostSelectorFree);
 
 
+	/* Map a host file into memory, read-only.  Returns NULL on error	*/
+	/* (see HostErrNo).  The file's size is returned in *sizeP.			*/
+
+const void*			HostMapFile(const char* nameP, long* sizeP)
+						HOST_TRAP(hostSelectorMapFile);
+
+HostErr				HostUnmapFile(const void* p)
+						HOST_TRAP(hostSelectorUnmapFile);
+
+
 char*				HostAscTime(const HostTmType*)
 						HOST_TRAP(hostSelectorAscTime);
 
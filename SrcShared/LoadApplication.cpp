@@ -17,6 +17,7 @@
 #include "EmErrCodes.h"			// kError_OutOfMemory
 #include "EmMemory.h"			// EmMem_memcpy
 #include "EmPalmStructs.h"		// RecordEntryType, RsrcEntryType, etc.
+#include "EmStorageReader.h"	// EmStorageImage, EmStorageReader
 #include "EmStreamFile.h"		// EmStreamFile
 #include "ErrorHandling.h"		// Errors::ThrowIfPalmError
 #include "Miscellaneous.h"		// StMemory
@@ -229,7 +230,7 @@ static void PrvMyShlExportAsPilotFile(EmStreamFile& fh, UInt16 cardNo, const cha
 			numRecords = ::DmNumRecords (dbP);
 
 			size = EmAliasDatabaseHdrType<LAS>::GetSize () + numRecords * EmAliasRecordEntryType<LAS>::GetSize () + kGapSize;
-			StMemory	outP(size);
+			StMemory	outP (size, true);
 
 			// Fill in header
 			EmAliasDatabaseHdrType<LAS>	hdr (outP.Get ());
@@ -377,5 +378,31 @@ static void PrvMyShlExportAsPilotFile(EmStreamFile& fh, UInt16 cardNo, const cha
 
 void SavePalmFile (EmStreamFile& appFile, UInt16 cardNo, const char* databaseName)
 {
+	// Databases in the RAM store can be read straight out of a copy of
+	// RAM, which is much quicker than going through the Data Manager.
+	// Anything it can't find (ROM databases, for instance) still goes
+	// through the Data Manager.
+
+	if (cardNo == 0)
+	{
+		EmStorageImage	image;
+
+		if (image.AcquireFromSession ())
+		{
+			EmStorageReader	reader (image);
+
+			if (reader.AcquireDatabases ())
+			{
+				const EmStorageReader::DatabaseType*	db = reader.FindDatabase (databaseName);
+
+				if (db)
+				{
+					reader.ExportDatabase (*db, appFile);
+					return;
+				}
+			}
+		}
+	}
+
 	::PrvMyShlExportAsPilotFile (appFile, cardNo, databaseName);
 }
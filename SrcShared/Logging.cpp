@@ -15,6 +15,7 @@
 #include "Logging.h"
 
 #include "EmApplication.h"		// gApplication, IsBound
+#include "EmAtomic.h"			// EmAtomicGet, EmAtomicSet
 #include "EmMemory.h"			// EmMemGet32, EmMemGet16, EmMem_strcpy, EmMem_strncat
 #include "EmStreamFile.h"		// EmStreamFile
 #include "Hordes.h"				// Hordes::IsOn, Hordes::EventCounter
@@ -91,6 +92,16 @@ void LogShutdown (void)
 }
 
 
+// Called by threads that may have logged, just before they exit, so that
+// the log can hand their record rings to other threads.
+
+void LogThreadExit (void)
+{
+	if (gStdLog)
+		gStdLog->ThreadExiting ();
+}
+
+
 // ---------------------------------------------------------------------------
 //		 CLASS LogStream
 // ---------------------------------------------------------------------------
@@ -100,6 +111,186 @@ const uint32	kInvalidTimestamp		= (uint32) -1;
 const int32		kInvalidGremlinCounter	= -2;
 const long		kEventTextMaxLen		= 255;
 
+const uint32	kRingSize				= 256 * 1024L;	// Must be a power of two.
+const uint32	kWriterPeriod			= 50;			// In milliseconds.
+
+
+// ---------------------------------------------------------------------------
+//		 CLASS LogRecordRing
+// ---------------------------------------------------------------------------
+// Single-producer, single-consumer ring of log records.  Each thread that
+// logs gets its own ring, so the producer side never needs a lock.  The
+// consumer side is whoever holds the LogStream's mutex.
+//
+// A record is a LogRecordHeader followed by fTextSize bytes of formatted
+// text and fDataSize bytes of raw binary data (for DataPrintf).  The
+// timestamp and the hex dump of the binary data are formatted by the
+// consumer, not the producer.  A record too big to fit in the ring is
+// written directly instead (see LogStream::Post), so it's never cut short.
+
+struct LogRecordHeader
+{
+	uint32	fSerial;		// Order in which records were posted, across all rings
+	uint32	fWhen;
+	int32	fEventCounter;
+	uint32	fTimestamp;
+	uint32	fTextSize;
+	uint32	fDataSize;
+};
+
+class LogRecordRing
+{
+	public:
+								LogRecordRing	(omni_thread* owner);
+								~LogRecordRing	(void);
+
+		omni_thread*			GetOwner		(void) const { return fOwner; }
+		void					SetOwner		(omni_thread* owner);
+		uint32					GetUsed			(void) const;
+
+		Bool					Put				(const LogRecordHeader&, const void* text, const void* data);
+		Bool					Peek			(LogRecordHeader&);
+		Bool					Get				(LogRecordHeader&, ByteList& payload);
+
+	private:
+		void					CopyIn			(uint32 offset, const void* src, uint32 size);
+		void					CopyOut			(uint32 offset, void* dest, uint32 size);
+
+		omni_thread* volatile	fOwner;		// NULL if free for another thread
+		uint8*					fBuffer;
+		volatile int32			fHead;		// Written only by the owner.
+		volatile int32			fTail;		// Written only by the consumer.
+};
+
+
+LogRecordRing::LogRecordRing (omni_thread* owner) :
+	fOwner (owner),
+	fBuffer ((uint8*) Platform::AllocateMemory (kRingSize)),
+	fHead (0),
+	fTail (0)
+{
+}
+
+
+LogRecordRing::~LogRecordRing (void)
+{
+	Platform::DisposeMemory (fBuffer);
+}
+
+
+void LogRecordRing::SetOwner (omni_thread* owner)
+{
+	EmAtomicExchangePtr ((void* volatile*) &fOwner, owner);
+}
+
+
+uint32 LogRecordRing::GetUsed (void) const
+{
+	return (uint32) EmAtomicGet (&fHead) - (uint32) EmAtomicGet (&fTail);
+}
+
+
+Bool LogRecordRing::Put (const LogRecordHeader& header, const void* text, const void* data)
+{
+	uint32	size = sizeof (header) + header.fTextSize + header.fDataSize;
+	uint32	head = (uint32) fHead;
+	uint32	tail = (uint32) EmAtomicGet (&fTail);
+
+	if (kRingSize - (head - tail) < size)
+		return false;
+
+	this->CopyIn (head, &header, sizeof (header));
+	head += sizeof (header);
+
+	this->CopyIn (head, text, header.fTextSize);
+	head += header.fTextSize;
+
+	this->CopyIn (head, data, header.fDataSize);
+	head += header.fDataSize;
+
+	// Publish the record only after all of it has been written.
+
+	EmAtomicSet (&fHead, (int32) head);
+
+	return true;
+}
+
+
+Bool LogRecordRing::Peek (LogRecordHeader& header)
+{
+	uint32	tail = (uint32) fTail;
+	uint32	head = (uint32) EmAtomicGet (&fHead);
+
+	if (tail == head)
+		return false;
+
+	this->CopyOut (tail, &header, sizeof (header));
+
+	return true;
+}
+
+
+Bool LogRecordRing::Get (LogRecordHeader& header, ByteList& payload)
+{
+	uint32	tail = (uint32) fTail;
+	uint32	head = (uint32) EmAtomicGet (&fHead);
+
+	if (tail == head)
+		return false;
+
+	this->CopyOut (tail, &header, sizeof (header));
+	tail += sizeof (header);
+
+	uint32	payloadSize = header.fTextSize + header.fDataSize;
+	payload.resize (payloadSize);
+
+	if (payloadSize)
+	{
+		this->CopyOut (tail, &payload[0], payloadSize);
+		tail += payloadSize;
+	}
+
+	// Give the space back to the producer only after we're done with it.
+
+	EmAtomicSet (&fTail, (int32) tail);
+
+	return true;
+}
+
+
+void LogRecordRing::CopyIn (uint32 offset, const void* src, uint32 size)
+{
+	offset &= kRingSize - 1;
+
+	uint32	firstPart = kRingSize - offset;
+
+	if (firstPart > size)
+		firstPart = size;
+
+	memcpy (fBuffer + offset, src, firstPart);
+	memcpy (fBuffer, (const uint8*) src + firstPart, size - firstPart);
+}
+
+
+void LogRecordRing::CopyOut (uint32 offset, void* dest, uint32 size)
+{
+	offset &= kRingSize - 1;
+
+	uint32	firstPart = kRingSize - offset;
+
+	if (firstPart > size)
+		firstPart = size;
+
+	memcpy (dest, fBuffer + offset, firstPart);
+	memcpy ((uint8*) dest + firstPart, fBuffer, size - firstPart);
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 CLASS LogStream
+// ---------------------------------------------------------------------------
 
 /***********************************************************************
  *
@@ -120,9 +311,26 @@ const long		kEventTextMaxLen		= 255;
 
 LogStream::LogStream (const char* baseName) :
 	fMutex (),
-	fInner (baseName)
+	fInner (baseName),
+	fNumRings (0),
+	fNextSerial (0),
+	fScratch ()
+#if HAS_OMNI_THREAD
+	,
+	fWriterCondition (&fMutex),
+	fWriter (NULL),
+	fWriterQuit (false)
+#endif
 {
 	gPrefs->AddNotification (PrefChanged, kPrefKeyLogFileSize, this);
+
+#if HAS_OMNI_THREAD
+	// Use the variant that takes a function returning void* so that
+	// the thread is created undetached and we can join it later.
+
+	fWriter = omni_thread::create (&LogStream::WriterStatic, this,
+		omni_thread::PRIORITY_LOW);
+#endif
 }
 
 
@@ -143,8 +351,27 @@ LogStream::~LogStream (void)
 {
 	gPrefs->RemoveNotification (PrefChanged);
 
+#if HAS_OMNI_THREAD
+	{
+		omni_mutex_lock lock (fMutex);
+
+		fWriterQuit = true;
+		fWriterCondition.signal ();
+	}
+
+	fWriter->join (NULL);
+	fWriter = NULL;
+#endif
+
 	omni_mutex_lock lock (fMutex);
+
+	this->Drain ();
 	fInner.DumpToFile ();
+
+	for (int32 ii = 0; ii < fNumRings; ++ii)
+	{
+		delete fRings[ii];
+	}
 }
 
 
@@ -170,15 +397,12 @@ int LogStream::Printf (const char* fmt, ...)
 	int		n;
 	va_list	arg;
 
-	omni_mutex_lock	lock (fMutex);
-
 	va_start (arg, fmt);
 
-	n = fInner.VPrintf (fmt, arg);
+	n = this->PostV (fmt, arg, true, NULL, 0);
 
 	va_end (arg);
 
-//	fInner.DumpToFile ();
 	return n;
 }
 
@@ -188,15 +412,12 @@ int LogStream::PrintfNoTime (const char* fmt, ...)
 	int		n;
 	va_list	arg;
 
-	omni_mutex_lock	lock (fMutex);
-
 	va_start (arg, fmt);
 
-	n = fInner.VPrintf (fmt, arg, false);
+	n = this->PostV (fmt, arg, false, NULL, 0);
 
 	va_end (arg);
 
-//	fInner.DumpToFile ();
 	return n;
 }
 
@@ -225,18 +446,17 @@ int LogStream::PrintfNoTime (const char* fmt, ...)
 
 int LogStream::DataPrintf (const void* data, long dataLen, const char* fmt, ...)
 {
-	omni_mutex_lock	lock (fMutex);
-
 	int		n;
 	va_list	arg;
 
 	va_start (arg, fmt);
 
-	n = fInner.VPrintf (fmt, arg);
+	// The data is copied into the log record as-is; it gets dumped
+	// nicely formatted when the record is written out.
 
-	// Dump the data nicely formatted
+	n = this->PostV (fmt, arg, true, data, dataLen);
 
-	n += fInner.DumpHex (data, dataLen);
+	va_end (arg);
 
 	return n;
 }
@@ -259,9 +479,7 @@ int LogStream::DataPrintf (const void* data, long dataLen, const char* fmt, ...)
 
 int LogStream::VPrintf (const char* fmt, va_list args)
 {
-	omni_mutex_lock	lock (fMutex);
-
-	return fInner.VPrintf (fmt, args);
+	return this->PostV (fmt, args, true, NULL, 0);
 }
 
 
@@ -279,9 +497,9 @@ int LogStream::VPrintf (const char* fmt, va_list args)
 
 int LogStream::Write (const void* buffer, long size)
 {
-	omni_mutex_lock	lock (fMutex);
+	this->Post (buffer, size, true, NULL, 0);
 
-	return fInner.Write (buffer, size);
+	return size;
 }
 
 
@@ -301,6 +519,7 @@ void LogStream::Clear (void)
 {
 	omni_mutex_lock	lock (fMutex);
 
+	this->Drain ();
 	fInner.Clear ();
 }
 
@@ -343,6 +562,7 @@ void LogStream::SetLogSize (long size)
 {
 	omni_mutex_lock	lock (fMutex);
 
+	this->Drain ();
 	fInner.SetLogSize (size);
 }
 
@@ -392,6 +612,7 @@ void LogStream::DumpToFile (void)
 {
 	omni_mutex_lock	lock (fMutex);
 
+	this->Drain ();
 	fInner.DumpToFile ();
 }
 
@@ -415,6 +636,331 @@ void LogStream::PrefChanged (PrefKeyType, PrefRefCon data)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::PostV
+ *
+ * DESCRIPTION:	Format the given text and queue it up, along with any
+ *				binary data, for the writer thread.
+ *
+ * PARAMETERS:	fmt, args - vprintf-like text to log.
+ *
+ *				timestamp - true if the text should be preceded by
+ *					a timestamp.
+ *
+ *				data, dataLen - optional binary data to dump after
+ *					the text.
+ *
+ * RETURNED:	Number of characters of text logged.
+ *
+ ***********************************************************************/
+
+int LogStream::PostV (const char* fmt, va_list args, Bool timestamp,
+					  const void* data, long dataLen)
+{
+	// The text has to be formatted here rather than in the writer
+	// thread: the arguments often point to temporary buffers.
+
+	char	buffer[2000];
+
+	int n = vsprintf (buffer, fmt, args);
+
+	// debug check, watch for buffer overflows here
+	if (n < 0 || n >= (int) sizeof (buffer))
+	{
+		Platform::Debugger();
+	}
+
+	this->Post (buffer, n, timestamp, data, dataLen);
+
+	return n;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::Post
+ *
+ * DESCRIPTION:	Queue up a log record in the calling thread's ring.  If
+ *				the thread can't have a ring, or if the ring is full,
+ *				fall back to writing the record synchronously.
+ *
+ * PARAMETERS:	text, textLen - already formatted text to log.
+ *
+ *				timestamp - true if the text should be preceded by
+ *					a timestamp.
+ *
+ *				data, dataLen - optional binary data to dump after
+ *					the text.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void LogStream::Post (const void* text, long textLen, Bool timestamp,
+					  const void* data, long dataLen)
+{
+	if (!data)
+		dataLen = 0;
+
+	LogRecordHeader	header;
+
+	header.fSerial			= (uint32) EmAtomicIncrement (&fNextSerial);
+	header.fWhen			= Platform::GetMilliseconds ();
+	header.fEventCounter	= Hordes::IsOn () ? Hordes::EventCounter () : kInvalidGremlinCounter;
+	header.fTimestamp		= timestamp ? 1 : 0;
+	header.fTextSize		= (uint32) textLen;
+	header.fDataSize		= (uint32) dataLen;
+
+	LogRecordRing*	ring = this->GetRing ();
+
+	if (ring)
+	{
+		uint32	usedBefore = ring->GetUsed ();
+
+		if (ring->Put (header, text, data))
+		{
+#if HAS_OMNI_THREAD
+			// Nudge the writer when the ring crosses the half-way mark
+			// so that we don't run into the synchronous path below.
+
+			if (usedBefore < kRingSize / 2 && ring->GetUsed () >= kRingSize / 2)
+			{
+				fWriterCondition.signal ();
+			}
+#endif
+
+			return;
+		}
+	}
+
+	// Synchronous path.  Drain first so that anything this thread
+	// queued up earlier comes out before this record.
+
+	omni_mutex_lock	lock (fMutex);
+
+	this->Drain ();
+
+	fInner.WriteAt (header.fWhen, header.fEventCounter, text, textLen, timestamp);
+	fInner.DumpHexAt (header.fWhen, header.fEventCounter, data, dataLen);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::GetRing
+ *
+ * DESCRIPTION:	Return the record ring for the calling thread, creating
+ *				it if necessary.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	The ring, or NULL if the caller should log synchronously
+ *				(it's not a thread we know how to identify, or all of
+ *				the rings we're going to hand out are in use).
+ *
+ ***********************************************************************/
+
+LogRecordRing* LogStream::GetRing (void)
+{
+#if HAS_OMNI_THREAD
+	omni_thread*	self = omni_thread::self ();
+
+	if (!self)
+		return NULL;
+
+	// Rings are only ever added, and fNumRings is bumped only after the
+	// new entry is in place, so this scan needs no lock.  A ring's owner
+	// only changes to or from the calling thread while it's in here or
+	// in ThreadExiting, so the owner test is safe, too.
+
+	int32	numRings = EmAtomicGet (&fNumRings);
+
+	for (int32 ii = 0; ii < numRings; ++ii)
+	{
+		if (fRings[ii]->GetOwner () == self)
+			return fRings[ii];
+	}
+
+	omni_mutex_lock	lock (fMutex);
+
+	// Reuse a ring given up by a thread that has exited.
+
+	for (int32 jj = 0; jj < fNumRings; ++jj)
+	{
+		if (fRings[jj]->GetOwner () == NULL)
+		{
+			fRings[jj]->SetOwner (self);
+			return fRings[jj];
+		}
+	}
+
+	if (fNumRings >= kMaxRings)
+		return NULL;
+
+	LogRecordRing*	ring = new LogRecordRing (self);
+
+	fRings[fNumRings] = ring;
+	EmAtomicSet (&fNumRings, fNumRings + 1);
+
+	return ring;
+#else
+	return NULL;
+#endif
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::ThreadExiting
+ *
+ * DESCRIPTION:	Give up the calling thread's record ring, if it has one,
+ *				so that another thread can use it.  Must be called by
+ *				a thread that logs when it's about to exit; otherwise,
+ *				its ring stays tied up for good.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void LogStream::ThreadExiting (void)
+{
+#if HAS_OMNI_THREAD
+	omni_thread*	self = omni_thread::self ();
+
+	if (!self)
+		return;
+
+	omni_mutex_lock	lock (fMutex);
+
+	for (int32 ii = 0; ii < fNumRings; ++ii)
+	{
+		if (fRings[ii]->GetOwner () == self)
+		{
+			// Empty it out first, so that the next owner starts with
+			// an empty ring.
+
+			this->Drain ();
+
+			fRings[ii]->SetOwner (NULL);
+			break;
+		}
+	}
+#endif
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::Drain
+ *
+ * DESCRIPTION:	Move all queued up records into the text buffer, in the
+ *				order in which they were posted.  Each ring is already
+ *				in that order, so this merges them by picking the ring
+ *				with the oldest record each time.  The caller must hold
+ *				fMutex.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void LogStream::Drain (void)
+{
+	for (;;)
+	{
+		LogRecordRing*	oldest = NULL;
+		LogRecordHeader	oldestHeader;
+		LogRecordHeader	header;
+
+		for (int32 ii = 0; ii < fNumRings; ++ii)
+		{
+			// Compare serial numbers so that wrap-around is handled.
+
+			if (fRings[ii]->Peek (header) &&
+				(!oldest || (int32) (header.fSerial - oldestHeader.fSerial) < 0))
+			{
+				oldest = fRings[ii];
+				oldestHeader = header;
+			}
+		}
+
+		if (!oldest)
+			break;
+
+		oldest->Get (header, fScratch);
+
+		const uint8*	payload = fScratch.empty () ? NULL : &fScratch[0];
+
+		fInner.WriteAt (header.fWhen, header.fEventCounter,
+			payload, header.fTextSize, header.fTimestamp != 0);
+
+		fInner.DumpHexAt (header.fWhen, header.fEventCounter,
+			payload + header.fTextSize, header.fDataSize);
+	}
+}
+
+
+#if HAS_OMNI_THREAD
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::WriterStatic
+ *
+ * DESCRIPTION:	Entry point for the writer thread.
+ *
+ * PARAMETERS:	data - the LogStream.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void* LogStream::WriterStatic (void* data)
+{
+	((LogStream*) data)->Writer ();
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStream::Writer
+ *
+ * DESCRIPTION:	Body of the writer thread.  Periodically (or when a
+ *				ring starts filling up) drains the record rings.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void LogStream::Writer (void)
+{
+	const unsigned long	kNanosecondsPerMillisecond = 1000000;
+
+	omni_mutex_lock	lock (fMutex);
+
+	while (!fWriterQuit)
+	{
+		unsigned long	secs;
+		unsigned long	nsecs;
+
+		omni_thread::get_time (&secs, &nsecs, 0, kWriterPeriod * kNanosecondsPerMillisecond);
+
+		fWriterCondition.timedwait (secs, nsecs);
+
+		this->Drain ();
+	}
+}
+
+#endif
+
+
 #pragma mark -
 
 /***********************************************************************
@@ -489,6 +1035,27 @@ LogStreamInner::~LogStreamInner (void)
  ***********************************************************************/
 
 int LogStreamInner::DumpHex (const void* data, long dataLen)
+{
+	return this->DumpHexAt (Platform::GetMilliseconds (),
+		Hordes::IsOn () ? Hordes::EventCounter () : kInvalidGremlinCounter,
+		data, dataLen);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStreamInner::DumpHexAt
+ *
+ * DESCRIPTION:	Same as DumpHex, but timestamping the lines with the
+ *				given time and Gremlin event counter.
+ *
+ * PARAMETERS:	
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+int LogStreamInner::DumpHexAt (uint32 when, int32 eventCounter, const void* data, long dataLen)
 {
 	int n = 0;
 	const uint8*	dataP = (const uint8*) data;
@@ -531,7 +1098,7 @@ int LogStreamInner::DumpHex (const void* data, long dataLen)
 
 			EmAssert (p - text <= (ptrdiff_t) sizeof (text));
 
-			this->Write (text, p - text);
+			this->WriteAt (when, eventCounter, text, p - text, true);
 		}
 	}	
 
@@ -585,9 +1152,36 @@ int LogStreamInner::VPrintf (const char* fmt, va_list args, Bool timestamp)
  ***********************************************************************/
 
 int LogStreamInner::Write (const void* buffer, long size, Bool timestamp)
+{
+	return this->WriteAt (Platform::GetMilliseconds (),
+		Hordes::IsOn () ? Hordes::EventCounter () : kInvalidGremlinCounter,
+		buffer, size, timestamp);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	LogStreamInner::WriteAt
+ *
+ * DESCRIPTION:	Same as Write, but using the given time and Gremlin
+ *				event counter for the timestamp.  Used when writing
+ *				records that were queued up some time ago.
+ *
+ * PARAMETERS:	when - Platform::GetMilliseconds at the time the
+ *					record was logged.
+ *
+ *				eventCounter - Hordes::EventCounter at the time the
+ *					record was logged, or kInvalidGremlinCounter if
+ *					no Gremlin was running.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+int LogStreamInner::WriteAt (uint32 when, int32 eventCounter, const void* buffer, long size, Bool timestamp)
 {
 	if (timestamp)
-		this->Timestamp ();
+		this->Timestamp (when, eventCounter);
 
 	this->Append ((const char*) buffer, size);
 	this->NewLine ();
@@ -856,16 +1450,19 @@ EmFileRef LogStreamInner::CreateFileReference (void)
  *
  * DESCRIPTION:	Outputs a timestamp to the log stream.
  *
- * PARAMETERS:	none
+ * PARAMETERS:	when - time to print.
+ *
+ *				eventCounter - Gremlin event number to print, or
+ *					kInvalidGremlinCounter if none.
  *
  * RETURNED:	nothing
  *
  ***********************************************************************/
 
-void LogStreamInner::Timestamp (void)
+void LogStreamInner::Timestamp (uint32 now, int32 eventCounter)
 {
 	Bool	reformat = false;
-	uint32	now = Platform::GetMilliseconds ();
+	Bool	gremlinsOn = eventCounter != kInvalidGremlinCounter;
 
 	// This may be a case of pre-optimization, but we try to keep around
 	// a formatted timestamp string for as long as possible.  If either
@@ -875,7 +1472,7 @@ void LogStreamInner::Timestamp (void)
 	if (fLastTimestampTime != now)
 		reformat = true;
 
-	if (!reformat && Hordes::IsOn () && fLastGremlinEventCounter != Hordes::EventCounter ())
+	if (!reformat && gremlinsOn && fLastGremlinEventCounter != eventCounter)
 		reformat = true;
 
 	if (reformat)
@@ -888,14 +1485,17 @@ void LogStreamInner::Timestamp (void)
 		if (fBaseTimestampTime == kInvalidTimestamp)
 			fBaseTimestampTime = now;
 
-		now -= fBaseTimestampTime;
+		// Records from different threads are drained one thread at a
+		// time, so a record can be slightly older than the base.
+
+		now = (now > fBaseTimestampTime) ? now - fBaseTimestampTime : 0;
 
 		// If a Gremlin is running, use a formatting string that includes
 		// the event number.  Otherwise, use a format string that omits it.
 
-		if (Hordes::IsOn ())
+		if (gremlinsOn)
 		{
-			fLastGremlinEventCounter = Hordes::EventCounter ();
+			fLastGremlinEventCounter = eventCounter;
 			sprintf (fLastTimestampString, "%ld.%03ld (%ld):\t", now / 1000, now % 1000, fLastGremlinEventCounter);
 		}
 		else
@@ -14,6 +14,7 @@
 #ifndef _LOGGING_H_
 #define _LOGGING_H_
 
+#include "EmStructs.h"			// ByteList
 #include "Hordes.h"				// Hordes::IsOn
 #include "Miscellaneous.h"		// StMemory
 #include "PreferenceMgr.h"		// FOR_EACH_PREF
@@ -25,6 +26,7 @@
 typedef deque<uint8>	ByteDeque;
 
 class EmStreamFile;
+class LogRecordRing;
 
 
 class LogStreamInner
@@ -40,6 +42,11 @@ class LogStreamInner
 		int						VPrintf			(const char* fmt, va_list args, Bool timestamp = true);
 		int						Write			(const void* buffer, long size, Bool timestamp = true);
 
+		int						DumpHexAt		(uint32 when, int32 eventCounter,
+												 const void*, long dataLen);
+		int						WriteAt			(uint32 when, int32 eventCounter,
+												 const void* buffer, long size, Bool timestamp);
+
 		void					Clear			(void);
 
 		long					GetLogSize		(void);
@@ -51,7 +58,7 @@ class LogStreamInner
 	private:
 		void					DumpToFile			(EmStreamFile&, const char*, long size);
 		EmFileRef				CreateFileReference	(void);
-		void					Timestamp			(void);
+		void					Timestamp			(uint32 when, int32 eventCounter);
 		void					NewLine				(void);
 		void					Append				(const char* buffer, long size);
 		void					TrimLeading			(void);
@@ -91,12 +98,46 @@ class LogStream
 		void					EnsureNewFile	(void);
 		void					DumpToFile		(void);
 
+		void					ThreadExiting	(void);
+
 	private:
 		static void				PrefChanged			(PrefKeyType, PrefRefCon);	
 
+		int						PostV				(const char* fmt, va_list args, Bool timestamp,
+													 const void* data, long dataLen);
+		void					Post				(const void* text, long textLen, Bool timestamp,
+													 const void* data, long dataLen);
+		LogRecordRing*			GetRing				(void);
+		void					Drain				(void);
+
+#if HAS_OMNI_THREAD
+		static void*			WriterStatic		(void*);
+		void					Writer				(void);
+#endif
+
 	private:
+		// Records are queued up by the logging threads in per-thread
+		// rings without taking fMutex.  A background writer thread
+		// (or anyone else holding fMutex) drains them into fInner,
+		// merging the rings in the order the records were posted.
+		// A thread's ring is handed to another thread once the first
+		// one calls ThreadExiting.
+
+		enum { kMaxRings = 8 };
+
 		omni_mutex				fMutex;
 		LogStreamInner			fInner;
+
+		LogRecordRing*			fRings[kMaxRings];
+		volatile int32			fNumRings;
+		volatile int32			fNextSerial;
+		ByteList				fScratch;
+
+#if HAS_OMNI_THREAD
+		omni_condition			fWriterCondition;
+		omni_thread*			fWriter;
+		Bool					fWriterQuit;
+#endif
 };
 
 void		LogEvtAddEventToQueue		(const EventType& event);
@@ -111,6 +152,7 @@ void		LogEvtGetSysEvent			(const EventType& event, Int32 timeout);
 LogStream*	LogGetStdLog				(void);
 void		LogStartup					(void);
 void		LogShutdown					(void);
+void		LogThreadExit				(void);
 
 #define LogAppendMsg		if (!LogGetStdLog ()) ; else LogGetStdLog ()->Printf
 #define LogAppendMsgNoTime	if (!LogGetStdLog ()) ; else LogGetStdLog ()->PrintfNoTime
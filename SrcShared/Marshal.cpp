@@ -1829,5 +1829,5 @@ void Marshal::PutSysKernelInfoType (emuptr p, const SysKernelInfoType& src)
 
 #ifdef SONY_ROM
 #include "UAE.h"
-#include "SonyShared\MarshalSony.inl"
+#include "SonyShared/MarshalSony.inl"
 #endif //SONY_ROM
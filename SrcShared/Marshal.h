@@ -21,9 +21,9 @@
 #include "Platform.h"			// Platform::AllocateMemory
 
 #ifdef SONY_ROM
-#include "SonyShared\ExpansionMgr.h"
-#include "SonyShared\VFSMgr.h"
-#include "SonyShared\SlotDrvLib.h"	// for Sony & SlotDriver Lib, CardMetricsType
+#include "SonyShared/ExpansionMgr.h"
+#include "SonyShared/VFSMgr.h"
+#include "SonyShared/SlotDrvLib.h"	// for Sony & SlotDriver Lib, CardMetricsType
 #endif //SONY_ROM
 
 
@@ -393,7 +393,7 @@ class Marshal
 		DECLARE_STRUCT_MARSHALLER (SysNVParamsType)
 
 #ifdef SONY_ROM
-#include	"SonyShared\MarshalSony.h"
+#include	"SonyShared/MarshalSony.h"
 #endif //SONY_ROM
 };
 
@@ -76,6 +76,11 @@ static Bool PrvForEachUIObject (IterFn fn, void* data);
 
 void MetaMemory::Initialize (void)
 {
+	// The direct-access opcode handlers hard-code the bits that make a
+	// write go through the bank handlers (see EmMemFastPut32).
+
+	COMPILE_TIME_ASSERT (kEmMemFastPutMetaBits ==
+		(kScreenBuffer | kSymbolIndex | kDataBreak));
 }
 
 
@@ -59,6 +59,9 @@ class MetaMemory
 		static void				MarkDataBreak			(emuptr begin, emuptr end);
 		static void				UnmarkDataBreak			(emuptr begin, emuptr end);
 
+		static void				MarkSymbolIndex			(emuptr begin, emuptr end);
+		static void				UnmarkSymbolIndex		(emuptr begin, emuptr end);
+
 		// Called when memory needs to be marked as initialized or not.
 
 #if FOR_LATER
@@ -153,6 +156,7 @@ class MetaMemory
 		static Bool				IsScreenBuffer16		(uint8* metaAddress);	// Inlined, defined below
 		static Bool				IsScreenBuffer32		(uint8* metaAddress);	// Inlined, defined below
 		static Bool				IsScreenBuffer			(uint8* metaAddress, uint32 size);
+		static Bool				IsSymbolIndex			(uint8* metaAddress, uint32 size);	// Inlined, defined below
 
 		static Bool				IsCPUBreak				(emuptr opcodeLocation);
 		static Bool				IsCPUBreak				(uint8* metaLocation);
@@ -225,7 +229,7 @@ class MetaMemory
 			kNoAppAccess		= 0x0001,
 			kNoSystemAccess		= 0x0002,
 			kNoMemMgrAccess		= 0x0004,
-			kUnusedMeta1		= 0x0008,
+			kSymbolIndex		= 0x0008,	// Code in the symbol index; forget that part of the index if these bytes are changed.
 			kStackBuffer		= 0x0010,	// Stack buffer; check to see if below-SP access is made.
 			kScreenBuffer		= 0x0020,	// Screen buffer; update host screen if these bytes are changed.
 			kInstructionBreak	= 0x0040,	// Halt CPU emulation and check to see why.
@@ -393,6 +397,28 @@ inline Bool MetaMemory::IsScreenBuffer (uint8* metaAddress, uint32 size)
 	return false;
 }
 
+inline Bool MetaMemory::IsSymbolIndex (uint8* metaAddress, uint32 size)
+{
+	if (size == 1)
+	{
+		const uint8 kMask = META_BITS_8 (kSymbolIndex);
+
+		return (META_VALUE_8 (metaAddress) & kMask) != 0;
+	}
+	else if (size == 2)
+	{
+		const uint16 kMask = META_BITS_16 (kSymbolIndex);
+
+		return (META_VALUE_16 (metaAddress) & kMask) != 0;
+	}
+
+	EmAssert (size == 4);
+
+	const uint32 kMask = META_BITS_32 (kSymbolIndex);
+
+	return (META_VALUE_32 (metaAddress) & kMask) != 0;
+}
+
 inline Bool MetaMemory::IsScreenBuffer8 (uint8* metaAddress)
 {
 	const uint8 kMask = META_BITS_8 (kScreenBuffer);
@@ -694,4 +720,24 @@ inline void MetaMemory::UnmarkDataBreak (emuptr begin, emuptr end)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 MetaMemory::MarkSymbolIndex
+// ---------------------------------------------------------------------------
+
+inline void MetaMemory::MarkSymbolIndex (emuptr begin, emuptr end)
+{
+	MarkRange (begin, end, kSymbolIndex);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::UnmarkSymbolIndex
+// ---------------------------------------------------------------------------
+
+inline void MetaMemory::UnmarkSymbolIndex (emuptr begin, emuptr end)
+{
+	UnmarkRange (begin, end, kSymbolIndex);
+}
+
+
 #endif /* _METAMEMORY_H_ */
@@ -17,6 +17,7 @@
 #include "Byteswapping.h"		// Canonical
 #include "ChunkFile.h"			// Chunk::GetPointer
 #include "EmBankMapped.h"		// EmBankMapped::GetEmulatedAddress
+#include "EmClock.h"			// EmClock::GetLocalTime
 #include "EmErrCodes.h"			// kError_UnimplementedTrap
 #include "EmHAL.h"				// EmHAL::ResetTimer, EmHAL::ResetRTC
 #include "EmLowMem.h"			// EmLowMem_SetGlobal, EmLowMem_GetGlobal
@@ -32,6 +33,8 @@
 #include "Strings.r.h"			// kStr_INetLibTrapBase, etc.
 #include "UAE.h"				// m68k_dreg, etc.
 
+#include "omnithread.h"			// omni_mutex
+
 #include <algorithm>			// sort()
 #include <locale.h> 			// localeconv, lconv
 #include <strstream>			// strstream
@@ -103,6 +106,11 @@ extern "C"
 	int PrvGzipWriteProc	(char* buf, unsigned size);
 }
 
+// The gzip code keeps its state in globals, so only one thread at a time
+// can be compressing or decompressing.
+
+static omni_mutex	gGzipMutex;
+
 static void*	gSrcP;
 static void*	gDstP;
 static long 	gSrcBytes;
@@ -1725,6 +1733,8 @@ long RunLengthWorstSize (long srcBytes)
 
 void GzipEncode (void** srcPP, void** dstPP, long srcBytes, long dstBytes)
 {
+	omni_mutex_lock	lock (gGzipMutex);
+
 	gSrcP		= *srcPP;
 	gDstP		= *dstPP;
 	gSrcBytes	= srcBytes;
@@ -1781,6 +1791,8 @@ void GzipEncode (void** srcPP, void** dstPP, long srcBytes, long dstBytes)
 
 void GzipDecode (void** srcPP, void** dstPP, long srcBytes, long dstBytes)
 {
+	omni_mutex_lock	lock (gGzipMutex);
+
 	gSrcP		= *srcPP;
 	gDstP		= *dstPP;
 	gSrcBytes	= srcBytes;
@@ -2441,6 +2453,8 @@ Bool GetSystemCallContext (emuptr pc, SystemCallContext& context)
  * FUNCTION:	GetHostTime
  *
  * DESCRIPTION: Returns the current time in hours, minutes, and seconds.
+ *				This is the time according to EmClock, which may not
+ *				be the host's.
  *
  * PARAMETERS:	none
  *
@@ -2450,11 +2464,9 @@ Bool GetSystemCallContext (emuptr pc, SystemCallContext& context)
 
 void GetHostTime (long* hour, long* min, long* sec)
 {
-	time_t t;
 	struct tm tm;
 	
-	time (&t);
-	tm = *localtime (&t);
+	EmClock::GetLocalTime (tm);
 	
 	*hour = tm.tm_hour; 	// 0...23
 	*min =	tm.tm_min;		// 0...59
@@ -2467,6 +2479,8 @@ void GetHostTime (long* hour, long* min, long* sec)
  * FUNCTION:	GetHostDate
  *
  * DESCRIPTION: Returns years since 1900, month as 0-11, and day as 1-31
+ *				This is the date according to EmClock, which may not
+ *				be the host's.
  *
  * PARAMETERS:	none
  *
@@ -2476,11 +2490,9 @@ void GetHostTime (long* hour, long* min, long* sec)
 
 void GetHostDate (long* year, long* month, long* day)
 {
-	time_t t;
 	struct tm tm;
 	
-	time (&t);
-	tm = *localtime (&t);
+	EmClock::GetLocalTime (tm);
 	
 	*year =  tm.tm_year + 1900; 	// 1904...2040
 	*month = tm.tm_mon + 1; 		// 1...12
@@ -23,10 +23,10 @@
 #include "EmPatchState.h"
 
 #ifdef SONY_ROM
-#include "SonyShared\EmPatchModule_ExpMgr.h"
-#include "SonyShared\EmPatchModule_MsfsLib.h"
-#include "SonyShared\EmPatchModule_SlotDrvLib.h"
-#include "SonyShared\EmPatchModule_VfsLib.h"
+#include "SonyShared/EmPatchModule_ExpMgr.h"
+#include "SonyShared/EmPatchModule_MsfsLib.h"
+#include "SonyShared/EmPatchModule_SlotDrvLib.h"
+#include "SonyShared/EmPatchModule_VfsLib.h"
 #endif //SONY_ROM
 // ======================================================================
 // This is where you might say all the good stuff actually happens... 
@@ -39,13 +39,10 @@
 
 #ifdef SONY_ROM
 #include "EmPatchModuleSys.h" 
-#include "SonyShared\EmPatchModule_ExpMgr.h"
-#include "SonyShared\EmPatchModule_VfsLib.h"
-#include "SonyShared\EmPatchModule_MsfsLib.h"
-#include "SonyShared\EmPatchModule_SlotDrvLib.h"
-
-extern 	gMsfsLibPatchTable;		// MS FileSystem Lib for Sony's ROM
-extern 	gSlotDrvLibPatchTable;	// Slot driver Lib for Sony's ROM
+#include "SonyShared/EmPatchModule_ExpMgr.h"
+#include "SonyShared/EmPatchModule_VfsLib.h"
+#include "SonyShared/EmPatchModule_MsfsLib.h"
+#include "SonyShared/EmPatchModule_SlotDrvLib.h"
 #endif //SONY_ROM
 
 #pragma mark -
@@ -174,7 +171,7 @@ void EmPatchMgr::Reset (void)
 
 void EmPatchMgr::Save (SessionFile& f)
 {
-	const long	kCurrentVersion = 5;
+	const long	kCurrentVersion = 6;
 
 	Chunk			chunk;
 	EmStreamChunk	s (chunk);
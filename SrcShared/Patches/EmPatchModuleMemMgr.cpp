@@ -1248,72 +1248,28 @@ void PrvRememberChunk (emuptr p)
 	}
 
 	//
-	// Ensure this pointer is not already on our list.
+	// Ensure this pointer is not already on our list.  If it is,
+	// we have a stale pointer in our list.  Look it up directly
+	// rather than walking the list, as this is called for every
+	// allocation.
 	//
 
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
+	if (EmPatchState::fgData.fTrackedChunks.Contains (p, false))
 	{
-		//
-		// If we have recorded a handle, make sure that our handle
-		// does not reference this newly allocated chunk.  That would
-		// indicate that we have a stale handle in our list.
-		//
-
-		if (iter->isHandle)
-		{
-			emuptr	hDereffed = (emuptr) EmPalmHeap::DerefHandle ((MemHandle) iter->ptr);
-			if (hDereffed == p)
-			{
-				EmAssert (false);
-			}
-		}
-
-		//
-		// If we have recorded a pointer, make sure that it doesn't
-		// also point to the newly allocated chunk.  That would indicate
-		// that we have a stale pointer in our list.
-		//
-
-		else
-		{
-			if (iter->ptr == p)
-			{
-				EmAssert (false);
-			}
-		}
-
-		++iter;
+		EmAssert (false);
 	}
 #endif
 
 	//
-	// Push an empty record onto our list.  We'll update it after
-	// it's on the list in order to reduce any performance impact
-	// due to copying the stack crawl.  Push the chunk at the front
-	// of the list; the theory here is that recently added chunks
-	// will be the ones most likely to be removed later, so adding
-	// them to the front will speed up the removal process when
-	// performing a forward traversal.
+	// Record the chunk along with the context in which it was
+	// allocated.  The stack crawl is shared with any other chunks
+	// allocated from the same place.
 	//
 
-	EmTrackedChunk	chunk;
-	EmPatchState::fgData.fTrackedChunks.push_front (chunk);
-
-	//
-	// Get the pointer to the newly-added record.
-	//
+	EmStackFrameList	stackCrawl;
+	EmPalmOS::GenerateStackCrawl (stackCrawl);
 
-	EmTrackedChunkList::reference	newChunk = EmPatchState::fgData.fTrackedChunks.front ();
-
-	//
-	// Fill in the newly added record.
-	//
-
-	newChunk.ptr		= p;
-	newChunk.isHandle	= false;
-
-	EmPalmOS::GenerateStackCrawl (newChunk.stackCrawl);
+	EmPatchState::fgData.fTrackedChunks.Add (p, false, stackCrawl);
 }
 
 
@@ -1344,73 +1300,41 @@ void PrvRememberHandle (emuptr h)
 
 #ifdef _DEBUG
 	//
-	// Ensure this handle is not already on our list.
+	// Ensure this handle is not already on our list.  If it is,
+	// we have a stale handle in our list.  Look it up directly
+	// rather than walking the list, as this is called for every
+	// allocation.
 	//
 
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
+	if (EmPatchState::fgData.fTrackedChunks.Contains (h, true))
 	{
-		//
-		// If we have recorded a handle, make sure it does not
-		// match the newly allocated handle.  That would indicate
-		// that we have a stale handle in our list.
-		//
-
-		if (iter->isHandle)
-		{
-			if (iter->ptr == h)
-			{
-				EmAssert (false);
-			}
-		}
-
-		//
-		// If we have recorded a pointer, make sure it is not
-		// pointed to by the newly allocate handle.  That would
-		// indicate that we have a stale pointer in our list.
-		//
-
-		else
-		{
-			emuptr hDereffed = (emuptr) EmPalmHeap::DerefHandle ((MemHandle) h);
-
-			if (iter->ptr == hDereffed)
-			{
-				EmAssert (false);
-			}
-		}
-
-		++iter;
+		EmAssert (false);
 	}
-#endif
 
 	//
-	// Push an empty record onto our list.  We'll update it after
-	// it's on the list in order to reduce any performance impact
-	// due to copying the stack crawl.  Push the handle at the front
-	// of the list; the theory here is that recently added chunks
-	// will be the ones most likely to be removed later, so adding
-	// them to the front will speed up the removal process when
-	// performing a forward traversal.
+	// Make sure we haven't recorded a pointer to the chunk that
+	// the newly allocated handle references.  That would indicate
+	// that we have a stale pointer in our list.
 	//
 
-	EmTrackedChunk	chunk;
-	EmPatchState::fgData.fTrackedChunks.push_front (chunk);
+	emuptr	hDereffed = (emuptr) EmPalmHeap::DerefHandle ((MemHandle) h);
 
-	//
-	// Get the pointer to the newly-added record.
-	//
-
-	EmTrackedChunkList::reference	newChunk = EmPatchState::fgData.fTrackedChunks.front ();
+	if (hDereffed && EmPatchState::fgData.fTrackedChunks.Contains (hDereffed, false))
+	{
+		EmAssert (false);
+	}
+#endif
 
 	//
-	// Fill in the newly added record.
+	// Record the handle along with the context in which it was
+	// allocated.  The stack crawl is shared with any other handles
+	// allocated from the same place.
 	//
 
-	newChunk.ptr		= h;
-	newChunk.isHandle	= true;
+	EmStackFrameList	stackCrawl;
+	EmPalmOS::GenerateStackCrawl (stackCrawl);
 
-	EmPalmOS::GenerateStackCrawl (newChunk.stackCrawl);
+	EmPatchState::fgData.fTrackedChunks.Add (h, true, stackCrawl);
 }
 
 
@@ -1444,24 +1368,10 @@ void PrvForgetChunk (emuptr p)
 	}
 
 	//
-	// Look for the given chunk in our records.
+	// Remove the given chunk from our records, if it's there.
 	//
 
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
-	{
-		if (!iter->isHandle && iter->ptr == p)
-		{
-			//
-			// If we've found it, erase it from our list and return.
-			//
-
-			EmPatchState::fgData.fTrackedChunks.erase (iter);
-			return;
-		}
-
-		++iter;
-	}
+	EmPatchState::fgData.fTrackedChunks.Remove (p, false);
 }
 
 
@@ -1481,24 +1391,10 @@ void PrvForgetChunk (emuptr p)
 void PrvForgetHandle (emuptr h)
 {
 	//
-	// Look for the given handle in our records.
+	// Remove the given handle from our records, if it's there.
 	//
 
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
-	{
-		if (iter->isHandle && iter->ptr == h)
-		{
-			//
-			// If we've found it, erase it from our list and return.
-			//
-
-			EmPatchState::fgData.fTrackedChunks.erase (iter);
-			return;
-		}
-
-		++iter;
-	}
+	EmPatchState::fgData.fTrackedChunks.Remove (h, true);
 }
 
 
@@ -1520,8 +1416,11 @@ void PrvForgetHandle (emuptr h)
 
 void PrvForgetAll (UInt16 heapID, UInt16 ownerID)
 {
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
+	EmTrackedChunkList	chunks;
+	EmPatchState::fgData.fTrackedChunks.GetChunks (chunks);
+
+	EmTrackedChunkList::iterator	iter = chunks.begin ();
+	while (iter != chunks.end ())
 	{
 		const EmPalmHeap*	heap	= NULL;
 		const EmPalmChunk*	chunk	= NULL;
@@ -1547,15 +1446,15 @@ void PrvForgetAll (UInt16 heapID, UInt16 ownerID)
 
 		if (chunk && chunk->Owner () == ownerID)
 		{
-			iter = EmPatchState::fgData.fTrackedChunks.erase (iter);
+			EmPatchState::fgData.fTrackedChunks.Remove (iter->ptr, iter->isHandle);
 		}
 		else
 		{
 			if (chunk)
 				EmAssert (!chunk->Free ());
-
-			++iter;
 		}
+
+		++iter;
 	}
 }
 
@@ -1578,8 +1477,11 @@ int PrvCountLeaks (UInt16 ownerID)
 {
 	int	leaks = 0;
 
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
+	EmTrackedChunkList	chunks;
+	EmPatchState::fgData.fTrackedChunks.GetChunks (chunks);
+
+	EmTrackedChunkList::iterator	iter = chunks.begin ();
+	while (iter != chunks.end ())
 	{
 		const EmPalmHeap*	heap	= NULL;
 		const EmPalmChunk*	chunk	= NULL;
@@ -1638,8 +1540,11 @@ int PrvCountLeaks (UInt16 ownerID)
 
 void PrvReportMemoryLeaks (UInt16 ownerID)
 {
-	EmTrackedChunkList::iterator	iter = EmPatchState::fgData.fTrackedChunks.begin ();
-	while (iter != EmPatchState::fgData.fTrackedChunks.end ())
+	EmTrackedChunkList	chunks;
+	EmPatchState::fgData.fTrackedChunks.GetChunks (chunks);
+
+	EmTrackedChunkList::iterator	iter = chunks.begin ();
+	while (iter != chunks.end ())
 	{
 		const EmPalmHeap*	heap	= NULL;
 		const EmPalmChunk*	chunk	= NULL;
@@ -1671,7 +1576,7 @@ void PrvReportMemoryLeaks (UInt16 ownerID)
 
 			if (!::PrvLeakException (*chunk))
 			{
-				if (iter != EmPatchState::fgData.fTrackedChunks.begin ())
+				if (iter != chunks.begin ())
 				{
 					LogAppendMsg ("--------------------------------------------------------");
 				}
@@ -1711,19 +1616,21 @@ void PrvReportLeakedChunk (const EmTrackedChunk& tracked, const EmPalmChunk& chu
 
 	StringList	stackCrawlFunctions;
 
-	EmStackFrameList::const_iterator	iter = tracked.stackCrawl.begin ();
-	while (iter != tracked.stackCrawl.end ())
+	const EmTrackedTrace&	trace = EmPatchState::fgData.fTrackedChunks.GetTrace (tracked.traceID);
+
+	EmTrackedTrace::const_iterator	iter = trace.begin ();
+	while (iter != trace.end ())
 	{
 		// Get the function name.
 
 		char	funcName[256] = {0};
-		::FindFunctionName (iter->fAddressInFunction, funcName, NULL, NULL, 255);
+		::FindFunctionName (*iter, funcName, NULL, NULL, 255);
 
 		// If we can't find the name, dummy one up.
 
 		if (strlen (funcName) == 0)
 		{
-			sprintf (funcName, "<Unknown @ 0x%08lX>", iter->fAddressInFunction);
+			sprintf (funcName, "<Unknown @ 0x%08lX>", *iter);
 		}
 
 		stackCrawlFunctions.push_back (string (funcName));
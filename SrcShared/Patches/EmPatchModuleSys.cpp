@@ -87,7 +87,9 @@
 #ifdef SONY_ROM
 #include "EmCommands.h"
 #include "EmWindow.h"
+#if PLATFORM_WINDOWS
 #include "EmWindowWin.h"		// GetHostWindow
+#endif
 #include "UAE.h"
 #endif //SONY_ROM
 
@@ -1423,9 +1425,7 @@ CallROMType SysHeadpatch::PrefSetAppPreferences (void)
 
 CallROMType SysHeadpatch::SndDoCmd (void)
 {
-	Preference<bool>	pref (kPrefKeyEnableSounds);
-
-	if (!*pref)
+	if (!gPrefs->GetSnapshot ()->fEnableSounds)
 		return kExecuteROM;
 
 	// Err SndDoCmd(void * chanP, SndCommandPtr cmdP, Boolean noWait)
@@ -1914,8 +1914,7 @@ CallROMType SysHeadpatch::SysEvGroupWait (void)
 
 CallROMType SysHeadpatch::SysFatalAlert (void)
 {
-	Preference<bool>	pref (kPrefKeyInterceptSysFatalAlert);
-	if (!*pref)
+	if (!gPrefs->GetSnapshot ()->fInterceptSysFatalAlert)
 	{
 		// Palm OS will display a dialog with just a Reset button
 		// in it.  So *always* turn off the Gremlin, as the user
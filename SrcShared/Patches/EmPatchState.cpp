@@ -24,12 +24,6 @@
 #include "ROMStubs.h"
 
 
-EmStream& operator >> (EmStream& inStream, EmStackFrame& outInfo);
-EmStream& operator << (EmStream& inStream, const EmStackFrame& inInfo);
-EmStream& operator >> (EmStream& inStream, EmTrackedChunk& outInfo);
-EmStream& operator << (EmStream& inStream, const EmTrackedChunk& inInfo);
-
-
 // STATIC class data:
 
 EmPatchStateData EmPatchState::fgData;
@@ -66,7 +60,7 @@ Err EmPatchState::Reset (void)
 	fgData.fHeapID 					= 0;
 
 	fgData.fRememberedHeaps.clear ();
-	fgData.fTrackedChunks.clear ();
+	fgData.fTrackedChunks.Clear ();
 
 	fgData.fLastEvtTrap				= 0;
 	fgData.fOSVersion				= kOSUndeterminedVersion;
@@ -137,9 +131,9 @@ Err EmPatchState::Save (EmStreamChunk &s, long streamFmtVer, PersistencePhase pa
 
 		s << fgData.fUIReset;
 
-		// Added in version 5
+		// Added in version 5, changed to the interned format in version 6.
 
-		s << fgData.fTrackedChunks;
+		fgData.fTrackedChunks.Save (s);
 	}
 
 	return errNone;
@@ -201,9 +195,13 @@ Err EmPatchState::Load (EmStreamChunk &s, long streamFmtVer, PersistencePhase pa
 			s >> fgData.fUIReset;
 		}
 
-		if (streamFmtVer >= 5)
+		if (streamFmtVer >= 6)
 		{
-			s >> fgData.fTrackedChunks;
+			fgData.fTrackedChunks.Load (s);
+		}
+		else if (streamFmtVer >= 5)
+		{
+			fgData.fTrackedChunks.LoadV5 (s);
 		}
 	}
 
@@ -978,57 +976,3 @@ EmuAppInfo EmPatchState::GetRootAppInfo (void)
 
 	return result;
 }
-
-
-// ---------------------------------------------------------------------------
-//		 operator >> (EmStream&, EmStackFrame&)
-// ---------------------------------------------------------------------------
-
-EmStream& operator >> (EmStream& inStream, EmStackFrame& outInfo)
-{
-	inStream >> outInfo.fAddressInFunction;
-	inStream >> outInfo.fA6;
-
-	return inStream;
-}
-
-
-// ---------------------------------------------------------------------------
-//		 operator << (EmStream&, const EmStackFrame&)
-// ---------------------------------------------------------------------------
-
-EmStream& operator << (EmStream& inStream, const EmStackFrame& inInfo)
-{
-	inStream << inInfo.fAddressInFunction;
-	inStream << inInfo.fA6;
-
-	return inStream;
-}
-
-
-// ---------------------------------------------------------------------------
-//		 operator >> (EmStream&, EmTrackedChunk&)
-// ---------------------------------------------------------------------------
-
-EmStream& operator >> (EmStream& inStream, EmTrackedChunk& outInfo)
-{
-	inStream >> outInfo.ptr;
-	inStream >> outInfo.isHandle;
-	inStream >> outInfo.stackCrawl;
-
-	return inStream;
-}
-
-
-// ---------------------------------------------------------------------------
-//		 operator << (EmStream&, const EmTrackedChunk&)
-// ---------------------------------------------------------------------------
-
-EmStream& operator << (EmStream& inStream, const EmTrackedChunk& inInfo)
-{
-	inStream << inInfo.ptr;
-	inStream << inInfo.isHandle;
-	inStream << inInfo.stackCrawl;
-
-	return inStream;
-}
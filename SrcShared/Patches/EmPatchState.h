@@ -18,6 +18,7 @@
 #include "ChunkFile.h"
 #include "EmPalmHeap.h"
 #include "EmPatchModuleTypes.h"
+#include "EmTrackedChunks.h"	// EmTrackedChunkTable
 #include "PreferenceMgr.h"		// PrefKeyType
 
 #include <vector>
@@ -52,19 +53,6 @@ struct EmuAppInfo
 typedef vector<EmuAppInfo>	EmuAppInfoList;
 
 
-// Structure used to keep track of the context in which
-// memory chunks were allocated.
-
-struct EmTrackedChunk
-{
-	emuptr				ptr;
-	bool				isHandle;
-	EmStackFrameList	stackCrawl;
-};
-
-typedef list<EmTrackedChunk> EmTrackedChunkList;
-
-
 struct EmPatchStateData
 {
 	public:
@@ -127,7 +115,7 @@ struct EmPatchStateData
 
 		EmHeapMap				fRememberedHeaps;
 
-		EmTrackedChunkList		fTrackedChunks;
+		EmTrackedChunkTable		fTrackedChunks;
 };
 
 
@@ -0,0 +1,565 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmTrackedChunks.h"
+
+#include "EmStream.h"			// EmStream
+
+#include <algorithm>			// sort
+
+
+static uint32	PrvHashChunk		(emuptr ptr, bool isHandle);
+static uint32	PrvHashTrace		(const EmTrackedTrace& trace);
+static bool		PrvNewerChunk		(const EmTrackedChunk& a, const EmTrackedChunk& b);
+
+const long		kMinCapacity		= 256;
+
+
+// What EmTrackedChunk looked like in version 5 session files.
+
+struct EmOldTrackedChunk
+{
+	emuptr				ptr;
+	bool				isHandle;
+	EmStackFrameList	stackCrawl;
+};
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::EmTrackedChunkTable
+// ---------------------------------------------------------------------------
+
+EmTrackedChunkTable::EmTrackedChunkTable (void) :
+	fSlots (),
+	fCount (0),
+	fNextSerial (0),
+	fTraces (),
+	fTraceRefs (),
+	fFreeTraces (),
+	fTraceIndex ()
+{
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Clear
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::Clear (void)
+{
+	fSlots.clear ();
+	fCount = 0;
+	fNextSerial = 0;
+
+	fTraces.clear ();
+	fTraceRefs.clear ();
+	fFreeTraces.clear ();
+	fTraceIndex.clear ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Add
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::Add (emuptr ptr, bool isHandle, const EmStackFrameList& stackCrawl)
+{
+	EmTrackedTrace	trace;
+	trace.reserve (stackCrawl.size ());
+
+	EmStackFrameList::const_iterator	iter = stackCrawl.begin ();
+	while (iter != stackCrawl.end ())
+	{
+		trace.push_back (iter->fAddressInFunction);
+		++iter;
+	}
+
+	this->AddTrace (ptr, isHandle, trace);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Remove
+// ---------------------------------------------------------------------------
+// Removes the given chunk, returning whether or not it was found.  Uses
+// backward-shift deletion instead of tombstones, so that a long run of
+// allocations and frees doesn't slowly fill the table with dead slots.
+
+Bool EmTrackedChunkTable::Remove (emuptr ptr, bool isHandle)
+{
+	long	hole = this->FindSlot (ptr, isHandle);
+
+	if (hole < 0)
+		return false;
+
+	this->ReleaseTrace (fSlots[hole].fTraceID);
+
+	long	mask	= fSlots.size () - 1;
+	long	index	= hole;
+
+	while (true)
+	{
+		index = (index + 1) & mask;
+
+		if (!fSlots[index].fUsed)
+			break;
+
+		// The entry at "index" can move into the hole if the slot it
+		// hashes to is not between the hole and its current position.
+
+		long	home = PrvHashChunk (fSlots[index].fPtr, fSlots[index].fIsHandle != 0) & mask;
+
+		if (((index - home) & mask) >= ((index - hole) & mask))
+		{
+			fSlots[hole] = fSlots[index];
+			hole = index;
+		}
+	}
+
+	fSlots[hole].fUsed = false;
+	--fCount;
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Contains
+// ---------------------------------------------------------------------------
+
+Bool EmTrackedChunkTable::Contains (emuptr ptr, bool isHandle) const
+{
+	return this->FindSlot (ptr, isHandle) >= 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::GetChunks
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::GetChunks (EmTrackedChunkList& chunks) const
+{
+	chunks.clear ();
+	chunks.reserve (fCount);
+
+	vector<Slot>::const_iterator	iter = fSlots.begin ();
+	while (iter != fSlots.end ())
+	{
+		if (iter->fUsed)
+		{
+			EmTrackedChunk	chunk;
+
+			chunk.ptr		= iter->fPtr;
+			chunk.isHandle	= iter->fIsHandle != 0;
+			chunk.traceID	= iter->fTraceID;
+			chunk.serial	= iter->fSerial;
+
+			chunks.push_back (chunk);
+		}
+
+		++iter;
+	}
+
+	sort (chunks.begin (), chunks.end (), PrvNewerChunk);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::GetTrace
+// ---------------------------------------------------------------------------
+
+const EmTrackedTrace& EmTrackedChunkTable::GetTrace (uint32 traceID) const
+{
+	EmAssert (traceID < fTraces.size ());
+	EmAssert (fTraceRefs[traceID] > 0);
+
+	return fTraces[traceID];
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Save
+// ---------------------------------------------------------------------------
+// Writes each live trace once, followed by the chunks (oldest first) with
+// the index of their trace.  Trace IDs are renumbered so that freed IDs
+// don't take up space in the file.
+
+void EmTrackedChunkTable::Save (EmStream& s) const
+{
+	vector<uint32>	newIDs (fTraces.size (), 0);
+	uint32			numTraces = 0;
+
+	uint32	ii;
+	for (ii = 0; ii < fTraces.size (); ++ii)
+	{
+		if (fTraceRefs[ii] > 0)
+		{
+			newIDs[ii] = numTraces++;
+		}
+	}
+
+	s << numTraces;
+
+	for (ii = 0; ii < fTraces.size (); ++ii)
+	{
+		if (fTraceRefs[ii] == 0)
+			continue;
+
+		const EmTrackedTrace&	trace = fTraces[ii];
+
+		s << (uint32) trace.size ();
+
+		EmTrackedTrace::const_iterator	iter = trace.begin ();
+		while (iter != trace.end ())
+		{
+			s << *iter;
+			++iter;
+		}
+	}
+
+	EmTrackedChunkList	chunks;
+	this->GetChunks (chunks);
+
+	s << (uint32) chunks.size ();
+
+	EmTrackedChunkList::reverse_iterator	iter = chunks.rbegin ();
+	while (iter != chunks.rend ())
+	{
+		s << iter->ptr;
+		s << iter->isHandle;
+		s << newIDs[iter->traceID];
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Load
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::Load (EmStream& s)
+{
+	this->Clear ();
+
+	uint32	numTraces;
+	s >> numTraces;
+
+	vector<EmTrackedTrace>	traces (numTraces);
+
+	uint32	ii;
+	for (ii = 0; ii < numTraces; ++ii)
+	{
+		uint32	numFrames;
+		s >> numFrames;
+
+		traces[ii].resize (numFrames);
+
+		for (uint32 jj = 0; jj < numFrames; ++jj)
+		{
+			s >> traces[ii][jj];
+		}
+	}
+
+	uint32	numChunks;
+	s >> numChunks;
+
+	for (ii = 0; ii < numChunks; ++ii)
+	{
+		emuptr	ptr;
+		bool	isHandle;
+		uint32	traceID;
+
+		s >> ptr;
+		s >> isHandle;
+		s >> traceID;
+
+		EmAssert (traceID < numTraces);
+
+		this->AddTrace (ptr, isHandle, traces[traceID]);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::LoadV5
+// ---------------------------------------------------------------------------
+// Reads the format used before the table existed: a list of chunks, newest
+// first, each with its own copy of the full stack crawl.
+
+void EmTrackedChunkTable::LoadV5 (EmStream& s)
+{
+	this->Clear ();
+
+	Int32	numChunks;
+	s >> numChunks;
+
+	vector<EmOldTrackedChunk>	chunks (numChunks);
+
+	Int32	ii;
+	for (ii = 0; ii < numChunks; ++ii)
+	{
+		s >> chunks[ii].ptr;
+		s >> chunks[ii].isHandle;
+
+		Int32	numFrames;
+		s >> numFrames;
+
+		chunks[ii].stackCrawl.resize (numFrames);
+
+		for (Int32 jj = 0; jj < numFrames; ++jj)
+		{
+			s >> chunks[ii].stackCrawl[jj].fAddressInFunction;
+			s >> chunks[ii].stackCrawl[jj].fA6;
+		}
+	}
+
+	for (ii = numChunks - 1; ii >= 0; --ii)
+	{
+		this->Add (chunks[ii].ptr, chunks[ii].isHandle, chunks[ii].stackCrawl);
+	}
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::FindSlot
+// ---------------------------------------------------------------------------
+
+long EmTrackedChunkTable::FindSlot (emuptr ptr, bool isHandle) const
+{
+	if (fSlots.size () == 0)
+		return -1;
+
+	long	mask	= fSlots.size () - 1;
+	long	index	= PrvHashChunk (ptr, isHandle) & mask;
+
+	while (fSlots[index].fUsed)
+	{
+		if (fSlots[index].fPtr == ptr && (fSlots[index].fIsHandle != 0) == isHandle)
+			return index;
+
+		index = (index + 1) & mask;
+	}
+
+	return -1;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::AddTrace
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::AddTrace (emuptr ptr, bool isHandle, const EmTrackedTrace& trace)
+{
+	// The MemMgr patches check for this, but a stale entry shouldn't
+	// leave two slots for the same chunk.
+
+	this->Remove (ptr, isHandle);
+
+	// Keep the load factor at or below 1/2.
+
+	if ((fCount + 1) * 2 > (long) fSlots.size ())
+	{
+		this->Grow ();
+	}
+
+	this->Insert (ptr, isHandle, this->InternTrace (trace), fNextSerial++);
+	++fCount;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Insert
+// ---------------------------------------------------------------------------
+// Puts the entry in the first free slot in its probe sequence.  Doesn't
+// touch fCount; the caller has already made room.
+
+void EmTrackedChunkTable::Insert (emuptr ptr, bool isHandle, uint32 traceID, uint32 serial)
+{
+	long	mask	= fSlots.size () - 1;
+	long	index	= PrvHashChunk (ptr, isHandle) & mask;
+
+	while (fSlots[index].fUsed)
+	{
+		index = (index + 1) & mask;
+	}
+
+	Slot&	slot = fSlots[index];
+
+	slot.fPtr		= ptr;
+	slot.fUsed		= true;
+	slot.fIsHandle	= isHandle;
+	slot.fTraceID	= traceID;
+	slot.fSerial	= serial;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::Grow
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::Grow (void)
+{
+	long	newCapacity = fSlots.size () ? fSlots.size () * 2 : kMinCapacity;
+
+	Slot	empty;
+	memset (&empty, 0, sizeof (empty));
+
+	vector<Slot>	oldSlots (newCapacity, empty);
+	oldSlots.swap (fSlots);		// oldSlots now holds the old entries
+
+	vector<Slot>::iterator	iter = oldSlots.begin ();
+	while (iter != oldSlots.end ())
+	{
+		if (iter->fUsed)
+		{
+			this->Insert (iter->fPtr, iter->fIsHandle != 0, iter->fTraceID, iter->fSerial);
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::InternTrace
+// ---------------------------------------------------------------------------
+// Returns the ID of an existing trace equal to the given one, or adds it
+// to the table.  Either way, the trace's reference count is bumped.
+
+uint32 EmTrackedChunkTable::InternTrace (const EmTrackedTrace& trace)
+{
+	uint32	hash = PrvHashTrace (trace);
+
+	typedef multimap<uint32, uint32>::iterator	IndexIter;
+	pair<IndexIter, IndexIter>	range = fTraceIndex.equal_range (hash);
+
+	IndexIter	iter = range.first;
+	while (iter != range.second)
+	{
+		if (fTraces[iter->second] == trace)
+		{
+			++fTraceRefs[iter->second];
+			return iter->second;
+		}
+
+		++iter;
+	}
+
+	uint32	traceID;
+
+	if (fFreeTraces.size () > 0)
+	{
+		traceID = fFreeTraces.back ();
+		fFreeTraces.pop_back ();
+
+		fTraces[traceID] = trace;
+	}
+	else
+	{
+		traceID = fTraces.size ();
+
+		fTraces.push_back (trace);
+		fTraceRefs.push_back (0);
+	}
+
+	fTraceRefs[traceID] = 1;
+	fTraceIndex.insert (make_pair (hash, traceID));
+
+	return traceID;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmTrackedChunkTable::ReleaseTrace
+// ---------------------------------------------------------------------------
+
+void EmTrackedChunkTable::ReleaseTrace (uint32 traceID)
+{
+	EmAssert (traceID < fTraces.size ());
+	EmAssert (fTraceRefs[traceID] > 0);
+
+	if (--fTraceRefs[traceID] > 0)
+		return;
+
+	typedef multimap<uint32, uint32>::iterator	IndexIter;
+	pair<IndexIter, IndexIter>	range = fTraceIndex.equal_range (PrvHashTrace (fTraces[traceID]));
+
+	IndexIter	iter = range.first;
+	while (iter != range.second)
+	{
+		if (iter->second == traceID)
+		{
+			fTraceIndex.erase (iter);
+			break;
+		}
+
+		++iter;
+	}
+
+	fTraces[traceID].clear ();
+	fFreeTraces.push_back (traceID);
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvHashChunk
+// ---------------------------------------------------------------------------
+// Chunks are at least 2-byte aligned, and handles 4-byte aligned, so the
+// low bits of the address carry little information.  Mix them up with a
+// multiplicative (Fibonacci) hash before the caller masks off the low bits.
+
+uint32 PrvHashChunk (emuptr ptr, bool isHandle)
+{
+	uint32	hash = (ptr ^ (isHandle ? 1 : 0)) * 2654435761UL;
+
+	return hash ^ (hash >> 16);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHashTrace
+// ---------------------------------------------------------------------------
+
+uint32 PrvHashTrace (const EmTrackedTrace& trace)
+{
+	// FNV-1a over the function addresses.
+
+	uint32	hash = 2166136261UL;
+
+	EmTrackedTrace::const_iterator	iter = trace.begin ();
+	while (iter != trace.end ())
+	{
+		hash = (hash ^ *iter) * 16777619UL;
+		++iter;
+	}
+
+	return hash;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvNewerChunk
+// ---------------------------------------------------------------------------
+
+bool PrvNewerChunk (const EmTrackedChunk& a, const EmTrackedChunk& b)
+{
+	return a.serial > b.serial;
+}
@@ -0,0 +1,111 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmTrackedChunks_h
+#define EmTrackedChunks_h
+
+#include "EmStructs.h"			// EmStackFrameList
+
+#include <map>					// multimap
+#include <vector>				// vector
+
+class EmStream;
+
+
+// Structure used to keep track of the context in which
+// memory chunks were allocated.  The stack crawl is kept
+// in EmTrackedChunkTable's trace table and referred to by
+// ID, as most chunks are allocated from a handful of places.
+
+struct EmTrackedChunk
+{
+	emuptr				ptr;
+	bool				isHandle;
+	uint32				traceID;
+	uint32				serial;		// Allocation order; newer is larger
+};
+
+typedef vector<EmTrackedChunk>	EmTrackedChunkList;
+
+
+// The function addresses from a stack crawl.  We don't keep the
+// frame pointers; they're not needed for reporting, and would keep
+// otherwise identical crawls from being shared.
+
+typedef vector<emuptr>			EmTrackedTrace;
+
+
+/*
+	EmTrackedChunkTable holds the chunks and handles allocated from the
+	dynamic heap while MemMgr leak checking is on.  Chunks are kept in
+	an open-addressed (linear probing) hash table keyed by address and
+	type, so remembering and forgetting a chunk doesn't depend on how
+	many chunks are live.  Stack crawls are interned into a reference-
+	counted trace table.
+*/
+
+class EmTrackedChunkTable
+{
+	public:
+								EmTrackedChunkTable		(void);
+
+		void					Clear					(void);
+
+		void					Add						(emuptr ptr, bool isHandle,
+														 const EmStackFrameList& stackCrawl);
+		Bool					Remove					(emuptr ptr, bool isHandle);
+		Bool					Contains				(emuptr ptr, bool isHandle) const;
+
+		long					Size					(void) const { return fCount; }
+
+		// Returns the tracked chunks, most recently allocated first.
+
+		void					GetChunks				(EmTrackedChunkList&) const;
+
+		const EmTrackedTrace&	GetTrace				(uint32 traceID) const;
+
+		void					Save					(EmStream&) const;
+		void					Load					(EmStream&);
+		void					LoadV5					(EmStream&);
+
+	private:
+		struct Slot
+		{
+			emuptr				fPtr;
+			uint8				fUsed;
+			uint8				fIsHandle;
+			uint32				fTraceID;
+			uint32				fSerial;
+		};
+
+		long					FindSlot				(emuptr ptr, bool isHandle) const;
+		void					AddTrace				(emuptr ptr, bool isHandle,
+														 const EmTrackedTrace& trace);
+		void					Insert					(emuptr ptr, bool isHandle,
+														 uint32 traceID, uint32 serial);
+		void					Grow					(void);
+
+		uint32					InternTrace				(const EmTrackedTrace&);
+		void					ReleaseTrace			(uint32 traceID);
+
+		vector<Slot>			fSlots;			// Size is zero or a power of two
+		long					fCount;
+		uint32					fNextSerial;
+
+		vector<EmTrackedTrace>	fTraces;
+		vector<uint32>			fTraceRefs;		// Zero if the ID is free
+		vector<uint32>			fFreeTraces;
+		multimap<uint32, uint32>	fTraceIndex;	// Trace hash -> trace ID
+};
+
+#endif	// EmTrackedChunks_h
@@ -153,6 +153,15 @@ class Platform
 		template <class T>
 		static void 			FreeMemory				(T*& p) { DisposeMemory(p); }
 
+		static void*			MapFile					(const EmFileRef& f, size_t size);
+		static void				UnmapFile				(void* p, size_t size);
+			// Map a file of exactly the given size into memory.  The
+			// mapping is copy-on-write: it can be written to, but the
+			// changes are private to this process and never reach the
+			// file.  Unmodified pages are shared with other processes
+			// that map the same file.  Returns NULL if the file does not
+			// exist, is not the given size, or cannot be mapped.
+
 		static Bool				ForceStartupScreen		(void);
 		static Bool 			StopOnResetKeyDown		(void);
 
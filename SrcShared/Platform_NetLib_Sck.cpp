@@ -14,7 +14,7 @@
 #include "EmCommon.h"
 #include "Platform_NetLib.h"
 
-#include "PreferenceMgr.h"		// Preference
+#include "PreferenceMgr.h"		// gPrefs
 #include "Byteswapping.h"		// Canonical
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// StMemory
@@ -277,8 +277,7 @@ void Platform_NetLib::Dispose		(void)
 
 Bool Platform_NetLib::Redirecting (void)
 {
-	Preference<bool>	pref (kPrefKeyRedirectNetLib);
-	return *pref;
+	return gPrefs->GetSnapshot ()->fRedirectNetLib;
 }
 
 
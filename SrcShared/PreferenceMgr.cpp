@@ -14,13 +14,16 @@
 #include "EmCommon.h"
 #include "PreferenceMgr.h"
 
+#include "EmAtomic.h"			// EmAtomicExchangePtr
 #include "EmCPU.h"				// gCPU
 #include "EmHAL.h"				// EmHAL::GetLineDriverState
 #include "EmMapFile.h"			// EmMapFile
+#include "EmPrefStore.h"		// EmPrefStore
 #include "EmSession.h"			// EmSessionStopper
 #include "EmTransportSerial.h"	// EmTransportSerial
 #include "EmTransportSocket.h"	// EmTransportSocket
 #include "EmTransportUSB.h"		// EmTransportUSB
+#include "Miscellaneous.h"		// EmValueChanger
 #include "Platform.h"			// _stricmp
 #include "StringConversions.h"	// ToString, FromString
 
@@ -1017,7 +1020,9 @@ void Preference<SlotInfoList>::DoSave (void)
  *
  * FUNCTION:	Preferences::Preferences
  *
- * DESCRIPTION: Constructor.  Does nothing but construct data members.
+ * DESCRIPTION: Constructor.  Constructs data members and, if this is
+ *				the global preferences object, sets up the snapshot of
+ *				frequently-read preferences.
  *
  * PARAMETERS:	None
  *
@@ -1026,10 +1031,29 @@ void Preference<SlotInfoList>::DoSave (void)
  ***********************************************************************/
 
 Preferences::Preferences (void) :
-	fPreferences ()
+	fPreferences (),
+	fStore (new EmPrefStore),
+	fSnapshot (NULL),
+	fRetiredSnapshots ()
 {
 	if (gPrefs == NULL)
 		gPrefs = this;
+
+	// The Preference objects used to fill in the snapshot work off of
+	// gPrefs, so we can only do this for the global object.
+
+	if (gPrefs == this)
+	{
+		PrefKeyList	keys;
+
+		#define ADD_SNAPSHOT_KEY(name, type)	\
+			keys.push_back (kPrefKey##name);
+
+		FOR_EACH_SNAPSHOT_PREF(ADD_SNAPSHOT_KEY)
+
+		this->AddNotification (&Preferences::SnapshotPrefChanged, keys, this);
+		this->UpdateSnapshot ();
+	}
 }
 
 
@@ -1049,6 +1073,16 @@ Preferences::~Preferences (void)
 {
 	if (gPrefs == this)
 		gPrefs = NULL;
+
+	delete fStore;
+	delete fSnapshot;
+
+	PrefSnapshotList::iterator	iter = fRetiredSnapshots.begin ();
+	while (iter != fRetiredSnapshots.end ())
+	{
+		delete *iter;
+		++iter;
+	}
 }
 
 
@@ -1056,7 +1090,11 @@ Preferences::~Preferences (void)
  *
  * FUNCTION:	Preferences::Load
  *
- * DESCRIPTION: Loads the preferences from the storage medium.
+ * DESCRIPTION: Loads the preferences from the storage medium.  If
+ *				there's a binary preferences file, that's used.
+ *				Otherwise, the text file is read, and its contents
+ *				will be imported into the binary file the next time
+ *				the preferences are saved.
  *
  * PARAMETERS:	None
  *
@@ -1066,6 +1104,37 @@ Preferences::~Preferences (void)
 
 void Preferences::Load (void)
 {
+	if (fStore->Open (this->GetPrefStoreRef ()))
+	{
+		// Values are left in the store until someone asks for them (see
+		// GetPref).  All we do here is what SetPref would have done if
+		// we'd set them: replace any default values we already have and
+		// send out notifications.
+
+		StringList	keys;
+		fStore->GetKeys (keys);
+
+		StringList::iterator	iter = keys.begin ();
+		while (iter != keys.end ())
+		{
+			if (fPreferences.find (*iter) != fPreferences.end ())
+			{
+				string	value;
+				fStore->Take (*iter, value);
+
+				this->SetPref (*iter, value);
+			}
+			else
+			{
+				this->DoNotify (*iter);
+			}
+
+			++iter;
+		}
+
+		return;
+	}
+
 	StringStringMap	mapData;
 
 	if (!this->ReadPreferences (mapData))
@@ -1098,9 +1167,18 @@ void Preferences::Load (void)
 
 void Preferences::Save (void)
 {
+	// Pull in everything that's still in the store, so that StripUnused
+	// gets to look at it, and so that the store can tell what's changed.
+
+	fStore->TakeAll (string (), fPreferences);
+
 	this->StripUnused ();
 
-	this->WritePreferences (fPreferences);
+	// Only what's changed gets written to the binary file.  If we can't
+	// do that (say, it's from a newer Emulator), write the text file.
+
+	if (!fStore->Update (fPreferences))
+		this->WritePreferences (fPreferences);
 }
 
 
@@ -1129,7 +1207,16 @@ bool Preferences::GetPref (const string& key, string& value)
 
 	iterator	iter = fPreferences.find (fullKey);
 	if (iter == fPreferences.end ())
-		return false;
+	{
+		// If it's in the store and we haven't looked at it yet, get it
+		// now and hold onto it.
+
+		if (!fStore->Take (fullKey, value))
+			return false;
+
+		fPreferences[fullKey] = value;
+		return true;
+	}
 
 	value = iter->second;
 	return true;
@@ -1166,7 +1253,12 @@ void Preferences::SetPref (const string& key, const string& value)
 	iterator	iter = fPreferences.find(fullKey);
 	if (iter == fPreferences.end ())
 	{
-		doNotify = true;
+		string	oldValue;
+		if (fStore->Take (fullKey, oldValue))
+			doNotify = (oldValue != value);
+		else
+			doNotify = true;
+
 		fPreferences[fullKey] = value;
 	}
 	else
@@ -1203,6 +1295,11 @@ void Preferences::DeletePref (const string& key)
 
 	string	deleteKey = gPrefs->ExpandKey (key);
 
+	// Pull in any matching entries still in the store, so that they
+	// get deleted, too.
+
+	fStore->TakeAll (deleteKey, fPreferences);
+
 	// Iterate over all the entries in the map.
 
 	iterator	iter = fPreferences.begin ();
@@ -1519,6 +1616,78 @@ void Preferences::DoNotify (const string& key)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Preferences::UpdateSnapshot
+ *
+ * DESCRIPTION: Build a new snapshot of the frequently-read preferences
+ *				and make it the current one.  The previous snapshot is
+ *				retired, not deleted, as other threads may still be
+ *				looking at it.
+ *
+ *				The caller is expected to hold fgPrefsMutex, or to
+ *				otherwise know that no one else is changing the
+ *				preferences.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Preferences::UpdateSnapshot (void)
+{
+	// We can get called from SetPref in the middle of saving a compound
+	// preference (RGBType, for instance, is saved one field at a time
+	// under a prefix).  Clear out the prefixes while we load our
+	// values so that we look them up from the top.  The last field of
+	// a compound preference to be saved will trigger the snapshot that
+	// sees the whole value.
+
+	EmValueChanger<PrefixType>	noPrefixes (fPrefixes, PrefixType ());
+
+	PrefSnapshot*	snapshot = new PrefSnapshot;
+
+	#define LOAD_SNAPSHOT_FIELD(name, type)					\
+	{														\
+		Preference<type>	pref (kPrefKey##name, false);	\
+															\
+		snapshot->f##name##Loaded = pref.Loaded ();			\
+		if (pref.Loaded ())									\
+			snapshot->f##name = *pref;						\
+	}
+
+	FOR_EACH_SNAPSHOT_PREF(LOAD_SNAPSHOT_FIELD)
+
+	PrefSnapshot*	oldSnapshot = (PrefSnapshot*)
+		::EmAtomicExchangePtr ((void* volatile*) &fSnapshot, snapshot);
+
+	if (oldSnapshot)
+	{
+		fRetiredSnapshots.push_back (oldSnapshot);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Preferences::SnapshotPrefChanged
+ *
+ * DESCRIPTION: Notification function called when one of the
+ *				preferences in the snapshot is changed.
+ *
+ * PARAMETERS:	Standard notification function parameters.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Preferences::SnapshotPrefChanged (PrefKeyType, PrefRefCon data)
+{
+	((Preferences*) data)->UpdateSnapshot ();
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Preferences::ReadPreferences
@@ -1602,6 +1771,46 @@ EmFileRef Preferences::GetPrefRef (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Preferences::GetPrefStoreRef
+ *
+ * DESCRIPTION: Return the binary preferences file.  It's kept in the
+ *				same directory as the text file, so that the Emulator's
+ *				directory is used if that's where the text file is.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The file reference.
+ *
+ ***********************************************************************/
+
+EmFileRef Preferences::GetPrefStoreRef (void)
+{
+	EmFileRef	textRef (this->GetPrefRef ());
+
+#if PLATFORM_MAC
+
+	string		name ("Palm OS Emulator Prefs.bin");
+
+#elif PLATFORM_UNIX
+
+	string		name (".poserrc.bin");
+
+#elif PLATFORM_WINDOWS
+
+	string		name ("Palm OS Emulator.prefs");
+
+#else
+
+	#error "Undefined platform"
+
+#endif
+
+	return EmFileRef (textRef.GetParent (), name);
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Preferences::WriteBanner
@@ -25,6 +25,7 @@
 #include <map>
 #include <vector>
 
+class EmPrefStore;
 class EmTransport;
 
 /*
@@ -148,6 +149,47 @@ typedef void*		PrefRefCon;
 typedef void		(*PrefNotifyFunc)(PrefKeyType, PrefRefCon);
 typedef StringList	PrefKeyList;
 
+
+/*
+	A few preferences are read all the time: the LCD colors are fetched on
+	every screen update, and some options are looked at on every call to a
+	patched trap.  Creating a Preference object for those each time means
+	taking the preferences mutex and parsing the value out of a string.
+
+	Those preferences are also kept, already decoded, in a PrefSnapshot.
+	A snapshot is never changed once it's been made available.  Instead,
+	when one of its preferences is changed, the Preferences object builds a
+	new snapshot and swaps it in.  Readers don't need to lock anything:
+
+		const PrefSnapshot*	prefs = gPrefs->GetSnapshot ();
+
+		if (prefs->fHighlightColorLoaded)
+			background = prefs->fHighlightColor;
+
+	Old snapshots are not deleted until the Preferences object is, so a
+	reader doesn't have to worry about one going away underneath it.
+
+	To add a preference to the snapshot, add it to FOR_EACH_SNAPSHOT_PREF.
+	It must also appear in FOR_EACH_PREF.
+*/
+
+#define FOR_EACH_SNAPSHOT_PREF(DO_TO_PREF)						\
+	DO_TO_PREF(BackgroundColor,			RGBType)				\
+	DO_TO_PREF(HighlightColor,			RGBType)				\
+	DO_TO_PREF(EnableSounds,			bool)					\
+	DO_TO_PREF(InterceptSysFatalAlert,	bool)					\
+	DO_TO_PREF(RedirectNetLib,			bool)
+
+struct PrefSnapshot
+{
+#define DECLARE_SNAPSHOT_FIELD(name, type)	\
+	type		f##name;					\
+	bool		f##name##Loaded;
+
+	FOR_EACH_SNAPSHOT_PREF(DECLARE_SNAPSHOT_FIELD)
+};
+
+
 enum
 {
 	MRU_COUNT = 9
@@ -186,20 +228,28 @@ class Preferences
 		void					RemoveNotification	(PrefNotifyFunc, const PrefKeyList&);
 		void					DoNotify			(const string& key);
 
+	public:
+		const PrefSnapshot*		GetSnapshot			(void) const	{ return fSnapshot; }
+
 	protected:
 		virtual Bool			ReadPreferences		(StringStringMap&);
 		virtual void			WritePreferences	(const StringStringMap&);
 		virtual EmFileRef		GetPrefRef			(void);
+		virtual EmFileRef		GetPrefStoreRef		(void);
 		virtual void			WriteBanner 		(FILE*);
 		virtual Bool			ReadBanner			(FILE*);
 		virtual void			StripUnused 		(void);
 
+		void					UpdateSnapshot		(void);
+		static void				SnapshotPrefChanged	(PrefKeyType, PrefRefCon);
+
 	protected:
 		typedef StringStringMap			PrefList;
 		typedef PrefList::value_type	PrefPairType;
 		typedef PrefList::iterator		iterator;
 
 		PrefList				fPreferences;
+		EmPrefStore*			fStore;
 
 		typedef StringList		PrefixType;
 		PrefixType				fPrefixes;
@@ -214,6 +264,11 @@ class Preferences
 
 		PrefNotifyList			fNotifications;
 
+		typedef vector<PrefSnapshot*>	PrefSnapshotList;
+
+		PrefSnapshot* volatile	fSnapshot;
+		PrefSnapshotList		fRetiredSnapshots;
+
 	public:
 		static omni_mutex		fgPrefsMutex;
 };
@@ -371,6 +426,10 @@ extern EmulatorPreferences* gEmuPrefs;
 																\
 	DO_TO_PREF(GremlinInfo, GremlinInfo, ())					\
 	DO_TO_PREF(HordeInfo, HordeInfo, ())						\
+	DO_TO_PREF(GremlinCoverage, bool, (false))				\
+	DO_TO_PREF(GremlinCoverageStart, long, (0))				\
+	DO_TO_PREF(GremlinCoverageEnd, long, (0))				\
+	DO_TO_PREF(VirtualClock, bool, (false))						\
 																\
 	DO_TO_PREF(LastPSF, EmFileRef, ())							\
 																\
@@ -480,6 +539,10 @@ extern EmulatorPreferences* gEmuPrefs;
 																				\
 	DO_TO_PREF(GremlinInfo,			GremlinInfo,		())						\
 	DO_TO_PREF(HordeInfo,			HordeInfo,			())						\
+	DO_TO_PREF(GremlinCoverage,		bool,				(false))					\
+	DO_TO_PREF(GremlinCoverageStart,	long,				(0))						\
+	DO_TO_PREF(GremlinCoverageEnd,	long,				(0))						\
+	DO_TO_PREF(VirtualClock,		bool,				(false))				\
 																				\
 	DO_TO_PREF(LastPSF,				EmFileRef,			())						\
 																				\
@@ -2003,6 +2003,31 @@ Err MemChunkFree (MemPtr chunkDataP)
 	RETURN_RESULT_VAL (Err);
 }
 
+// --------------------
+// Called:
+//
+//	*	when a bulk database install fails or is cancelled
+//		(EmFileImport::BulkInstallCancel) to free the records that were
+//		allocated but not yet attached to the database.
+// --------------------
+
+Err MemHandleFree (MemHandle h)
+{
+	// Prepare the stack.
+	CALLER_SETUP ("Err", "MemHandle h");
+
+	// Set the parameters.
+	CALLER_PUT_PARAM_VAL (MemHandle, h);
+
+	// Call the function.
+	sub.Call (sysTrapMemHandleFree);
+
+	// Write back any "by ref" parameters.
+
+	// Return the result.
+	RETURN_RESULT_VAL (Err);
+}
+
 // --------------------
 // Called:
 //
@@ -2034,6 +2059,31 @@ MemPtr MemHandleLock (MemHandle h)
 	RETURN_RESULT_PTR (MemPtr);
 }
 
+// --------------------
+// Called:
+//
+//	*	during a bulk database install (EmFileImport::BulkInstallEnd)
+//		to grow the database header to hold the entire record list.
+// --------------------
+
+Err MemHandleResize (MemHandle h, UInt32 newSize)
+{
+	// Prepare the stack.
+	CALLER_SETUP ("Err", "MemHandle h, UInt32 newSize");
+
+	// Set the parameters.
+	CALLER_PUT_PARAM_VAL (MemHandle, h);
+	CALLER_PUT_PARAM_VAL (UInt32, newSize);
+
+	// Call the function.
+	sub.Call (sysTrapMemHandleResize);
+
+	// Write back any "by ref" parameters.
+
+	// Return the result.
+	RETURN_RESULT_VAL (Err);
+}
+
 // --------------------
 // Called:
 //
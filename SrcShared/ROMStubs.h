@@ -117,7 +117,9 @@ Int16 LstGetSelection (const ListType* lst);
 Char * LstGetSelectionText (const ListType *listP, Int16 itemNum);
 
 Err MemChunkFree (MemPtr chunkDataP);
+Err MemHandleFree (MemHandle h);
 MemPtr MemHandleLock (MemHandle h);
+Err MemHandleResize (MemHandle h, UInt32 newSize);
 UInt32 MemHandleSize (MemHandle h);
 LocalID MemHandleToLocalID (MemHandle h);
 Err MemHandleUnlock (MemHandle h);
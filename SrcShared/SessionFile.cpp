@@ -23,6 +23,16 @@
 #include "UAE.h"				// regstruct
 
 
+// Granularity at which checkpoint deltas compare and record RAM.
+
+const uint32	kCheckpointPageSize	= 4096;
+
+// Checkpoint chains are normally consolidated long before this; the
+// limit just keeps a damaged or circular chain from recursing forever.
+
+const long		kMaxCheckpointDepth	= 256;
+
+
 /***********************************************************************
  *
  * FUNCTION:	SessionFile constructor
@@ -43,7 +53,10 @@ SessionFile::SessionFile (ChunkFile& f) :
 	fCfg (),
 	fReadBugFixes (false),
 	fChangedBugFixes (false),
-	fBugFixes (0)
+	fBugFixes (0),
+	fCheckpoint (NULL),
+	fWroteDelta (false),
+	fChainDepth (0)
 {
 }
 
@@ -168,6 +181,9 @@ Bool SessionFile::ReadRAMImage (void* image)
 	if (!result)
 		result = this->ReadChunk (kUncompRAMDataTag, image, kNoCompression);
 
+	if (!result)
+		result = this->ReadDeltaImage (kRAMDeltaTag, image, &SessionFile::ReadRAMImage);
+
 	return result;
 }
 
@@ -197,6 +213,9 @@ Bool SessionFile::ReadMetaRAMImage (void* image)
 	if (!result)
 		result = this->ReadChunk (kRLEMetaRAMDataTag, image, kRLECompression);
 
+	if (!result)
+		result = this->ReadDeltaImage (kMetaRAMDeltaTag, image, &SessionFile::ReadMetaRAMImage);
+
 	return result;
 }
 
@@ -570,6 +589,13 @@ long SessionFile::GetRAMImageSize (void)
 		EmStreamChunk	s (chunk);
 		s >> numBytes;
 	}
+	else if (this->ReadChunk (kRAMDeltaTag, chunk, kGzipCompression))
+	{
+		// Delta chunks record the size of the whole image up front.
+
+		EmStreamChunk	s (chunk);
+		s >> numBytes;
+	}
 	else
 	{
 		numBytes = fFile.FindChunk (kUncompRAMDataTag);
@@ -631,7 +657,11 @@ void SessionFile::WriteROMFileReference (const EmFileRef& f)
 
 void SessionFile::WriteRAMImage (const void* image, uint32 size)
 {
-	this->WriteChunk (kRAMDataTag, size, image, kGzipCompression);
+	if (fCheckpoint)
+		this->WriteCheckpointImage (kRAMDeltaTag, kRAMDataTag, image, size, fCheckpoint->fRAM);
+	else
+		this->WriteChunk (kRAMDataTag, size, image, kGzipCompression);
+
 	fCfg.fRAMSize = size / 1024;
 }
 
@@ -655,7 +685,10 @@ void SessionFile::WriteRAMImage (const void* image, uint32 size)
 
 void SessionFile::WriteMetaRAMImage (const void* image, uint32 size)
 {
-	this->WriteChunk (kMetaRAMDataTag, size, image, kGzipCompression);
+	if (fCheckpoint)
+		this->WriteCheckpointImage (kMetaRAMDeltaTag, kMetaRAMDataTag, image, size, fCheckpoint->fMetaRAM);
+	else
+		this->WriteChunk (kMetaRAMDataTag, size, image, kGzipCompression);
 }
 
 
@@ -962,6 +995,50 @@ Bool SessionFile::IncludesBugFix (BugFix val)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::SetCheckpoint
+ *
+ * DESCRIPTION:	Attach checkpoint state to this file.  Subsequent calls
+ *				to WriteRAMImage and WriteMetaRAMImage write just the
+ *				pages that differ from the images recorded in the
+ *				checkpoint, provided that it names a parent file.
+ *				Either way, the recorded images are brought up to date
+ *				with what was written.
+ *
+ * PARAMETERS:	checkpoint - state carried over from the previous
+ *					checkpoint, or NULL to always write full images.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void SessionFile::SetCheckpoint (EmCheckpoint* checkpoint)
+{
+	fCheckpoint = checkpoint;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::WroteCheckpointDelta
+ *
+ * DESCRIPTION:	Return whether any image was written as a delta against
+ *				the parent checkpoint (and hence whether this file needs
+ *				that parent in order to be loaded).
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if a delta was written.
+ *
+ ***********************************************************************/
+
+Bool SessionFile::WroteCheckpointDelta (void)
+{
+	return fWroteDelta;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SessionFile::ReadChunk
@@ -1183,3 +1260,164 @@ void SessionFile::WriteChunk (ChunkFile::Tag tag, const Chunk& chunk, Compressio
 {
 	this->WriteChunk (tag, chunk.GetLength (), chunk.GetPointer (), compType);
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::ReadDeltaImage
+ *
+ * DESCRIPTION:	Read an image stored as a delta against a parent
+ *				checkpoint.  The parent's image is read in first (which
+ *				may in turn recurse to its parent), and then the pages
+ *				recorded in this file are laid over it.
+ *
+ * PARAMETERS:	tag - marker of the delta chunk.
+ *
+ *				image - buffer to receive the image.
+ *
+ *				reader - method used to read the same image from the
+ *					parent file.
+ *
+ * RETURNED:	True if the delta and its whole chain could be read.
+ *
+ ***********************************************************************/
+
+Bool SessionFile::ReadDeltaImage (ChunkFile::Tag tag, void* image, ImageReader reader)
+{
+	Chunk	delta;
+	if (!this->ReadChunk (tag, delta, kGzipCompression))
+		return false;
+
+	string	parentPath;
+	if (!fFile.ReadString (kCheckpointParent, parentPath))
+		return false;
+
+	if (fChainDepth >= kMaxCheckpointDepth)
+		return false;
+
+	EmFileRef	parentRef (parentPath);
+	if (!parentRef.Exists ())
+		return false;
+
+	{
+		EmStreamFile	stream (parentRef, kOpenExistingForRead);
+		ChunkFile		chunkFile (stream);
+		SessionFile		parentFile (chunkFile);
+
+		parentFile.fChainDepth = fChainDepth + 1;
+
+		if (!(parentFile.*reader) (image))
+			return false;
+	}
+
+	EmStreamChunk	s (delta);
+	uint32			size;
+	uint32			pageSize;
+	uint32			numPages;
+
+	s >> size >> pageSize >> numPages;
+
+	while (numPages--)
+	{
+		uint32	index;
+		s >> index;
+
+		uint32	offset = index * pageSize;
+		if (offset >= size)
+			return false;
+
+		uint32	len = min (pageSize, size - offset);
+		s.GetBytes ((uint8*) image + offset, len);
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::WriteCheckpointImage
+ *
+ * DESCRIPTION:	Write an image on behalf of a checkpoint.  If the
+ *				checkpoint has a parent holding an image of the same
+ *				size, only the pages that differ from it are written,
+ *				along with a reference to the parent.  Otherwise, the
+ *				full image is written.  The checkpoint's copy of the
+ *				image is updated to match in either case.
+ *
+ * PARAMETERS:	deltaTag - marker to use for a delta.
+ *
+ *				fullTag - marker to use for a full image.
+ *
+ *				image - pointer to the data to be written.
+ *
+ *				size - number of bytes in the image.
+ *
+ *				base - the image as last written to the parent.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void SessionFile::WriteCheckpointImage (ChunkFile::Tag deltaTag, ChunkFile::Tag fullTag,
+				const void* image, uint32 size, ByteList& base)
+{
+	EmAssert (fCheckpoint);
+
+	const uint8*	src = (const uint8*) image;
+
+	if (!fCheckpoint->fParent.IsSpecified () || base.size () != size)
+	{
+		this->WriteChunk (fullTag, size, image, kGzipCompression);
+		base.assign (src, src + size);
+		return;
+	}
+
+	// Find the pages that have changed since the parent was written.
+	// Comparing against our own copy is cheap next to compressing the
+	// whole image, and it doesn't require the memory banks to track
+	// writes (which the direct-access opcode handlers bypass anyway).
+
+	vector<uint32>	dirty;
+	uint32			numPages = (size + kCheckpointPageSize - 1) / kCheckpointPageSize;
+	uint32			index;
+
+	for (index = 0; index < numPages; ++index)
+	{
+		uint32	offset = index * kCheckpointPageSize;
+		uint32	len = min (kCheckpointPageSize, size - offset);
+
+		if (memcmp (src + offset, &base[offset], len) != 0)
+			dirty.push_back (index);
+	}
+
+	// Pack them up as: image size, page size, page count, and then
+	// each page's index followed by its contents.
+
+	Chunk			delta;
+	EmStreamChunk	s (delta);
+
+	s << size << kCheckpointPageSize << (uint32) dirty.size ();
+
+	vector<uint32>::iterator	iter = dirty.begin ();
+	while (iter != dirty.end ())
+	{
+		uint32	offset = *iter * kCheckpointPageSize;
+		uint32	len = min (kCheckpointPageSize, size - offset);
+
+		s << *iter;
+		s.PutBytes (src + offset, len);
+
+		memcpy (&base[offset], src + offset, len);
+
+		++iter;
+	}
+
+	this->WriteChunk (deltaTag, delta, kGzipCompression);
+
+	if (!fWroteDelta)
+	{
+		fFile.WriteString (kCheckpointParent, fCheckpoint->fParent.GetFullPath ());
+		fWroteDelta = true;
+	}
+}
@@ -29,11 +29,37 @@ struct SED1375RegsType;
 struct SED1376RegsType;
 
 #ifdef SONY_ROM
-#include "SonyShared\EmRegsLCDCtrl.h"
-#include "SonyShared\EmRegsLCDCtrlT2.h"
-#include "SonyShared\ExpansionMgr.h"
+#include "SonyShared/EmRegsLCDCtrl.h"
+#include "SonyShared/EmRegsLCDCtrlT2.h"
+#include "SonyShared/ExpansionMgr.h"
 #endif //SONY_ROM
 
+// State carried from one checkpoint save to the next (see
+// EmSession::SaveCheckpoint).  When fParent is specified, RAM images
+// are written as the pages that differ from fRAM/fMetaRAM -- the
+// images as they were in fParent -- rather than in their entirety.
+
+struct EmCheckpointFile
+{
+	EmFileRef					fRef;
+	uint32						fSize;			// Size and date just after it was written,
+	uint32						fModDate;		// to tell if something else has replaced it
+};
+
+typedef vector<EmCheckpointFile>	EmCheckpointFileList;
+
+struct EmCheckpoint
+{
+								EmCheckpoint	(void) : fChainLength (0) {}
+
+	EmFileRef					fParent;		// Previous checkpoint file
+	long						fChainLength;	// Deltas written since the last full image
+	EmCheckpointFileList		fChain;			// fParent and all the files it depends on, oldest first
+	ByteList					fRAM;			// RAM image as saved in fParent
+	ByteList					fMetaRAM;		// MetaRAM image as saved in fParent
+};
+
+
 class SessionFile
 {
 	public:
@@ -49,7 +75,7 @@ class SessionFile
 								~SessionFile			(void);
 
 #ifdef	SONY_ROM
-#include "SonyShared\SessionFileSony.h"
+#include "SonyShared/SessionFileSony.h"
 #endif //SONY_ROM
 
 		// ---------- Reading ----------
@@ -87,6 +113,7 @@ class SessionFile
 
 		Bool					ReadGremlinInfo			(Chunk& chunk) { return fFile.ReadChunk (kGremlinInfo, chunk); }
 		Bool					ReadGremlinHistory		(Chunk& chunk) { return this->ReadChunk (kGremlinHistory, chunk, kGzipCompression); }
+		Bool					ReadPlaybackInfo		(Chunk& chunk) { return fFile.ReadChunk (kPlaybackInfo, chunk); }
 		Bool					ReadDebugInfo			(Chunk& chunk) { return fFile.ReadChunk (kDebugInfo, chunk); }
 		Bool					ReadMetaInfo			(Chunk& chunk) { return fFile.ReadChunk (kMetaInfo, chunk); }
 		Bool					ReadPatchInfo			(Chunk& chunk) { return fFile.ReadChunk (kPatchInfo, chunk); }
@@ -94,6 +121,7 @@ class SessionFile
 		Bool					ReadLoggingInfo			(Chunk& chunk) { return fFile.ReadChunk (kLoggingInfo, chunk); }
 		Bool					ReadStackInfo			(Chunk& chunk) { return fFile.ReadChunk (kStackInfo, chunk); }
 		Bool					ReadHeapInfo			(Chunk& chunk) { return fFile.ReadChunk (kHeapInfo, chunk); }
+		Bool					ReadClockInfo			(Chunk& chunk) { return fFile.ReadChunk (kClockInfo, chunk); }
 
 		Bool					ReadPlatformInfo		(Chunk& chunk) { return fFile.ReadChunk (kPlatformInfo, chunk); }
 		Bool					ReadPlatformInfoMac		(Chunk& chunk) { return fFile.ReadChunk (kPlatformMac, chunk); }
@@ -141,6 +169,7 @@ class SessionFile
 
 		void					WriteGremlinInfo		(const Chunk& chunk) { fFile.WriteChunk (kGremlinInfo, chunk); }
 		void					WriteGremlinHistory		(const Chunk& chunk) { this->WriteChunk (kGremlinHistory, chunk, kGzipCompression); }
+		void					WritePlaybackInfo		(const Chunk& chunk) { fFile.WriteChunk (kPlaybackInfo, chunk); }
 		void					WriteDebugInfo			(const Chunk& chunk) { fFile.WriteChunk (kDebugInfo, chunk); }
 		void					WriteMetaInfo			(const Chunk& chunk) { fFile.WriteChunk (kMetaInfo, chunk); }
 		void					WritePatchInfo			(const Chunk& chunk) { fFile.WriteChunk (kPatchInfo, chunk); }
@@ -148,6 +177,7 @@ class SessionFile
 		void					WriteLoggingInfo		(const Chunk& chunk) { fFile.WriteChunk (kLoggingInfo, chunk); }
 		void					WriteStackInfo			(const Chunk& chunk) { fFile.WriteChunk (kStackInfo, chunk); }
 		void					WriteHeapInfo			(const Chunk& chunk) { fFile.WriteChunk (kHeapInfo, chunk); }
+		void					WriteClockInfo			(const Chunk& chunk) { fFile.WriteChunk (kClockInfo, chunk); }
 
 		void					WritePlatformInfo		(const Chunk& chunk) { fFile.WriteChunk (kPlatformInfo, chunk); }
 		void					WritePlatformInfoMac	(const Chunk& chunk) { fFile.WriteChunk (kPlatformMac, chunk); }
@@ -178,6 +208,14 @@ class SessionFile
 		void					FixBug					(BugFix);
 		Bool					IncludesBugFix			(BugFix);
 
+		// Checkpoint support.  With a checkpoint attached, WriteRAMImage and
+		// WriteMetaRAMImage write only the pages changed since the previous
+		// checkpoint.  The Read methods follow such files back to their
+		// parents transparently.
+
+		void					SetCheckpoint			(EmCheckpoint*);
+		Bool					WroteCheckpointDelta	(void);
+
 	private:
 		enum CompressionType
 		{
@@ -203,6 +241,18 @@ class SessionFile
 														 const Chunk& chunk,
 														 CompressionType);
 
+		typedef Bool			(SessionFile::*ImageReader)	(void*);
+
+		Bool					ReadDeltaImage			(ChunkFile::Tag tag,
+														 void*,
+														 ImageReader);
+
+		void					WriteCheckpointImage	(ChunkFile::Tag deltaTag,
+														 ChunkFile::Tag fullTag,
+														 const void*,
+														 uint32,
+														 ByteList& base);
+
 		// These functions access kROMAliasTag, kROMNameTag, kROMPathTag
 		friend Bool Platform::ReadROMFileReference (ChunkFile&, EmFileRef&);
 		friend void Platform::WriteROMFileReference (ChunkFile&, const EmFileRef&);
@@ -247,6 +297,7 @@ class SessionFile
 
 			kGremlinInfo		= 'grem',	// Gremlin state
 			kGremlinHistory		= 'hist',	// Gremlin event history
+			kPlaybackInfo		= 'play',	// Number of events recorded when saved
 			kDebugInfo			= 'dbug',	// Debug state
 			kMetaInfo			= 'meta',	// MetaMemory state
 			kPatchInfo			= 'ptch',	// Trappatch state
@@ -254,6 +305,7 @@ class SessionFile
 			kLoggingInfo		= 'log ',	// Standard LogStream data
 			kStackInfo			= 'stak',	// List of currently known stacks
 			kHeapInfo			= 'heap',	// Heap state
+			kClockInfo			= 'clok',	// Virtual clock state
 
 			kPlatformInfo		= 'plat',	// Information managed by the Platform sub-system that has analogs on all platforms.
 			kPlatformMac		= 'mac ',	// Mac-specific information
@@ -269,6 +321,10 @@ class SessionFile
 
 			kBugsTag			= 'bugz',	// bit flags indicating bug fixes in file format
 			
+			kRAMDeltaTag		= 'dram',	// gzip compressed RAM pages changed since the parent checkpoint
+			kMetaRAMDeltaTag	= 'dmrm',	// gzip compressed meta-RAM pages changed since the parent checkpoint
+			kCheckpointParent	= 'dref',	// Full path to the parent checkpoint file
+
 			kRLERAMDataTag		= 'cram',	// RLE compressed RAM image - obsolete
 			kRLEMetaRAMDataTag	= 'mram',	// RLE compressed meta-RAM image - obsolete
 
@@ -290,6 +346,9 @@ class SessionFile
 		bool					fReadBugFixes;
 		bool					fChangedBugFixes;
 		BugFixes				fBugFixes;
+		EmCheckpoint*			fCheckpoint;
+		Bool					fWroteDelta;
+		long					fChainDepth;
 };
 
 #endif	// _SESSIONFILE_H_
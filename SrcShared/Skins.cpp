@@ -16,6 +16,7 @@
 
 #include "ChunkFile.h"			// Chunk
 #include "EmApplication.h"		// gApplication
+#include "EmCatalog.h"			// EmCatalog
 #include "EmFileRef.h"			// EmFileRef
 #include "EmMapFile.h"			// EmMapFile
 #include "EmSession.h"			// gSession
@@ -1083,7 +1084,9 @@ static void PrvAddSkin (SkinList& skins, EmStream& skinStream)
 static void PrvAddSkin (SkinList& skins, const EmFileRef& skinFile)
 {
 	StringStringMap	entries;
-	EmMapFile::Read (skinFile, entries);
+
+	if (!EmCatalog::GetSkinEntries (skinFile, entries))
+		EmMapFile::Read (skinFile, entries);
 
 	PrvAddSkin (skins, entries, &skinFile);
 }
@@ -1101,7 +1104,7 @@ static void PrvAddSkin (SkinList& skins, const EmFileRef& skinFile)
  *
  ***********************************************************************/
 
-static void PrvScanForSkinFiles (SkinList& skins, const EmDirRef& skinDir)
+static void PrvScanForSkinFiles (EmFileRefList& skinFiles, const EmDirRef& skinDir)
 {
 	EmDirRefList	dirs;
 	EmFileRefList	files;
@@ -1114,7 +1117,7 @@ static void PrvScanForSkinFiles (SkinList& skins, const EmDirRef& skinDir)
 		{
 			if (iter->IsType (kFileTypeSkin))
 			{
-				::PrvAddSkin (skins, *iter);
+				skinFiles.push_back (*iter);
 			}
 
 			++iter;
@@ -1131,7 +1134,7 @@ static void PrvScanForSkinFiles (SkinList& skins, const EmDirRef& skinDir)
 				name[0] != '(' ||
 				name[name.size () - 1] != ')')
 			{
-				::PrvScanForSkinFiles (skins, *iter);
+				::PrvScanForSkinFiles (skinFiles, *iter);
 			}
 
 			++iter;
@@ -1198,7 +1201,20 @@ void PrvBuildSkinList (SkinList& skins)
 
 	if (scanDir.Exists ())
 	{
-		::PrvScanForSkinFiles (skins, scanDir);
+		// Find all the skin files first, so that the ones the catalog
+		// doesn't know about yet can be read in all at once.
+
+		EmFileRefList	skinFiles;
+		::PrvScanForSkinFiles (skinFiles, scanDir);
+
+		EmCatalog::ScanSkins (skinFiles);
+
+		EmFileRefList::iterator	iter = skinFiles.begin ();
+		while (iter != skinFiles.end ())
+		{
+			::PrvAddSkin (skins, *iter);
+			++iter;
+		}
 	}
 }
 
@@ -1502,6 +1518,7 @@ SkinName PrvGetSkinName (const EmDevice& device)
 }
 
 #ifdef SONY_ROM
+#if PLATFORM_WINDOWS
 Bool	SkinGetElementRect	(SkinElementType which, RECT *lprc)
 {
 	ButtonBoundsList::iterator	iter = gCurrentSkin.fButtons.begin ();
@@ -1521,6 +1538,7 @@ Bool	SkinGetElementRect	(SkinElementType which, RECT *lprc)
 	}
 	return false;
 }
+#endif
 
 Bool	SkinGetElementEmRect	(SkinElementType which, EmRect *lprc)
 {
@@ -105,7 +105,9 @@ EmPoint			SkinScaleUp				(const EmPoint&);
 EmRect			SkinScaleUp				(const EmRect&);
 
 #ifdef SONY_ROM
+#if PLATFORM_WINDOWS
 Bool			SkinGetElementRect		(SkinElementType which, RECT *lprc);
+#endif
 Bool			SkinGetElementEmRect	(SkinElementType which, EmRect *lprc);
 #endif //SONY_ROM
 
@@ -15,13 +15,15 @@
 #include "Logging.h"			// LogAppendMsg
 #include "Marshal.h"			// PARAM_VAL, etc.
 
-#include "SonyShared\ExpansionMgr.h"
+#include "SonyShared/ExpansionMgr.h"
 #include "EmPatchModule_ExpMgr.h"	
-#include "SonyWin\Platform_MsfsLib.h"	
-#include "SonyWin\Platform_ExpMgrLib.h"
+#include "SonyShared/Platform_MsfsLib.h"	
+#include "SonyShared/Platform_ExpMgrLib.h"
 
+#if PLATFORM_WINDOWS
 void	LCD_SetStateJogButton(SkinElementType witch, Bool bPress, Bool bEnabled);
 void	LCD_DrawButtonForPEG(HDC hDC, SkinElementType witch);
+#endif
 
 // ======================================================================
 //	Globals and constants
@@ -236,8 +238,10 @@ CallROMType ExpMgrLibHeadpatch::CardRemoved (void)
 
 	g_nCardInserted = MSSTATE_REMOVED;
 
+#if PLATFORM_WINDOWS
 	LCD_SetStateJogButton(kElement_MS_InOut, false, true);
 	LCD_DrawButtonForPEG(NULL, kElement_MS_InOut);
+#endif
 
 	return kExecuteROM;
 }
@@ -264,8 +268,10 @@ CallROMType ExpMgrLibHeadpatch::CardInserted (void)
 	
 	g_nCardInserted = slotRefNum;
 
+#if PLATFORM_WINDOWS
 	LCD_SetStateJogButton(kElement_MS_InOut, true, true);
 	LCD_DrawButtonForPEG(NULL, kElement_MS_InOut);
+#endif
 
 	return kExecuteROM;
 }
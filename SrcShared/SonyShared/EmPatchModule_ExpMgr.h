@@ -2,7 +2,7 @@
 #ifndef	_EMPATCHMODULE_EXPMGR_H
 #define _EMPATCHMODULE_EXPMGR_H
 
-#include "SonyShared\VFSMgr.h"
+#include "SonyShared/VFSMgr.h"
 
 #include "EmPatchModule.h"
 
@@ -8,9 +8,9 @@
 #include "Marshal.h"			// PARAM_VAL, etc.
 
 #include "EmPatchModule_MsfsLib.h"	
-#include "SonyWin\Platform_MsfsLib.h"	
-#include "SonyShared\VFSMgr.h"
-#include "SonyShared\FSLib.h"
+#include "SonyShared/Platform_MsfsLib.h"	
+#include "SonyShared/VFSMgr.h"
+#include "SonyShared/FSLib.h"
 
 // ======================================================================
 //	Proto patch table for ExpansionManager functions.  
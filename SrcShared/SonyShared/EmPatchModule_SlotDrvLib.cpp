@@ -9,8 +9,8 @@
 
 #include "EmPatchModule_ExpMgr.h"		// g_nCardInserted, SetCardInfo()
 #include "EmPatchModule_SlotDrvLib.h"	
-#include "SonyShared\FSLib.h"
-#include "SonyShared\VFSMgr.h"
+#include "SonyShared/FSLib.h"
+#include "SonyShared/VFSMgr.h"
 #include "SlotDrvLib.h"				// CardMetricsType
 
 // ======================================================================
@@ -19,8 +19,8 @@
 #include "Logging.h"					// LogAppendMsg
 #include "Marshal.h"					// PARAM_VAL, etc.
 #include "EmPatchModule_VfsLib.h"	
-#include "SonyWin\Platform_VfsLib.h"	// Platform_VfsLib
-#include "SonyWin\Platform_MsfsLib.h"	// FSVolumeEnumerate()
+#include "SonyShared/Platform_VfsLib.h"	// Platform_VfsLib
+#include "SonyShared/Platform_MsfsLib.h"	// FSVolumeEnumerate()
 
 
 /***************************************************************************
@@ -16,7 +16,7 @@
 #undef NON_PORTABLE
 #include "PalmPackPop.h"
 
-#include "SonyShared\ExpansionMgr.h"
+#include "SonyShared/ExpansionMgr.h"
 
 ////////////////////////////////////////////////////////////////////////////
 //
@@ -14,8 +14,8 @@
 #undef NON_PORTABLE
 #include "PalmPackPop.h"
 
-#include "SonyShared\ExpansionMgr.h"
-#include "SonyWin\Platform_MsfsLib.h"
+#include "SonyShared/ExpansionMgr.h"
+#include "SonyShared/Platform_MsfsLib.h"
 
 ////////////////////////////////////////////////////////////////////////////
 //
@@ -20,6 +20,22 @@
 
 static	UInt16	g_highResMode = 160;
 
+
+// Tables for converting 16-bit RGB565 pixels to 24-bit RGB.  A pixel is
+// converted by looking up its high byte in the "Hi" table and its low byte
+// in the "Lo" table and OR-ing the results together, giving a 0x00RRGGBB
+// value.  Each 5- or 6-bit component is widened to 8 bits by copying its
+// most significant bits into the low bits (RRRRRrrr, GGGGGGgg, BBBBBbbb).
+// The "Mono" variants replicate the green component into all three.
+
+static uint32	gConvert565Hi[256];
+static uint32	gConvert565Lo[256];
+static uint32	gConvert565HiMono[256];
+static uint32	gConvert565LoMono[256];
+static Bool		gConvert565Initialized;
+
+static void		PrvInitConvert565Tables (void);
+
 // ---------------------------------------------------------------------------
 //		 EmRegsMQLCDControl::EmRegsMQLCDControl
 // ---------------------------------------------------------------------------
@@ -427,7 +443,6 @@ void EmRegsMQLCDControl::GetLCDScanlines (EmScreenUpdateInfo& info)
 	}
 	else
 	{
-		Bool	byteSwapped	= true;
 		// Set depth, size, and color table of EmPixMap.
 		info.fImage.SetSize (EmPoint (width, height));
 		info.fImage.SetFormat (kPixMapFormat24RGB);
@@ -436,6 +451,8 @@ void EmRegsMQLCDControl::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		info.fFirstLine		= (info.fScreenLow - baseAddr) / rowBytes;
 		info.fLastLine		= (info.fScreenHigh - baseAddr - 1) / rowBytes + 1;
+		if (info.fLastLine > height)
+			info.fLastLine = height;
 
 		// Get location and rowBytes of source bytes.
 
@@ -455,45 +472,49 @@ void EmRegsMQLCDControl::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		int32	height = info.fLastLine - info.fFirstLine;
 
-		// Copy the pixels from source to dest.
+		// Copy the pixels from source to dest.  Each 16-bit RRRRRGGG GGGBBBBB
+		// pixel is split into its two bytes, and each byte is looked up in
+		// a table that gives its contribution to the packed 0x00RRGGBB
+		// result.  The two contributions don't overlap, so they can just be
+		// OR'd together.
+
+		PrvInitConvert565Tables ();
+
+		const uint32*	hiTable	= mono ? gConvert565HiMono : gConvert565Hi;
+		const uint32*	loTable	= mono ? gConvert565LoMono : gConvert565Lo;
 
 		for (int yy = 0; yy < height; ++yy)
 		{
-			for (int xx = 0; xx < width; ++xx)
+			int	xx = width;
+
+			while (xx >= 2)
 			{
-				uint8	p1 = EmMemDoGet8 (srcPtr++);	// GGGBBBBB
-				uint8	p2 = EmMemDoGet8 (srcPtr++);	// RRRRRGGG
-
-				// Merge the two together so that we get RRRRRGGG GGGBBBBB
-
-				uint16	p;
-				
-				if (!byteSwapped)
-					p = (p2 << 8) | p1;
-				else
-					p = (p1 << 8) | p2;
-
-				// Shift the bits around, forming RRRRRrrr, GGGGGGgg, and
-				// BBBBBbbb values, where the lower-case bits are copies of
-				// the least significant bits in the upper-case bits.
-				//
-				// Note that all of this could also be done with three 64K
-				// lookup tables.  If speed is an issue, we might want to
-				// investigate that.
-
-				if (mono)
-				{
-					uint8	green = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = green;
-					*destPtr++ = green;
-					*destPtr++ = green;
-				}
-				else
-				{
-					*destPtr++ = ((p >> 8) & 0xF8) | ((p >> 11) & 0x07);
-					*destPtr++ = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = ((p << 3) & 0xF8) | ((p >>  0) & 0x07);
-				}
+				uint16	p1 = EmMemDoGet16 (srcPtr);
+				uint16	p2 = EmMemDoGet16 (srcPtr + 2);
+
+				uint32	rgb1 = hiTable[p1 >> 8] | loTable[p1 & 0xFF];
+				uint32	rgb2 = hiTable[p2 >> 8] | loTable[p2 & 0xFF];
+
+				destPtr[0] = (uint8) (rgb1 >> 16);
+				destPtr[1] = (uint8) (rgb1 >>  8);
+				destPtr[2] = (uint8) (rgb1 >>  0);
+				destPtr[3] = (uint8) (rgb2 >> 16);
+				destPtr[4] = (uint8) (rgb2 >>  8);
+				destPtr[5] = (uint8) (rgb2 >>  0);
+
+				srcPtr += 4;
+				destPtr += 6;
+				xx -= 2;
+			}
+
+			if (xx)
+			{
+				uint16	p = EmMemDoGet16 (srcPtr);
+				uint32	rgb = hiTable[p >> 8] | loTable[p & 0xFF];
+
+				destPtr[0] = (uint8) (rgb >> 16);
+				destPtr[1] = (uint8) (rgb >>  8);
+				destPtr[2] = (uint8) (rgb >>  0);
 			}
 
 			srcPtr	= srcPtr0 += srcRowBytes;
@@ -599,4 +620,38 @@ void EmRegsMQLCDControl::PrvGetPalette (RGBList& thePalette)
 UInt16 EmRegsMQLCDControl::GetResolutionMode ()
 {
 	return g_highResMode;
-}
\ No newline at end of file
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvInitConvert565Tables
+// ---------------------------------------------------------------------------
+
+void PrvInitConvert565Tables (void)
+{
+	if (gConvert565Initialized)
+		return;
+
+	for (uint32 ii = 0; ii < 256; ++ii)
+	{
+		// High byte: RRRRRGGG.  Supplies all of red and the top three
+		// bits of green.
+
+		uint32	red		= (ii & 0xF8) | ((ii >> 3) & 0x07);
+		uint32	greenHi	= (ii << 5) & 0xE0;
+
+		// Low byte: GGGBBBBB.  Supplies the rest of green, including the
+		// two bits replicated into the bottom of the green byte, and all
+		// of blue.
+
+		uint32	greenLo	= ((ii >> 3) & 0x1C) | ((ii >> 5) & 0x03);
+		uint32	blue	= ((ii << 3) & 0xF8) | (ii & 0x07);
+
+		gConvert565Hi[ii]		= (red << 16) | (greenHi << 8);
+		gConvert565Lo[ii]		= (greenLo << 8) | blue;
+		gConvert565HiMono[ii]	= greenHi * 0x00010101;
+		gConvert565LoMono[ii]	= greenLo * 0x00010101;
+	}
+
+	gConvert565Initialized = true;
+}
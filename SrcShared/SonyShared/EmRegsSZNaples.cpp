@@ -14,9 +14,9 @@
 #include "PalmPack.h"
 #include "PalmPackPop.h"
 
-#include "SonyShared\SonyKeyMgr.h"
-#include "SonyShared\ExpansionMgr.h"
-#include "SonyWin\Platform_MsfsLib.h"
+#include "SonyShared/SonyKeyMgr.h"
+#include "SonyShared/ExpansionMgr.h"
+#include "SonyShared/Platform_MsfsLib.h"
 
 ////////////////////////////////////////////////////////////////////////////
 //
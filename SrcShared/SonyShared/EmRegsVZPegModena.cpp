@@ -3,7 +3,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "EmCommon.h"
-#include "EmRegsVzPegModena.h"
+#include "EmRegsVZPegModena.h"
 #include "EmRegsVZPrv.h"
 #include "EmMemory.h"
 #include "EmBankRegs.h"			// EmBankRegs::InvalidAccess
@@ -17,9 +17,9 @@
 #undef NON_PORTABLE
 #include "PalmPackPop.h"
 
-#include "SonyShared\SonyKeyMgr.h"
-#include "SonyShared\ExpansionMgr.h"
-#include "SonyWin\Platform_MsfsLib.h"
+#include "SonyShared/SonyKeyMgr.h"
+#include "SonyShared/ExpansionMgr.h"
+#include "SonyShared/Platform_MsfsLib.h"
 
 ////////////////////////////////////////////////////////////////////////////
 //
@@ -3,7 +3,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "EmCommon.h"
-#include "EmRegsVzPegVenice.h"
+#include "EmRegsVZPegVenice.h"
 #include "EmRegsVZPrv.h"
 #include "EmMemory.h"
 #include "EmBankRegs.h"			// EmBankRegs::InvalidAccess
@@ -18,8 +18,8 @@
 #undef NON_PORTABLE
 #include "PalmPackPop.h"
 
-#include "SonyShared\ExpansionMgr.h"
-#include "SonyWin\Platform_MsfsLib.h"
+#include "SonyShared/ExpansionMgr.h"
+#include "SonyShared/Platform_MsfsLib.h"
 
 
 
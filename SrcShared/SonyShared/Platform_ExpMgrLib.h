@@ -15,7 +15,7 @@
 #define _PLATFORM_EXPMGRLIB_H_
 
 #include "SessionFile.h"		// SessionFile
-#include "SonyShared\ExpansionMgr.h"
+#include "SonyShared/ExpansionMgr.h"
 
 class Platform_ExpMgrLib
 {
@@ -14,8 +14,8 @@
 #ifndef _PLATFORM_MSFSLIB_H_
 #define _PLATFORM_MSFSLIB_H_
 
-#include "SonyShared\ExpansionMgr.h"
-#include "SonyShared\VFSMgr.h"
+#include "SonyShared/ExpansionMgr.h"
+#include "SonyShared/VFSMgr.h"
 #include "SessionFile.h"		// SessionFile
 
 class Platform_MsfsLib
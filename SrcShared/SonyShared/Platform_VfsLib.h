@@ -14,7 +14,7 @@
 #ifndef _PLATFORM_VFSLIB_H_
 #define _PLATFORM_VFSLIB_H_
 
-#include "SonyShared\Ffs.h"
+#include "SonyShared/Ffs.h"
 #include "SessionFile.h"		// SessionFile
 
 class Platform_VfsLib
@@ -63,7 +63,7 @@ inline void Canonical_If_Not_Null (T* p)
 // ---------------------------------------------------------------------------
 //		 Expansion Manager functions
 // ---------------------------------------------------------------------------
-#include "SonyShared\ExpansionMgr.h"
+#include "SonyShared/ExpansionMgr.h"
 
 #define CallExpansionMgr(selector)		\
 	theTrap.SetNewDReg (2, selector);	\
@@ -39,6 +39,7 @@ static Bool				gMinimize;
 static Bool				gStartNewHorde;
 static Bool				gHordeQuitWhenDone;
 static Bool				gMinimizeQuitWhenDone;
+static Bool				gStartBenchmark;
 // Quit actions.
 static Bool				gQuitOnExit;
 
@@ -48,6 +49,7 @@ static EmFileRef		gSessionOpenRef;	// For OpenSession.
 static EmFileRef		gMinimizeRef;		// For Minimize
 static HordeInfo		gHorde;				// For StartNewGremlin
 static StringList		gHordeApps;			// For StartNewGremlin
+static EmFileRef		gBenchmarkRef;		// For Benchmark
 
 	// These are the files listed on the command line.
 static string			gAutoRunApp;
@@ -81,6 +83,7 @@ static const char		kOptHordeSaveFreq[]		= "horde_save_freq";
 static const char		kOptHordeDepthMax[]		= "horde_depth_max";
 static const char		kOptHordeDepthSwitch[]	= "horde_depth_switch";
 static const char		kOptHordeQuitWhenDone[]	= "horde_quit_when_done";
+static const char		kOptBenchmark[]			= "benchmark";
 
 
 // These are the options the user can specify on the command line.
@@ -115,7 +118,8 @@ kOptionMap [] =
 	{ "-horde_save_freq",		kOptHordeSaveFreq,		1 },
 	{ "-horde_depth_max",		kOptHordeDepthMax,		1 },
 	{ "-horde_depth_switch",	kOptHordeDepthSwitch,	1 },
-	{ "-horde_quit_when_done",	kOptHordeQuitWhenDone,	0 }
+	{ "-horde_quit_when_done",	kOptHordeQuitWhenDone,	0 },
+	{ "-benchmark",				kOptBenchmark,			1 }
 };
 
 
@@ -321,6 +325,7 @@ void Startup::PrvPrintHelp (void)
 	printf (" -run_app <name>      Name of file to automatically run at startup\n");
 	printf (" -quit_on_exit        Cause Poser to quit after -run application exits\n");
 	printf (" -pref <key=value>    Change a preference setting\n");
+	printf (" -benchmark <file>    Run the benchmark suite, write the results to <file>, and quit\n");
 	printf ("\n");
 
 	Platform::PrintHelp ();
@@ -911,6 +916,34 @@ Bool Startup::PrvHandleSkinParameters (OptionList& options)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:    PrvHandleBenchmarkParameters
+ *
+ * DESCRIPTION: Handle the following command line options:
+ *
+ *					kOptBenchmark
+ *
+ * PARAMETERS:  options - the OptionList containing the complete set
+ *					of parsed switches and parameters.
+ *
+ * RETURNED:    True if everything when OK.
+ *
+ ***********************************************************************/
+
+Bool Startup::PrvHandleBenchmarkParameters (OptionList& options)
+{
+	DEFINE_VARS(Benchmark);
+
+	if (haveBenchmark)
+	{
+		Startup::ScheduleBenchmark (EmFileRef (optBenchmark));
+	}
+
+	return true;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:    PrvHandlePreferenceParameters
@@ -1006,6 +1039,10 @@ Bool Startup::PrvParseCommandLine (int argc, char** argv)
 	if (!Startup::PrvHandleSkinParameters (options))
 		goto BadParameter;
 
+	// Handle kOptBenchmark
+	if (!Startup::PrvHandleBenchmarkParameters (options))
+		goto BadParameter;
+
 	// Handle preference changes.
 	if (!Startup::PrvHandlePreferenceParameters (prefs))
 		goto BadParameter;
@@ -1419,6 +1456,38 @@ Bool Startup::NewHorde (HordeInfo* info)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:    Startup::Benchmark
+ *
+ * DESCRIPTION: Return whether or not we are supposed to run the
+ *				benchmark suite.  Like NewHorde, this returns true only
+ *				once, and only if "ref" is non-NULL.
+ *
+ * PARAMETERS:  ref - receives the file to write the results to.
+ *
+ * RETURNED:    True if so.
+ *
+ ***********************************************************************/
+
+Bool Startup::Benchmark (EmFileRef* ref)
+{
+	Bool	result = gStartBenchmark;
+
+	if (ref != NULL)
+	{
+		if (result)
+		{
+			*ref = gBenchmarkRef;
+		}
+
+		gStartBenchmark = false;
+	}
+
+	return result;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:    Startup::HordeQuitWhenDone
@@ -1495,6 +1564,7 @@ void Startup::Clear (void)
 	gCreateSession	= false;
 	gOpenSession	= false;
 	gStartNewHorde	= false;
+	gStartBenchmark	= false;
 	gQuitOnExit		= false;
 
 	gAutoRunApp = "";
@@ -1640,3 +1710,23 @@ void Startup::ScheduleQuitOnExit (void)
 {
 	gQuitOnExit = true;
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:    Startup::ScheduleBenchmark
+ *
+ * DESCRIPTION: Schedule our "state machine" so that Benchmark will
+ *				return True.
+ *
+ * PARAMETERS:  ref - file to write the results to.
+ *
+ * RETURNED:    Nothing
+ *
+ ***********************************************************************/
+
+void Startup::ScheduleBenchmark (const EmFileRef& ref)
+{
+	gStartBenchmark = true;
+	gBenchmarkRef = ref;
+}
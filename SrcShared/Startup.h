@@ -42,6 +42,7 @@ class Startup
 		static Bool				OpenSession				(EmFileRef&);
 		static Bool				Minimize				(EmFileRef&);
 		static Bool				NewHorde				(HordeInfo*);
+		static Bool				Benchmark				(EmFileRef*);
 		static Bool				HordeQuitWhenDone		(void);
 		static Bool				MinimizeQuitWhenDone	(void);
 		static Bool				CloseSession			(EmFileRef&);
@@ -67,6 +68,7 @@ class Startup
 		static Bool				PrvHandleNewHordeParameters			(OptionList& options);
 		static Bool				PrvHandleAutoLoadParameters			(OptionList& options);
 		static Bool				PrvHandleSkinParameters				(OptionList& options);
+		static Bool				PrvHandleBenchmarkParameters		(OptionList& options);
 		static Bool				PrvHandlePreferenceParameters		(PreferenceList& prefs);
 		static Bool				PrvParseCommandLine		(int argc, char** argv);
 		static void				PrvLookForAutoloads		(void);
@@ -83,6 +85,7 @@ class Startup
 		static void				ScheduleMinimize		(const EmFileRef&);
 		static void				ScheduleNewHorde		(const HordeInfo&, const StringList&);
 		static void				ScheduleQuitOnExit		(void);
+		static void				ScheduleBenchmark		(const EmFileRef&);
 };
 
 #endif	/* _STARTUP_H_ */
@@ -114,6 +114,7 @@
 #define kStr_InvalidAddressNotInROMOrRAM 1108
 #define kStr_CannotParseCondition		1109
 #define kStr_UserNameTooLong			1110
+#define kStr_MappedFileTooBig			1111
 
 
 // --------------------------------------------------------------------------------
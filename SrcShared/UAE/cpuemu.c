@@ -10214,7 +10214,7 @@ unsigned long REGPARAM2 op_48a0_3(uae_u32 opcode) /* MVMLE */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) - 0;
 {	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
-	m68k_areg(regs, dstreg) -= 16*2;
+	m68k_areg (regs, dstreg) -= 16 * 2;
 	while (amask) { srca -= 2; put_word(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
 	while (dmask) { srca -= 2; put_word(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
 	m68k_areg(regs, dstreg) = srca;
@@ -10293,7 +10293,7 @@ unsigned long REGPARAM2 op_48e0_3(uae_u32 opcode) /* MVMLE */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) - 0;
 {	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
-	m68k_areg(regs, dstreg) -= 16*4;
+	m68k_areg (regs, dstreg) -= 16 * 4;
 	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
 	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
 	m68k_areg(regs, dstreg) = srca;
@@ -11118,6 +11118,7 @@ unsigned long REGPARAM2 op_4e74_3(uae_u32 opcode) /* RTD */
 	m68k_areg(regs, 7) += 4;
 {	uae_s16 offs = get_iword(2);
 	m68k_areg(regs, 7) += offs;
+	CHECK_STACK_POINTER_INCREMENT ();
 	m68k_setpc_rte(pc);
 }}}}return 8;
 }
@@ -0,0 +1,24257 @@
+#include "UAE.h"
+#if HAS_PROFILING
+#include "Profiling.h"
+#endif
+
+#undef get_long
+#define get_long EmMemFastGet32
+#undef get_word
+#define get_word EmMemFastGet16
+#undef get_byte
+#define get_byte EmMemFastGet8
+#undef put_long
+#define put_long EmMemFastPut32
+#undef put_word
+#define put_word EmMemFastPut16
+#undef put_byte
+#define put_byte EmMemFastPut8
+
+#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
+#define PART_1 1
+#define PART_2 1
+#define PART_3 1
+#define PART_4 1
+#define PART_5 1
+#define PART_6 1
+#define PART_7 1
+#define PART_8 1
+#endif
+
+#ifdef PART_1
+unsigned long REGPARAM2 op_0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_10_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_18_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_20_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_28_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_30_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_38_5(uae_u32 opcode) /* OR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_39_5(uae_u32 opcode) /* OR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_3c_5(uae_u32 opcode) /* ORSR */
+{
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	src &= 0xFF;
+	regs.sr |= src;
+	MakeFromSR();
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_40_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_50_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_58_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_60_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_68_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_70_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_78_5(uae_u32 opcode) /* OR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_79_5(uae_u32 opcode) /* OR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_7c_5(uae_u32 opcode) /* ORSR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel1602; }
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	regs.sr |= src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel1602: ;
+return 4;
+}
+unsigned long REGPARAM2 op_80_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_90_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_98_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_a0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_a8_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_b0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_b8_5(uae_u32 opcode) /* OR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_b9_5(uae_u32 opcode) /* OR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+return 18;
+}
+unsigned long REGPARAM2 op_100_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_108_5(uae_u32 opcode) /* MVPMR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr memp = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_u16 val = (get_byte(memp) << 8) + get_byte(memp + 2);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_110_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_118_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_120_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_128_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_130_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_138_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_139_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_13a_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_13b_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_13c_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = get_ibyte(2);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_140_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_148_5(uae_u32 opcode) /* MVPMR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr memp = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_u32 val = (get_byte(memp) << 24) + (get_byte(memp + 2) << 16)
+              + (get_byte(memp + 4) << 8) + get_byte(memp + 6);
+	m68k_dreg(regs, dstreg) = (val);
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_150_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_158_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_160_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_168_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_170_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_178_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_179_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_17a_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_17b_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_180_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_188_5(uae_u32 opcode) /* MVPRM */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	uaecptr memp = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	put_byte(memp, src >> 8); put_byte(memp + 2, src);
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_190_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_198_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1a0_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1a8_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1b0_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1b8_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1b9_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_1ba_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1bb_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1c0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_1c8_5(uae_u32 opcode) /* MVPRM */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	uaecptr memp = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	put_byte(memp, src >> 24); put_byte(memp + 2, src >> 16);
+	put_byte(memp + 4, src >> 8); put_byte(memp + 6, src);
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_1d0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1d8_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1e0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1e8_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1f0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1f8_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1f9_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_1fa_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1fb_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_200_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_210_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_218_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_220_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_228_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_230_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_238_5(uae_u32 opcode) /* AND */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_239_5(uae_u32 opcode) /* AND */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_23c_5(uae_u32 opcode) /* ANDSR */
+{
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	src |= 0xFF00;
+	regs.sr &= src;
+	MakeFromSR();
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_240_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_250_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_258_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_260_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_268_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_270_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_278_5(uae_u32 opcode) /* AND */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_279_5(uae_u32 opcode) /* AND */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_27c_5(uae_u32 opcode) /* ANDSR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel1673; }
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	regs.sr &= src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel1673: ;
+return 4;
+}
+unsigned long REGPARAM2 op_280_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_290_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_298_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_2a0_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_2a8_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_2b0_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_2b8_5(uae_u32 opcode) /* AND */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_2b9_5(uae_u32 opcode) /* AND */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+return 18;
+}
+unsigned long REGPARAM2 op_400_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_410_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_418_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_420_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_428_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_430_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_438_5(uae_u32 opcode) /* SUB */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_439_5(uae_u32 opcode) /* SUB */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_440_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_450_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_458_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_460_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_468_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_470_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_478_5(uae_u32 opcode) /* SUB */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_479_5(uae_u32 opcode) /* SUB */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_480_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_490_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_498_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_4a0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_4a8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_4b0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_4b8_5(uae_u32 opcode) /* SUB */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_4b9_5(uae_u32 opcode) /* SUB */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(10);
+return 18;
+}
+unsigned long REGPARAM2 op_600_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_610_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_618_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_620_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_628_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_630_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_638_5(uae_u32 opcode) /* ADD */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_639_5(uae_u32 opcode) /* ADD */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_640_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_650_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_658_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_660_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_668_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_670_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_678_5(uae_u32 opcode) /* ADD */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_679_5(uae_u32 opcode) /* ADD */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_680_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_690_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_698_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_6a0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_6a8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_6b0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_6b8_5(uae_u32 opcode) /* ADD */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_6b9_5(uae_u32 opcode) /* ADD */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(10);
+return 18;
+}
+unsigned long REGPARAM2 op_800_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_810_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_818_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_820_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_828_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_830_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_838_5(uae_u32 opcode) /* BTST */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_839_5(uae_u32 opcode) /* BTST */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(8);
+return 10;
+}
+unsigned long REGPARAM2 op_83a_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_83b_5(uae_u32 opcode) /* BTST */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_83c_5(uae_u32 opcode) /* BTST */
+{
+{{	uae_s16 src = get_iword(2);
+{	uae_s8 dst = get_ibyte(4);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_840_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_850_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_858_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_860_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_868_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_870_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_878_5(uae_u32 opcode) /* BCHG */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_879_5(uae_u32 opcode) /* BCHG */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_87a_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_87b_5(uae_u32 opcode) /* BCHG */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_880_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_890_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_898_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8a0_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8a8_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8b0_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8b8_5(uae_u32 opcode) /* BCLR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8b9_5(uae_u32 opcode) /* BCLR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_8ba_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8bb_5(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8c0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_8d0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8d8_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8e0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8e8_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8f0_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8f8_5(uae_u32 opcode) /* BSET */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8f9_5(uae_u32 opcode) /* BSET */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_8fa_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8fb_5(uae_u32 opcode) /* BSET */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_a00_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_a10_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_a18_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_a20_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_a28_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_a30_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_a38_5(uae_u32 opcode) /* EOR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_a39_5(uae_u32 opcode) /* EOR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_a3c_5(uae_u32 opcode) /* EORSR */
+{
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	src &= 0xFF;
+	regs.sr ^= src;
+	MakeFromSR();
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_a40_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_a50_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_a58_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_a60_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_a68_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_a70_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+#endif
+
+#ifdef PART_2
+unsigned long REGPARAM2 op_a78_5(uae_u32 opcode) /* EOR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_a79_5(uae_u32 opcode) /* EOR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_a7c_5(uae_u32 opcode) /* EORSR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel1788; }
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	regs.sr ^= src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel1788: ;
+return 4;
+}
+unsigned long REGPARAM2 op_a80_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_a90_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_a98_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_aa0_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_aa8_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_ab0_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_ab8_5(uae_u32 opcode) /* EOR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_ab9_5(uae_u32 opcode) /* EOR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+return 18;
+}
+unsigned long REGPARAM2 op_c00_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_c10_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c18_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c20_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c28_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c30_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c38_5(uae_u32 opcode) /* CMP */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c39_5(uae_u32 opcode) /* CMP */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 10;
+}
+unsigned long REGPARAM2 op_c3a_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c3b_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c40_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_c50_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c58_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c60_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c68_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c70_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c78_5(uae_u32 opcode) /* CMP */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c79_5(uae_u32 opcode) /* CMP */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 10;
+}
+unsigned long REGPARAM2 op_c7a_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c7b_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c80_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_c90_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_c98_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_ca0_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_ca8_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_cb0_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_cb8_5(uae_u32 opcode) /* CMP */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_cb9_5(uae_u32 opcode) /* CMP */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(10);
+return 14;
+}
+unsigned long REGPARAM2 op_cba_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_getpc () + 6;
+	dsta += (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_cbb_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr tmppc = m68k_getpc() + 6;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_1000_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_1010_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_1018_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_1020_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_1028_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1030_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1038_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1039_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_103a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_103b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_103c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_1080_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_1090_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1098_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_10a0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_10a8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10b0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10b8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10b9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_10ba_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10bb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10bc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_10c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_10d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_10d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_10e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_10e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10f8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10f9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_10fa_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10fb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_10fc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1100_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_1110_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1118_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1120_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_1128_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1130_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1138_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1139_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_113a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_113b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_113c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1140_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1150_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1158_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1160_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1168_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_1170_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_1178_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_1179_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_117a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_117b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_117c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_1180_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_1190_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_1198_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_11a0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_11a8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11b0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11b8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11b9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_11ba_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11bb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11bc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_11c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_11d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_11d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_11e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_11e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11f8_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11f9_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_11fa_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11fb_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_11fc_5(uae_u32 opcode) /* MOVE */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_13c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_13d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_13d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_13e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_13e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_13f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_13f8_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_13f9_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(10);
+return 14;
+}
+unsigned long REGPARAM2 op_13fa_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_13fb_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_13fc_5(uae_u32 opcode) /* MOVE */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(8);
+return 10;
+}
+unsigned long REGPARAM2 op_2000_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_2008_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_2010_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2018_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2020_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2028_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2030_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2038_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2039_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_203a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_203b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_203c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_2040_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_2048_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_2050_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2058_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2060_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2068_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2070_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2078_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2079_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_207a_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_207b_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_207c_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_2080_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2088_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2090_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_2098_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_20a0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_20a8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20b0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20b8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20b9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_20ba_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20bb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20bc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_20c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_20c8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_20d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_20d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_20e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_20e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20f8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20f9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_20fa_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20fb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_20fc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_2100_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2108_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_2110_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_2118_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_2120_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_2128_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2130_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2138_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2139_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_213a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_213b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+#endif
+
+#ifdef PART_3
+unsigned long REGPARAM2 op_213c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_2140_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2148_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2150_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2158_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2160_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2168_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_2170_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_2178_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_2179_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_217a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_217b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_217c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_2180_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2188_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_2190_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_2198_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_21a0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_21a8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21b0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21b8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21b9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_21ba_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21bb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21bc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_21c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_21c8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_21d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_21d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_21e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_21e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21f8_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21f9_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_21fa_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21fb_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_21fc_5(uae_u32 opcode) /* MOVE */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_23c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_23c8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_23d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_23d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_23e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_23e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_23f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_23f8_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_23f9_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+return 18;
+}
+unsigned long REGPARAM2 op_23fa_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_23fb_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+return 16;
+}
+unsigned long REGPARAM2 op_23fc_5(uae_u32 opcode) /* MOVE */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(10);
+return 14;
+}
+unsigned long REGPARAM2 op_3000_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_3008_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_3010_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3018_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3020_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3028_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3030_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3038_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3039_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_303a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_303b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_303c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_3040_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_3048_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_3050_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3058_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3060_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3068_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3070_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3078_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3079_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_307a_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_307b_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_307c_5(uae_u32 opcode) /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_3080_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3088_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3090_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_3098_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_30a0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_30a8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30b0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30b8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30b9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_30ba_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30bb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30bc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_30c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_30c8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_30d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_30d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_30e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_30e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30f8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30f9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_30fa_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30fb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_30fc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3100_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3108_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_3110_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_3118_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_3120_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_3128_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3130_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3138_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3139_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_313a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_313b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_313c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3140_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3148_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3150_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3158_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3160_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3168_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_3170_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_3178_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_3179_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_317a_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_317b_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_317c_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_3180_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3188_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_3190_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_3198_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_31a0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_31a8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31b0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31b8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31b9_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_31ba_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31bb_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31bc_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_31c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_31c8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_31d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_31d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_31e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_31e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31f8_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31f9_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_31fa_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31fb_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_31fc_5(uae_u32 opcode) /* MOVE */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_33c0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_33c8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_33d0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_33d8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_33e0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_33e8_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_33f0_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_33f8_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_33f9_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(6);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(10);
+return 14;
+}
+unsigned long REGPARAM2 op_33fa_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_33fb_5(uae_u32 opcode) /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+return 12;
+}
+unsigned long REGPARAM2 op_33fc_5(uae_u32 opcode) /* MOVE */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(8);
+return 10;
+}
+unsigned long REGPARAM2 op_4000_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((newv) & 0xff);
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4010_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4018_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4020_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4028_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4030_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4038_5(uae_u32 opcode) /* NEGX */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4039_5(uae_u32 opcode) /* NEGX */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4040_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4050_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4058_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4060_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4068_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4070_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4078_5(uae_u32 opcode) /* NEGX */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4079_5(uae_u32 opcode) /* NEGX */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4080_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (newv);
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4090_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_4098_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_40a0_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_40a8_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_40b0_5(uae_u32 opcode) /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_40b8_5(uae_u32 opcode) /* NEGX */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_40b9_5(uae_u32 opcode) /* NEGX */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_40c0_5(uae_u32 opcode) /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	MakeSR();
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((regs.sr) & 0xffff);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_40d0_5(uae_u32 opcode) /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_40d8_5(uae_u32 opcode) /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 2;
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_40e0_5(uae_u32 opcode) /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_40e8_5(uae_u32 opcode) /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_40f0_5(uae_u32 opcode) /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_40f8_5(uae_u32 opcode) /* MVSR2 */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_40f9_5(uae_u32 opcode) /* MVSR2 */
+{
+{{	uaecptr srca = get_ilong(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_4100_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2163; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2163; }
+}}}m68k_incpc(2);
+endlabel2163: ;
+return 2;
+}
+unsigned long REGPARAM2 op_4110_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2164; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2164; }
+}}}}m68k_incpc(2);
+endlabel2164: ;
+return 6;
+}
+unsigned long REGPARAM2 op_4118_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2165; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2165; }
+}}}}m68k_incpc(2);
+endlabel2165: ;
+return 6;
+}
+unsigned long REGPARAM2 op_4120_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2166; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2166; }
+}}}}m68k_incpc(2);
+endlabel2166: ;
+return 6;
+}
+unsigned long REGPARAM2 op_4128_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2167; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2167; }
+}}}}m68k_incpc(4);
+endlabel2167: ;
+return 8;
+}
+unsigned long REGPARAM2 op_4130_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2168; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2168; }
+}}}}m68k_incpc(4);
+endlabel2168: ;
+return 8;
+}
+unsigned long REGPARAM2 op_4138_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2169; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2169; }
+}}}}m68k_incpc(4);
+endlabel2169: ;
+return 8;
+}
+unsigned long REGPARAM2 op_4139_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2170; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2170; }
+}}}}m68k_incpc(6);
+endlabel2170: ;
+return 10;
+}
+unsigned long REGPARAM2 op_413a_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2171; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2171; }
+}}}}m68k_incpc(4);
+endlabel2171: ;
+return 8;
+}
+unsigned long REGPARAM2 op_413b_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2172; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2172; }
+}}}}m68k_incpc(4);
+endlabel2172: ;
+return 8;
+}
+unsigned long REGPARAM2 op_413c_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2173; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2173; }
+}}}m68k_incpc(6);
+endlabel2173: ;
+return 6;
+}
+unsigned long REGPARAM2 op_4180_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2174; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2174; }
+}}}m68k_incpc(2);
+endlabel2174: ;
+return 2;
+}
+unsigned long REGPARAM2 op_4190_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2175; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2175; }
+}}}}m68k_incpc(2);
+endlabel2175: ;
+return 4;
+}
+unsigned long REGPARAM2 op_4198_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2176; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2176; }
+}}}}m68k_incpc(2);
+endlabel2176: ;
+return 4;
+}
+unsigned long REGPARAM2 op_41a0_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2177; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2177; }
+}}}}m68k_incpc(2);
+endlabel2177: ;
+return 4;
+}
+unsigned long REGPARAM2 op_41a8_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2178; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2178; }
+}}}}m68k_incpc(4);
+endlabel2178: ;
+return 6;
+}
+unsigned long REGPARAM2 op_41b0_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2179; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2179; }
+}}}}m68k_incpc(4);
+endlabel2179: ;
+return 6;
+}
+unsigned long REGPARAM2 op_41b8_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2180; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2180; }
+}}}}m68k_incpc(4);
+endlabel2180: ;
+return 6;
+}
+unsigned long REGPARAM2 op_41b9_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2181; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2181; }
+}}}}m68k_incpc(6);
+endlabel2181: ;
+return 8;
+}
+unsigned long REGPARAM2 op_41ba_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2182; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2182; }
+}}}}m68k_incpc(4);
+endlabel2182: ;
+return 6;
+}
+unsigned long REGPARAM2 op_41bb_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2183; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2183; }
+}}}}m68k_incpc(4);
+endlabel2183: ;
+return 6;
+}
+unsigned long REGPARAM2 op_41bc_5(uae_u32 opcode) /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2184; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2184; }
+}}}m68k_incpc(4);
+endlabel2184: ;
+return 4;
+}
+unsigned long REGPARAM2 op_41d0_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{{	uaecptr prev_dstreg = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) {
+		if (srcreg == 7) {
+			if (prev_dstreg < (srca)) CHECK_STACK_POINTER_INCREMENT ();
+			if (prev_dstreg > (srca)) CHECK_STACK_POINTER_DECREMENT ();
+		} else {
+			CHECK_STACK_POINTER_ASSIGNMENT ();
+		}
+	}
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_41e8_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr prev_dstreg = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) {
+		if (srcreg == 7) {
+			if (prev_dstreg < (srca)) CHECK_STACK_POINTER_INCREMENT ();
+			if (prev_dstreg > (srca)) CHECK_STACK_POINTER_DECREMENT ();
+		} else {
+			CHECK_STACK_POINTER_ASSIGNMENT ();
+		}
+	}
+}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_41f0_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr prev_dstreg = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) {
+		if (srcreg == 7) {
+			if (prev_dstreg < (srca)) CHECK_STACK_POINTER_INCREMENT ();
+			if (prev_dstreg > (srca)) CHECK_STACK_POINTER_DECREMENT ();
+		} else {
+			CHECK_STACK_POINTER_ASSIGNMENT ();
+		}
+	}
+}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_41f8_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_41f9_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_41fa_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_41fb_5(uae_u32 opcode) /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4200_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4210_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4218_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4220_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4228_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4230_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4238_5(uae_u32 opcode) /* CLR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4239_5(uae_u32 opcode) /* CLR */
+{
+{{	uaecptr srca = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_4240_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4250_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4258_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4260_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4268_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+return 6;
+}
+#endif
+
+#ifdef PART_4
+unsigned long REGPARAM2 op_4270_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4278_5(uae_u32 opcode) /* CLR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4279_5(uae_u32 opcode) /* CLR */
+{
+{{	uaecptr srca = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_4280_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	m68k_dreg(regs, srcreg) = (0);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4290_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4298_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_42a0_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_42a8_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_42b0_5(uae_u32 opcode) /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_42b8_5(uae_u32 opcode) /* CLR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_42b9_5(uae_u32 opcode) /* CLR */
+{
+{{	uaecptr srca = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4400_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4410_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4418_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4420_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4428_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4430_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4438_5(uae_u32 opcode) /* NEG */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4439_5(uae_u32 opcode) /* NEG */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4440_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4450_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4458_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4460_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4468_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4470_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4478_5(uae_u32 opcode) /* NEG */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4479_5(uae_u32 opcode) /* NEG */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4480_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4490_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_4498_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_44a0_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_44a8_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_44b0_5(uae_u32 opcode) /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_44b8_5(uae_u32 opcode) /* NEG */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_44b9_5(uae_u32 opcode) /* NEG */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_44c0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_44d0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_44d8_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_44e0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_44e8_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_44f0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_44f8_5(uae_u32 opcode) /* MV2SR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_44f9_5(uae_u32 opcode) /* MV2SR */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_44fa_5(uae_u32 opcode) /* MV2SR */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_44fb_5(uae_u32 opcode) /* MV2SR */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_44fc_5(uae_u32 opcode) /* MV2SR */
+{
+{{	uae_s16 src = get_iword(2);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4600_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4610_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4618_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4620_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4628_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4630_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4638_5(uae_u32 opcode) /* NOT */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4639_5(uae_u32 opcode) /* NOT */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4640_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4650_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4658_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4660_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4668_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4670_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4678_5(uae_u32 opcode) /* NOT */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4679_5(uae_u32 opcode) /* NOT */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4680_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4690_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_4698_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_46a0_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_46a8_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_46b0_5(uae_u32 opcode) /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_46b8_5(uae_u32 opcode) /* NOT */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_46b9_5(uae_u32 opcode) /* NOT */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_46c0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2275; }
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	regs.sr = src;
+	MakeFromSR();
+}}}m68k_incpc(2);
+endlabel2275: ;
+return 2;
+}
+unsigned long REGPARAM2 op_46d0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2276; }
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(2);
+endlabel2276: ;
+return 4;
+}
+unsigned long REGPARAM2 op_46d8_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2277; }
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(2);
+endlabel2277: ;
+return 4;
+}
+unsigned long REGPARAM2 op_46e0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2278; }
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(2);
+endlabel2278: ;
+return 4;
+}
+unsigned long REGPARAM2 op_46e8_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2279; }
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2279: ;
+return 6;
+}
+unsigned long REGPARAM2 op_46f0_5(uae_u32 opcode) /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2280; }
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2280: ;
+return 6;
+}
+unsigned long REGPARAM2 op_46f8_5(uae_u32 opcode) /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2281; }
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2281: ;
+return 6;
+}
+unsigned long REGPARAM2 op_46f9_5(uae_u32 opcode) /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2282; }
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(6);
+endlabel2282: ;
+return 8;
+}
+unsigned long REGPARAM2 op_46fa_5(uae_u32 opcode) /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2283; }
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2283: ;
+return 6;
+}
+unsigned long REGPARAM2 op_46fb_5(uae_u32 opcode) /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2284; }
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2284: ;
+return 6;
+}
+unsigned long REGPARAM2 op_46fc_5(uae_u32 opcode) /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2285; }
+{{	uae_s16 src = get_iword(2);
+	regs.sr = src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel2285: ;
+return 4;
+}
+unsigned long REGPARAM2 op_4800_5(uae_u32 opcode) /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((newv) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4810_5(uae_u32 opcode) /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4818_5(uae_u32 opcode) /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4820_5(uae_u32 opcode) /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4828_5(uae_u32 opcode) /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4830_5(uae_u32 opcode) /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4838_5(uae_u32 opcode) /* NBCD */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4839_5(uae_u32 opcode) /* NBCD */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4840_5(uae_u32 opcode) /* SWAP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4850_5(uae_u32 opcode) /* PEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4868_5(uae_u32 opcode) /* PEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4870_5(uae_u32 opcode) /* PEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4878_5(uae_u32 opcode) /* PEA */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4879_5(uae_u32 opcode) /* PEA */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_487a_5(uae_u32 opcode) /* PEA */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_487b_5(uae_u32 opcode) /* PEA */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4880_5(uae_u32 opcode) /* EXT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u16 dst = (uae_s16)(uae_s8)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4890_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_48a0_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	m68k_areg (regs, dstreg) -= 16 * 2;
+	while (amask) { srca -= 2; put_word(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 2; put_word(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+	CHECK_STACK_POINTER_DECREMENT ();
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_48a8_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_48b0_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_48b8_5(uae_u32 opcode) /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_48b9_5(uae_u32 opcode) /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_ilong(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+return 8;
+}
+unsigned long REGPARAM2 op_48c0_5(uae_u32 opcode) /* EXT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_48d0_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_48e0_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	m68k_areg (regs, dstreg) -= 16 * 4;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+	CHECK_STACK_POINTER_DECREMENT ();
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_48e8_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_48f0_5(uae_u32 opcode) /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_48f8_5(uae_u32 opcode) /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_48f9_5(uae_u32 opcode) /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_ilong(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+return 8;
+}
+unsigned long REGPARAM2 op_49c0_5(uae_u32 opcode) /* EXT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = (uae_s32)(uae_s8)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4a00_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4a10_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4a18_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4a20_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4a28_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a30_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a38_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a39_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_4a3a_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a3b_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a3c_5(uae_u32 opcode) /* TST */
+{
+{{	uae_s8 src = get_ibyte(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4a40_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4a48_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4a50_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4a58_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4a60_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_4a68_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a70_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a78_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a79_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_4a7a_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a7b_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_4a7c_5(uae_u32 opcode) /* TST */
+{
+{{	uae_s16 src = get_iword(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4a80_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4a88_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4a90_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4a98_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4aa0_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4aa8_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4ab0_5(uae_u32 opcode) /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4ab8_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4ab9_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4aba_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4abb_5(uae_u32 opcode) /* TST */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4abc_5(uae_u32 opcode) /* TST */
+{
+{{	uae_s32 src = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4ac0_5(uae_u32 opcode) /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
+}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4ad0_5(uae_u32 opcode) /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4ad8_5(uae_u32 opcode) /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4ae0_5(uae_u32 opcode) /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4ae8_5(uae_u32 opcode) /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4af0_5(uae_u32 opcode) /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4af8_5(uae_u32 opcode) /* TAS */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4af9_5(uae_u32 opcode) /* TAS */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_4c90_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4c98_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4ca8_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cb0_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cb8_5(uae_u32 opcode) /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cb9_5(uae_u32 opcode) /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_ilong(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+return 8;
+}
+unsigned long REGPARAM2 op_4cba_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = 2;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_getpc () + 4;
+	srca += (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cbb_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = 3;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cd0_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4cd8_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_4ce8_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cf0_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cf8_5(uae_u32 opcode) /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cf9_5(uae_u32 opcode) /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_ilong(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+return 8;
+}
+unsigned long REGPARAM2 op_4cfa_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = 2;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_getpc () + 4;
+	srca += (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4cfb_5(uae_u32 opcode) /* MVMEL */
+{
+	uae_u32 dstreg = 3;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_4e40_5(uae_u32 opcode) /* TRAP */
+{
+	uae_u32 srcreg = (opcode & 15);
+{{	uae_u32 src = srcreg;
+m68k_incpc(2);
+	Exception(src+32,0);
+}}return 2;
+}
+unsigned long REGPARAM2 op_4e50_5(uae_u32 opcode) /* LINK */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr olda = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = olda;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 src = m68k_areg(regs, srcreg);
+	put_long(olda,src);
+	m68k_areg(regs, srcreg) = (m68k_areg(regs, 7));
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+{	uae_s16 offs = get_iword(2);
+	m68k_areg(regs, 7) += offs;
+	CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_4e58_5(uae_u32 opcode) /* UNLK */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+	m68k_areg(regs, 7) = src;
+	CHECK_STACK_POINTER_INCREMENT ();
+{	uaecptr olda = m68k_areg(regs, 7);
+{	uae_s32 old = get_long(olda);
+	m68k_areg(regs, 7) += 4;
+	m68k_areg(regs, srcreg) = (old);
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_4e60_5(uae_u32 opcode) /* MVR2USP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2379; }
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+	regs.usp = src;
+}}}m68k_incpc(2);
+endlabel2379: ;
+return 2;
+}
+unsigned long REGPARAM2 op_4e68_5(uae_u32 opcode) /* MVUSP2R */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel2380; }
+{{	m68k_areg(regs, srcreg) = (regs.usp);
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+endlabel2380: ;
+return 2;
+}
+unsigned long REGPARAM2 op_4e70_5(uae_u32 opcode) /* RESET */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2381; }
+{	customreset();
+}}m68k_incpc(2);
+endlabel2381: ;
+return 2;
+}
+unsigned long REGPARAM2 op_4e71_5(uae_u32 opcode) /* NOP */
+{
+{}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_4e72_5(uae_u32 opcode) /* STOP */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2383; }
+{{	uae_s16 src = get_iword(2);
+	regs.sr = src;
+	MakeFromSR();
+	m68k_setstopped(1);
+}}}m68k_incpc(4);
+endlabel2383: ;
+return 4;
+}
+unsigned long REGPARAM2 op_4e73_5(uae_u32 opcode) /* RTE */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel2384; }
+{{	uaecptr sra = m68k_areg(regs, 7);
+{	uae_s16 sr = get_word(sra);
+	m68k_areg(regs, 7) += 2;
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+	regs.sr = sr; m68k_do_rte(pc);
+	MakeFromSR();
+}}}}}}endlabel2384: ;
+return 8;
+}
+unsigned long REGPARAM2 op_4e74_5(uae_u32 opcode) /* RTD */
+{
+{	compiler_flush_jsr_stack();
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+{	uae_s16 offs = get_iword(2);
+	m68k_areg(regs, 7) += offs;
+	CHECK_STACK_POINTER_INCREMENT ();
+	m68k_setpc_rte(pc);
+}}}}return 8;
+}
+unsigned long REGPARAM2 op_4e75_5(uae_u32 opcode) /* RTS */
+{
+{	m68k_do_rts();
+}return 2;
+}
+unsigned long REGPARAM2 op_4e76_5(uae_u32 opcode) /* TRAPV */
+{
+{m68k_incpc(2);
+	if (GET_VFLG) { Exception(7,m68k_getpc()); goto endlabel2387; }
+}endlabel2387: ;
+return 2;
+}
+unsigned long REGPARAM2 op_4e77_5(uae_u32 opcode) /* RTR */
+{
+{	compiler_flush_jsr_stack();
+	MakeSR();
+{	uaecptr sra = m68k_areg(regs, 7);
+{	uae_s16 sr = get_word(sra);
+	m68k_areg(regs, 7) += 2;
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+	regs.sr &= 0xFF00; sr &= 0xFF;
+	regs.sr |= sr; m68k_setpc(pc);
+	MakeFromSR();
+}}}}}return 8;
+}
+unsigned long REGPARAM2 op_4e90_5(uae_u32 opcode) /* JSR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+if (!Software_ProcessJSR_Ind (m68k_getpc(), srca))
+	m68k_do_jsr(m68k_getpc() + 2, srca);
+}}return 2;
+}
+unsigned long REGPARAM2 op_4ea8_5(uae_u32 opcode) /* JSR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4eb0_5(uae_u32 opcode) /* JSR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4eb8_5(uae_u32 opcode) /* JSR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4eb9_5(uae_u32 opcode) /* JSR */
+{
+{{	uaecptr srca = get_ilong(2);
+	m68k_do_jsr(m68k_getpc() + 6, srca);
+}}return 6;
+}
+unsigned long REGPARAM2 op_4eba_5(uae_u32 opcode) /* JSR */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4ebb_5(uae_u32 opcode) /* JSR */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4ed0_5(uae_u32 opcode) /* JMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_setpc(srca);
+}}return 2;
+}
+unsigned long REGPARAM2 op_4ee8_5(uae_u32 opcode) /* JMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	m68k_setpc(srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4ef0_5(uae_u32 opcode) /* JMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	m68k_setpc(srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4ef8_5(uae_u32 opcode) /* JMP */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	m68k_setpc(srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4ef9_5(uae_u32 opcode) /* JMP */
+{
+{{	uaecptr srca = get_ilong(2);
+	m68k_setpc(srca);
+}}return 6;
+}
+unsigned long REGPARAM2 op_4efa_5(uae_u32 opcode) /* JMP */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+	m68k_setpc(srca);
+}}return 4;
+}
+unsigned long REGPARAM2 op_4efb_5(uae_u32 opcode) /* JMP */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+	m68k_setpc(srca);
+}}return 4;
+}
+#endif
+
+#ifdef PART_5
+unsigned long REGPARAM2 op_5000_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5010_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5018_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5020_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5028_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5030_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5038_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5039_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_5040_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5048_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5050_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5058_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5060_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5068_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5070_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5078_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5079_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_5080_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5088_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5090_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_5098_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_50a0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_50a8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_50b0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_50b8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_50b9_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_50c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(0) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_50c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(0)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2430;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2430: ;
+return 4;
+}
+unsigned long REGPARAM2 op_50d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_50d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_50e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_50e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_50f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_50f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_50f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_5100_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5110_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5118_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5120_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5128_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5130_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5138_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5139_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_5140_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5148_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5150_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5158_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5160_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_5168_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5170_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5178_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_5179_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_5180_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5188_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5190_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_5198_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_51a0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_51a8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_51b0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_51b8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_51b9_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_51c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(1) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_51c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2465;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2465: ;
+return 4;
+}
+unsigned long REGPARAM2 op_51d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_51d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_51e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_51e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_51f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_51f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_51f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_52c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(2) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_52c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(2)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2474;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2474: ;
+return 4;
+}
+unsigned long REGPARAM2 op_52d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_52d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_52e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_52e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_52f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_52f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_52f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_53c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(3) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_53c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(3)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2483;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2483: ;
+return 4;
+}
+unsigned long REGPARAM2 op_53d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_53d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_53e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_53e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_53f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_53f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_53f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_54c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(4) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_54c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(4)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2492;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2492: ;
+return 4;
+}
+unsigned long REGPARAM2 op_54d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_54d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_54e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_54e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_54f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_54f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_54f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_55c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(5) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_55c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(5)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2501;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2501: ;
+return 4;
+}
+unsigned long REGPARAM2 op_55d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_55d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_55e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_55e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_55f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_55f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_55f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_56c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(6) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_56c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(6)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2510;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2510: ;
+return 4;
+}
+unsigned long REGPARAM2 op_56d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_56d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_56e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_56e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_56f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_56f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_56f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_57c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(7) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_57c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(7)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2519;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2519: ;
+return 4;
+}
+unsigned long REGPARAM2 op_57d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_57d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_57e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_57e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_57f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_57f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_57f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_58c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(8) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_58c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(8)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2528;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2528: ;
+return 4;
+}
+unsigned long REGPARAM2 op_58d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_58d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_58e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_58e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_58f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_58f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_58f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_59c0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(9) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_59c8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(9)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2537;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2537: ;
+return 4;
+}
+unsigned long REGPARAM2 op_59d0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_59d8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_59e0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_59e8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_59f0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_59f8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_59f9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_5ac0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(10) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5ac8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(10)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2546;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2546: ;
+return 4;
+}
+unsigned long REGPARAM2 op_5ad0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ad8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ae0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ae8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5af0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5af8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5af9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_5bc0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(11) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5bc8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(11)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2555;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2555: ;
+return 4;
+}
+unsigned long REGPARAM2 op_5bd0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5bd8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5be0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5be8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5bf0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5bf8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5bf9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_5cc0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(12) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5cc8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(12)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2564;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2564: ;
+return 4;
+}
+unsigned long REGPARAM2 op_5cd0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5cd8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ce0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ce8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5cf0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5cf8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5cf9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_5dc0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(13) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5dc8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(13)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2573;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2573: ;
+return 4;
+}
+unsigned long REGPARAM2 op_5dd0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5dd8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5de0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5de8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5df0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5df8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5df9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_5ec0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(14) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5ec8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(14)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2582;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2582: ;
+return 4;
+}
+unsigned long REGPARAM2 op_5ed0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ed8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ee0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5ee8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5ef0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5ef8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5ef9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+#endif
+
+#ifdef PART_6
+unsigned long REGPARAM2 op_5fc0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = cctrue(15) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_5fc8_5(uae_u32 opcode) /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(15)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel2591;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2591: ;
+return 4;
+}
+unsigned long REGPARAM2 op_5fd0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5fd8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5fe0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_5fe8_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5ff0_5(uae_u32 opcode) /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5ff8_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_5ff9_5(uae_u32 opcode) /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_6000_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(0)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2599;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2599: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6001_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(0)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2600;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2600: ;
+return 2;
+}
+unsigned long REGPARAM2 op_60ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(0)) goto endlabel2601;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2601;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(0)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2601;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2601: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6100_5(uae_u32 opcode) /* BSR */
+{
+{{	uae_s16 src = get_iword(2);
+	uae_s32 s = (uae_s32)src + 2;
+	m68k_do_bsr(m68k_getpc() + 4, s);
+}}return 4;
+}
+unsigned long REGPARAM2 op_6101_5(uae_u32 opcode) /* BSR */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	uae_s32 s = (uae_s32)src + 2;
+	m68k_do_bsr(m68k_getpc() + 2, s);
+}}return 2;
+}
+unsigned long REGPARAM2 op_61ff_5(uae_u32 opcode) /* BSR */
+{
+{{	uae_s32 src = get_ilong(2);
+	uae_s32 s = (uae_s32)src + 2;
+	m68k_do_bsr(m68k_getpc() + 6, s);
+}}return 6;
+}
+unsigned long REGPARAM2 op_6200_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(2)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2605;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2605: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6201_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(2)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2606;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2606: ;
+return 2;
+}
+unsigned long REGPARAM2 op_62ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(2)) goto endlabel2607;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2607;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(2)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2607;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2607: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6300_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(3)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2608;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2608: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6301_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(3)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2609;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2609: ;
+return 2;
+}
+unsigned long REGPARAM2 op_63ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(3)) goto endlabel2610;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2610;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(3)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2610;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2610: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6400_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(4)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2611;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2611: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6401_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(4)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2612;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2612: ;
+return 2;
+}
+unsigned long REGPARAM2 op_64ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(4)) goto endlabel2613;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2613;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(4)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2613;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2613: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6500_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2614;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2614: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6501_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2615;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2615: ;
+return 2;
+}
+unsigned long REGPARAM2 op_65ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(5)) goto endlabel2616;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2616;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2616;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2616: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6600_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2617;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2617: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6601_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2618;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2618: ;
+return 2;
+}
+unsigned long REGPARAM2 op_66ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(6)) goto endlabel2619;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2619;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2619;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2619: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6700_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2620;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2620: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6701_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2621;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2621: ;
+return 2;
+}
+unsigned long REGPARAM2 op_67ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(7)) goto endlabel2622;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2622;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2622;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2622: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6800_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(8)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2623;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2623: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6801_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(8)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2624;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2624: ;
+return 2;
+}
+unsigned long REGPARAM2 op_68ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(8)) goto endlabel2625;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2625;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(8)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2625;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2625: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6900_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(9)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2626;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2626: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6901_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(9)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2627;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2627: ;
+return 2;
+}
+unsigned long REGPARAM2 op_69ff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(9)) goto endlabel2628;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2628;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(9)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2628;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2628: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6a00_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(10)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2629;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2629: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6a01_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(10)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2630;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2630: ;
+return 2;
+}
+unsigned long REGPARAM2 op_6aff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(10)) goto endlabel2631;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2631;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(10)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2631;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2631: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6b00_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(11)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2632;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2632: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6b01_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(11)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2633;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2633: ;
+return 2;
+}
+unsigned long REGPARAM2 op_6bff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(11)) goto endlabel2634;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2634;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(11)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2634;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2634: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6c00_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2635;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2635: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6c01_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2636;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2636: ;
+return 2;
+}
+unsigned long REGPARAM2 op_6cff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(12)) goto endlabel2637;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2637;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2637;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2637: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6d00_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(13)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2638;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2638: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6d01_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(13)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2639;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2639: ;
+return 2;
+}
+unsigned long REGPARAM2 op_6dff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(13)) goto endlabel2640;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2640;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(13)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2640;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2640: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6e00_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(14)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2641;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2641: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6e01_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(14)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2642;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2642: ;
+return 2;
+}
+unsigned long REGPARAM2 op_6eff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(14)) goto endlabel2643;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2643;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(14)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2643;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2643: ;
+return 6;
+}
+unsigned long REGPARAM2 op_6f00_5(uae_u32 opcode) /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(15)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2644;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel2644: ;
+return 4;
+}
+unsigned long REGPARAM2 op_6f01_5(uae_u32 opcode) /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(15)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2645;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2645: ;
+return 2;
+}
+unsigned long REGPARAM2 op_6fff_5(uae_u32 opcode) /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!cctrue(15)) goto endlabel2646;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2646;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(15)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel2646;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2646: ;
+return 6;
+}
+unsigned long REGPARAM2 op_7000_5(uae_u32 opcode) /* MOVE */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_u32 src = srcreg;
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_8000_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_8010_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_8018_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_8020_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_8028_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_8030_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_8038_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_8039_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_803a_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_803b_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_803c_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_8040_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_8050_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_8058_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_8060_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_8068_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_8070_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_8078_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_8079_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_807a_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_807b_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_807c_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_8080_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_8090_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8098_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_80a0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_80a8_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_80b0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_80b8_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_80b9_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_80ba_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_80bb_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_80bc_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_80c0_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2681; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(2);
+endlabel2681: ;
+return 70;
+}
+unsigned long REGPARAM2 op_80d0_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2682; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel2682: ;
+return 72;
+}
+unsigned long REGPARAM2 op_80d8_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2683; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel2683: ;
+return 72;
+}
+unsigned long REGPARAM2 op_80e0_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2684; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel2684: ;
+return 72;
+}
+unsigned long REGPARAM2 op_80e8_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2685; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2685: ;
+return 74;
+}
+unsigned long REGPARAM2 op_80f0_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2686; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2686: ;
+return 74;
+}
+unsigned long REGPARAM2 op_80f8_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2687; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2687: ;
+return 74;
+}
+unsigned long REGPARAM2 op_80f9_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2688; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(6);
+endlabel2688: ;
+return 76;
+}
+unsigned long REGPARAM2 op_80fa_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2689; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2689: ;
+return 74;
+}
+unsigned long REGPARAM2 op_80fb_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2690; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2690: ;
+return 74;
+}
+unsigned long REGPARAM2 op_80fc_5(uae_u32 opcode) /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2691; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(4);
+endlabel2691: ;
+return 72;
+}
+unsigned long REGPARAM2 op_8100_5(uae_u32 opcode) /* SBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_8108_5(uae_u32 opcode) /* SBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 8;
+}
+unsigned long REGPARAM2 op_8110_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8118_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8120_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8128_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8130_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8138_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8139_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8150_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8158_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8160_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_8168_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8170_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8178_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_8179_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_8190_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_8198_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_81a0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_81a8_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_81b0_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_81b8_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_81b9_5(uae_u32 opcode) /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_81c0_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2715; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(2);
+endlabel2715: ;
+return 74;
+}
+unsigned long REGPARAM2 op_81d0_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2716; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel2716: ;
+return 76;
+}
+unsigned long REGPARAM2 op_81d8_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2717; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel2717: ;
+return 76;
+}
+unsigned long REGPARAM2 op_81e0_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2718; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel2718: ;
+return 76;
+}
+unsigned long REGPARAM2 op_81e8_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2719; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2719: ;
+return 78;
+}
+unsigned long REGPARAM2 op_81f0_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2720; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2720: ;
+return 78;
+}
+unsigned long REGPARAM2 op_81f8_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2721; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2721: ;
+return 78;
+}
+unsigned long REGPARAM2 op_81f9_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2722; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(6);
+endlabel2722: ;
+return 80;
+}
+unsigned long REGPARAM2 op_81fa_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2723; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2723: ;
+return 78;
+}
+unsigned long REGPARAM2 op_81fb_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2724; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel2724: ;
+return 78;
+}
+unsigned long REGPARAM2 op_81fc_5(uae_u32 opcode) /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel2725; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(4);
+endlabel2725: ;
+return 76;
+}
+unsigned long REGPARAM2 op_9000_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9010_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_9018_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_9020_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_9028_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_9030_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_9038_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_9039_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_903a_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_903b_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_903c_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_9040_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9048_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9050_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_9058_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_9060_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_9068_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_9070_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_9078_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_9079_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_907a_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_907b_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_907c_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_9080_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9088_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9090_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9098_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_90a0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_90a8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_90b0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_90b8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_90b9_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_90ba_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_90bb_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_90bc_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_90c0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_90c8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_90d0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_90d8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_90e0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_90e8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_90f0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_90f8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_90f9_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_90fa_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_90fb_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_90fc_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_9100_5(uae_u32 opcode) /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9108_5(uae_u32 opcode) /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 8;
+}
+unsigned long REGPARAM2 op_9110_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9118_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9120_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9128_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_9130_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_9138_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_9139_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_9140_5(uae_u32 opcode) /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9148_5(uae_u32 opcode) /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 8;
+}
+unsigned long REGPARAM2 op_9150_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9158_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9160_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_9168_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_9170_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_9178_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_9179_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_9180_5(uae_u32 opcode) /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_9188_5(uae_u32 opcode) /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 14;
+}
+unsigned long REGPARAM2 op_9190_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_9198_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_91a0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_91a8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_91b0_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_91b8_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_91b9_5(uae_u32 opcode) /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_91c0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_91c8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_91d0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_91d8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_91e0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_91e8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_91f0_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_91f8_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_91f9_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_91fa_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_91fb_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_91fc_5(uae_u32 opcode) /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_b000_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b010_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+#endif
+
+#ifdef PART_7
+unsigned long REGPARAM2 op_b018_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b020_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b028_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b030_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b038_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b039_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_b03a_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b03b_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b03c_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_b040_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b048_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b050_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b058_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b060_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b068_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b070_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b078_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b079_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_b07a_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b07b_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b07c_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_b080_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b088_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b090_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b098_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b0a0_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b0a8_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b0b0_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b0b8_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b0b9_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_b0ba_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b0bb_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b0bc_5(uae_u32 opcode) /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_b0c0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b0c8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b0d0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b0d8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b0e0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_b0e8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b0f0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b0f8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b0f9_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_b0fa_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b0fb_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_b0fc_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_b100_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b108_5(uae_u32 opcode) /* CMPM */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b110_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b118_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b120_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b128_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b130_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b138_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b139_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_b140_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b148_5(uae_u32 opcode) /* CMPM */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b150_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b158_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b160_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b168_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b170_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b178_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b179_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_b180_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b188_5(uae_u32 opcode) /* CMPM */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_b190_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_b198_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_b1a0_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_b1a8_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_b1b0_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_b1b8_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_b1b9_5(uae_u32 opcode) /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_b1c0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b1c8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_b1d0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b1d8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b1e0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_b1e8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b1f0_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b1f8_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b1f9_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_b1fa_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b1fb_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_b1fc_5(uae_u32 opcode) /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_c000_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c010_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_c018_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_c020_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_c028_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c030_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c038_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c039_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c03a_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c03b_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c03c_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_c040_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c050_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_c058_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_c060_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_c068_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c070_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c078_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c079_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_c07a_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c07b_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_c07c_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_c080_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c090_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c098_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c0a0_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c0a8_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c0b0_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c0b8_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c0b9_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_c0ba_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c0bb_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c0bc_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_c0c0_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(2);
+return 34;
+}
+unsigned long REGPARAM2 op_c0d0_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 36;
+}
+unsigned long REGPARAM2 op_c0d8_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 36;
+}
+unsigned long REGPARAM2 op_c0e0_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 36;
+}
+unsigned long REGPARAM2 op_c0e8_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c0f0_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c0f8_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c0f9_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+return 40;
+}
+unsigned long REGPARAM2 op_c0fa_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c0fb_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c0fc_5(uae_u32 opcode) /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(4);
+return 36;
+}
+unsigned long REGPARAM2 op_c100_5(uae_u32 opcode) /* ABCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo +=6; }
+	newv = newv_hi + newv_lo;	SET_CFLG (cflg = (newv & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv += 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c108_5(uae_u32 opcode) /* ABCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo +=6; }
+	newv = newv_hi + newv_lo;	SET_CFLG (cflg = (newv & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv += 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 8;
+}
+unsigned long REGPARAM2 op_c110_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c118_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c120_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c128_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c130_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c138_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c139_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_c140_5(uae_u32 opcode) /* EXG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	m68k_dreg(regs, srcreg) = (dst);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c148_5(uae_u32 opcode) /* EXG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+	m68k_areg(regs, srcreg) = (dst);
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+	m68k_areg(regs, dstreg) = (src);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c150_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c158_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c160_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_c168_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c170_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c178_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_c179_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_c188_5(uae_u32 opcode) /* EXG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+	m68k_dreg(regs, srcreg) = (dst);
+	m68k_areg(regs, dstreg) = (src);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_c190_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_c198_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_c1a0_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_c1a8_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_c1b0_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_c1b8_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_c1b9_5(uae_u32 opcode) /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_c1c0_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(2);
+return 34;
+}
+unsigned long REGPARAM2 op_c1d0_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 36;
+}
+unsigned long REGPARAM2 op_c1d8_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 36;
+}
+unsigned long REGPARAM2 op_c1e0_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 36;
+}
+unsigned long REGPARAM2 op_c1e8_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c1f0_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c1f8_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c1f9_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+return 40;
+}
+unsigned long REGPARAM2 op_c1fa_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c1fb_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+return 38;
+}
+unsigned long REGPARAM2 op_c1fc_5(uae_u32 opcode) /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(4);
+return 36;
+}
+unsigned long REGPARAM2 op_d000_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d010_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d018_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d020_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d028_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d030_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d038_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d039_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_d03a_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d03b_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d03c_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_d040_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d048_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d050_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d058_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d060_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d068_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d070_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d078_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d079_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_d07a_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d07b_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d07c_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_d080_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d088_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d090_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d098_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d0a0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d0a8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d0b0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d0b8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d0b9_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_d0ba_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d0bb_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d0bc_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_d0c0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d0c8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d0d0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d0d8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d0e0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+return 4;
+}
+unsigned long REGPARAM2 op_d0e8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d0f0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d0f8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d0f9_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(6);
+return 8;
+}
+unsigned long REGPARAM2 op_d0fa_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d0fb_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 6;
+}
+unsigned long REGPARAM2 op_d0fc_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(4);
+return 4;
+}
+unsigned long REGPARAM2 op_d100_5(uae_u32 opcode) /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d108_5(uae_u32 opcode) /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 8;
+}
+unsigned long REGPARAM2 op_d110_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d118_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d120_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d128_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d130_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d138_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d139_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_d140_5(uae_u32 opcode) /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d148_5(uae_u32 opcode) /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 8;
+}
+unsigned long REGPARAM2 op_d150_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d158_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d160_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d168_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d170_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d178_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d179_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_d180_5(uae_u32 opcode) /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+return 2;
+}
+#endif
+
+#ifdef PART_8
+unsigned long REGPARAM2 op_d188_5(uae_u32 opcode) /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 14;
+}
+unsigned long REGPARAM2 op_d190_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_d198_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_d1a0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+return 10;
+}
+unsigned long REGPARAM2 op_d1a8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_d1b0_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_d1b8_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+return 12;
+}
+unsigned long REGPARAM2 op_d1b9_5(uae_u32 opcode) /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(6);
+return 14;
+}
+unsigned long REGPARAM2 op_d1c0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d1c8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_d1d0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d1d8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d1e0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_d1e8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d1f0_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d1f8_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d1f9_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_d1fa_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d1fb_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_d1fc_5(uae_u32 opcode) /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(6);
+return 6;
+}
+unsigned long REGPARAM2 op_e000_5(uae_u32 opcode) /* ASR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	uae_u32 sign = (0x80 & val) >> 7;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		val = 0xff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e008_5(uae_u32 opcode) /* LSR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG ((cnt == 8) & (val >> 7));
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e010_5(uae_u32 opcode) /* ROXR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (7 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e018_5(uae_u32 opcode) /* ROR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u8 val = data;
+	uae_u32 cmask = 0x80;
+	cnt &= 63;
+	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e020_5(uae_u32 opcode) /* ASR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	uae_u32 sign = (0x80 & val) >> 7;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		val = 0xff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e028_5(uae_u32 opcode) /* LSR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG ((cnt == 8) & (val >> 7));
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e030_5(uae_u32 opcode) /* ROXR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 36) cnt -= 36;
+	if (cnt >= 18) cnt -= 18;
+	if (cnt >= 9) cnt -= 9;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (7 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e038_5(uae_u32 opcode) /* ROR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u8 val = data;
+	uae_u32 cmask = 0x80;
+	cnt &= 63;
+	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e040_5(uae_u32 opcode) /* ASR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = (0x8000 & val) >> 15;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		val = 0xffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e048_5(uae_u32 opcode) /* LSR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG ((cnt == 16) & (val >> 15));
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e050_5(uae_u32 opcode) /* ROXR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (15 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e058_5(uae_u32 opcode) /* ROR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u16 val = data;
+	uae_u32 cmask = 0x8000;
+	cnt &= 63;
+	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e060_5(uae_u32 opcode) /* ASR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = (0x8000 & val) >> 15;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		val = 0xffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e068_5(uae_u32 opcode) /* LSR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG ((cnt == 16) & (val >> 15));
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e070_5(uae_u32 opcode) /* ROXR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 34) cnt -= 34;
+	if (cnt >= 17) cnt -= 17;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (15 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e078_5(uae_u32 opcode) /* ROR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u16 val = data;
+	uae_u32 cmask = 0x8000;
+	cnt &= 63;
+	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e080_5(uae_u32 opcode) /* ASR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 sign = (0x80000000 & val) >> 31;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		val = 0xffffffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e088_5(uae_u32 opcode) /* LSR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG ((cnt == 32) & (val >> 31));
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e090_5(uae_u32 opcode) /* ROXR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (31 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e098_5(uae_u32 opcode) /* ROR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 cmask = 0x80000000;
+	cnt &= 63;
+	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e0a0_5(uae_u32 opcode) /* ASR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 sign = (0x80000000 & val) >> 31;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		val = 0xffffffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e0a8_5(uae_u32 opcode) /* LSR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG ((cnt == 32) & (val >> 31));
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e0b0_5(uae_u32 opcode) /* ROXR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 33) cnt -= 33;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (31 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e0b8_5(uae_u32 opcode) /* ROR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 cmask = 0x80000000;
+	cnt &= 63;
+	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e0d0_5(uae_u32 opcode) /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e0d8_5(uae_u32 opcode) /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e0e0_5(uae_u32 opcode) /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e0e8_5(uae_u32 opcode) /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e0f0_5(uae_u32 opcode) /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e0f8_5(uae_u32 opcode) /* ASRW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e0f9_5(uae_u32 opcode) /* ASRW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e100_5(uae_u32 opcode) /* ASL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		uae_u32 mask = (0xff << (7 - cnt)) & 0xff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e108_5(uae_u32 opcode) /* LSL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e110_5(uae_u32 opcode) /* ROXL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (7 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e118_5(uae_u32 opcode) /* ROL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	uae_u32 loval;
+	cnt &= 7;
+	loval = val >> (8 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e120_5(uae_u32 opcode) /* ASL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		uae_u32 mask = (0xff << (7 - cnt)) & 0xff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e128_5(uae_u32 opcode) /* LSL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e130_5(uae_u32 opcode) /* ROXL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 36) cnt -= 36;
+	if (cnt >= 18) cnt -= 18;
+	if (cnt >= 9) cnt -= 9;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (7 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e138_5(uae_u32 opcode) /* ROL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt > 0) {
+	uae_u32 loval;
+	cnt &= 7;
+	loval = val >> (8 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e140_5(uae_u32 opcode) /* ASL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		uae_u32 mask = (0xffff << (15 - cnt)) & 0xffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e148_5(uae_u32 opcode) /* LSL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e150_5(uae_u32 opcode) /* ROXL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (15 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e158_5(uae_u32 opcode) /* ROL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	uae_u32 loval;
+	cnt &= 15;
+	loval = val >> (16 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e160_5(uae_u32 opcode) /* ASL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		uae_u32 mask = (0xffff << (15 - cnt)) & 0xffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e168_5(uae_u32 opcode) /* LSL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e170_5(uae_u32 opcode) /* ROXL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 34) cnt -= 34;
+	if (cnt >= 17) cnt -= 17;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (15 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e178_5(uae_u32 opcode) /* ROL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt > 0) {
+	uae_u32 loval;
+	cnt &= 15;
+	loval = val >> (16 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e180_5(uae_u32 opcode) /* ASL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		uae_u32 mask = (0xffffffff << (31 - cnt)) & 0xffffffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e188_5(uae_u32 opcode) /* LSL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e190_5(uae_u32 opcode) /* ROXL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (31 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e198_5(uae_u32 opcode) /* ROL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	uae_u32 loval;
+	cnt &= 31;
+	loval = val >> (32 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffffffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e1a0_5(uae_u32 opcode) /* ASL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		uae_u32 mask = (0xffffffff << (31 - cnt)) & 0xffffffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e1a8_5(uae_u32 opcode) /* LSL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e1b0_5(uae_u32 opcode) /* ROXL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 33) cnt -= 33;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (31 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e1b8_5(uae_u32 opcode) /* ROL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt > 0) {
+	uae_u32 loval;
+	cnt &= 31;
+	loval = val >> (32 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffffffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+return 2;
+}
+unsigned long REGPARAM2 op_e1d0_5(uae_u32 opcode) /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e1d8_5(uae_u32 opcode) /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e1e0_5(uae_u32 opcode) /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e1e8_5(uae_u32 opcode) /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e1f0_5(uae_u32 opcode) /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e1f8_5(uae_u32 opcode) /* ASLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e1f9_5(uae_u32 opcode) /* ASLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e2d0_5(uae_u32 opcode) /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e2d8_5(uae_u32 opcode) /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e2e0_5(uae_u32 opcode) /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e2e8_5(uae_u32 opcode) /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e2f0_5(uae_u32 opcode) /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e2f8_5(uae_u32 opcode) /* LSRW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e2f9_5(uae_u32 opcode) /* LSRW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e3d0_5(uae_u32 opcode) /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e3d8_5(uae_u32 opcode) /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e3e0_5(uae_u32 opcode) /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e3e8_5(uae_u32 opcode) /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e3f0_5(uae_u32 opcode) /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e3f8_5(uae_u32 opcode) /* LSLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e3f9_5(uae_u32 opcode) /* LSLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e4d0_5(uae_u32 opcode) /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e4d8_5(uae_u32 opcode) /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e4e0_5(uae_u32 opcode) /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e4e8_5(uae_u32 opcode) /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e4f0_5(uae_u32 opcode) /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e4f8_5(uae_u32 opcode) /* ROXRW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e4f9_5(uae_u32 opcode) /* ROXRW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e5d0_5(uae_u32 opcode) /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e5d8_5(uae_u32 opcode) /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e5e0_5(uae_u32 opcode) /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e5e8_5(uae_u32 opcode) /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e5f0_5(uae_u32 opcode) /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e5f8_5(uae_u32 opcode) /* ROXLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e5f9_5(uae_u32 opcode) /* ROXLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e6d0_5(uae_u32 opcode) /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e6d8_5(uae_u32 opcode) /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e6e0_5(uae_u32 opcode) /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e6e8_5(uae_u32 opcode) /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e6f0_5(uae_u32 opcode) /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e6f8_5(uae_u32 opcode) /* RORW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e6f9_5(uae_u32 opcode) /* RORW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+unsigned long REGPARAM2 op_e7d0_5(uae_u32 opcode) /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e7d8_5(uae_u32 opcode) /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e7e0_5(uae_u32 opcode) /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+return 6;
+}
+unsigned long REGPARAM2 op_e7e8_5(uae_u32 opcode) /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e7f0_5(uae_u32 opcode) /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e7f8_5(uae_u32 opcode) /* ROLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+return 8;
+}
+unsigned long REGPARAM2 op_e7f9_5(uae_u32 opcode) /* ROLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+return 10;
+}
+#endif
+
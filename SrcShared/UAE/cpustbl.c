@@ -1588,3 +1588,1589 @@ struct cputbl op_smalltbl_3[] = {
 { op_e7f8_3, 0, 59384, 0, 3, 1 }, /* ROLW */
 { op_e7f9_3, 0, 59385, 0, 4, 1 }, /* ROLW */
 { 0, 0, 0 }};
+struct cputbl op_smalltbl_5[] = {
+{ op_0_5, 0, 0, 0, 2, 0 }, /* OR */
+{ op_10_5, 0, 16, 0, 3, 1 }, /* OR */
+{ op_18_5, 0, 24, 0, 3, 1 }, /* OR */
+{ op_20_5, 0, 32, 2, 3, 1 }, /* OR */
+{ op_28_5, 0, 40, 0, 4, 1 }, /* OR */
+{ op_30_5, 0, 48, 2, 4, 1 }, /* OR */
+{ op_38_5, 0, 56, 0, 4, 1 }, /* OR */
+{ op_39_5, 0, 57, 0, 5, 1 }, /* OR */
+{ op_3c_5, 0, 60, 8, 4, 0 }, /* ORSR */
+{ op_40_5, 0, 64, 0, 2, 0 }, /* OR */
+{ op_50_5, 0, 80, 0, 3, 1 }, /* OR */
+{ op_58_5, 0, 88, 0, 3, 1 }, /* OR */
+{ op_60_5, 0, 96, 2, 3, 1 }, /* OR */
+{ op_68_5, 0, 104, 0, 4, 1 }, /* OR */
+{ op_70_5, 0, 112, 2, 4, 1 }, /* OR */
+{ op_78_5, 0, 120, 0, 4, 1 }, /* OR */
+{ op_79_5, 0, 121, 0, 5, 1 }, /* OR */
+{ op_7c_5, 0, 124, 8, 4, 0 }, /* ORSR */
+{ op_80_5, 0, 128, 2, 3, 0 }, /* OR */
+{ op_90_5, 0, 144, 0, 5, 2 }, /* OR */
+{ op_98_5, 0, 152, 0, 5, 2 }, /* OR */
+{ op_a0_5, 0, 160, 2, 5, 2 }, /* OR */
+{ op_a8_5, 0, 168, 0, 6, 2 }, /* OR */
+{ op_b0_5, 0, 176, 2, 6, 2 }, /* OR */
+{ op_b8_5, 0, 184, 0, 6, 2 }, /* OR */
+{ op_b9_5, 0, 185, 0, 7, 2 }, /* OR */
+{ op_100_5, 0, 256, 2, 1, 0 }, /* BTST */
+{ op_108_5, 0, 264, 0, 4, 0 }, /* MVPMR */
+{ op_110_5, 0, 272, 0, 2, 0 }, /* BTST */
+{ op_118_5, 0, 280, 0, 2, 0 }, /* BTST */
+{ op_120_5, 0, 288, 2, 2, 0 }, /* BTST */
+{ op_128_5, 0, 296, 0, 3, 0 }, /* BTST */
+{ op_130_5, 0, 304, 2, 3, 0 }, /* BTST */
+{ op_138_5, 0, 312, 0, 3, 0 }, /* BTST */
+{ op_139_5, 0, 313, 0, 4, 0 }, /* BTST */
+{ op_13a_5, 0, 314, 0, 3, 0 }, /* BTST */
+{ op_13b_5, 0, 315, 2, 3, 0 }, /* BTST */
+{ op_13c_5, 0, 316, 0, 2, 0 }, /* BTST */
+{ op_140_5, 0, 320, 4, 1, 0 }, /* BCHG */
+{ op_148_5, 0, 328, 0, 6, 0 }, /* MVPMR */
+{ op_150_5, 0, 336, 0, 2, 1 }, /* BCHG */
+{ op_158_5, 0, 344, 0, 2, 1 }, /* BCHG */
+{ op_160_5, 0, 352, 2, 2, 1 }, /* BCHG */
+{ op_168_5, 0, 360, 0, 3, 1 }, /* BCHG */
+{ op_170_5, 0, 368, 2, 3, 1 }, /* BCHG */
+{ op_178_5, 0, 376, 0, 3, 1 }, /* BCHG */
+{ op_179_5, 0, 377, 0, 4, 1 }, /* BCHG */
+{ op_17a_5, 0, 378, 0, 3, 1 }, /* BCHG */
+{ op_17b_5, 0, 379, 2, 3, 1 }, /* BCHG */
+{ op_180_5, 0, 384, 6, 1, 0 }, /* BCLR */
+{ op_188_5, 0, 392, 0, 2, 2 }, /* MVPRM */
+{ op_190_5, 0, 400, 0, 2, 1 }, /* BCLR */
+{ op_198_5, 0, 408, 0, 2, 1 }, /* BCLR */
+{ op_1a0_5, 0, 416, 2, 2, 1 }, /* BCLR */
+{ op_1a8_5, 0, 424, 0, 3, 1 }, /* BCLR */
+{ op_1b0_5, 0, 432, 2, 3, 1 }, /* BCLR */
+{ op_1b8_5, 0, 440, 0, 3, 1 }, /* BCLR */
+{ op_1b9_5, 0, 441, 0, 4, 1 }, /* BCLR */
+{ op_1ba_5, 0, 442, 0, 3, 1 }, /* BCLR */
+{ op_1bb_5, 0, 443, 2, 3, 1 }, /* BCLR */
+{ op_1c0_5, 0, 448, 4, 1, 0 }, /* BSET */
+{ op_1c8_5, 0, 456, 0, 2, 4 }, /* MVPRM */
+{ op_1d0_5, 0, 464, 0, 2, 1 }, /* BSET */
+{ op_1d8_5, 0, 472, 0, 2, 1 }, /* BSET */
+{ op_1e0_5, 0, 480, 2, 2, 1 }, /* BSET */
+{ op_1e8_5, 0, 488, 0, 3, 1 }, /* BSET */
+{ op_1f0_5, 0, 496, 2, 3, 1 }, /* BSET */
+{ op_1f8_5, 0, 504, 0, 3, 1 }, /* BSET */
+{ op_1f9_5, 0, 505, 0, 4, 1 }, /* BSET */
+{ op_1fa_5, 0, 506, 0, 3, 1 }, /* BSET */
+{ op_1fb_5, 0, 507, 2, 3, 1 }, /* BSET */
+{ op_200_5, 0, 512, 0, 2, 0 }, /* AND */
+{ op_210_5, 0, 528, 0, 3, 1 }, /* AND */
+{ op_218_5, 0, 536, 0, 3, 1 }, /* AND */
+{ op_220_5, 0, 544, 2, 3, 1 }, /* AND */
+{ op_228_5, 0, 552, 0, 4, 1 }, /* AND */
+{ op_230_5, 0, 560, 2, 4, 1 }, /* AND */
+{ op_238_5, 0, 568, 0, 4, 1 }, /* AND */
+{ op_239_5, 0, 569, 0, 5, 1 }, /* AND */
+{ op_23c_5, 0, 572, 8, 4, 0 }, /* ANDSR */
+{ op_240_5, 0, 576, 0, 2, 0 }, /* AND */
+{ op_250_5, 0, 592, 0, 3, 1 }, /* AND */
+{ op_258_5, 0, 600, 0, 3, 1 }, /* AND */
+{ op_260_5, 0, 608, 2, 3, 1 }, /* AND */
+{ op_268_5, 0, 616, 0, 4, 1 }, /* AND */
+{ op_270_5, 0, 624, 2, 4, 1 }, /* AND */
+{ op_278_5, 0, 632, 0, 4, 1 }, /* AND */
+{ op_279_5, 0, 633, 0, 5, 1 }, /* AND */
+{ op_27c_5, 0, 636, 8, 4, 0 }, /* ANDSR */
+{ op_280_5, 0, 640, 2, 3, 0 }, /* AND */
+{ op_290_5, 0, 656, 0, 5, 2 }, /* AND */
+{ op_298_5, 0, 664, 0, 5, 2 }, /* AND */
+{ op_2a0_5, 0, 672, 2, 5, 2 }, /* AND */
+{ op_2a8_5, 0, 680, 0, 6, 2 }, /* AND */
+{ op_2b0_5, 0, 688, 2, 6, 2 }, /* AND */
+{ op_2b8_5, 0, 696, 0, 6, 2 }, /* AND */
+{ op_2b9_5, 0, 697, 0, 7, 2 }, /* AND */
+{ op_400_5, 0, 1024, 0, 2, 0 }, /* SUB */
+{ op_410_5, 0, 1040, 0, 3, 1 }, /* SUB */
+{ op_418_5, 0, 1048, 0, 3, 1 }, /* SUB */
+{ op_420_5, 0, 1056, 2, 3, 1 }, /* SUB */
+{ op_428_5, 0, 1064, 0, 4, 1 }, /* SUB */
+{ op_430_5, 0, 1072, 2, 4, 1 }, /* SUB */
+{ op_438_5, 0, 1080, 0, 4, 1 }, /* SUB */
+{ op_439_5, 0, 1081, 0, 5, 1 }, /* SUB */
+{ op_440_5, 0, 1088, 0, 2, 0 }, /* SUB */
+{ op_450_5, 0, 1104, 0, 3, 1 }, /* SUB */
+{ op_458_5, 0, 1112, 0, 3, 1 }, /* SUB */
+{ op_460_5, 0, 1120, 2, 3, 1 }, /* SUB */
+{ op_468_5, 0, 1128, 0, 4, 1 }, /* SUB */
+{ op_470_5, 0, 1136, 2, 4, 1 }, /* SUB */
+{ op_478_5, 0, 1144, 0, 4, 1 }, /* SUB */
+{ op_479_5, 0, 1145, 0, 5, 1 }, /* SUB */
+{ op_480_5, 0, 1152, 4, 3, 0 }, /* SUB */
+{ op_490_5, 0, 1168, 0, 5, 2 }, /* SUB */
+{ op_498_5, 0, 1176, 0, 5, 2 }, /* SUB */
+{ op_4a0_5, 0, 1184, 2, 5, 2 }, /* SUB */
+{ op_4a8_5, 0, 1192, 0, 6, 2 }, /* SUB */
+{ op_4b0_5, 0, 1200, 2, 6, 2 }, /* SUB */
+{ op_4b8_5, 0, 1208, 0, 6, 2 }, /* SUB */
+{ op_4b9_5, 0, 1209, 0, 7, 2 }, /* SUB */
+{ op_600_5, 0, 1536, 0, 2, 0 }, /* ADD */
+{ op_610_5, 0, 1552, 0, 3, 1 }, /* ADD */
+{ op_618_5, 0, 1560, 0, 3, 1 }, /* ADD */
+{ op_620_5, 0, 1568, 2, 3, 1 }, /* ADD */
+{ op_628_5, 0, 1576, 0, 4, 1 }, /* ADD */
+{ op_630_5, 0, 1584, 2, 4, 1 }, /* ADD */
+{ op_638_5, 0, 1592, 0, 4, 1 }, /* ADD */
+{ op_639_5, 0, 1593, 0, 5, 1 }, /* ADD */
+{ op_640_5, 0, 1600, 0, 2, 0 }, /* ADD */
+{ op_650_5, 0, 1616, 0, 3, 1 }, /* ADD */
+{ op_658_5, 0, 1624, 0, 3, 1 }, /* ADD */
+{ op_660_5, 0, 1632, 2, 3, 1 }, /* ADD */
+{ op_668_5, 0, 1640, 0, 4, 1 }, /* ADD */
+{ op_670_5, 0, 1648, 2, 4, 1 }, /* ADD */
+{ op_678_5, 0, 1656, 0, 4, 1 }, /* ADD */
+{ op_679_5, 0, 1657, 0, 5, 1 }, /* ADD */
+{ op_680_5, 0, 1664, 4, 3, 0 }, /* ADD */
+{ op_690_5, 0, 1680, 0, 5, 2 }, /* ADD */
+{ op_698_5, 0, 1688, 0, 5, 2 }, /* ADD */
+{ op_6a0_5, 0, 1696, 2, 5, 2 }, /* ADD */
+{ op_6a8_5, 0, 1704, 0, 6, 2 }, /* ADD */
+{ op_6b0_5, 0, 1712, 2, 6, 2 }, /* ADD */
+{ op_6b8_5, 0, 1720, 0, 6, 2 }, /* ADD */
+{ op_6b9_5, 0, 1721, 0, 7, 2 }, /* ADD */
+{ op_800_5, 0, 2048, 2, 2, 0 }, /* BTST */
+{ op_810_5, 0, 2064, 0, 3, 0 }, /* BTST */
+{ op_818_5, 0, 2072, 0, 3, 0 }, /* BTST */
+{ op_820_5, 0, 2080, 2, 3, 0 }, /* BTST */
+{ op_828_5, 0, 2088, 0, 4, 0 }, /* BTST */
+{ op_830_5, 0, 2096, 2, 4, 0 }, /* BTST */
+{ op_838_5, 0, 2104, 0, 4, 0 }, /* BTST */
+{ op_839_5, 0, 2105, 0, 5, 0 }, /* BTST */
+{ op_83a_5, 0, 2106, 0, 4, 0 }, /* BTST */
+{ op_83b_5, 0, 2107, 2, 4, 0 }, /* BTST */
+{ op_83c_5, 0, 2108, 0, 3, 0 }, /* BTST */
+{ op_840_5, 0, 2112, 4, 2, 0 }, /* BCHG */
+{ op_850_5, 0, 2128, 0, 3, 1 }, /* BCHG */
+{ op_858_5, 0, 2136, 0, 3, 1 }, /* BCHG */
+{ op_860_5, 0, 2144, 2, 3, 1 }, /* BCHG */
+{ op_868_5, 0, 2152, 0, 4, 1 }, /* BCHG */
+{ op_870_5, 0, 2160, 2, 4, 1 }, /* BCHG */
+{ op_878_5, 0, 2168, 0, 4, 1 }, /* BCHG */
+{ op_879_5, 0, 2169, 0, 5, 1 }, /* BCHG */
+{ op_87a_5, 0, 2170, 0, 4, 1 }, /* BCHG */
+{ op_87b_5, 0, 2171, 2, 4, 1 }, /* BCHG */
+{ op_880_5, 0, 2176, 6, 2, 0 }, /* BCLR */
+{ op_890_5, 0, 2192, 0, 3, 1 }, /* BCLR */
+{ op_898_5, 0, 2200, 0, 3, 1 }, /* BCLR */
+{ op_8a0_5, 0, 2208, 2, 3, 1 }, /* BCLR */
+{ op_8a8_5, 0, 2216, 0, 4, 1 }, /* BCLR */
+{ op_8b0_5, 0, 2224, 2, 4, 1 }, /* BCLR */
+{ op_8b8_5, 0, 2232, 0, 4, 1 }, /* BCLR */
+{ op_8b9_5, 0, 2233, 0, 5, 1 }, /* BCLR */
+{ op_8ba_5, 0, 2234, 0, 4, 1 }, /* BCLR */
+{ op_8bb_5, 0, 2235, 2, 4, 1 }, /* BCLR */
+{ op_8c0_5, 0, 2240, 4, 2, 0 }, /* BSET */
+{ op_8d0_5, 0, 2256, 0, 3, 1 }, /* BSET */
+{ op_8d8_5, 0, 2264, 0, 3, 1 }, /* BSET */
+{ op_8e0_5, 0, 2272, 2, 3, 1 }, /* BSET */
+{ op_8e8_5, 0, 2280, 0, 4, 1 }, /* BSET */
+{ op_8f0_5, 0, 2288, 2, 4, 1 }, /* BSET */
+{ op_8f8_5, 0, 2296, 0, 4, 1 }, /* BSET */
+{ op_8f9_5, 0, 2297, 0, 5, 1 }, /* BSET */
+{ op_8fa_5, 0, 2298, 0, 4, 1 }, /* BSET */
+{ op_8fb_5, 0, 2299, 2, 4, 1 }, /* BSET */
+{ op_a00_5, 0, 2560, 0, 2, 0 }, /* EOR */
+{ op_a10_5, 0, 2576, 0, 3, 1 }, /* EOR */
+{ op_a18_5, 0, 2584, 0, 3, 1 }, /* EOR */
+{ op_a20_5, 0, 2592, 2, 3, 1 }, /* EOR */
+{ op_a28_5, 0, 2600, 0, 4, 1 }, /* EOR */
+{ op_a30_5, 0, 2608, 2, 4, 1 }, /* EOR */
+{ op_a38_5, 0, 2616, 0, 4, 1 }, /* EOR */
+{ op_a39_5, 0, 2617, 0, 5, 1 }, /* EOR */
+{ op_a3c_5, 0, 2620, 8, 4, 0 }, /* EORSR */
+{ op_a40_5, 0, 2624, 0, 2, 0 }, /* EOR */
+{ op_a50_5, 0, 2640, 0, 3, 1 }, /* EOR */
+{ op_a58_5, 0, 2648, 0, 3, 1 }, /* EOR */
+{ op_a60_5, 0, 2656, 2, 3, 1 }, /* EOR */
+{ op_a68_5, 0, 2664, 0, 4, 1 }, /* EOR */
+{ op_a70_5, 0, 2672, 2, 4, 1 }, /* EOR */
+{ op_a78_5, 0, 2680, 0, 4, 1 }, /* EOR */
+{ op_a79_5, 0, 2681, 0, 5, 1 }, /* EOR */
+{ op_a7c_5, 0, 2684, 8, 4, 0 }, /* EORSR */
+{ op_a80_5, 0, 2688, 4, 3, 0 }, /* EOR */
+{ op_a90_5, 0, 2704, 0, 5, 2 }, /* EOR */
+{ op_a98_5, 0, 2712, 0, 5, 2 }, /* EOR */
+{ op_aa0_5, 0, 2720, 2, 5, 2 }, /* EOR */
+{ op_aa8_5, 0, 2728, 0, 6, 2 }, /* EOR */
+{ op_ab0_5, 0, 2736, 2, 6, 2 }, /* EOR */
+{ op_ab8_5, 0, 2744, 0, 6, 2 }, /* EOR */
+{ op_ab9_5, 0, 2745, 0, 7, 2 }, /* EOR */
+{ op_c00_5, 0, 3072, 0, 2, 0 }, /* CMP */
+{ op_c10_5, 0, 3088, 0, 3, 0 }, /* CMP */
+{ op_c18_5, 0, 3096, 0, 3, 0 }, /* CMP */
+{ op_c20_5, 0, 3104, 2, 3, 0 }, /* CMP */
+{ op_c28_5, 0, 3112, 0, 4, 0 }, /* CMP */
+{ op_c30_5, 0, 3120, 2, 4, 0 }, /* CMP */
+{ op_c38_5, 0, 3128, 0, 4, 0 }, /* CMP */
+{ op_c39_5, 0, 3129, 0, 5, 0 }, /* CMP */
+{ op_c3a_5, 0, 3130, 0, 4, 0 }, /* CMP */
+{ op_c3b_5, 0, 3131, 2, 4, 0 }, /* CMP */
+{ op_c40_5, 0, 3136, 0, 2, 0 }, /* CMP */
+{ op_c50_5, 0, 3152, 0, 3, 0 }, /* CMP */
+{ op_c58_5, 0, 3160, 0, 3, 0 }, /* CMP */
+{ op_c60_5, 0, 3168, 2, 3, 0 }, /* CMP */
+{ op_c68_5, 0, 3176, 0, 4, 0 }, /* CMP */
+{ op_c70_5, 0, 3184, 2, 4, 0 }, /* CMP */
+{ op_c78_5, 0, 3192, 0, 4, 0 }, /* CMP */
+{ op_c79_5, 0, 3193, 0, 5, 0 }, /* CMP */
+{ op_c7a_5, 0, 3194, 0, 4, 0 }, /* CMP */
+{ op_c7b_5, 0, 3195, 2, 4, 0 }, /* CMP */
+{ op_c80_5, 0, 3200, 2, 3, 0 }, /* CMP */
+{ op_c90_5, 0, 3216, 0, 5, 0 }, /* CMP */
+{ op_c98_5, 0, 3224, 0, 5, 0 }, /* CMP */
+{ op_ca0_5, 0, 3232, 2, 5, 0 }, /* CMP */
+{ op_ca8_5, 0, 3240, 0, 6, 0 }, /* CMP */
+{ op_cb0_5, 0, 3248, 2, 6, 0 }, /* CMP */
+{ op_cb8_5, 0, 3256, 0, 6, 0 }, /* CMP */
+{ op_cb9_5, 0, 3257, 0, 7, 0 }, /* CMP */
+{ op_cba_5, 0, 3258, 0, 6, 0 }, /* CMP */
+{ op_cbb_5, 0, 3259, 2, 6, 0 }, /* CMP */
+{ op_1000_5, 0, 4096, 0, 1, 0 }, /* MOVE */
+{ op_1010_5, 0, 4112, 0, 2, 0 }, /* MOVE */
+{ op_1018_5, 0, 4120, 0, 2, 0 }, /* MOVE */
+{ op_1020_5, 0, 4128, 2, 2, 0 }, /* MOVE */
+{ op_1028_5, 0, 4136, 0, 3, 0 }, /* MOVE */
+{ op_1030_5, 0, 4144, 2, 3, 0 }, /* MOVE */
+{ op_1038_5, 0, 4152, 0, 3, 0 }, /* MOVE */
+{ op_1039_5, 0, 4153, 0, 4, 0 }, /* MOVE */
+{ op_103a_5, 0, 4154, 0, 3, 0 }, /* MOVE */
+{ op_103b_5, 0, 4155, 2, 3, 0 }, /* MOVE */
+{ op_103c_5, 0, 4156, 0, 2, 0 }, /* MOVE */
+{ op_1080_5, 0, 4224, 0, 1, 1 }, /* MOVE */
+{ op_1090_5, 0, 4240, 0, 2, 1 }, /* MOVE */
+{ op_1098_5, 0, 4248, 0, 2, 1 }, /* MOVE */
+{ op_10a0_5, 0, 4256, 2, 2, 1 }, /* MOVE */
+{ op_10a8_5, 0, 4264, 0, 3, 1 }, /* MOVE */
+{ op_10b0_5, 0, 4272, 2, 3, 1 }, /* MOVE */
+{ op_10b8_5, 0, 4280, 0, 3, 1 }, /* MOVE */
+{ op_10b9_5, 0, 4281, 0, 4, 1 }, /* MOVE */
+{ op_10ba_5, 0, 4282, 0, 3, 1 }, /* MOVE */
+{ op_10bb_5, 0, 4283, 2, 3, 1 }, /* MOVE */
+{ op_10bc_5, 0, 4284, 0, 2, 1 }, /* MOVE */
+{ op_10c0_5, 0, 4288, 0, 1, 1 }, /* MOVE */
+{ op_10d0_5, 0, 4304, 0, 2, 1 }, /* MOVE */
+{ op_10d8_5, 0, 4312, 0, 2, 1 }, /* MOVE */
+{ op_10e0_5, 0, 4320, 2, 2, 1 }, /* MOVE */
+{ op_10e8_5, 0, 4328, 0, 3, 1 }, /* MOVE */
+{ op_10f0_5, 0, 4336, 2, 3, 1 }, /* MOVE */
+{ op_10f8_5, 0, 4344, 0, 3, 1 }, /* MOVE */
+{ op_10f9_5, 0, 4345, 0, 4, 1 }, /* MOVE */
+{ op_10fa_5, 0, 4346, 0, 3, 1 }, /* MOVE */
+{ op_10fb_5, 0, 4347, 2, 3, 1 }, /* MOVE */
+{ op_10fc_5, 0, 4348, 0, 2, 1 }, /* MOVE */
+{ op_1100_5, 0, 4352, 2, 1, 1 }, /* MOVE */
+{ op_1110_5, 0, 4368, 2, 2, 1 }, /* MOVE */
+{ op_1118_5, 0, 4376, 2, 2, 1 }, /* MOVE */
+{ op_1120_5, 0, 4384, 4, 2, 1 }, /* MOVE */
+{ op_1128_5, 0, 4392, 2, 3, 1 }, /* MOVE */
+{ op_1130_5, 0, 4400, 4, 3, 1 }, /* MOVE */
+{ op_1138_5, 0, 4408, 2, 3, 1 }, /* MOVE */
+{ op_1139_5, 0, 4409, 2, 4, 1 }, /* MOVE */
+{ op_113a_5, 0, 4410, 2, 3, 1 }, /* MOVE */
+{ op_113b_5, 0, 4411, 4, 3, 1 }, /* MOVE */
+{ op_113c_5, 0, 4412, 2, 2, 1 }, /* MOVE */
+{ op_1140_5, 0, 4416, 0, 2, 1 }, /* MOVE */
+{ op_1150_5, 0, 4432, 0, 3, 1 }, /* MOVE */
+{ op_1158_5, 0, 4440, 0, 3, 1 }, /* MOVE */
+{ op_1160_5, 0, 4448, 2, 3, 1 }, /* MOVE */
+{ op_1168_5, 0, 4456, 0, 4, 1 }, /* MOVE */
+{ op_1170_5, 0, 4464, 2, 4, 1 }, /* MOVE */
+{ op_1178_5, 0, 4472, 0, 4, 1 }, /* MOVE */
+{ op_1179_5, 0, 4473, 0, 5, 1 }, /* MOVE */
+{ op_117a_5, 0, 4474, 0, 4, 1 }, /* MOVE */
+{ op_117b_5, 0, 4475, 2, 4, 1 }, /* MOVE */
+{ op_117c_5, 0, 4476, 0, 3, 1 }, /* MOVE */
+{ op_1180_5, 0, 4480, 2, 2, 1 }, /* MOVE */
+{ op_1190_5, 0, 4496, 2, 3, 1 }, /* MOVE */
+{ op_1198_5, 0, 4504, 2, 3, 1 }, /* MOVE */
+{ op_11a0_5, 0, 4512, 4, 3, 1 }, /* MOVE */
+{ op_11a8_5, 0, 4520, 2, 4, 1 }, /* MOVE */
+{ op_11b0_5, 0, 4528, 4, 4, 1 }, /* MOVE */
+{ op_11b8_5, 0, 4536, 2, 4, 1 }, /* MOVE */
+{ op_11b9_5, 0, 4537, 2, 5, 1 }, /* MOVE */
+{ op_11ba_5, 0, 4538, 2, 4, 1 }, /* MOVE */
+{ op_11bb_5, 0, 4539, 4, 4, 1 }, /* MOVE */
+{ op_11bc_5, 0, 4540, 2, 3, 1 }, /* MOVE */
+{ op_11c0_5, 0, 4544, 0, 2, 1 }, /* MOVE */
+{ op_11d0_5, 0, 4560, 0, 3, 1 }, /* MOVE */
+{ op_11d8_5, 0, 4568, 0, 3, 1 }, /* MOVE */
+{ op_11e0_5, 0, 4576, 2, 3, 1 }, /* MOVE */
+{ op_11e8_5, 0, 4584, 0, 4, 1 }, /* MOVE */
+{ op_11f0_5, 0, 4592, 2, 4, 1 }, /* MOVE */
+{ op_11f8_5, 0, 4600, 0, 4, 1 }, /* MOVE */
+{ op_11f9_5, 0, 4601, 0, 5, 1 }, /* MOVE */
+{ op_11fa_5, 0, 4602, 0, 4, 1 }, /* MOVE */
+{ op_11fb_5, 0, 4603, 2, 4, 1 }, /* MOVE */
+{ op_11fc_5, 0, 4604, 0, 3, 1 }, /* MOVE */
+{ op_13c0_5, 0, 5056, 0, 3, 1 }, /* MOVE */
+{ op_13d0_5, 0, 5072, 0, 4, 1 }, /* MOVE */
+{ op_13d8_5, 0, 5080, 0, 4, 1 }, /* MOVE */
+{ op_13e0_5, 0, 5088, 2, 4, 1 }, /* MOVE */
+{ op_13e8_5, 0, 5096, 0, 5, 1 }, /* MOVE */
+{ op_13f0_5, 0, 5104, 2, 5, 1 }, /* MOVE */
+{ op_13f8_5, 0, 5112, 0, 5, 1 }, /* MOVE */
+{ op_13f9_5, 0, 5113, 0, 6, 1 }, /* MOVE */
+{ op_13fa_5, 0, 5114, 0, 5, 1 }, /* MOVE */
+{ op_13fb_5, 0, 5115, 2, 5, 1 }, /* MOVE */
+{ op_13fc_5, 0, 5116, 0, 4, 1 }, /* MOVE */
+{ op_2000_5, 0, 8192, 0, 1, 0 }, /* MOVE */
+{ op_2008_5, 0, 8200, 0, 1, 0 }, /* MOVE */
+{ op_2010_5, 0, 8208, 0, 3, 0 }, /* MOVE */
+{ op_2018_5, 0, 8216, 0, 3, 0 }, /* MOVE */
+{ op_2020_5, 0, 8224, 2, 3, 0 }, /* MOVE */
+{ op_2028_5, 0, 8232, 0, 4, 0 }, /* MOVE */
+{ op_2030_5, 0, 8240, 2, 4, 0 }, /* MOVE */
+{ op_2038_5, 0, 8248, 0, 4, 0 }, /* MOVE */
+{ op_2039_5, 0, 8249, 0, 5, 0 }, /* MOVE */
+{ op_203a_5, 0, 8250, 0, 4, 0 }, /* MOVE */
+{ op_203b_5, 0, 8251, 2, 4, 0 }, /* MOVE */
+{ op_203c_5, 0, 8252, 0, 3, 0 }, /* MOVE */
+{ op_2040_5, 0, 8256, 0, 1, 0 }, /* MOVEA */
+{ op_2048_5, 0, 8264, 0, 1, 0 }, /* MOVEA */
+{ op_2050_5, 0, 8272, 0, 3, 0 }, /* MOVEA */
+{ op_2058_5, 0, 8280, 0, 3, 0 }, /* MOVEA */
+{ op_2060_5, 0, 8288, 2, 3, 0 }, /* MOVEA */
+{ op_2068_5, 0, 8296, 0, 4, 0 }, /* MOVEA */
+{ op_2070_5, 0, 8304, 2, 4, 0 }, /* MOVEA */
+{ op_2078_5, 0, 8312, 0, 4, 0 }, /* MOVEA */
+{ op_2079_5, 0, 8313, 0, 5, 0 }, /* MOVEA */
+{ op_207a_5, 0, 8314, 0, 4, 0 }, /* MOVEA */
+{ op_207b_5, 0, 8315, 2, 4, 0 }, /* MOVEA */
+{ op_207c_5, 0, 8316, 0, 3, 0 }, /* MOVEA */
+{ op_2080_5, 0, 8320, 0, 1, 2 }, /* MOVE */
+{ op_2088_5, 0, 8328, 0, 1, 2 }, /* MOVE */
+{ op_2090_5, 0, 8336, 0, 3, 2 }, /* MOVE */
+{ op_2098_5, 0, 8344, 0, 3, 2 }, /* MOVE */
+{ op_20a0_5, 0, 8352, 2, 3, 2 }, /* MOVE */
+{ op_20a8_5, 0, 8360, 0, 4, 2 }, /* MOVE */
+{ op_20b0_5, 0, 8368, 2, 4, 2 }, /* MOVE */
+{ op_20b8_5, 0, 8376, 0, 4, 2 }, /* MOVE */
+{ op_20b9_5, 0, 8377, 0, 5, 2 }, /* MOVE */
+{ op_20ba_5, 0, 8378, 0, 4, 2 }, /* MOVE */
+{ op_20bb_5, 0, 8379, 2, 4, 2 }, /* MOVE */
+{ op_20bc_5, 0, 8380, 0, 3, 2 }, /* MOVE */
+{ op_20c0_5, 0, 8384, 0, 1, 2 }, /* MOVE */
+{ op_20c8_5, 0, 8392, 0, 1, 2 }, /* MOVE */
+{ op_20d0_5, 0, 8400, 0, 3, 2 }, /* MOVE */
+{ op_20d8_5, 0, 8408, 0, 3, 2 }, /* MOVE */
+{ op_20e0_5, 0, 8416, 2, 3, 2 }, /* MOVE */
+{ op_20e8_5, 0, 8424, 0, 4, 2 }, /* MOVE */
+{ op_20f0_5, 0, 8432, 2, 4, 2 }, /* MOVE */
+{ op_20f8_5, 0, 8440, 0, 4, 2 }, /* MOVE */
+{ op_20f9_5, 0, 8441, 0, 5, 2 }, /* MOVE */
+{ op_20fa_5, 0, 8442, 0, 4, 2 }, /* MOVE */
+{ op_20fb_5, 0, 8443, 2, 4, 2 }, /* MOVE */
+{ op_20fc_5, 0, 8444, 0, 3, 2 }, /* MOVE */
+{ op_2100_5, 0, 8448, 2, 1, 2 }, /* MOVE */
+{ op_2108_5, 0, 8456, 2, 1, 2 }, /* MOVE */
+{ op_2110_5, 0, 8464, 2, 3, 2 }, /* MOVE */
+{ op_2118_5, 0, 8472, 2, 3, 2 }, /* MOVE */
+{ op_2120_5, 0, 8480, 4, 3, 2 }, /* MOVE */
+{ op_2128_5, 0, 8488, 2, 4, 2 }, /* MOVE */
+{ op_2130_5, 0, 8496, 4, 4, 2 }, /* MOVE */
+{ op_2138_5, 0, 8504, 2, 4, 2 }, /* MOVE */
+{ op_2139_5, 0, 8505, 2, 5, 2 }, /* MOVE */
+{ op_213a_5, 0, 8506, 2, 4, 2 }, /* MOVE */
+{ op_213b_5, 0, 8507, 4, 4, 2 }, /* MOVE */
+{ op_213c_5, 0, 8508, 2, 3, 2 }, /* MOVE */
+{ op_2140_5, 0, 8512, 0, 2, 2 }, /* MOVE */
+{ op_2148_5, 0, 8520, 0, 2, 2 }, /* MOVE */
+{ op_2150_5, 0, 8528, 0, 4, 2 }, /* MOVE */
+{ op_2158_5, 0, 8536, 0, 4, 2 }, /* MOVE */
+{ op_2160_5, 0, 8544, 2, 4, 2 }, /* MOVE */
+{ op_2168_5, 0, 8552, 0, 5, 2 }, /* MOVE */
+{ op_2170_5, 0, 8560, 2, 5, 2 }, /* MOVE */
+{ op_2178_5, 0, 8568, 0, 5, 2 }, /* MOVE */
+{ op_2179_5, 0, 8569, 0, 6, 2 }, /* MOVE */
+{ op_217a_5, 0, 8570, 0, 5, 2 }, /* MOVE */
+{ op_217b_5, 0, 8571, 2, 5, 2 }, /* MOVE */
+{ op_217c_5, 0, 8572, 0, 4, 2 }, /* MOVE */
+{ op_2180_5, 0, 8576, 2, 2, 2 }, /* MOVE */
+{ op_2188_5, 0, 8584, 2, 2, 2 }, /* MOVE */
+{ op_2190_5, 0, 8592, 2, 4, 2 }, /* MOVE */
+{ op_2198_5, 0, 8600, 2, 4, 2 }, /* MOVE */
+{ op_21a0_5, 0, 8608, 4, 4, 2 }, /* MOVE */
+{ op_21a8_5, 0, 8616, 2, 5, 2 }, /* MOVE */
+{ op_21b0_5, 0, 8624, 4, 5, 2 }, /* MOVE */
+{ op_21b8_5, 0, 8632, 2, 5, 2 }, /* MOVE */
+{ op_21b9_5, 0, 8633, 2, 6, 2 }, /* MOVE */
+{ op_21ba_5, 0, 8634, 2, 5, 2 }, /* MOVE */
+{ op_21bb_5, 0, 8635, 4, 5, 2 }, /* MOVE */
+{ op_21bc_5, 0, 8636, 2, 4, 2 }, /* MOVE */
+{ op_21c0_5, 0, 8640, 0, 2, 2 }, /* MOVE */
+{ op_21c8_5, 0, 8648, 0, 2, 2 }, /* MOVE */
+{ op_21d0_5, 0, 8656, 0, 4, 2 }, /* MOVE */
+{ op_21d8_5, 0, 8664, 0, 4, 2 }, /* MOVE */
+{ op_21e0_5, 0, 8672, 2, 4, 2 }, /* MOVE */
+{ op_21e8_5, 0, 8680, 0, 5, 2 }, /* MOVE */
+{ op_21f0_5, 0, 8688, 2, 5, 2 }, /* MOVE */
+{ op_21f8_5, 0, 8696, 0, 5, 2 }, /* MOVE */
+{ op_21f9_5, 0, 8697, 0, 6, 2 }, /* MOVE */
+{ op_21fa_5, 0, 8698, 0, 5, 2 }, /* MOVE */
+{ op_21fb_5, 0, 8699, 2, 5, 2 }, /* MOVE */
+{ op_21fc_5, 0, 8700, 0, 4, 2 }, /* MOVE */
+{ op_23c0_5, 0, 9152, 0, 3, 2 }, /* MOVE */
+{ op_23c8_5, 0, 9160, 0, 3, 2 }, /* MOVE */
+{ op_23d0_5, 0, 9168, 0, 5, 2 }, /* MOVE */
+{ op_23d8_5, 0, 9176, 0, 5, 2 }, /* MOVE */
+{ op_23e0_5, 0, 9184, 2, 5, 2 }, /* MOVE */
+{ op_23e8_5, 0, 9192, 0, 6, 2 }, /* MOVE */
+{ op_23f0_5, 0, 9200, 2, 6, 2 }, /* MOVE */
+{ op_23f8_5, 0, 9208, 0, 6, 2 }, /* MOVE */
+{ op_23f9_5, 0, 9209, 0, 7, 2 }, /* MOVE */
+{ op_23fa_5, 0, 9210, 0, 6, 2 }, /* MOVE */
+{ op_23fb_5, 0, 9211, 2, 6, 2 }, /* MOVE */
+{ op_23fc_5, 0, 9212, 0, 5, 2 }, /* MOVE */
+{ op_3000_5, 0, 12288, 0, 1, 0 }, /* MOVE */
+{ op_3008_5, 0, 12296, 0, 1, 0 }, /* MOVE */
+{ op_3010_5, 0, 12304, 0, 2, 0 }, /* MOVE */
+{ op_3018_5, 0, 12312, 0, 2, 0 }, /* MOVE */
+{ op_3020_5, 0, 12320, 2, 2, 0 }, /* MOVE */
+{ op_3028_5, 0, 12328, 0, 3, 0 }, /* MOVE */
+{ op_3030_5, 0, 12336, 2, 3, 0 }, /* MOVE */
+{ op_3038_5, 0, 12344, 0, 3, 0 }, /* MOVE */
+{ op_3039_5, 0, 12345, 0, 4, 0 }, /* MOVE */
+{ op_303a_5, 0, 12346, 0, 3, 0 }, /* MOVE */
+{ op_303b_5, 0, 12347, 2, 3, 0 }, /* MOVE */
+{ op_303c_5, 0, 12348, 0, 2, 0 }, /* MOVE */
+{ op_3040_5, 0, 12352, 0, 1, 0 }, /* MOVEA */
+{ op_3048_5, 0, 12360, 0, 1, 0 }, /* MOVEA */
+{ op_3050_5, 0, 12368, 0, 2, 0 }, /* MOVEA */
+{ op_3058_5, 0, 12376, 0, 2, 0 }, /* MOVEA */
+{ op_3060_5, 0, 12384, 2, 2, 0 }, /* MOVEA */
+{ op_3068_5, 0, 12392, 0, 3, 0 }, /* MOVEA */
+{ op_3070_5, 0, 12400, 2, 3, 0 }, /* MOVEA */
+{ op_3078_5, 0, 12408, 0, 3, 0 }, /* MOVEA */
+{ op_3079_5, 0, 12409, 0, 4, 0 }, /* MOVEA */
+{ op_307a_5, 0, 12410, 0, 3, 0 }, /* MOVEA */
+{ op_307b_5, 0, 12411, 2, 3, 0 }, /* MOVEA */
+{ op_307c_5, 0, 12412, 0, 2, 0 }, /* MOVEA */
+{ op_3080_5, 0, 12416, 0, 1, 1 }, /* MOVE */
+{ op_3088_5, 0, 12424, 0, 1, 1 }, /* MOVE */
+{ op_3090_5, 0, 12432, 0, 2, 1 }, /* MOVE */
+{ op_3098_5, 0, 12440, 0, 2, 1 }, /* MOVE */
+{ op_30a0_5, 0, 12448, 2, 2, 1 }, /* MOVE */
+{ op_30a8_5, 0, 12456, 0, 3, 1 }, /* MOVE */
+{ op_30b0_5, 0, 12464, 2, 3, 1 }, /* MOVE */
+{ op_30b8_5, 0, 12472, 0, 3, 1 }, /* MOVE */
+{ op_30b9_5, 0, 12473, 0, 4, 1 }, /* MOVE */
+{ op_30ba_5, 0, 12474, 0, 3, 1 }, /* MOVE */
+{ op_30bb_5, 0, 12475, 2, 3, 1 }, /* MOVE */
+{ op_30bc_5, 0, 12476, 0, 2, 1 }, /* MOVE */
+{ op_30c0_5, 0, 12480, 0, 1, 1 }, /* MOVE */
+{ op_30c8_5, 0, 12488, 0, 1, 1 }, /* MOVE */
+{ op_30d0_5, 0, 12496, 0, 2, 1 }, /* MOVE */
+{ op_30d8_5, 0, 12504, 0, 2, 1 }, /* MOVE */
+{ op_30e0_5, 0, 12512, 2, 2, 1 }, /* MOVE */
+{ op_30e8_5, 0, 12520, 0, 3, 1 }, /* MOVE */
+{ op_30f0_5, 0, 12528, 2, 3, 1 }, /* MOVE */
+{ op_30f8_5, 0, 12536, 0, 3, 1 }, /* MOVE */
+{ op_30f9_5, 0, 12537, 0, 4, 1 }, /* MOVE */
+{ op_30fa_5, 0, 12538, 0, 3, 1 }, /* MOVE */
+{ op_30fb_5, 0, 12539, 2, 3, 1 }, /* MOVE */
+{ op_30fc_5, 0, 12540, 0, 2, 1 }, /* MOVE */
+{ op_3100_5, 0, 12544, 2, 1, 1 }, /* MOVE */
+{ op_3108_5, 0, 12552, 2, 1, 1 }, /* MOVE */
+{ op_3110_5, 0, 12560, 2, 2, 1 }, /* MOVE */
+{ op_3118_5, 0, 12568, 2, 2, 1 }, /* MOVE */
+{ op_3120_5, 0, 12576, 4, 2, 1 }, /* MOVE */
+{ op_3128_5, 0, 12584, 2, 3, 1 }, /* MOVE */
+{ op_3130_5, 0, 12592, 4, 3, 1 }, /* MOVE */
+{ op_3138_5, 0, 12600, 2, 3, 1 }, /* MOVE */
+{ op_3139_5, 0, 12601, 2, 4, 1 }, /* MOVE */
+{ op_313a_5, 0, 12602, 2, 3, 1 }, /* MOVE */
+{ op_313b_5, 0, 12603, 4, 3, 1 }, /* MOVE */
+{ op_313c_5, 0, 12604, 2, 2, 1 }, /* MOVE */
+{ op_3140_5, 0, 12608, 0, 2, 1 }, /* MOVE */
+{ op_3148_5, 0, 12616, 0, 2, 1 }, /* MOVE */
+{ op_3150_5, 0, 12624, 0, 3, 1 }, /* MOVE */
+{ op_3158_5, 0, 12632, 0, 3, 1 }, /* MOVE */
+{ op_3160_5, 0, 12640, 2, 3, 1 }, /* MOVE */
+{ op_3168_5, 0, 12648, 0, 4, 1 }, /* MOVE */
+{ op_3170_5, 0, 12656, 2, 4, 1 }, /* MOVE */
+{ op_3178_5, 0, 12664, 0, 4, 1 }, /* MOVE */
+{ op_3179_5, 0, 12665, 0, 5, 1 }, /* MOVE */
+{ op_317a_5, 0, 12666, 0, 4, 1 }, /* MOVE */
+{ op_317b_5, 0, 12667, 2, 4, 1 }, /* MOVE */
+{ op_317c_5, 0, 12668, 0, 3, 1 }, /* MOVE */
+{ op_3180_5, 0, 12672, 2, 2, 1 }, /* MOVE */
+{ op_3188_5, 0, 12680, 2, 2, 1 }, /* MOVE */
+{ op_3190_5, 0, 12688, 2, 3, 1 }, /* MOVE */
+{ op_3198_5, 0, 12696, 2, 3, 1 }, /* MOVE */
+{ op_31a0_5, 0, 12704, 4, 3, 1 }, /* MOVE */
+{ op_31a8_5, 0, 12712, 2, 4, 1 }, /* MOVE */
+{ op_31b0_5, 0, 12720, 4, 4, 1 }, /* MOVE */
+{ op_31b8_5, 0, 12728, 2, 4, 1 }, /* MOVE */
+{ op_31b9_5, 0, 12729, 2, 5, 1 }, /* MOVE */
+{ op_31ba_5, 0, 12730, 2, 4, 1 }, /* MOVE */
+{ op_31bb_5, 0, 12731, 4, 4, 1 }, /* MOVE */
+{ op_31bc_5, 0, 12732, 2, 3, 1 }, /* MOVE */
+{ op_31c0_5, 0, 12736, 0, 2, 1 }, /* MOVE */
+{ op_31c8_5, 0, 12744, 0, 2, 1 }, /* MOVE */
+{ op_31d0_5, 0, 12752, 0, 3, 1 }, /* MOVE */
+{ op_31d8_5, 0, 12760, 0, 3, 1 }, /* MOVE */
+{ op_31e0_5, 0, 12768, 2, 3, 1 }, /* MOVE */
+{ op_31e8_5, 0, 12776, 0, 4, 1 }, /* MOVE */
+{ op_31f0_5, 0, 12784, 2, 4, 1 }, /* MOVE */
+{ op_31f8_5, 0, 12792, 0, 4, 1 }, /* MOVE */
+{ op_31f9_5, 0, 12793, 0, 5, 1 }, /* MOVE */
+{ op_31fa_5, 0, 12794, 0, 4, 1 }, /* MOVE */
+{ op_31fb_5, 0, 12795, 2, 4, 1 }, /* MOVE */
+{ op_31fc_5, 0, 12796, 0, 3, 1 }, /* MOVE */
+{ op_33c0_5, 0, 13248, 0, 3, 1 }, /* MOVE */
+{ op_33c8_5, 0, 13256, 0, 3, 1 }, /* MOVE */
+{ op_33d0_5, 0, 13264, 0, 4, 1 }, /* MOVE */
+{ op_33d8_5, 0, 13272, 0, 4, 1 }, /* MOVE */
+{ op_33e0_5, 0, 13280, 2, 4, 1 }, /* MOVE */
+{ op_33e8_5, 0, 13288, 0, 5, 1 }, /* MOVE */
+{ op_33f0_5, 0, 13296, 2, 5, 1 }, /* MOVE */
+{ op_33f8_5, 0, 13304, 0, 5, 1 }, /* MOVE */
+{ op_33f9_5, 0, 13305, 0, 6, 1 }, /* MOVE */
+{ op_33fa_5, 0, 13306, 0, 5, 1 }, /* MOVE */
+{ op_33fb_5, 0, 13307, 2, 5, 1 }, /* MOVE */
+{ op_33fc_5, 0, 13308, 0, 4, 1 }, /* MOVE */
+{ op_4000_5, 0, 16384, 0, 1, 0 }, /* NEGX */
+{ op_4010_5, 0, 16400, 0, 2, 1 }, /* NEGX */
+{ op_4018_5, 0, 16408, 0, 2, 1 }, /* NEGX */
+{ op_4020_5, 0, 16416, 2, 2, 1 }, /* NEGX */
+{ op_4028_5, 0, 16424, 0, 3, 1 }, /* NEGX */
+{ op_4030_5, 0, 16432, 2, 3, 1 }, /* NEGX */
+{ op_4038_5, 0, 16440, 0, 3, 1 }, /* NEGX */
+{ op_4039_5, 0, 16441, 0, 4, 1 }, /* NEGX */
+{ op_4040_5, 0, 16448, 0, 1, 0 }, /* NEGX */
+{ op_4050_5, 0, 16464, 0, 2, 1 }, /* NEGX */
+{ op_4058_5, 0, 16472, 0, 2, 1 }, /* NEGX */
+{ op_4060_5, 0, 16480, 2, 2, 1 }, /* NEGX */
+{ op_4068_5, 0, 16488, 0, 3, 1 }, /* NEGX */
+{ op_4070_5, 0, 16496, 2, 3, 1 }, /* NEGX */
+{ op_4078_5, 0, 16504, 0, 3, 1 }, /* NEGX */
+{ op_4079_5, 0, 16505, 0, 4, 1 }, /* NEGX */
+{ op_4080_5, 0, 16512, 2, 1, 0 }, /* NEGX */
+{ op_4090_5, 0, 16528, 0, 3, 2 }, /* NEGX */
+{ op_4098_5, 0, 16536, 0, 3, 2 }, /* NEGX */
+{ op_40a0_5, 0, 16544, 2, 3, 2 }, /* NEGX */
+{ op_40a8_5, 0, 16552, 0, 4, 2 }, /* NEGX */
+{ op_40b0_5, 0, 16560, 2, 4, 2 }, /* NEGX */
+{ op_40b8_5, 0, 16568, 0, 4, 2 }, /* NEGX */
+{ op_40b9_5, 0, 16569, 0, 5, 2 }, /* NEGX */
+{ op_40c0_5, 0, 16576, 2, 1, 0 }, /* MVSR2 */
+{ op_40d0_5, 0, 16592, 0, 1, 1 }, /* MVSR2 */
+{ op_40d8_5, 0, 16600, 0, 1, 1 }, /* MVSR2 */
+{ op_40e0_5, 0, 16608, 2, 1, 1 }, /* MVSR2 */
+{ op_40e8_5, 0, 16616, 0, 2, 1 }, /* MVSR2 */
+{ op_40f0_5, 0, 16624, 2, 2, 1 }, /* MVSR2 */
+{ op_40f8_5, 0, 16632, 0, 2, 1 }, /* MVSR2 */
+{ op_40f9_5, 0, 16633, 0, 3, 1 }, /* MVSR2 */
+{ op_4100_5, 0, 16640, 6, 1, 0 }, /* CHK */
+{ op_4110_5, 0, 16656, 6, 3, 0 }, /* CHK */
+{ op_4118_5, 0, 16664, 6, 3, 0 }, /* CHK */
+{ op_4120_5, 0, 16672, 8, 3, 0 }, /* CHK */
+{ op_4128_5, 0, 16680, 6, 4, 0 }, /* CHK */
+{ op_4130_5, 0, 16688, 8, 4, 0 }, /* CHK */
+{ op_4138_5, 0, 16696, 6, 4, 0 }, /* CHK */
+{ op_4139_5, 0, 16697, 6, 5, 0 }, /* CHK */
+{ op_413a_5, 0, 16698, 6, 4, 0 }, /* CHK */
+{ op_413b_5, 0, 16699, 8, 4, 0 }, /* CHK */
+{ op_413c_5, 0, 16700, 6, 3, 0 }, /* CHK */
+{ op_4180_5, 0, 16768, 6, 1, 0 }, /* CHK */
+{ op_4190_5, 0, 16784, 6, 2, 0 }, /* CHK */
+{ op_4198_5, 0, 16792, 6, 2, 0 }, /* CHK */
+{ op_41a0_5, 0, 16800, 8, 2, 0 }, /* CHK */
+{ op_41a8_5, 0, 16808, 6, 3, 0 }, /* CHK */
+{ op_41b0_5, 0, 16816, 8, 3, 0 }, /* CHK */
+{ op_41b8_5, 0, 16824, 6, 3, 0 }, /* CHK */
+{ op_41b9_5, 0, 16825, 6, 4, 0 }, /* CHK */
+{ op_41ba_5, 0, 16826, 6, 3, 0 }, /* CHK */
+{ op_41bb_5, 0, 16827, 8, 3, 0 }, /* CHK */
+{ op_41bc_5, 0, 16828, 6, 2, 0 }, /* CHK */
+{ op_41d0_5, 0, 16848, 0, 1, 0 }, /* LEA */
+{ op_41e8_5, 0, 16872, 0, 2, 0 }, /* LEA */
+{ op_41f0_5, 0, 16880, 4, 2, 0 }, /* LEA */
+{ op_41f8_5, 0, 16888, 0, 2, 0 }, /* LEA */
+{ op_41f9_5, 0, 16889, 0, 3, 0 }, /* LEA */
+{ op_41fa_5, 0, 16890, 0, 2, 0 }, /* LEA */
+{ op_41fb_5, 0, 16891, 4, 2, 0 }, /* LEA */
+{ op_4200_5, 0, 16896, 0, 1, 0 }, /* CLR */
+{ op_4210_5, 0, 16912, 0, 1, 1 }, /* CLR */
+{ op_4218_5, 0, 16920, 0, 1, 1 }, /* CLR */
+{ op_4220_5, 0, 16928, 2, 1, 1 }, /* CLR */
+{ op_4228_5, 0, 16936, 0, 2, 1 }, /* CLR */
+{ op_4230_5, 0, 16944, 2, 2, 1 }, /* CLR */
+{ op_4238_5, 0, 16952, 0, 2, 1 }, /* CLR */
+{ op_4239_5, 0, 16953, 0, 3, 1 }, /* CLR */
+{ op_4240_5, 0, 16960, 0, 1, 0 }, /* CLR */
+{ op_4250_5, 0, 16976, 0, 1, 1 }, /* CLR */
+{ op_4258_5, 0, 16984, 0, 1, 1 }, /* CLR */
+{ op_4260_5, 0, 16992, 2, 1, 1 }, /* CLR */
+{ op_4268_5, 0, 17000, 0, 2, 1 }, /* CLR */
+{ op_4270_5, 0, 17008, 2, 2, 1 }, /* CLR */
+{ op_4278_5, 0, 17016, 0, 2, 1 }, /* CLR */
+{ op_4279_5, 0, 17017, 0, 3, 1 }, /* CLR */
+{ op_4280_5, 0, 17024, 2, 1, 0 }, /* CLR */
+{ op_4290_5, 0, 17040, 0, 1, 2 }, /* CLR */
+{ op_4298_5, 0, 17048, 0, 1, 2 }, /* CLR */
+{ op_42a0_5, 0, 17056, 2, 1, 2 }, /* CLR */
+{ op_42a8_5, 0, 17064, 0, 2, 2 }, /* CLR */
+{ op_42b0_5, 0, 17072, 2, 2, 2 }, /* CLR */
+{ op_42b8_5, 0, 17080, 0, 2, 2 }, /* CLR */
+{ op_42b9_5, 0, 17081, 0, 3, 2 }, /* CLR */
+{ op_4400_5, 0, 17408, 0, 1, 0 }, /* NEG */
+{ op_4410_5, 0, 17424, 0, 2, 1 }, /* NEG */
+{ op_4418_5, 0, 17432, 0, 2, 1 }, /* NEG */
+{ op_4420_5, 0, 17440, 2, 2, 1 }, /* NEG */
+{ op_4428_5, 0, 17448, 0, 3, 1 }, /* NEG */
+{ op_4430_5, 0, 17456, 2, 3, 1 }, /* NEG */
+{ op_4438_5, 0, 17464, 0, 3, 1 }, /* NEG */
+{ op_4439_5, 0, 17465, 0, 4, 1 }, /* NEG */
+{ op_4440_5, 0, 17472, 0, 1, 0 }, /* NEG */
+{ op_4450_5, 0, 17488, 0, 2, 1 }, /* NEG */
+{ op_4458_5, 0, 17496, 0, 2, 1 }, /* NEG */
+{ op_4460_5, 0, 17504, 2, 2, 1 }, /* NEG */
+{ op_4468_5, 0, 17512, 0, 3, 1 }, /* NEG */
+{ op_4470_5, 0, 17520, 2, 3, 1 }, /* NEG */
+{ op_4478_5, 0, 17528, 0, 3, 1 }, /* NEG */
+{ op_4479_5, 0, 17529, 0, 4, 1 }, /* NEG */
+{ op_4480_5, 0, 17536, 2, 1, 0 }, /* NEG */
+{ op_4490_5, 0, 17552, 0, 3, 2 }, /* NEG */
+{ op_4498_5, 0, 17560, 0, 3, 2 }, /* NEG */
+{ op_44a0_5, 0, 17568, 2, 3, 2 }, /* NEG */
+{ op_44a8_5, 0, 17576, 0, 4, 2 }, /* NEG */
+{ op_44b0_5, 0, 17584, 2, 4, 2 }, /* NEG */
+{ op_44b8_5, 0, 17592, 0, 4, 2 }, /* NEG */
+{ op_44b9_5, 0, 17593, 0, 5, 2 }, /* NEG */
+{ op_44c0_5, 0, 17600, 4, 2, 0 }, /* MV2SR */
+{ op_44d0_5, 0, 17616, 4, 3, 0 }, /* MV2SR */
+{ op_44d8_5, 0, 17624, 4, 3, 0 }, /* MV2SR */
+{ op_44e0_5, 0, 17632, 6, 3, 0 }, /* MV2SR */
+{ op_44e8_5, 0, 17640, 4, 4, 0 }, /* MV2SR */
+{ op_44f0_5, 0, 17648, 6, 4, 0 }, /* MV2SR */
+{ op_44f8_5, 0, 17656, 4, 4, 0 }, /* MV2SR */
+{ op_44f9_5, 0, 17657, 4, 5, 0 }, /* MV2SR */
+{ op_44fa_5, 0, 17658, 4, 4, 0 }, /* MV2SR */
+{ op_44fb_5, 0, 17659, 6, 4, 0 }, /* MV2SR */
+{ op_44fc_5, 0, 17660, 4, 3, 0 }, /* MV2SR */
+{ op_4600_5, 0, 17920, 0, 1, 0 }, /* NOT */
+{ op_4610_5, 0, 17936, 0, 2, 1 }, /* NOT */
+{ op_4618_5, 0, 17944, 0, 2, 1 }, /* NOT */
+{ op_4620_5, 0, 17952, 2, 2, 1 }, /* NOT */
+{ op_4628_5, 0, 17960, 0, 3, 1 }, /* NOT */
+{ op_4630_5, 0, 17968, 2, 3, 1 }, /* NOT */
+{ op_4638_5, 0, 17976, 0, 3, 1 }, /* NOT */
+{ op_4639_5, 0, 17977, 0, 4, 1 }, /* NOT */
+{ op_4640_5, 0, 17984, 0, 1, 0 }, /* NOT */
+{ op_4650_5, 0, 18000, 0, 2, 1 }, /* NOT */
+{ op_4658_5, 0, 18008, 0, 2, 1 }, /* NOT */
+{ op_4660_5, 0, 18016, 2, 2, 1 }, /* NOT */
+{ op_4668_5, 0, 18024, 0, 3, 1 }, /* NOT */
+{ op_4670_5, 0, 18032, 2, 3, 1 }, /* NOT */
+{ op_4678_5, 0, 18040, 0, 3, 1 }, /* NOT */
+{ op_4679_5, 0, 18041, 0, 4, 1 }, /* NOT */
+{ op_4680_5, 0, 18048, 2, 1, 0 }, /* NOT */
+{ op_4690_5, 0, 18064, 0, 3, 2 }, /* NOT */
+{ op_4698_5, 0, 18072, 0, 3, 2 }, /* NOT */
+{ op_46a0_5, 0, 18080, 2, 3, 2 }, /* NOT */
+{ op_46a8_5, 0, 18088, 0, 4, 2 }, /* NOT */
+{ op_46b0_5, 0, 18096, 2, 4, 2 }, /* NOT */
+{ op_46b8_5, 0, 18104, 0, 4, 2 }, /* NOT */
+{ op_46b9_5, 0, 18105, 0, 5, 2 }, /* NOT */
+{ op_46c0_5, 0, 18112, 4, 2, 0 }, /* MV2SR */
+{ op_46d0_5, 0, 18128, 4, 3, 0 }, /* MV2SR */
+{ op_46d8_5, 0, 18136, 4, 3, 0 }, /* MV2SR */
+{ op_46e0_5, 0, 18144, 6, 3, 0 }, /* MV2SR */
+{ op_46e8_5, 0, 18152, 4, 4, 0 }, /* MV2SR */
+{ op_46f0_5, 0, 18160, 6, 4, 0 }, /* MV2SR */
+{ op_46f8_5, 0, 18168, 4, 4, 0 }, /* MV2SR */
+{ op_46f9_5, 0, 18169, 4, 5, 0 }, /* MV2SR */
+{ op_46fa_5, 0, 18170, 4, 4, 0 }, /* MV2SR */
+{ op_46fb_5, 0, 18171, 6, 4, 0 }, /* MV2SR */
+{ op_46fc_5, 0, 18172, 4, 3, 0 }, /* MV2SR */
+{ op_4800_5, 0, 18432, 2, 1, 0 }, /* NBCD */
+{ op_4810_5, 0, 18448, 0, 2, 1 }, /* NBCD */
+{ op_4818_5, 0, 18456, 0, 2, 1 }, /* NBCD */
+{ op_4820_5, 0, 18464, 2, 2, 1 }, /* NBCD */
+{ op_4828_5, 0, 18472, 0, 3, 1 }, /* NBCD */
+{ op_4830_5, 0, 18480, 2, 3, 1 }, /* NBCD */
+{ op_4838_5, 0, 18488, 0, 3, 1 }, /* NBCD */
+{ op_4839_5, 0, 18489, 0, 4, 1 }, /* NBCD */
+{ op_4840_5, 0, 18496, 0, 1, 0 }, /* SWAP */
+{ op_4850_5, 0, 18512, 2, 1, 2 }, /* PEA */
+{ op_4868_5, 0, 18536, 2, 2, 2 }, /* PEA */
+{ op_4870_5, 0, 18544, 5, 2, 2 }, /* PEA */
+{ op_4878_5, 0, 18552, 2, 2, 2 }, /* PEA */
+{ op_4879_5, 0, 18553, 2, 3, 2 }, /* PEA */
+{ op_487a_5, 0, 18554, 2, 2, 2 }, /* PEA */
+{ op_487b_5, 0, 18555, 5, 2, 2 }, /* PEA */
+{ op_4880_5, 0, 18560, 0, 1, 0 }, /* EXT */
+{ op_4890_5, 0, 18576, 0, 2, 255 }, /* MVMLE */
+{ op_48a0_5, 0, 18592, 2, 2, 255 }, /* MVMLE */
+{ op_48a8_5, 0, 18600, 0, 3, 255 }, /* MVMLE */
+{ op_48b0_5, 0, 18608, 2, 3, 255 }, /* MVMLE */
+{ op_48b8_5, 0, 18616, 0, 3, 255 }, /* MVMLE */
+{ op_48b9_5, 0, 18617, 0, 4, 255 }, /* MVMLE */
+{ op_48c0_5, 0, 18624, 0, 1, 0 }, /* EXT */
+{ op_48d0_5, 0, 18640, 0, 2, 255 }, /* MVMLE */
+{ op_48e0_5, 0, 18656, 2, 2, 255 }, /* MVMLE */
+{ op_48e8_5, 0, 18664, 0, 3, 255 }, /* MVMLE */
+{ op_48f0_5, 0, 18672, 2, 3, 255 }, /* MVMLE */
+{ op_48f8_5, 0, 18680, 0, 3, 255 }, /* MVMLE */
+{ op_48f9_5, 0, 18681, 0, 4, 255 }, /* MVMLE */
+{ op_49c0_5, 0, 18880, 0, 1, 0 }, /* EXT */
+{ op_4a00_5, 0, 18944, 0, 1, 0 }, /* TST */
+{ op_4a10_5, 0, 18960, 0, 2, 0 }, /* TST */
+{ op_4a18_5, 0, 18968, 0, 2, 0 }, /* TST */
+{ op_4a20_5, 0, 18976, 2, 2, 0 }, /* TST */
+{ op_4a28_5, 0, 18984, 0, 3, 0 }, /* TST */
+{ op_4a30_5, 0, 18992, 2, 3, 0 }, /* TST */
+{ op_4a38_5, 0, 19000, 0, 3, 0 }, /* TST */
+{ op_4a39_5, 0, 19001, 0, 4, 0 }, /* TST */
+{ op_4a3a_5, 0, 19002, 0, 3, 0 }, /* TST */
+{ op_4a3b_5, 0, 19003, 2, 3, 0 }, /* TST */
+{ op_4a3c_5, 0, 19004, 0, 2, 0 }, /* TST */
+{ op_4a40_5, 0, 19008, 0, 1, 0 }, /* TST */
+{ op_4a48_5, 0, 19016, 0, 1, 0 }, /* TST */
+{ op_4a50_5, 0, 19024, 0, 2, 0 }, /* TST */
+{ op_4a58_5, 0, 19032, 0, 2, 0 }, /* TST */
+{ op_4a60_5, 0, 19040, 2, 2, 0 }, /* TST */
+{ op_4a68_5, 0, 19048, 0, 3, 0 }, /* TST */
+{ op_4a70_5, 0, 19056, 2, 3, 0 }, /* TST */
+{ op_4a78_5, 0, 19064, 0, 3, 0 }, /* TST */
+{ op_4a79_5, 0, 19065, 0, 4, 0 }, /* TST */
+{ op_4a7a_5, 0, 19066, 0, 3, 0 }, /* TST */
+{ op_4a7b_5, 0, 19067, 2, 3, 0 }, /* TST */
+{ op_4a7c_5, 0, 19068, 0, 2, 0 }, /* TST */
+{ op_4a80_5, 0, 19072, 0, 1, 0 }, /* TST */
+{ op_4a88_5, 0, 19080, 0, 1, 0 }, /* TST */
+{ op_4a90_5, 0, 19088, 0, 3, 0 }, /* TST */
+{ op_4a98_5, 0, 19096, 0, 3, 0 }, /* TST */
+{ op_4aa0_5, 0, 19104, 2, 3, 0 }, /* TST */
+{ op_4aa8_5, 0, 19112, 0, 4, 0 }, /* TST */
+{ op_4ab0_5, 0, 19120, 2, 4, 0 }, /* TST */
+{ op_4ab8_5, 0, 19128, 0, 4, 0 }, /* TST */
+{ op_4ab9_5, 0, 19129, 0, 5, 0 }, /* TST */
+{ op_4aba_5, 0, 19130, 0, 4, 0 }, /* TST */
+{ op_4abb_5, 0, 19131, 2, 4, 0 }, /* TST */
+{ op_4abc_5, 0, 19132, 0, 3, 0 }, /* TST */
+{ op_4ac0_5, 0, 19136, 0, 1, 0 }, /* TAS */
+{ op_4ad0_5, 0, 19152, 2, 2, 1 }, /* TAS */
+{ op_4ad8_5, 0, 19160, 2, 2, 1 }, /* TAS */
+{ op_4ae0_5, 0, 19168, 4, 2, 1 }, /* TAS */
+{ op_4ae8_5, 0, 19176, 2, 3, 1 }, /* TAS */
+{ op_4af0_5, 0, 19184, 4, 3, 1 }, /* TAS */
+{ op_4af8_5, 0, 19192, 2, 3, 1 }, /* TAS */
+{ op_4af9_5, 0, 19193, 2, 4, 1 }, /* TAS */
+{ op_4c90_5, 0, 19600, 0, 255, 0 }, /* MVMEL */
+{ op_4c98_5, 0, 19608, 0, 255, 0 }, /* MVMEL */
+{ op_4ca8_5, 0, 19624, 0, 255, 0 }, /* MVMEL */
+{ op_4cb0_5, 0, 19632, 2, 255, 0 }, /* MVMEL */
+{ op_4cb8_5, 0, 19640, 0, 255, 0 }, /* MVMEL */
+{ op_4cb9_5, 0, 19641, 0, 255, 0 }, /* MVMEL */
+{ op_4cba_5, 0, 19642, 0, 255, 0 }, /* MVMEL */
+{ op_4cbb_5, 0, 19643, 2, 255, 0 }, /* MVMEL */
+{ op_4cd0_5, 0, 19664, 0, 255, 0 }, /* MVMEL */
+{ op_4cd8_5, 0, 19672, 0, 255, 0 }, /* MVMEL */
+{ op_4ce8_5, 0, 19688, 0, 255, 0 }, /* MVMEL */
+{ op_4cf0_5, 0, 19696, 2, 255, 0 }, /* MVMEL */
+{ op_4cf8_5, 0, 19704, 0, 255, 0 }, /* MVMEL */
+{ op_4cf9_5, 0, 19705, 0, 255, 0 }, /* MVMEL */
+{ op_4cfa_5, 0, 19706, 0, 255, 0 }, /* MVMEL */
+{ op_4cfb_5, 0, 19707, 2, 255, 0 }, /* MVMEL */
+{ op_4e40_5, 0, 20032, 6, 255, 255 }, /* TRAP */
+{ op_4e50_5, 0, 20048, 2, 2, 2 }, /* LINK */
+{ op_4e58_5, 0, 20056, 0, 3, 0 }, /* UNLK */
+{ op_4e60_5, 0, 20064, 0, 1, 0 }, /* MVR2USP */
+{ op_4e68_5, 0, 20072, 0, 1, 0 }, /* MVUSP2R */
+{ op_4e70_5, 0, 20080, 128, 1, 0 }, /* RESET */
+{ op_4e71_5, 0, 20081, 0, 1, 0 }, /* NOP */
+{ op_4e72_5, 0, 20082, 4, 1, 0 }, /* STOP */
+{ op_4e73_5, 0, 20083, 0, 5, 0 }, /* RTE */
+{ op_4e74_5, 0, 20084, 0, 3, 0 }, /* RTD */
+{ op_4e75_5, 0, 20085, 0, 4, 0 }, /* RTS */
+{ op_4e76_5, 0, 20086, 0, 255, 255 }, /* TRAPV */
+{ op_4e77_5, 0, 20087, 12, 2, 0 }, /* RTR */
+{ op_4e90_5, 0, 20112, 0, 2, 2 }, /* JSR */
+{ op_4ea8_5, 0, 20136, 2, 2, 2 }, /* JSR */
+{ op_4eb0_5, 0, 20144, 6, 2, 2 }, /* JSR */
+{ op_4eb8_5, 0, 20152, 2, 2, 2 }, /* JSR */
+{ op_4eb9_5, 0, 20153, 0, 3, 2 }, /* JSR */
+{ op_4eba_5, 0, 20154, 2, 2, 2 }, /* JSR */
+{ op_4ebb_5, 0, 20155, 6, 2, 2 }, /* JSR */
+{ op_4ed0_5, 0, 20176, 0, 2, 0 }, /* JMP */
+{ op_4ee8_5, 0, 20200, 2, 2, 0 }, /* JMP */
+{ op_4ef0_5, 0, 20208, 2, 3, 0 }, /* JMP */
+{ op_4ef8_5, 0, 20216, 2, 2, 0 }, /* JMP */
+{ op_4ef9_5, 0, 20217, 0, 3, 0 }, /* JMP */
+{ op_4efa_5, 0, 20218, 2, 2, 0 }, /* JMP */
+{ op_4efb_5, 0, 20219, 2, 3, 0 }, /* JMP */
+{ op_5000_5, 0, 20480, 0, 1, 0 }, /* ADD */
+{ op_5010_5, 0, 20496, 0, 2, 1 }, /* ADD */
+{ op_5018_5, 0, 20504, 0, 2, 1 }, /* ADD */
+{ op_5020_5, 0, 20512, 2, 2, 1 }, /* ADD */
+{ op_5028_5, 0, 20520, 0, 3, 1 }, /* ADD */
+{ op_5030_5, 0, 20528, 2, 3, 1 }, /* ADD */
+{ op_5038_5, 0, 20536, 0, 3, 1 }, /* ADD */
+{ op_5039_5, 0, 20537, 0, 4, 1 }, /* ADD */
+{ op_5040_5, 0, 20544, 0, 1, 0 }, /* ADD */
+{ op_5048_5, 0, 20552, 4, 1, 0 }, /* ADDA */
+{ op_5050_5, 0, 20560, 0, 2, 1 }, /* ADD */
+{ op_5058_5, 0, 20568, 0, 2, 1 }, /* ADD */
+{ op_5060_5, 0, 20576, 2, 2, 1 }, /* ADD */
+{ op_5068_5, 0, 20584, 0, 3, 1 }, /* ADD */
+{ op_5070_5, 0, 20592, 2, 3, 1 }, /* ADD */
+{ op_5078_5, 0, 20600, 0, 3, 1 }, /* ADD */
+{ op_5079_5, 0, 20601, 0, 4, 1 }, /* ADD */
+{ op_5080_5, 0, 20608, 4, 1, 0 }, /* ADD */
+{ op_5088_5, 0, 20616, 4, 1, 0 }, /* ADDA */
+{ op_5090_5, 0, 20624, 0, 3, 2 }, /* ADD */
+{ op_5098_5, 0, 20632, 0, 3, 2 }, /* ADD */
+{ op_50a0_5, 0, 20640, 2, 3, 2 }, /* ADD */
+{ op_50a8_5, 0, 20648, 0, 4, 2 }, /* ADD */
+{ op_50b0_5, 0, 20656, 2, 4, 2 }, /* ADD */
+{ op_50b8_5, 0, 20664, 0, 4, 2 }, /* ADD */
+{ op_50b9_5, 0, 20665, 0, 5, 2 }, /* ADD */
+{ op_50c0_5, 0, 20672, 0, 1, 0 }, /* Scc */
+{ op_50c8_5, 0, 20680, 2, 2, 0 }, /* DBcc */
+{ op_50d0_5, 0, 20688, 0, 1, 1 }, /* Scc */
+{ op_50d8_5, 0, 20696, 0, 1, 1 }, /* Scc */
+{ op_50e0_5, 0, 20704, 2, 1, 1 }, /* Scc */
+{ op_50e8_5, 0, 20712, 0, 2, 1 }, /* Scc */
+{ op_50f0_5, 0, 20720, 2, 2, 1 }, /* Scc */
+{ op_50f8_5, 0, 20728, 0, 2, 1 }, /* Scc */
+{ op_50f9_5, 0, 20729, 0, 3, 1 }, /* Scc */
+{ op_5100_5, 0, 20736, 0, 1, 0 }, /* SUB */
+{ op_5110_5, 0, 20752, 0, 2, 1 }, /* SUB */
+{ op_5118_5, 0, 20760, 0, 2, 1 }, /* SUB */
+{ op_5120_5, 0, 20768, 2, 2, 1 }, /* SUB */
+{ op_5128_5, 0, 20776, 0, 3, 1 }, /* SUB */
+{ op_5130_5, 0, 20784, 2, 3, 1 }, /* SUB */
+{ op_5138_5, 0, 20792, 0, 3, 1 }, /* SUB */
+{ op_5139_5, 0, 20793, 0, 4, 1 }, /* SUB */
+{ op_5140_5, 0, 20800, 0, 1, 0 }, /* SUB */
+{ op_5148_5, 0, 20808, 4, 1, 0 }, /* SUBA */
+{ op_5150_5, 0, 20816, 0, 2, 1 }, /* SUB */
+{ op_5158_5, 0, 20824, 0, 2, 1 }, /* SUB */
+{ op_5160_5, 0, 20832, 2, 2, 1 }, /* SUB */
+{ op_5168_5, 0, 20840, 0, 3, 1 }, /* SUB */
+{ op_5170_5, 0, 20848, 2, 3, 1 }, /* SUB */
+{ op_5178_5, 0, 20856, 0, 3, 1 }, /* SUB */
+{ op_5179_5, 0, 20857, 0, 4, 1 }, /* SUB */
+{ op_5180_5, 0, 20864, 4, 1, 0 }, /* SUB */
+{ op_5188_5, 0, 20872, 4, 1, 0 }, /* SUBA */
+{ op_5190_5, 0, 20880, 0, 3, 2 }, /* SUB */
+{ op_5198_5, 0, 20888, 0, 3, 2 }, /* SUB */
+{ op_51a0_5, 0, 20896, 2, 3, 2 }, /* SUB */
+{ op_51a8_5, 0, 20904, 0, 4, 2 }, /* SUB */
+{ op_51b0_5, 0, 20912, 2, 4, 2 }, /* SUB */
+{ op_51b8_5, 0, 20920, 0, 4, 2 }, /* SUB */
+{ op_51b9_5, 0, 20921, 0, 5, 2 }, /* SUB */
+{ op_51c0_5, 0, 20928, 0, 1, 0 }, /* Scc */
+{ op_51c8_5, 0, 20936, 2, 2, 0 }, /* DBcc */
+{ op_51d0_5, 0, 20944, 0, 1, 1 }, /* Scc */
+{ op_51d8_5, 0, 20952, 0, 1, 1 }, /* Scc */
+{ op_51e0_5, 0, 20960, 2, 1, 1 }, /* Scc */
+{ op_51e8_5, 0, 20968, 0, 2, 1 }, /* Scc */
+{ op_51f0_5, 0, 20976, 2, 2, 1 }, /* Scc */
+{ op_51f8_5, 0, 20984, 0, 2, 1 }, /* Scc */
+{ op_51f9_5, 0, 20985, 0, 3, 1 }, /* Scc */
+{ op_52c0_5, 0, 21184, 0, 1, 0 }, /* Scc */
+{ op_52c8_5, 0, 21192, 2, 2, 0 }, /* DBcc */
+{ op_52d0_5, 0, 21200, 0, 1, 1 }, /* Scc */
+{ op_52d8_5, 0, 21208, 0, 1, 1 }, /* Scc */
+{ op_52e0_5, 0, 21216, 2, 1, 1 }, /* Scc */
+{ op_52e8_5, 0, 21224, 0, 2, 1 }, /* Scc */
+{ op_52f0_5, 0, 21232, 2, 2, 1 }, /* Scc */
+{ op_52f8_5, 0, 21240, 0, 2, 1 }, /* Scc */
+{ op_52f9_5, 0, 21241, 0, 3, 1 }, /* Scc */
+{ op_53c0_5, 0, 21440, 0, 1, 0 }, /* Scc */
+{ op_53c8_5, 0, 21448, 2, 2, 0 }, /* DBcc */
+{ op_53d0_5, 0, 21456, 0, 1, 1 }, /* Scc */
+{ op_53d8_5, 0, 21464, 0, 1, 1 }, /* Scc */
+{ op_53e0_5, 0, 21472, 2, 1, 1 }, /* Scc */
+{ op_53e8_5, 0, 21480, 0, 2, 1 }, /* Scc */
+{ op_53f0_5, 0, 21488, 2, 2, 1 }, /* Scc */
+{ op_53f8_5, 0, 21496, 0, 2, 1 }, /* Scc */
+{ op_53f9_5, 0, 21497, 0, 3, 1 }, /* Scc */
+{ op_54c0_5, 0, 21696, 0, 1, 0 }, /* Scc */
+{ op_54c8_5, 0, 21704, 2, 2, 0 }, /* DBcc */
+{ op_54d0_5, 0, 21712, 0, 1, 1 }, /* Scc */
+{ op_54d8_5, 0, 21720, 0, 1, 1 }, /* Scc */
+{ op_54e0_5, 0, 21728, 2, 1, 1 }, /* Scc */
+{ op_54e8_5, 0, 21736, 0, 2, 1 }, /* Scc */
+{ op_54f0_5, 0, 21744, 2, 2, 1 }, /* Scc */
+{ op_54f8_5, 0, 21752, 0, 2, 1 }, /* Scc */
+{ op_54f9_5, 0, 21753, 0, 3, 1 }, /* Scc */
+{ op_55c0_5, 0, 21952, 0, 1, 0 }, /* Scc */
+{ op_55c8_5, 0, 21960, 2, 2, 0 }, /* DBcc */
+{ op_55d0_5, 0, 21968, 0, 1, 1 }, /* Scc */
+{ op_55d8_5, 0, 21976, 0, 1, 1 }, /* Scc */
+{ op_55e0_5, 0, 21984, 2, 1, 1 }, /* Scc */
+{ op_55e8_5, 0, 21992, 0, 2, 1 }, /* Scc */
+{ op_55f0_5, 0, 22000, 2, 2, 1 }, /* Scc */
+{ op_55f8_5, 0, 22008, 0, 2, 1 }, /* Scc */
+{ op_55f9_5, 0, 22009, 0, 3, 1 }, /* Scc */
+{ op_56c0_5, 0, 22208, 0, 1, 0 }, /* Scc */
+{ op_56c8_5, 0, 22216, 2, 2, 0 }, /* DBcc */
+{ op_56d0_5, 0, 22224, 0, 1, 1 }, /* Scc */
+{ op_56d8_5, 0, 22232, 0, 1, 1 }, /* Scc */
+{ op_56e0_5, 0, 22240, 2, 1, 1 }, /* Scc */
+{ op_56e8_5, 0, 22248, 0, 2, 1 }, /* Scc */
+{ op_56f0_5, 0, 22256, 2, 2, 1 }, /* Scc */
+{ op_56f8_5, 0, 22264, 0, 2, 1 }, /* Scc */
+{ op_56f9_5, 0, 22265, 0, 3, 1 }, /* Scc */
+{ op_57c0_5, 0, 22464, 0, 1, 0 }, /* Scc */
+{ op_57c8_5, 0, 22472, 2, 2, 0 }, /* DBcc */
+{ op_57d0_5, 0, 22480, 0, 1, 1 }, /* Scc */
+{ op_57d8_5, 0, 22488, 0, 1, 1 }, /* Scc */
+{ op_57e0_5, 0, 22496, 2, 1, 1 }, /* Scc */
+{ op_57e8_5, 0, 22504, 0, 2, 1 }, /* Scc */
+{ op_57f0_5, 0, 22512, 2, 2, 1 }, /* Scc */
+{ op_57f8_5, 0, 22520, 0, 2, 1 }, /* Scc */
+{ op_57f9_5, 0, 22521, 0, 3, 1 }, /* Scc */
+{ op_58c0_5, 0, 22720, 0, 1, 0 }, /* Scc */
+{ op_58c8_5, 0, 22728, 2, 2, 0 }, /* DBcc */
+{ op_58d0_5, 0, 22736, 0, 1, 1 }, /* Scc */
+{ op_58d8_5, 0, 22744, 0, 1, 1 }, /* Scc */
+{ op_58e0_5, 0, 22752, 2, 1, 1 }, /* Scc */
+{ op_58e8_5, 0, 22760, 0, 2, 1 }, /* Scc */
+{ op_58f0_5, 0, 22768, 2, 2, 1 }, /* Scc */
+{ op_58f8_5, 0, 22776, 0, 2, 1 }, /* Scc */
+{ op_58f9_5, 0, 22777, 0, 3, 1 }, /* Scc */
+{ op_59c0_5, 0, 22976, 0, 1, 0 }, /* Scc */
+{ op_59c8_5, 0, 22984, 2, 2, 0 }, /* DBcc */
+{ op_59d0_5, 0, 22992, 0, 1, 1 }, /* Scc */
+{ op_59d8_5, 0, 23000, 0, 1, 1 }, /* Scc */
+{ op_59e0_5, 0, 23008, 2, 1, 1 }, /* Scc */
+{ op_59e8_5, 0, 23016, 0, 2, 1 }, /* Scc */
+{ op_59f0_5, 0, 23024, 2, 2, 1 }, /* Scc */
+{ op_59f8_5, 0, 23032, 0, 2, 1 }, /* Scc */
+{ op_59f9_5, 0, 23033, 0, 3, 1 }, /* Scc */
+{ op_5ac0_5, 0, 23232, 0, 1, 0 }, /* Scc */
+{ op_5ac8_5, 0, 23240, 2, 2, 0 }, /* DBcc */
+{ op_5ad0_5, 0, 23248, 0, 1, 1 }, /* Scc */
+{ op_5ad8_5, 0, 23256, 0, 1, 1 }, /* Scc */
+{ op_5ae0_5, 0, 23264, 2, 1, 1 }, /* Scc */
+{ op_5ae8_5, 0, 23272, 0, 2, 1 }, /* Scc */
+{ op_5af0_5, 0, 23280, 2, 2, 1 }, /* Scc */
+{ op_5af8_5, 0, 23288, 0, 2, 1 }, /* Scc */
+{ op_5af9_5, 0, 23289, 0, 3, 1 }, /* Scc */
+{ op_5bc0_5, 0, 23488, 0, 1, 0 }, /* Scc */
+{ op_5bc8_5, 0, 23496, 2, 2, 0 }, /* DBcc */
+{ op_5bd0_5, 0, 23504, 0, 1, 1 }, /* Scc */
+{ op_5bd8_5, 0, 23512, 0, 1, 1 }, /* Scc */
+{ op_5be0_5, 0, 23520, 2, 1, 1 }, /* Scc */
+{ op_5be8_5, 0, 23528, 0, 2, 1 }, /* Scc */
+{ op_5bf0_5, 0, 23536, 2, 2, 1 }, /* Scc */
+{ op_5bf8_5, 0, 23544, 0, 2, 1 }, /* Scc */
+{ op_5bf9_5, 0, 23545, 0, 3, 1 }, /* Scc */
+{ op_5cc0_5, 0, 23744, 0, 1, 0 }, /* Scc */
+{ op_5cc8_5, 0, 23752, 2, 2, 0 }, /* DBcc */
+{ op_5cd0_5, 0, 23760, 0, 1, 1 }, /* Scc */
+{ op_5cd8_5, 0, 23768, 0, 1, 1 }, /* Scc */
+{ op_5ce0_5, 0, 23776, 2, 1, 1 }, /* Scc */
+{ op_5ce8_5, 0, 23784, 0, 2, 1 }, /* Scc */
+{ op_5cf0_5, 0, 23792, 2, 2, 1 }, /* Scc */
+{ op_5cf8_5, 0, 23800, 0, 2, 1 }, /* Scc */
+{ op_5cf9_5, 0, 23801, 0, 3, 1 }, /* Scc */
+{ op_5dc0_5, 0, 24000, 0, 1, 0 }, /* Scc */
+{ op_5dc8_5, 0, 24008, 2, 2, 0 }, /* DBcc */
+{ op_5dd0_5, 0, 24016, 0, 1, 1 }, /* Scc */
+{ op_5dd8_5, 0, 24024, 0, 1, 1 }, /* Scc */
+{ op_5de0_5, 0, 24032, 2, 1, 1 }, /* Scc */
+{ op_5de8_5, 0, 24040, 0, 2, 1 }, /* Scc */
+{ op_5df0_5, 0, 24048, 2, 2, 1 }, /* Scc */
+{ op_5df8_5, 0, 24056, 0, 2, 1 }, /* Scc */
+{ op_5df9_5, 0, 24057, 0, 3, 1 }, /* Scc */
+{ op_5ec0_5, 0, 24256, 0, 1, 0 }, /* Scc */
+{ op_5ec8_5, 0, 24264, 2, 2, 0 }, /* DBcc */
+{ op_5ed0_5, 0, 24272, 0, 1, 1 }, /* Scc */
+{ op_5ed8_5, 0, 24280, 0, 1, 1 }, /* Scc */
+{ op_5ee0_5, 0, 24288, 2, 1, 1 }, /* Scc */
+{ op_5ee8_5, 0, 24296, 0, 2, 1 }, /* Scc */
+{ op_5ef0_5, 0, 24304, 2, 2, 1 }, /* Scc */
+{ op_5ef8_5, 0, 24312, 0, 2, 1 }, /* Scc */
+{ op_5ef9_5, 0, 24313, 0, 3, 1 }, /* Scc */
+{ op_5fc0_5, 0, 24512, 0, 1, 0 }, /* Scc */
+{ op_5fc8_5, 0, 24520, 2, 2, 0 }, /* DBcc */
+{ op_5fd0_5, 0, 24528, 0, 1, 1 }, /* Scc */
+{ op_5fd8_5, 0, 24536, 0, 1, 1 }, /* Scc */
+{ op_5fe0_5, 0, 24544, 2, 1, 1 }, /* Scc */
+{ op_5fe8_5, 0, 24552, 0, 2, 1 }, /* Scc */
+{ op_5ff0_5, 0, 24560, 2, 2, 1 }, /* Scc */
+{ op_5ff8_5, 0, 24568, 0, 2, 1 }, /* Scc */
+{ op_5ff9_5, 0, 24569, 0, 3, 1 }, /* Scc */
+{ op_6000_5, 0, 24576, 2, 255, 0 }, /* Bcc */
+{ op_6001_5, 0, 24577, 2, 255, 0 }, /* Bcc */
+{ op_60ff_5, 0, 24831, 2, 255, 0 }, /* Bcc */
+{ op_6100_5, 0, 24832, 2, 2, 2 }, /* BSR */
+{ op_6101_5, 0, 24833, 2, 2, 2 }, /* BSR */
+{ op_61ff_5, 0, 25087, 2, 2, 2 }, /* BSR */
+{ op_6200_5, 0, 25088, 2, 255, 0 }, /* Bcc */
+{ op_6201_5, 0, 25089, 2, 255, 0 }, /* Bcc */
+{ op_62ff_5, 0, 25343, 2, 255, 0 }, /* Bcc */
+{ op_6300_5, 0, 25344, 2, 255, 0 }, /* Bcc */
+{ op_6301_5, 0, 25345, 2, 255, 0 }, /* Bcc */
+{ op_63ff_5, 0, 25599, 2, 255, 0 }, /* Bcc */
+{ op_6400_5, 0, 25600, 2, 255, 0 }, /* Bcc */
+{ op_6401_5, 0, 25601, 2, 255, 0 }, /* Bcc */
+{ op_64ff_5, 0, 25855, 2, 255, 0 }, /* Bcc */
+{ op_6500_5, 0, 25856, 2, 255, 0 }, /* Bcc */
+{ op_6501_5, 0, 25857, 2, 255, 0 }, /* Bcc */
+{ op_65ff_5, 0, 26111, 2, 255, 0 }, /* Bcc */
+{ op_6600_5, 0, 26112, 2, 255, 0 }, /* Bcc */
+{ op_6601_5, 0, 26113, 2, 255, 0 }, /* Bcc */
+{ op_66ff_5, 0, 26367, 2, 255, 0 }, /* Bcc */
+{ op_6700_5, 0, 26368, 2, 255, 0 }, /* Bcc */
+{ op_6701_5, 0, 26369, 2, 255, 0 }, /* Bcc */
+{ op_67ff_5, 0, 26623, 2, 255, 0 }, /* Bcc */
+{ op_6800_5, 0, 26624, 2, 255, 0 }, /* Bcc */
+{ op_6801_5, 0, 26625, 2, 255, 0 }, /* Bcc */
+{ op_68ff_5, 0, 26879, 2, 255, 0 }, /* Bcc */
+{ op_6900_5, 0, 26880, 2, 255, 0 }, /* Bcc */
+{ op_6901_5, 0, 26881, 2, 255, 0 }, /* Bcc */
+{ op_69ff_5, 0, 27135, 2, 255, 0 }, /* Bcc */
+{ op_6a00_5, 0, 27136, 2, 255, 0 }, /* Bcc */
+{ op_6a01_5, 0, 27137, 2, 255, 0 }, /* Bcc */
+{ op_6aff_5, 0, 27391, 2, 255, 0 }, /* Bcc */
+{ op_6b00_5, 0, 27392, 2, 255, 0 }, /* Bcc */
+{ op_6b01_5, 0, 27393, 2, 255, 0 }, /* Bcc */
+{ op_6bff_5, 0, 27647, 2, 255, 0 }, /* Bcc */
+{ op_6c00_5, 0, 27648, 2, 255, 0 }, /* Bcc */
+{ op_6c01_5, 0, 27649, 2, 255, 0 }, /* Bcc */
+{ op_6cff_5, 0, 27903, 2, 255, 0 }, /* Bcc */
+{ op_6d00_5, 0, 27904, 2, 255, 0 }, /* Bcc */
+{ op_6d01_5, 0, 27905, 2, 255, 0 }, /* Bcc */
+{ op_6dff_5, 0, 28159, 2, 255, 0 }, /* Bcc */
+{ op_6e00_5, 0, 28160, 2, 255, 0 }, /* Bcc */
+{ op_6e01_5, 0, 28161, 2, 255, 0 }, /* Bcc */
+{ op_6eff_5, 0, 28415, 2, 255, 0 }, /* Bcc */
+{ op_6f00_5, 0, 28416, 2, 255, 0 }, /* Bcc */
+{ op_6f01_5, 0, 28417, 2, 255, 0 }, /* Bcc */
+{ op_6fff_5, 0, 28671, 2, 255, 0 }, /* Bcc */
+{ op_7000_5, 0, 28672, 0, 1, 0 }, /* MOVE */
+{ op_8000_5, 0, 32768, 0, 1, 0 }, /* OR */
+{ op_8010_5, 0, 32784, 0, 2, 0 }, /* OR */
+{ op_8018_5, 0, 32792, 0, 2, 0 }, /* OR */
+{ op_8020_5, 0, 32800, 2, 2, 0 }, /* OR */
+{ op_8028_5, 0, 32808, 0, 3, 0 }, /* OR */
+{ op_8030_5, 0, 32816, 2, 3, 0 }, /* OR */
+{ op_8038_5, 0, 32824, 0, 3, 0 }, /* OR */
+{ op_8039_5, 0, 32825, 0, 4, 0 }, /* OR */
+{ op_803a_5, 0, 32826, 0, 3, 0 }, /* OR */
+{ op_803b_5, 0, 32827, 2, 3, 0 }, /* OR */
+{ op_803c_5, 0, 32828, 0, 2, 0 }, /* OR */
+{ op_8040_5, 0, 32832, 0, 1, 0 }, /* OR */
+{ op_8050_5, 0, 32848, 0, 2, 0 }, /* OR */
+{ op_8058_5, 0, 32856, 0, 2, 0 }, /* OR */
+{ op_8060_5, 0, 32864, 2, 2, 0 }, /* OR */
+{ op_8068_5, 0, 32872, 0, 3, 0 }, /* OR */
+{ op_8070_5, 0, 32880, 2, 3, 0 }, /* OR */
+{ op_8078_5, 0, 32888, 0, 3, 0 }, /* OR */
+{ op_8079_5, 0, 32889, 0, 4, 0 }, /* OR */
+{ op_807a_5, 0, 32890, 0, 3, 0 }, /* OR */
+{ op_807b_5, 0, 32891, 2, 3, 0 }, /* OR */
+{ op_807c_5, 0, 32892, 0, 2, 0 }, /* OR */
+{ op_8080_5, 0, 32896, 2, 1, 0 }, /* OR */
+{ op_8090_5, 0, 32912, 2, 3, 0 }, /* OR */
+{ op_8098_5, 0, 32920, 2, 3, 0 }, /* OR */
+{ op_80a0_5, 0, 32928, 4, 3, 0 }, /* OR */
+{ op_80a8_5, 0, 32936, 2, 4, 0 }, /* OR */
+{ op_80b0_5, 0, 32944, 4, 4, 0 }, /* OR */
+{ op_80b8_5, 0, 32952, 2, 4, 0 }, /* OR */
+{ op_80b9_5, 0, 32953, 2, 5, 0 }, /* OR */
+{ op_80ba_5, 0, 32954, 2, 4, 0 }, /* OR */
+{ op_80bb_5, 0, 32955, 4, 4, 0 }, /* OR */
+{ op_80bc_5, 0, 32956, 2, 3, 0 }, /* OR */
+{ op_80c0_5, 0, 32960, 136, 1, 0 }, /* DIVU */
+{ op_80d0_5, 0, 32976, 136, 2, 0 }, /* DIVU */
+{ op_80d8_5, 0, 32984, 136, 2, 0 }, /* DIVU */
+{ op_80e0_5, 0, 32992, 138, 2, 0 }, /* DIVU */
+{ op_80e8_5, 0, 33000, 136, 3, 0 }, /* DIVU */
+{ op_80f0_5, 0, 33008, 138, 3, 0 }, /* DIVU */
+{ op_80f8_5, 0, 33016, 136, 3, 0 }, /* DIVU */
+{ op_80f9_5, 0, 33017, 136, 4, 0 }, /* DIVU */
+{ op_80fa_5, 0, 33018, 136, 3, 0 }, /* DIVU */
+{ op_80fb_5, 0, 33019, 138, 3, 0 }, /* DIVU */
+{ op_80fc_5, 0, 33020, 136, 2, 0 }, /* DIVU */
+{ op_8100_5, 0, 33024, 2, 1, 0 }, /* SBCD */
+{ op_8108_5, 0, 33032, 2, 3, 1 }, /* SBCD */
+{ op_8110_5, 0, 33040, 0, 2, 1 }, /* OR */
+{ op_8118_5, 0, 33048, 0, 2, 1 }, /* OR */
+{ op_8120_5, 0, 33056, 2, 2, 1 }, /* OR */
+{ op_8128_5, 0, 33064, 0, 3, 1 }, /* OR */
+{ op_8130_5, 0, 33072, 2, 3, 1 }, /* OR */
+{ op_8138_5, 0, 33080, 0, 3, 1 }, /* OR */
+{ op_8139_5, 0, 33081, 0, 4, 1 }, /* OR */
+{ op_8150_5, 0, 33104, 0, 2, 1 }, /* OR */
+{ op_8158_5, 0, 33112, 0, 2, 1 }, /* OR */
+{ op_8160_5, 0, 33120, 2, 2, 1 }, /* OR */
+{ op_8168_5, 0, 33128, 0, 3, 1 }, /* OR */
+{ op_8170_5, 0, 33136, 2, 3, 1 }, /* OR */
+{ op_8178_5, 0, 33144, 0, 3, 1 }, /* OR */
+{ op_8179_5, 0, 33145, 0, 4, 1 }, /* OR */
+{ op_8190_5, 0, 33168, 0, 3, 2 }, /* OR */
+{ op_8198_5, 0, 33176, 0, 3, 2 }, /* OR */
+{ op_81a0_5, 0, 33184, 2, 3, 2 }, /* OR */
+{ op_81a8_5, 0, 33192, 0, 4, 2 }, /* OR */
+{ op_81b0_5, 0, 33200, 2, 4, 2 }, /* OR */
+{ op_81b8_5, 0, 33208, 0, 4, 2 }, /* OR */
+{ op_81b9_5, 0, 33209, 0, 5, 2 }, /* OR */
+{ op_81c0_5, 0, 33216, 154, 1, 0 }, /* DIVS */
+{ op_81d0_5, 0, 33232, 154, 2, 0 }, /* DIVS */
+{ op_81d8_5, 0, 33240, 154, 2, 0 }, /* DIVS */
+{ op_81e0_5, 0, 33248, 156, 2, 0 }, /* DIVS */
+{ op_81e8_5, 0, 33256, 154, 3, 0 }, /* DIVS */
+{ op_81f0_5, 0, 33264, 156, 3, 0 }, /* DIVS */
+{ op_81f8_5, 0, 33272, 154, 3, 0 }, /* DIVS */
+{ op_81f9_5, 0, 33273, 154, 4, 0 }, /* DIVS */
+{ op_81fa_5, 0, 33274, 154, 3, 0 }, /* DIVS */
+{ op_81fb_5, 0, 33275, 156, 3, 0 }, /* DIVS */
+{ op_81fc_5, 0, 33276, 154, 2, 0 }, /* DIVS */
+{ op_9000_5, 0, 36864, 0, 1, 0 }, /* SUB */
+{ op_9010_5, 0, 36880, 0, 2, 0 }, /* SUB */
+{ op_9018_5, 0, 36888, 0, 2, 0 }, /* SUB */
+{ op_9020_5, 0, 36896, 2, 2, 0 }, /* SUB */
+{ op_9028_5, 0, 36904, 0, 3, 0 }, /* SUB */
+{ op_9030_5, 0, 36912, 2, 3, 0 }, /* SUB */
+{ op_9038_5, 0, 36920, 0, 3, 0 }, /* SUB */
+{ op_9039_5, 0, 36921, 0, 4, 0 }, /* SUB */
+{ op_903a_5, 0, 36922, 0, 3, 0 }, /* SUB */
+{ op_903b_5, 0, 36923, 2, 3, 0 }, /* SUB */
+{ op_903c_5, 0, 36924, 0, 2, 0 }, /* SUB */
+{ op_9040_5, 0, 36928, 0, 1, 0 }, /* SUB */
+{ op_9048_5, 0, 36936, 0, 1, 0 }, /* SUB */
+{ op_9050_5, 0, 36944, 0, 2, 0 }, /* SUB */
+{ op_9058_5, 0, 36952, 0, 2, 0 }, /* SUB */
+{ op_9060_5, 0, 36960, 2, 2, 0 }, /* SUB */
+{ op_9068_5, 0, 36968, 0, 3, 0 }, /* SUB */
+{ op_9070_5, 0, 36976, 2, 3, 0 }, /* SUB */
+{ op_9078_5, 0, 36984, 0, 3, 0 }, /* SUB */
+{ op_9079_5, 0, 36985, 0, 4, 0 }, /* SUB */
+{ op_907a_5, 0, 36986, 0, 3, 0 }, /* SUB */
+{ op_907b_5, 0, 36987, 2, 3, 0 }, /* SUB */
+{ op_907c_5, 0, 36988, 0, 2, 0 }, /* SUB */
+{ op_9080_5, 0, 36992, 4, 1, 0 }, /* SUB */
+{ op_9088_5, 0, 37000, 4, 1, 0 }, /* SUB */
+{ op_9090_5, 0, 37008, 2, 3, 0 }, /* SUB */
+{ op_9098_5, 0, 37016, 2, 3, 0 }, /* SUB */
+{ op_90a0_5, 0, 37024, 4, 3, 0 }, /* SUB */
+{ op_90a8_5, 0, 37032, 2, 4, 0 }, /* SUB */
+{ op_90b0_5, 0, 37040, 4, 4, 0 }, /* SUB */
+{ op_90b8_5, 0, 37048, 2, 4, 0 }, /* SUB */
+{ op_90b9_5, 0, 37049, 2, 5, 0 }, /* SUB */
+{ op_90ba_5, 0, 37050, 2, 4, 0 }, /* SUB */
+{ op_90bb_5, 0, 37051, 4, 4, 0 }, /* SUB */
+{ op_90bc_5, 0, 37052, 4, 3, 0 }, /* SUB */
+{ op_90c0_5, 0, 37056, 4, 1, 0 }, /* SUBA */
+{ op_90c8_5, 0, 37064, 4, 1, 0 }, /* SUBA */
+{ op_90d0_5, 0, 37072, 4, 2, 0 }, /* SUBA */
+{ op_90d8_5, 0, 37080, 4, 2, 0 }, /* SUBA */
+{ op_90e0_5, 0, 37088, 6, 2, 0 }, /* SUBA */
+{ op_90e8_5, 0, 37096, 4, 3, 0 }, /* SUBA */
+{ op_90f0_5, 0, 37104, 6, 3, 0 }, /* SUBA */
+{ op_90f8_5, 0, 37112, 4, 3, 0 }, /* SUBA */
+{ op_90f9_5, 0, 37113, 4, 4, 0 }, /* SUBA */
+{ op_90fa_5, 0, 37114, 4, 3, 0 }, /* SUBA */
+{ op_90fb_5, 0, 37115, 6, 3, 0 }, /* SUBA */
+{ op_90fc_5, 0, 37116, 4, 2, 0 }, /* SUBA */
+{ op_9100_5, 0, 37120, 0, 1, 0 }, /* SUBX */
+{ op_9108_5, 0, 37128, 2, 3, 1 }, /* SUBX */
+{ op_9110_5, 0, 37136, 0, 2, 1 }, /* SUB */
+{ op_9118_5, 0, 37144, 0, 2, 1 }, /* SUB */
+{ op_9120_5, 0, 37152, 2, 2, 1 }, /* SUB */
+{ op_9128_5, 0, 37160, 0, 3, 1 }, /* SUB */
+{ op_9130_5, 0, 37168, 2, 3, 1 }, /* SUB */
+{ op_9138_5, 0, 37176, 0, 3, 1 }, /* SUB */
+{ op_9139_5, 0, 37177, 0, 4, 1 }, /* SUB */
+{ op_9140_5, 0, 37184, 0, 1, 0 }, /* SUBX */
+{ op_9148_5, 0, 37192, 2, 3, 1 }, /* SUBX */
+{ op_9150_5, 0, 37200, 0, 2, 1 }, /* SUB */
+{ op_9158_5, 0, 37208, 0, 2, 1 }, /* SUB */
+{ op_9160_5, 0, 37216, 2, 2, 1 }, /* SUB */
+{ op_9168_5, 0, 37224, 0, 3, 1 }, /* SUB */
+{ op_9170_5, 0, 37232, 2, 3, 1 }, /* SUB */
+{ op_9178_5, 0, 37240, 0, 3, 1 }, /* SUB */
+{ op_9179_5, 0, 37241, 0, 4, 1 }, /* SUB */
+{ op_9180_5, 0, 37248, 4, 1, 0 }, /* SUBX */
+{ op_9188_5, 0, 37256, 2, 5, 2 }, /* SUBX */
+{ op_9190_5, 0, 37264, 0, 3, 2 }, /* SUB */
+{ op_9198_5, 0, 37272, 0, 3, 2 }, /* SUB */
+{ op_91a0_5, 0, 37280, 2, 3, 2 }, /* SUB */
+{ op_91a8_5, 0, 37288, 0, 4, 2 }, /* SUB */
+{ op_91b0_5, 0, 37296, 2, 4, 2 }, /* SUB */
+{ op_91b8_5, 0, 37304, 0, 4, 2 }, /* SUB */
+{ op_91b9_5, 0, 37305, 0, 5, 2 }, /* SUB */
+{ op_91c0_5, 0, 37312, 4, 1, 0 }, /* SUBA */
+{ op_91c8_5, 0, 37320, 4, 1, 0 }, /* SUBA */
+{ op_91d0_5, 0, 37328, 2, 3, 0 }, /* SUBA */
+{ op_91d8_5, 0, 37336, 2, 3, 0 }, /* SUBA */
+{ op_91e0_5, 0, 37344, 4, 3, 0 }, /* SUBA */
+{ op_91e8_5, 0, 37352, 2, 4, 0 }, /* SUBA */
+{ op_91f0_5, 0, 37360, 4, 4, 0 }, /* SUBA */
+{ op_91f8_5, 0, 37368, 2, 4, 0 }, /* SUBA */
+{ op_91f9_5, 0, 37369, 2, 5, 0 }, /* SUBA */
+{ op_91fa_5, 0, 37370, 2, 4, 0 }, /* SUBA */
+{ op_91fb_5, 0, 37371, 4, 4, 0 }, /* SUBA */
+{ op_91fc_5, 0, 37372, 4, 3, 0 }, /* SUBA */
+{ op_b000_5, 0, 45056, 0, 1, 0 }, /* CMP */
+{ op_b010_5, 0, 45072, 0, 2, 0 }, /* CMP */
+{ op_b018_5, 0, 45080, 0, 2, 0 }, /* CMP */
+{ op_b020_5, 0, 45088, 2, 2, 0 }, /* CMP */
+{ op_b028_5, 0, 45096, 0, 3, 0 }, /* CMP */
+{ op_b030_5, 0, 45104, 2, 3, 0 }, /* CMP */
+{ op_b038_5, 0, 45112, 0, 3, 0 }, /* CMP */
+{ op_b039_5, 0, 45113, 0, 4, 0 }, /* CMP */
+{ op_b03a_5, 0, 45114, 0, 3, 0 }, /* CMP */
+{ op_b03b_5, 0, 45115, 2, 3, 0 }, /* CMP */
+{ op_b03c_5, 0, 45116, 0, 2, 0 }, /* CMP */
+{ op_b040_5, 0, 45120, 0, 1, 0 }, /* CMP */
+{ op_b048_5, 0, 45128, 0, 1, 0 }, /* CMP */
+{ op_b050_5, 0, 45136, 0, 2, 0 }, /* CMP */
+{ op_b058_5, 0, 45144, 0, 2, 0 }, /* CMP */
+{ op_b060_5, 0, 45152, 2, 2, 0 }, /* CMP */
+{ op_b068_5, 0, 45160, 0, 3, 0 }, /* CMP */
+{ op_b070_5, 0, 45168, 2, 3, 0 }, /* CMP */
+{ op_b078_5, 0, 45176, 0, 3, 0 }, /* CMP */
+{ op_b079_5, 0, 45177, 0, 4, 0 }, /* CMP */
+{ op_b07a_5, 0, 45178, 0, 3, 0 }, /* CMP */
+{ op_b07b_5, 0, 45179, 2, 3, 0 }, /* CMP */
+{ op_b07c_5, 0, 45180, 0, 2, 0 }, /* CMP */
+{ op_b080_5, 0, 45184, 2, 1, 0 }, /* CMP */
+{ op_b088_5, 0, 45192, 2, 1, 0 }, /* CMP */
+{ op_b090_5, 0, 45200, 2, 3, 0 }, /* CMP */
+{ op_b098_5, 0, 45208, 2, 3, 0 }, /* CMP */
+{ op_b0a0_5, 0, 45216, 4, 3, 0 }, /* CMP */
+{ op_b0a8_5, 0, 45224, 2, 4, 0 }, /* CMP */
+{ op_b0b0_5, 0, 45232, 4, 4, 0 }, /* CMP */
+{ op_b0b8_5, 0, 45240, 2, 4, 0 }, /* CMP */
+{ op_b0b9_5, 0, 45241, 2, 5, 0 }, /* CMP */
+{ op_b0ba_5, 0, 45242, 2, 4, 0 }, /* CMP */
+{ op_b0bb_5, 0, 45243, 4, 4, 0 }, /* CMP */
+{ op_b0bc_5, 0, 45244, 2, 3, 0 }, /* CMP */
+{ op_b0c0_5, 0, 45248, 2, 1, 0 }, /* CMPA */
+{ op_b0c8_5, 0, 45256, 2, 1, 0 }, /* CMPA */
+{ op_b0d0_5, 0, 45264, 2, 2, 0 }, /* CMPA */
+{ op_b0d8_5, 0, 45272, 2, 2, 0 }, /* CMPA */
+{ op_b0e0_5, 0, 45280, 4, 2, 0 }, /* CMPA */
+{ op_b0e8_5, 0, 45288, 2, 3, 0 }, /* CMPA */
+{ op_b0f0_5, 0, 45296, 4, 3, 0 }, /* CMPA */
+{ op_b0f8_5, 0, 45304, 2, 3, 0 }, /* CMPA */
+{ op_b0f9_5, 0, 45305, 2, 4, 0 }, /* CMPA */
+{ op_b0fa_5, 0, 45306, 2, 3, 0 }, /* CMPA */
+{ op_b0fb_5, 0, 45307, 4, 3, 0 }, /* CMPA */
+{ op_b0fc_5, 0, 45308, 2, 2, 0 }, /* CMPA */
+{ op_b100_5, 0, 45312, 0, 1, 0 }, /* EOR */
+{ op_b108_5, 0, 45320, 0, 3, 0 }, /* CMPM */
+{ op_b110_5, 0, 45328, 0, 2, 1 }, /* EOR */
+{ op_b118_5, 0, 45336, 0, 2, 1 }, /* EOR */
+{ op_b120_5, 0, 45344, 2, 2, 1 }, /* EOR */
+{ op_b128_5, 0, 45352, 0, 3, 1 }, /* EOR */
+{ op_b130_5, 0, 45360, 2, 3, 1 }, /* EOR */
+{ op_b138_5, 0, 45368, 0, 3, 1 }, /* EOR */
+{ op_b139_5, 0, 45369, 0, 4, 1 }, /* EOR */
+{ op_b140_5, 0, 45376, 0, 1, 0 }, /* EOR */
+{ op_b148_5, 0, 45384, 0, 3, 0 }, /* CMPM */
+{ op_b150_5, 0, 45392, 0, 2, 1 }, /* EOR */
+{ op_b158_5, 0, 45400, 0, 2, 1 }, /* EOR */
+{ op_b160_5, 0, 45408, 2, 2, 1 }, /* EOR */
+{ op_b168_5, 0, 45416, 0, 3, 1 }, /* EOR */
+{ op_b170_5, 0, 45424, 2, 3, 1 }, /* EOR */
+{ op_b178_5, 0, 45432, 0, 3, 1 }, /* EOR */
+{ op_b179_5, 0, 45433, 0, 4, 1 }, /* EOR */
+{ op_b180_5, 0, 45440, 4, 1, 0 }, /* EOR */
+{ op_b188_5, 0, 45448, 0, 5, 0 }, /* CMPM */
+{ op_b190_5, 0, 45456, 0, 3, 2 }, /* EOR */
+{ op_b198_5, 0, 45464, 0, 3, 2 }, /* EOR */
+{ op_b1a0_5, 0, 45472, 2, 3, 2 }, /* EOR */
+{ op_b1a8_5, 0, 45480, 0, 4, 2 }, /* EOR */
+{ op_b1b0_5, 0, 45488, 2, 4, 2 }, /* EOR */
+{ op_b1b8_5, 0, 45496, 0, 4, 2 }, /* EOR */
+{ op_b1b9_5, 0, 45497, 0, 5, 2 }, /* EOR */
+{ op_b1c0_5, 0, 45504, 2, 1, 0 }, /* CMPA */
+{ op_b1c8_5, 0, 45512, 2, 1, 0 }, /* CMPA */
+{ op_b1d0_5, 0, 45520, 2, 3, 0 }, /* CMPA */
+{ op_b1d8_5, 0, 45528, 2, 3, 0 }, /* CMPA */
+{ op_b1e0_5, 0, 45536, 4, 3, 0 }, /* CMPA */
+{ op_b1e8_5, 0, 45544, 2, 4, 0 }, /* CMPA */
+{ op_b1f0_5, 0, 45552, 4, 4, 0 }, /* CMPA */
+{ op_b1f8_5, 0, 45560, 2, 4, 0 }, /* CMPA */
+{ op_b1f9_5, 0, 45561, 2, 5, 0 }, /* CMPA */
+{ op_b1fa_5, 0, 45562, 2, 4, 0 }, /* CMPA */
+{ op_b1fb_5, 0, 45563, 4, 4, 0 }, /* CMPA */
+{ op_b1fc_5, 0, 45564, 2, 3, 0 }, /* CMPA */
+{ op_c000_5, 0, 49152, 0, 1, 0 }, /* AND */
+{ op_c010_5, 0, 49168, 0, 2, 0 }, /* AND */
+{ op_c018_5, 0, 49176, 0, 2, 0 }, /* AND */
+{ op_c020_5, 0, 49184, 2, 2, 0 }, /* AND */
+{ op_c028_5, 0, 49192, 0, 3, 0 }, /* AND */
+{ op_c030_5, 0, 49200, 2, 3, 0 }, /* AND */
+{ op_c038_5, 0, 49208, 0, 3, 0 }, /* AND */
+{ op_c039_5, 0, 49209, 0, 4, 0 }, /* AND */
+{ op_c03a_5, 0, 49210, 0, 3, 0 }, /* AND */
+{ op_c03b_5, 0, 49211, 2, 3, 0 }, /* AND */
+{ op_c03c_5, 0, 49212, 0, 2, 0 }, /* AND */
+{ op_c040_5, 0, 49216, 0, 1, 0 }, /* AND */
+{ op_c050_5, 0, 49232, 0, 2, 0 }, /* AND */
+{ op_c058_5, 0, 49240, 0, 2, 0 }, /* AND */
+{ op_c060_5, 0, 49248, 2, 2, 0 }, /* AND */
+{ op_c068_5, 0, 49256, 0, 3, 0 }, /* AND */
+{ op_c070_5, 0, 49264, 2, 3, 0 }, /* AND */
+{ op_c078_5, 0, 49272, 0, 3, 0 }, /* AND */
+{ op_c079_5, 0, 49273, 0, 4, 0 }, /* AND */
+{ op_c07a_5, 0, 49274, 0, 3, 0 }, /* AND */
+{ op_c07b_5, 0, 49275, 2, 3, 0 }, /* AND */
+{ op_c07c_5, 0, 49276, 0, 2, 0 }, /* AND */
+{ op_c080_5, 0, 49280, 2, 1, 0 }, /* AND */
+{ op_c090_5, 0, 49296, 2, 3, 0 }, /* AND */
+{ op_c098_5, 0, 49304, 2, 3, 0 }, /* AND */
+{ op_c0a0_5, 0, 49312, 4, 3, 0 }, /* AND */
+{ op_c0a8_5, 0, 49320, 2, 4, 0 }, /* AND */
+{ op_c0b0_5, 0, 49328, 4, 4, 0 }, /* AND */
+{ op_c0b8_5, 0, 49336, 2, 4, 0 }, /* AND */
+{ op_c0b9_5, 0, 49337, 2, 5, 0 }, /* AND */
+{ op_c0ba_5, 0, 49338, 2, 4, 0 }, /* AND */
+{ op_c0bb_5, 0, 49339, 4, 4, 0 }, /* AND */
+{ op_c0bc_5, 0, 49340, 2, 3, 0 }, /* AND */
+{ op_c0c0_5, 0, 49344, 66, 1, 0 }, /* MULU */
+{ op_c0d0_5, 0, 49360, 66, 2, 0 }, /* MULU */
+{ op_c0d8_5, 0, 49368, 66, 2, 0 }, /* MULU */
+{ op_c0e0_5, 0, 49376, 68, 2, 0 }, /* MULU */
+{ op_c0e8_5, 0, 49384, 66, 3, 0 }, /* MULU */
+{ op_c0f0_5, 0, 49392, 68, 3, 0 }, /* MULU */
+{ op_c0f8_5, 0, 49400, 66, 3, 0 }, /* MULU */
+{ op_c0f9_5, 0, 49401, 66, 4, 0 }, /* MULU */
+{ op_c0fa_5, 0, 49402, 66, 3, 0 }, /* MULU */
+{ op_c0fb_5, 0, 49403, 68, 3, 0 }, /* MULU */
+{ op_c0fc_5, 0, 49404, 66, 2, 0 }, /* MULU */
+{ op_c100_5, 0, 49408, 2, 1, 0 }, /* ABCD */
+{ op_c108_5, 0, 49416, 2, 3, 1 }, /* ABCD */
+{ op_c110_5, 0, 49424, 0, 2, 1 }, /* AND */
+{ op_c118_5, 0, 49432, 0, 2, 1 }, /* AND */
+{ op_c120_5, 0, 49440, 2, 2, 1 }, /* AND */
+{ op_c128_5, 0, 49448, 0, 3, 1 }, /* AND */
+{ op_c130_5, 0, 49456, 2, 3, 1 }, /* AND */
+{ op_c138_5, 0, 49464, 0, 3, 1 }, /* AND */
+{ op_c139_5, 0, 49465, 0, 4, 1 }, /* AND */
+{ op_c140_5, 0, 49472, 2, 1, 0 }, /* EXG */
+{ op_c148_5, 0, 49480, 2, 1, 0 }, /* EXG */
+{ op_c150_5, 0, 49488, 0, 2, 1 }, /* AND */
+{ op_c158_5, 0, 49496, 0, 2, 1 }, /* AND */
+{ op_c160_5, 0, 49504, 2, 2, 1 }, /* AND */
+{ op_c168_5, 0, 49512, 0, 3, 1 }, /* AND */
+{ op_c170_5, 0, 49520, 2, 3, 1 }, /* AND */
+{ op_c178_5, 0, 49528, 0, 3, 1 }, /* AND */
+{ op_c179_5, 0, 49529, 0, 4, 1 }, /* AND */
+{ op_c188_5, 0, 49544, 2, 1, 0 }, /* EXG */
+{ op_c190_5, 0, 49552, 0, 3, 2 }, /* AND */
+{ op_c198_5, 0, 49560, 0, 3, 2 }, /* AND */
+{ op_c1a0_5, 0, 49568, 2, 3, 2 }, /* AND */
+{ op_c1a8_5, 0, 49576, 0, 4, 2 }, /* AND */
+{ op_c1b0_5, 0, 49584, 2, 4, 2 }, /* AND */
+{ op_c1b8_5, 0, 49592, 0, 4, 2 }, /* AND */
+{ op_c1b9_5, 0, 49593, 0, 5, 2 }, /* AND */
+{ op_c1c0_5, 0, 49600, 66, 1, 0 }, /* MULS */
+{ op_c1d0_5, 0, 49616, 66, 2, 0 }, /* MULS */
+{ op_c1d8_5, 0, 49624, 66, 2, 0 }, /* MULS */
+{ op_c1e0_5, 0, 49632, 68, 2, 0 }, /* MULS */
+{ op_c1e8_5, 0, 49640, 66, 3, 0 }, /* MULS */
+{ op_c1f0_5, 0, 49648, 68, 3, 0 }, /* MULS */
+{ op_c1f8_5, 0, 49656, 66, 3, 0 }, /* MULS */
+{ op_c1f9_5, 0, 49657, 66, 4, 0 }, /* MULS */
+{ op_c1fa_5, 0, 49658, 66, 3, 0 }, /* MULS */
+{ op_c1fb_5, 0, 49659, 68, 3, 0 }, /* MULS */
+{ op_c1fc_5, 0, 49660, 66, 2, 0 }, /* MULS */
+{ op_d000_5, 0, 53248, 0, 1, 0 }, /* ADD */
+{ op_d010_5, 0, 53264, 0, 2, 0 }, /* ADD */
+{ op_d018_5, 0, 53272, 0, 2, 0 }, /* ADD */
+{ op_d020_5, 0, 53280, 2, 2, 0 }, /* ADD */
+{ op_d028_5, 0, 53288, 0, 3, 0 }, /* ADD */
+{ op_d030_5, 0, 53296, 2, 3, 0 }, /* ADD */
+{ op_d038_5, 0, 53304, 0, 3, 0 }, /* ADD */
+{ op_d039_5, 0, 53305, 0, 4, 0 }, /* ADD */
+{ op_d03a_5, 0, 53306, 0, 3, 0 }, /* ADD */
+{ op_d03b_5, 0, 53307, 2, 3, 0 }, /* ADD */
+{ op_d03c_5, 0, 53308, 0, 2, 0 }, /* ADD */
+{ op_d040_5, 0, 53312, 0, 1, 0 }, /* ADD */
+{ op_d048_5, 0, 53320, 0, 1, 0 }, /* ADD */
+{ op_d050_5, 0, 53328, 0, 2, 0 }, /* ADD */
+{ op_d058_5, 0, 53336, 0, 2, 0 }, /* ADD */
+{ op_d060_5, 0, 53344, 2, 2, 0 }, /* ADD */
+{ op_d068_5, 0, 53352, 0, 3, 0 }, /* ADD */
+{ op_d070_5, 0, 53360, 2, 3, 0 }, /* ADD */
+{ op_d078_5, 0, 53368, 0, 3, 0 }, /* ADD */
+{ op_d079_5, 0, 53369, 0, 4, 0 }, /* ADD */
+{ op_d07a_5, 0, 53370, 0, 3, 0 }, /* ADD */
+{ op_d07b_5, 0, 53371, 2, 3, 0 }, /* ADD */
+{ op_d07c_5, 0, 53372, 0, 2, 0 }, /* ADD */
+{ op_d080_5, 0, 53376, 4, 1, 0 }, /* ADD */
+{ op_d088_5, 0, 53384, 4, 1, 0 }, /* ADD */
+{ op_d090_5, 0, 53392, 2, 3, 0 }, /* ADD */
+{ op_d098_5, 0, 53400, 2, 3, 0 }, /* ADD */
+{ op_d0a0_5, 0, 53408, 4, 3, 0 }, /* ADD */
+{ op_d0a8_5, 0, 53416, 2, 4, 0 }, /* ADD */
+{ op_d0b0_5, 0, 53424, 4, 4, 0 }, /* ADD */
+{ op_d0b8_5, 0, 53432, 2, 4, 0 }, /* ADD */
+{ op_d0b9_5, 0, 53433, 2, 5, 0 }, /* ADD */
+{ op_d0ba_5, 0, 53434, 2, 4, 0 }, /* ADD */
+{ op_d0bb_5, 0, 53435, 4, 4, 0 }, /* ADD */
+{ op_d0bc_5, 0, 53436, 4, 3, 0 }, /* ADD */
+{ op_d0c0_5, 0, 53440, 4, 1, 0 }, /* ADDA */
+{ op_d0c8_5, 0, 53448, 4, 1, 0 }, /* ADDA */
+{ op_d0d0_5, 0, 53456, 4, 2, 0 }, /* ADDA */
+{ op_d0d8_5, 0, 53464, 4, 2, 0 }, /* ADDA */
+{ op_d0e0_5, 0, 53472, 6, 2, 0 }, /* ADDA */
+{ op_d0e8_5, 0, 53480, 4, 3, 0 }, /* ADDA */
+{ op_d0f0_5, 0, 53488, 6, 3, 0 }, /* ADDA */
+{ op_d0f8_5, 0, 53496, 4, 3, 0 }, /* ADDA */
+{ op_d0f9_5, 0, 53497, 4, 4, 0 }, /* ADDA */
+{ op_d0fa_5, 0, 53498, 4, 3, 0 }, /* ADDA */
+{ op_d0fb_5, 0, 53499, 6, 3, 0 }, /* ADDA */
+{ op_d0fc_5, 0, 53500, 4, 2, 0 }, /* ADDA */
+{ op_d100_5, 0, 53504, 0, 1, 0 }, /* ADDX */
+{ op_d108_5, 0, 53512, 2, 3, 1 }, /* ADDX */
+{ op_d110_5, 0, 53520, 0, 2, 1 }, /* ADD */
+{ op_d118_5, 0, 53528, 0, 2, 1 }, /* ADD */
+{ op_d120_5, 0, 53536, 2, 2, 1 }, /* ADD */
+{ op_d128_5, 0, 53544, 0, 3, 1 }, /* ADD */
+{ op_d130_5, 0, 53552, 2, 3, 1 }, /* ADD */
+{ op_d138_5, 0, 53560, 0, 3, 1 }, /* ADD */
+{ op_d139_5, 0, 53561, 0, 4, 1 }, /* ADD */
+{ op_d140_5, 0, 53568, 0, 1, 0 }, /* ADDX */
+{ op_d148_5, 0, 53576, 2, 3, 1 }, /* ADDX */
+{ op_d150_5, 0, 53584, 0, 2, 1 }, /* ADD */
+{ op_d158_5, 0, 53592, 0, 2, 1 }, /* ADD */
+{ op_d160_5, 0, 53600, 2, 2, 1 }, /* ADD */
+{ op_d168_5, 0, 53608, 0, 3, 1 }, /* ADD */
+{ op_d170_5, 0, 53616, 2, 3, 1 }, /* ADD */
+{ op_d178_5, 0, 53624, 0, 3, 1 }, /* ADD */
+{ op_d179_5, 0, 53625, 0, 4, 1 }, /* ADD */
+{ op_d180_5, 0, 53632, 4, 1, 0 }, /* ADDX */
+{ op_d188_5, 0, 53640, 2, 5, 2 }, /* ADDX */
+{ op_d190_5, 0, 53648, 0, 3, 2 }, /* ADD */
+{ op_d198_5, 0, 53656, 0, 3, 2 }, /* ADD */
+{ op_d1a0_5, 0, 53664, 2, 3, 2 }, /* ADD */
+{ op_d1a8_5, 0, 53672, 0, 4, 2 }, /* ADD */
+{ op_d1b0_5, 0, 53680, 2, 4, 2 }, /* ADD */
+{ op_d1b8_5, 0, 53688, 0, 4, 2 }, /* ADD */
+{ op_d1b9_5, 0, 53689, 0, 5, 2 }, /* ADD */
+{ op_d1c0_5, 0, 53696, 4, 1, 0 }, /* ADDA */
+{ op_d1c8_5, 0, 53704, 4, 1, 0 }, /* ADDA */
+{ op_d1d0_5, 0, 53712, 2, 3, 0 }, /* ADDA */
+{ op_d1d8_5, 0, 53720, 2, 3, 0 }, /* ADDA */
+{ op_d1e0_5, 0, 53728, 4, 3, 0 }, /* ADDA */
+{ op_d1e8_5, 0, 53736, 2, 4, 0 }, /* ADDA */
+{ op_d1f0_5, 0, 53744, 4, 4, 0 }, /* ADDA */
+{ op_d1f8_5, 0, 53752, 2, 4, 0 }, /* ADDA */
+{ op_d1f9_5, 0, 53753, 2, 5, 0 }, /* ADDA */
+{ op_d1fa_5, 0, 53754, 2, 4, 0 }, /* ADDA */
+{ op_d1fb_5, 0, 53755, 4, 4, 0 }, /* ADDA */
+{ op_d1fc_5, 0, 53756, 4, 3, 0 }, /* ADDA */
+{ op_e000_5, 0, 57344, 2, 1, 0 }, /* ASR */
+{ op_e008_5, 0, 57352, 2, 1, 0 }, /* LSR */
+{ op_e010_5, 0, 57360, 2, 1, 0 }, /* ROXR */
+{ op_e018_5, 0, 57368, 2, 1, 0 }, /* ROR */
+{ op_e020_5, 0, 57376, 2, 1, 0 }, /* ASR */
+{ op_e028_5, 0, 57384, 2, 1, 0 }, /* LSR */
+{ op_e030_5, 0, 57392, 2, 1, 0 }, /* ROXR */
+{ op_e038_5, 0, 57400, 2, 1, 0 }, /* ROR */
+{ op_e040_5, 0, 57408, 2, 1, 0 }, /* ASR */
+{ op_e048_5, 0, 57416, 2, 1, 0 }, /* LSR */
+{ op_e050_5, 0, 57424, 2, 1, 0 }, /* ROXR */
+{ op_e058_5, 0, 57432, 2, 1, 0 }, /* ROR */
+{ op_e060_5, 0, 57440, 2, 1, 0 }, /* ASR */
+{ op_e068_5, 0, 57448, 2, 1, 0 }, /* LSR */
+{ op_e070_5, 0, 57456, 2, 1, 0 }, /* ROXR */
+{ op_e078_5, 0, 57464, 2, 1, 0 }, /* ROR */
+{ op_e080_5, 0, 57472, 4, 1, 0 }, /* ASR */
+{ op_e088_5, 0, 57480, 4, 1, 0 }, /* LSR */
+{ op_e090_5, 0, 57488, 4, 1, 0 }, /* ROXR */
+{ op_e098_5, 0, 57496, 4, 1, 0 }, /* ROR */
+{ op_e0a0_5, 0, 57504, 4, 1, 0 }, /* ASR */
+{ op_e0a8_5, 0, 57512, 4, 1, 0 }, /* LSR */
+{ op_e0b0_5, 0, 57520, 4, 1, 0 }, /* ROXR */
+{ op_e0b8_5, 0, 57528, 4, 1, 0 }, /* ROR */
+{ op_e0d0_5, 0, 57552, 0, 2, 1 }, /* ASRW */
+{ op_e0d8_5, 0, 57560, 0, 2, 1 }, /* ASRW */
+{ op_e0e0_5, 0, 57568, 2, 2, 1 }, /* ASRW */
+{ op_e0e8_5, 0, 57576, 0, 3, 1 }, /* ASRW */
+{ op_e0f0_5, 0, 57584, 2, 3, 1 }, /* ASRW */
+{ op_e0f8_5, 0, 57592, 0, 3, 1 }, /* ASRW */
+{ op_e0f9_5, 0, 57593, 0, 4, 1 }, /* ASRW */
+{ op_e100_5, 0, 57600, 2, 1, 0 }, /* ASL */
+{ op_e108_5, 0, 57608, 2, 1, 0 }, /* LSL */
+{ op_e110_5, 0, 57616, 2, 1, 0 }, /* ROXL */
+{ op_e118_5, 0, 57624, 2, 1, 0 }, /* ROL */
+{ op_e120_5, 0, 57632, 2, 1, 0 }, /* ASL */
+{ op_e128_5, 0, 57640, 2, 1, 0 }, /* LSL */
+{ op_e130_5, 0, 57648, 2, 1, 0 }, /* ROXL */
+{ op_e138_5, 0, 57656, 2, 1, 0 }, /* ROL */
+{ op_e140_5, 0, 57664, 2, 1, 0 }, /* ASL */
+{ op_e148_5, 0, 57672, 2, 1, 0 }, /* LSL */
+{ op_e150_5, 0, 57680, 2, 1, 0 }, /* ROXL */
+{ op_e158_5, 0, 57688, 2, 1, 0 }, /* ROL */
+{ op_e160_5, 0, 57696, 2, 1, 0 }, /* ASL */
+{ op_e168_5, 0, 57704, 2, 1, 0 }, /* LSL */
+{ op_e170_5, 0, 57712, 2, 1, 0 }, /* ROXL */
+{ op_e178_5, 0, 57720, 2, 1, 0 }, /* ROL */
+{ op_e180_5, 0, 57728, 4, 1, 0 }, /* ASL */
+{ op_e188_5, 0, 57736, 4, 1, 0 }, /* LSL */
+{ op_e190_5, 0, 57744, 4, 1, 0 }, /* ROXL */
+{ op_e198_5, 0, 57752, 4, 1, 0 }, /* ROL */
+{ op_e1a0_5, 0, 57760, 4, 1, 0 }, /* ASL */
+{ op_e1a8_5, 0, 57768, 4, 1, 0 }, /* LSL */
+{ op_e1b0_5, 0, 57776, 4, 1, 0 }, /* ROXL */
+{ op_e1b8_5, 0, 57784, 4, 1, 0 }, /* ROL */
+{ op_e1d0_5, 0, 57808, 0, 2, 1 }, /* ASLW */
+{ op_e1d8_5, 0, 57816, 0, 2, 1 }, /* ASLW */
+{ op_e1e0_5, 0, 57824, 2, 2, 1 }, /* ASLW */
+{ op_e1e8_5, 0, 57832, 0, 3, 1 }, /* ASLW */
+{ op_e1f0_5, 0, 57840, 2, 3, 1 }, /* ASLW */
+{ op_e1f8_5, 0, 57848, 0, 3, 1 }, /* ASLW */
+{ op_e1f9_5, 0, 57849, 0, 4, 1 }, /* ASLW */
+{ op_e2d0_5, 0, 58064, 0, 2, 1 }, /* LSRW */
+{ op_e2d8_5, 0, 58072, 0, 2, 1 }, /* LSRW */
+{ op_e2e0_5, 0, 58080, 2, 2, 1 }, /* LSRW */
+{ op_e2e8_5, 0, 58088, 0, 3, 1 }, /* LSRW */
+{ op_e2f0_5, 0, 58096, 2, 3, 1 }, /* LSRW */
+{ op_e2f8_5, 0, 58104, 0, 3, 1 }, /* LSRW */
+{ op_e2f9_5, 0, 58105, 0, 4, 1 }, /* LSRW */
+{ op_e3d0_5, 0, 58320, 0, 2, 1 }, /* LSLW */
+{ op_e3d8_5, 0, 58328, 0, 2, 1 }, /* LSLW */
+{ op_e3e0_5, 0, 58336, 2, 2, 1 }, /* LSLW */
+{ op_e3e8_5, 0, 58344, 0, 3, 1 }, /* LSLW */
+{ op_e3f0_5, 0, 58352, 2, 3, 1 }, /* LSLW */
+{ op_e3f8_5, 0, 58360, 0, 3, 1 }, /* LSLW */
+{ op_e3f9_5, 0, 58361, 0, 4, 1 }, /* LSLW */
+{ op_e4d0_5, 0, 58576, 0, 2, 1 }, /* ROXRW */
+{ op_e4d8_5, 0, 58584, 0, 2, 1 }, /* ROXRW */
+{ op_e4e0_5, 0, 58592, 2, 2, 1 }, /* ROXRW */
+{ op_e4e8_5, 0, 58600, 0, 3, 1 }, /* ROXRW */
+{ op_e4f0_5, 0, 58608, 2, 3, 1 }, /* ROXRW */
+{ op_e4f8_5, 0, 58616, 0, 3, 1 }, /* ROXRW */
+{ op_e4f9_5, 0, 58617, 0, 4, 1 }, /* ROXRW */
+{ op_e5d0_5, 0, 58832, 0, 2, 1 }, /* ROXLW */
+{ op_e5d8_5, 0, 58840, 0, 2, 1 }, /* ROXLW */
+{ op_e5e0_5, 0, 58848, 2, 2, 1 }, /* ROXLW */
+{ op_e5e8_5, 0, 58856, 0, 3, 1 }, /* ROXLW */
+{ op_e5f0_5, 0, 58864, 2, 3, 1 }, /* ROXLW */
+{ op_e5f8_5, 0, 58872, 0, 3, 1 }, /* ROXLW */
+{ op_e5f9_5, 0, 58873, 0, 4, 1 }, /* ROXLW */
+{ op_e6d0_5, 0, 59088, 0, 2, 1 }, /* RORW */
+{ op_e6d8_5, 0, 59096, 0, 2, 1 }, /* RORW */
+{ op_e6e0_5, 0, 59104, 2, 2, 1 }, /* RORW */
+{ op_e6e8_5, 0, 59112, 0, 3, 1 }, /* RORW */
+{ op_e6f0_5, 0, 59120, 2, 3, 1 }, /* RORW */
+{ op_e6f8_5, 0, 59128, 0, 3, 1 }, /* RORW */
+{ op_e6f9_5, 0, 59129, 0, 4, 1 }, /* RORW */
+{ op_e7d0_5, 0, 59344, 0, 2, 1 }, /* ROLW */
+{ op_e7d8_5, 0, 59352, 0, 2, 1 }, /* ROLW */
+{ op_e7e0_5, 0, 59360, 2, 2, 1 }, /* ROLW */
+{ op_e7e8_5, 0, 59368, 0, 3, 1 }, /* ROLW */
+{ op_e7f0_5, 0, 59376, 2, 3, 1 }, /* ROLW */
+{ op_e7f8_5, 0, 59384, 0, 3, 1 }, /* ROLW */
+{ op_e7f9_5, 0, 59385, 0, 4, 1 }, /* ROLW */
+{ 0, 0, 0 }};
@@ -1582,3 +1582,1587 @@ extern cpuop_func op_e7e8_3;
 extern cpuop_func op_e7f0_3;
 extern cpuop_func op_e7f8_3;
 extern cpuop_func op_e7f9_3;
+extern cpuop_func op_0_5;
+extern cpuop_func op_10_5;
+extern cpuop_func op_18_5;
+extern cpuop_func op_20_5;
+extern cpuop_func op_28_5;
+extern cpuop_func op_30_5;
+extern cpuop_func op_38_5;
+extern cpuop_func op_39_5;
+extern cpuop_func op_3c_5;
+extern cpuop_func op_40_5;
+extern cpuop_func op_50_5;
+extern cpuop_func op_58_5;
+extern cpuop_func op_60_5;
+extern cpuop_func op_68_5;
+extern cpuop_func op_70_5;
+extern cpuop_func op_78_5;
+extern cpuop_func op_79_5;
+extern cpuop_func op_7c_5;
+extern cpuop_func op_80_5;
+extern cpuop_func op_90_5;
+extern cpuop_func op_98_5;
+extern cpuop_func op_a0_5;
+extern cpuop_func op_a8_5;
+extern cpuop_func op_b0_5;
+extern cpuop_func op_b8_5;
+extern cpuop_func op_b9_5;
+extern cpuop_func op_100_5;
+extern cpuop_func op_108_5;
+extern cpuop_func op_110_5;
+extern cpuop_func op_118_5;
+extern cpuop_func op_120_5;
+extern cpuop_func op_128_5;
+extern cpuop_func op_130_5;
+extern cpuop_func op_138_5;
+extern cpuop_func op_139_5;
+extern cpuop_func op_13a_5;
+extern cpuop_func op_13b_5;
+extern cpuop_func op_13c_5;
+extern cpuop_func op_140_5;
+extern cpuop_func op_148_5;
+extern cpuop_func op_150_5;
+extern cpuop_func op_158_5;
+extern cpuop_func op_160_5;
+extern cpuop_func op_168_5;
+extern cpuop_func op_170_5;
+extern cpuop_func op_178_5;
+extern cpuop_func op_179_5;
+extern cpuop_func op_17a_5;
+extern cpuop_func op_17b_5;
+extern cpuop_func op_180_5;
+extern cpuop_func op_188_5;
+extern cpuop_func op_190_5;
+extern cpuop_func op_198_5;
+extern cpuop_func op_1a0_5;
+extern cpuop_func op_1a8_5;
+extern cpuop_func op_1b0_5;
+extern cpuop_func op_1b8_5;
+extern cpuop_func op_1b9_5;
+extern cpuop_func op_1ba_5;
+extern cpuop_func op_1bb_5;
+extern cpuop_func op_1c0_5;
+extern cpuop_func op_1c8_5;
+extern cpuop_func op_1d0_5;
+extern cpuop_func op_1d8_5;
+extern cpuop_func op_1e0_5;
+extern cpuop_func op_1e8_5;
+extern cpuop_func op_1f0_5;
+extern cpuop_func op_1f8_5;
+extern cpuop_func op_1f9_5;
+extern cpuop_func op_1fa_5;
+extern cpuop_func op_1fb_5;
+extern cpuop_func op_200_5;
+extern cpuop_func op_210_5;
+extern cpuop_func op_218_5;
+extern cpuop_func op_220_5;
+extern cpuop_func op_228_5;
+extern cpuop_func op_230_5;
+extern cpuop_func op_238_5;
+extern cpuop_func op_239_5;
+extern cpuop_func op_23c_5;
+extern cpuop_func op_240_5;
+extern cpuop_func op_250_5;
+extern cpuop_func op_258_5;
+extern cpuop_func op_260_5;
+extern cpuop_func op_268_5;
+extern cpuop_func op_270_5;
+extern cpuop_func op_278_5;
+extern cpuop_func op_279_5;
+extern cpuop_func op_27c_5;
+extern cpuop_func op_280_5;
+extern cpuop_func op_290_5;
+extern cpuop_func op_298_5;
+extern cpuop_func op_2a0_5;
+extern cpuop_func op_2a8_5;
+extern cpuop_func op_2b0_5;
+extern cpuop_func op_2b8_5;
+extern cpuop_func op_2b9_5;
+extern cpuop_func op_400_5;
+extern cpuop_func op_410_5;
+extern cpuop_func op_418_5;
+extern cpuop_func op_420_5;
+extern cpuop_func op_428_5;
+extern cpuop_func op_430_5;
+extern cpuop_func op_438_5;
+extern cpuop_func op_439_5;
+extern cpuop_func op_440_5;
+extern cpuop_func op_450_5;
+extern cpuop_func op_458_5;
+extern cpuop_func op_460_5;
+extern cpuop_func op_468_5;
+extern cpuop_func op_470_5;
+extern cpuop_func op_478_5;
+extern cpuop_func op_479_5;
+extern cpuop_func op_480_5;
+extern cpuop_func op_490_5;
+extern cpuop_func op_498_5;
+extern cpuop_func op_4a0_5;
+extern cpuop_func op_4a8_5;
+extern cpuop_func op_4b0_5;
+extern cpuop_func op_4b8_5;
+extern cpuop_func op_4b9_5;
+extern cpuop_func op_600_5;
+extern cpuop_func op_610_5;
+extern cpuop_func op_618_5;
+extern cpuop_func op_620_5;
+extern cpuop_func op_628_5;
+extern cpuop_func op_630_5;
+extern cpuop_func op_638_5;
+extern cpuop_func op_639_5;
+extern cpuop_func op_640_5;
+extern cpuop_func op_650_5;
+extern cpuop_func op_658_5;
+extern cpuop_func op_660_5;
+extern cpuop_func op_668_5;
+extern cpuop_func op_670_5;
+extern cpuop_func op_678_5;
+extern cpuop_func op_679_5;
+extern cpuop_func op_680_5;
+extern cpuop_func op_690_5;
+extern cpuop_func op_698_5;
+extern cpuop_func op_6a0_5;
+extern cpuop_func op_6a8_5;
+extern cpuop_func op_6b0_5;
+extern cpuop_func op_6b8_5;
+extern cpuop_func op_6b9_5;
+extern cpuop_func op_800_5;
+extern cpuop_func op_810_5;
+extern cpuop_func op_818_5;
+extern cpuop_func op_820_5;
+extern cpuop_func op_828_5;
+extern cpuop_func op_830_5;
+extern cpuop_func op_838_5;
+extern cpuop_func op_839_5;
+extern cpuop_func op_83a_5;
+extern cpuop_func op_83b_5;
+extern cpuop_func op_83c_5;
+extern cpuop_func op_840_5;
+extern cpuop_func op_850_5;
+extern cpuop_func op_858_5;
+extern cpuop_func op_860_5;
+extern cpuop_func op_868_5;
+extern cpuop_func op_870_5;
+extern cpuop_func op_878_5;
+extern cpuop_func op_879_5;
+extern cpuop_func op_87a_5;
+extern cpuop_func op_87b_5;
+extern cpuop_func op_880_5;
+extern cpuop_func op_890_5;
+extern cpuop_func op_898_5;
+extern cpuop_func op_8a0_5;
+extern cpuop_func op_8a8_5;
+extern cpuop_func op_8b0_5;
+extern cpuop_func op_8b8_5;
+extern cpuop_func op_8b9_5;
+extern cpuop_func op_8ba_5;
+extern cpuop_func op_8bb_5;
+extern cpuop_func op_8c0_5;
+extern cpuop_func op_8d0_5;
+extern cpuop_func op_8d8_5;
+extern cpuop_func op_8e0_5;
+extern cpuop_func op_8e8_5;
+extern cpuop_func op_8f0_5;
+extern cpuop_func op_8f8_5;
+extern cpuop_func op_8f9_5;
+extern cpuop_func op_8fa_5;
+extern cpuop_func op_8fb_5;
+extern cpuop_func op_a00_5;
+extern cpuop_func op_a10_5;
+extern cpuop_func op_a18_5;
+extern cpuop_func op_a20_5;
+extern cpuop_func op_a28_5;
+extern cpuop_func op_a30_5;
+extern cpuop_func op_a38_5;
+extern cpuop_func op_a39_5;
+extern cpuop_func op_a3c_5;
+extern cpuop_func op_a40_5;
+extern cpuop_func op_a50_5;
+extern cpuop_func op_a58_5;
+extern cpuop_func op_a60_5;
+extern cpuop_func op_a68_5;
+extern cpuop_func op_a70_5;
+extern cpuop_func op_a78_5;
+extern cpuop_func op_a79_5;
+extern cpuop_func op_a7c_5;
+extern cpuop_func op_a80_5;
+extern cpuop_func op_a90_5;
+extern cpuop_func op_a98_5;
+extern cpuop_func op_aa0_5;
+extern cpuop_func op_aa8_5;
+extern cpuop_func op_ab0_5;
+extern cpuop_func op_ab8_5;
+extern cpuop_func op_ab9_5;
+extern cpuop_func op_c00_5;
+extern cpuop_func op_c10_5;
+extern cpuop_func op_c18_5;
+extern cpuop_func op_c20_5;
+extern cpuop_func op_c28_5;
+extern cpuop_func op_c30_5;
+extern cpuop_func op_c38_5;
+extern cpuop_func op_c39_5;
+extern cpuop_func op_c3a_5;
+extern cpuop_func op_c3b_5;
+extern cpuop_func op_c40_5;
+extern cpuop_func op_c50_5;
+extern cpuop_func op_c58_5;
+extern cpuop_func op_c60_5;
+extern cpuop_func op_c68_5;
+extern cpuop_func op_c70_5;
+extern cpuop_func op_c78_5;
+extern cpuop_func op_c79_5;
+extern cpuop_func op_c7a_5;
+extern cpuop_func op_c7b_5;
+extern cpuop_func op_c80_5;
+extern cpuop_func op_c90_5;
+extern cpuop_func op_c98_5;
+extern cpuop_func op_ca0_5;
+extern cpuop_func op_ca8_5;
+extern cpuop_func op_cb0_5;
+extern cpuop_func op_cb8_5;
+extern cpuop_func op_cb9_5;
+extern cpuop_func op_cba_5;
+extern cpuop_func op_cbb_5;
+extern cpuop_func op_1000_5;
+extern cpuop_func op_1010_5;
+extern cpuop_func op_1018_5;
+extern cpuop_func op_1020_5;
+extern cpuop_func op_1028_5;
+extern cpuop_func op_1030_5;
+extern cpuop_func op_1038_5;
+extern cpuop_func op_1039_5;
+extern cpuop_func op_103a_5;
+extern cpuop_func op_103b_5;
+extern cpuop_func op_103c_5;
+extern cpuop_func op_1080_5;
+extern cpuop_func op_1090_5;
+extern cpuop_func op_1098_5;
+extern cpuop_func op_10a0_5;
+extern cpuop_func op_10a8_5;
+extern cpuop_func op_10b0_5;
+extern cpuop_func op_10b8_5;
+extern cpuop_func op_10b9_5;
+extern cpuop_func op_10ba_5;
+extern cpuop_func op_10bb_5;
+extern cpuop_func op_10bc_5;
+extern cpuop_func op_10c0_5;
+extern cpuop_func op_10d0_5;
+extern cpuop_func op_10d8_5;
+extern cpuop_func op_10e0_5;
+extern cpuop_func op_10e8_5;
+extern cpuop_func op_10f0_5;
+extern cpuop_func op_10f8_5;
+extern cpuop_func op_10f9_5;
+extern cpuop_func op_10fa_5;
+extern cpuop_func op_10fb_5;
+extern cpuop_func op_10fc_5;
+extern cpuop_func op_1100_5;
+extern cpuop_func op_1110_5;
+extern cpuop_func op_1118_5;
+extern cpuop_func op_1120_5;
+extern cpuop_func op_1128_5;
+extern cpuop_func op_1130_5;
+extern cpuop_func op_1138_5;
+extern cpuop_func op_1139_5;
+extern cpuop_func op_113a_5;
+extern cpuop_func op_113b_5;
+extern cpuop_func op_113c_5;
+extern cpuop_func op_1140_5;
+extern cpuop_func op_1150_5;
+extern cpuop_func op_1158_5;
+extern cpuop_func op_1160_5;
+extern cpuop_func op_1168_5;
+extern cpuop_func op_1170_5;
+extern cpuop_func op_1178_5;
+extern cpuop_func op_1179_5;
+extern cpuop_func op_117a_5;
+extern cpuop_func op_117b_5;
+extern cpuop_func op_117c_5;
+extern cpuop_func op_1180_5;
+extern cpuop_func op_1190_5;
+extern cpuop_func op_1198_5;
+extern cpuop_func op_11a0_5;
+extern cpuop_func op_11a8_5;
+extern cpuop_func op_11b0_5;
+extern cpuop_func op_11b8_5;
+extern cpuop_func op_11b9_5;
+extern cpuop_func op_11ba_5;
+extern cpuop_func op_11bb_5;
+extern cpuop_func op_11bc_5;
+extern cpuop_func op_11c0_5;
+extern cpuop_func op_11d0_5;
+extern cpuop_func op_11d8_5;
+extern cpuop_func op_11e0_5;
+extern cpuop_func op_11e8_5;
+extern cpuop_func op_11f0_5;
+extern cpuop_func op_11f8_5;
+extern cpuop_func op_11f9_5;
+extern cpuop_func op_11fa_5;
+extern cpuop_func op_11fb_5;
+extern cpuop_func op_11fc_5;
+extern cpuop_func op_13c0_5;
+extern cpuop_func op_13d0_5;
+extern cpuop_func op_13d8_5;
+extern cpuop_func op_13e0_5;
+extern cpuop_func op_13e8_5;
+extern cpuop_func op_13f0_5;
+extern cpuop_func op_13f8_5;
+extern cpuop_func op_13f9_5;
+extern cpuop_func op_13fa_5;
+extern cpuop_func op_13fb_5;
+extern cpuop_func op_13fc_5;
+extern cpuop_func op_2000_5;
+extern cpuop_func op_2008_5;
+extern cpuop_func op_2010_5;
+extern cpuop_func op_2018_5;
+extern cpuop_func op_2020_5;
+extern cpuop_func op_2028_5;
+extern cpuop_func op_2030_5;
+extern cpuop_func op_2038_5;
+extern cpuop_func op_2039_5;
+extern cpuop_func op_203a_5;
+extern cpuop_func op_203b_5;
+extern cpuop_func op_203c_5;
+extern cpuop_func op_2040_5;
+extern cpuop_func op_2048_5;
+extern cpuop_func op_2050_5;
+extern cpuop_func op_2058_5;
+extern cpuop_func op_2060_5;
+extern cpuop_func op_2068_5;
+extern cpuop_func op_2070_5;
+extern cpuop_func op_2078_5;
+extern cpuop_func op_2079_5;
+extern cpuop_func op_207a_5;
+extern cpuop_func op_207b_5;
+extern cpuop_func op_207c_5;
+extern cpuop_func op_2080_5;
+extern cpuop_func op_2088_5;
+extern cpuop_func op_2090_5;
+extern cpuop_func op_2098_5;
+extern cpuop_func op_20a0_5;
+extern cpuop_func op_20a8_5;
+extern cpuop_func op_20b0_5;
+extern cpuop_func op_20b8_5;
+extern cpuop_func op_20b9_5;
+extern cpuop_func op_20ba_5;
+extern cpuop_func op_20bb_5;
+extern cpuop_func op_20bc_5;
+extern cpuop_func op_20c0_5;
+extern cpuop_func op_20c8_5;
+extern cpuop_func op_20d0_5;
+extern cpuop_func op_20d8_5;
+extern cpuop_func op_20e0_5;
+extern cpuop_func op_20e8_5;
+extern cpuop_func op_20f0_5;
+extern cpuop_func op_20f8_5;
+extern cpuop_func op_20f9_5;
+extern cpuop_func op_20fa_5;
+extern cpuop_func op_20fb_5;
+extern cpuop_func op_20fc_5;
+extern cpuop_func op_2100_5;
+extern cpuop_func op_2108_5;
+extern cpuop_func op_2110_5;
+extern cpuop_func op_2118_5;
+extern cpuop_func op_2120_5;
+extern cpuop_func op_2128_5;
+extern cpuop_func op_2130_5;
+extern cpuop_func op_2138_5;
+extern cpuop_func op_2139_5;
+extern cpuop_func op_213a_5;
+extern cpuop_func op_213b_5;
+extern cpuop_func op_213c_5;
+extern cpuop_func op_2140_5;
+extern cpuop_func op_2148_5;
+extern cpuop_func op_2150_5;
+extern cpuop_func op_2158_5;
+extern cpuop_func op_2160_5;
+extern cpuop_func op_2168_5;
+extern cpuop_func op_2170_5;
+extern cpuop_func op_2178_5;
+extern cpuop_func op_2179_5;
+extern cpuop_func op_217a_5;
+extern cpuop_func op_217b_5;
+extern cpuop_func op_217c_5;
+extern cpuop_func op_2180_5;
+extern cpuop_func op_2188_5;
+extern cpuop_func op_2190_5;
+extern cpuop_func op_2198_5;
+extern cpuop_func op_21a0_5;
+extern cpuop_func op_21a8_5;
+extern cpuop_func op_21b0_5;
+extern cpuop_func op_21b8_5;
+extern cpuop_func op_21b9_5;
+extern cpuop_func op_21ba_5;
+extern cpuop_func op_21bb_5;
+extern cpuop_func op_21bc_5;
+extern cpuop_func op_21c0_5;
+extern cpuop_func op_21c8_5;
+extern cpuop_func op_21d0_5;
+extern cpuop_func op_21d8_5;
+extern cpuop_func op_21e0_5;
+extern cpuop_func op_21e8_5;
+extern cpuop_func op_21f0_5;
+extern cpuop_func op_21f8_5;
+extern cpuop_func op_21f9_5;
+extern cpuop_func op_21fa_5;
+extern cpuop_func op_21fb_5;
+extern cpuop_func op_21fc_5;
+extern cpuop_func op_23c0_5;
+extern cpuop_func op_23c8_5;
+extern cpuop_func op_23d0_5;
+extern cpuop_func op_23d8_5;
+extern cpuop_func op_23e0_5;
+extern cpuop_func op_23e8_5;
+extern cpuop_func op_23f0_5;
+extern cpuop_func op_23f8_5;
+extern cpuop_func op_23f9_5;
+extern cpuop_func op_23fa_5;
+extern cpuop_func op_23fb_5;
+extern cpuop_func op_23fc_5;
+extern cpuop_func op_3000_5;
+extern cpuop_func op_3008_5;
+extern cpuop_func op_3010_5;
+extern cpuop_func op_3018_5;
+extern cpuop_func op_3020_5;
+extern cpuop_func op_3028_5;
+extern cpuop_func op_3030_5;
+extern cpuop_func op_3038_5;
+extern cpuop_func op_3039_5;
+extern cpuop_func op_303a_5;
+extern cpuop_func op_303b_5;
+extern cpuop_func op_303c_5;
+extern cpuop_func op_3040_5;
+extern cpuop_func op_3048_5;
+extern cpuop_func op_3050_5;
+extern cpuop_func op_3058_5;
+extern cpuop_func op_3060_5;
+extern cpuop_func op_3068_5;
+extern cpuop_func op_3070_5;
+extern cpuop_func op_3078_5;
+extern cpuop_func op_3079_5;
+extern cpuop_func op_307a_5;
+extern cpuop_func op_307b_5;
+extern cpuop_func op_307c_5;
+extern cpuop_func op_3080_5;
+extern cpuop_func op_3088_5;
+extern cpuop_func op_3090_5;
+extern cpuop_func op_3098_5;
+extern cpuop_func op_30a0_5;
+extern cpuop_func op_30a8_5;
+extern cpuop_func op_30b0_5;
+extern cpuop_func op_30b8_5;
+extern cpuop_func op_30b9_5;
+extern cpuop_func op_30ba_5;
+extern cpuop_func op_30bb_5;
+extern cpuop_func op_30bc_5;
+extern cpuop_func op_30c0_5;
+extern cpuop_func op_30c8_5;
+extern cpuop_func op_30d0_5;
+extern cpuop_func op_30d8_5;
+extern cpuop_func op_30e0_5;
+extern cpuop_func op_30e8_5;
+extern cpuop_func op_30f0_5;
+extern cpuop_func op_30f8_5;
+extern cpuop_func op_30f9_5;
+extern cpuop_func op_30fa_5;
+extern cpuop_func op_30fb_5;
+extern cpuop_func op_30fc_5;
+extern cpuop_func op_3100_5;
+extern cpuop_func op_3108_5;
+extern cpuop_func op_3110_5;
+extern cpuop_func op_3118_5;
+extern cpuop_func op_3120_5;
+extern cpuop_func op_3128_5;
+extern cpuop_func op_3130_5;
+extern cpuop_func op_3138_5;
+extern cpuop_func op_3139_5;
+extern cpuop_func op_313a_5;
+extern cpuop_func op_313b_5;
+extern cpuop_func op_313c_5;
+extern cpuop_func op_3140_5;
+extern cpuop_func op_3148_5;
+extern cpuop_func op_3150_5;
+extern cpuop_func op_3158_5;
+extern cpuop_func op_3160_5;
+extern cpuop_func op_3168_5;
+extern cpuop_func op_3170_5;
+extern cpuop_func op_3178_5;
+extern cpuop_func op_3179_5;
+extern cpuop_func op_317a_5;
+extern cpuop_func op_317b_5;
+extern cpuop_func op_317c_5;
+extern cpuop_func op_3180_5;
+extern cpuop_func op_3188_5;
+extern cpuop_func op_3190_5;
+extern cpuop_func op_3198_5;
+extern cpuop_func op_31a0_5;
+extern cpuop_func op_31a8_5;
+extern cpuop_func op_31b0_5;
+extern cpuop_func op_31b8_5;
+extern cpuop_func op_31b9_5;
+extern cpuop_func op_31ba_5;
+extern cpuop_func op_31bb_5;
+extern cpuop_func op_31bc_5;
+extern cpuop_func op_31c0_5;
+extern cpuop_func op_31c8_5;
+extern cpuop_func op_31d0_5;
+extern cpuop_func op_31d8_5;
+extern cpuop_func op_31e0_5;
+extern cpuop_func op_31e8_5;
+extern cpuop_func op_31f0_5;
+extern cpuop_func op_31f8_5;
+extern cpuop_func op_31f9_5;
+extern cpuop_func op_31fa_5;
+extern cpuop_func op_31fb_5;
+extern cpuop_func op_31fc_5;
+extern cpuop_func op_33c0_5;
+extern cpuop_func op_33c8_5;
+extern cpuop_func op_33d0_5;
+extern cpuop_func op_33d8_5;
+extern cpuop_func op_33e0_5;
+extern cpuop_func op_33e8_5;
+extern cpuop_func op_33f0_5;
+extern cpuop_func op_33f8_5;
+extern cpuop_func op_33f9_5;
+extern cpuop_func op_33fa_5;
+extern cpuop_func op_33fb_5;
+extern cpuop_func op_33fc_5;
+extern cpuop_func op_4000_5;
+extern cpuop_func op_4010_5;
+extern cpuop_func op_4018_5;
+extern cpuop_func op_4020_5;
+extern cpuop_func op_4028_5;
+extern cpuop_func op_4030_5;
+extern cpuop_func op_4038_5;
+extern cpuop_func op_4039_5;
+extern cpuop_func op_4040_5;
+extern cpuop_func op_4050_5;
+extern cpuop_func op_4058_5;
+extern cpuop_func op_4060_5;
+extern cpuop_func op_4068_5;
+extern cpuop_func op_4070_5;
+extern cpuop_func op_4078_5;
+extern cpuop_func op_4079_5;
+extern cpuop_func op_4080_5;
+extern cpuop_func op_4090_5;
+extern cpuop_func op_4098_5;
+extern cpuop_func op_40a0_5;
+extern cpuop_func op_40a8_5;
+extern cpuop_func op_40b0_5;
+extern cpuop_func op_40b8_5;
+extern cpuop_func op_40b9_5;
+extern cpuop_func op_40c0_5;
+extern cpuop_func op_40d0_5;
+extern cpuop_func op_40d8_5;
+extern cpuop_func op_40e0_5;
+extern cpuop_func op_40e8_5;
+extern cpuop_func op_40f0_5;
+extern cpuop_func op_40f8_5;
+extern cpuop_func op_40f9_5;
+extern cpuop_func op_4100_5;
+extern cpuop_func op_4110_5;
+extern cpuop_func op_4118_5;
+extern cpuop_func op_4120_5;
+extern cpuop_func op_4128_5;
+extern cpuop_func op_4130_5;
+extern cpuop_func op_4138_5;
+extern cpuop_func op_4139_5;
+extern cpuop_func op_413a_5;
+extern cpuop_func op_413b_5;
+extern cpuop_func op_413c_5;
+extern cpuop_func op_4180_5;
+extern cpuop_func op_4190_5;
+extern cpuop_func op_4198_5;
+extern cpuop_func op_41a0_5;
+extern cpuop_func op_41a8_5;
+extern cpuop_func op_41b0_5;
+extern cpuop_func op_41b8_5;
+extern cpuop_func op_41b9_5;
+extern cpuop_func op_41ba_5;
+extern cpuop_func op_41bb_5;
+extern cpuop_func op_41bc_5;
+extern cpuop_func op_41d0_5;
+extern cpuop_func op_41e8_5;
+extern cpuop_func op_41f0_5;
+extern cpuop_func op_41f8_5;
+extern cpuop_func op_41f9_5;
+extern cpuop_func op_41fa_5;
+extern cpuop_func op_41fb_5;
+extern cpuop_func op_4200_5;
+extern cpuop_func op_4210_5;
+extern cpuop_func op_4218_5;
+extern cpuop_func op_4220_5;
+extern cpuop_func op_4228_5;
+extern cpuop_func op_4230_5;
+extern cpuop_func op_4238_5;
+extern cpuop_func op_4239_5;
+extern cpuop_func op_4240_5;
+extern cpuop_func op_4250_5;
+extern cpuop_func op_4258_5;
+extern cpuop_func op_4260_5;
+extern cpuop_func op_4268_5;
+extern cpuop_func op_4270_5;
+extern cpuop_func op_4278_5;
+extern cpuop_func op_4279_5;
+extern cpuop_func op_4280_5;
+extern cpuop_func op_4290_5;
+extern cpuop_func op_4298_5;
+extern cpuop_func op_42a0_5;
+extern cpuop_func op_42a8_5;
+extern cpuop_func op_42b0_5;
+extern cpuop_func op_42b8_5;
+extern cpuop_func op_42b9_5;
+extern cpuop_func op_4400_5;
+extern cpuop_func op_4410_5;
+extern cpuop_func op_4418_5;
+extern cpuop_func op_4420_5;
+extern cpuop_func op_4428_5;
+extern cpuop_func op_4430_5;
+extern cpuop_func op_4438_5;
+extern cpuop_func op_4439_5;
+extern cpuop_func op_4440_5;
+extern cpuop_func op_4450_5;
+extern cpuop_func op_4458_5;
+extern cpuop_func op_4460_5;
+extern cpuop_func op_4468_5;
+extern cpuop_func op_4470_5;
+extern cpuop_func op_4478_5;
+extern cpuop_func op_4479_5;
+extern cpuop_func op_4480_5;
+extern cpuop_func op_4490_5;
+extern cpuop_func op_4498_5;
+extern cpuop_func op_44a0_5;
+extern cpuop_func op_44a8_5;
+extern cpuop_func op_44b0_5;
+extern cpuop_func op_44b8_5;
+extern cpuop_func op_44b9_5;
+extern cpuop_func op_44c0_5;
+extern cpuop_func op_44d0_5;
+extern cpuop_func op_44d8_5;
+extern cpuop_func op_44e0_5;
+extern cpuop_func op_44e8_5;
+extern cpuop_func op_44f0_5;
+extern cpuop_func op_44f8_5;
+extern cpuop_func op_44f9_5;
+extern cpuop_func op_44fa_5;
+extern cpuop_func op_44fb_5;
+extern cpuop_func op_44fc_5;
+extern cpuop_func op_4600_5;
+extern cpuop_func op_4610_5;
+extern cpuop_func op_4618_5;
+extern cpuop_func op_4620_5;
+extern cpuop_func op_4628_5;
+extern cpuop_func op_4630_5;
+extern cpuop_func op_4638_5;
+extern cpuop_func op_4639_5;
+extern cpuop_func op_4640_5;
+extern cpuop_func op_4650_5;
+extern cpuop_func op_4658_5;
+extern cpuop_func op_4660_5;
+extern cpuop_func op_4668_5;
+extern cpuop_func op_4670_5;
+extern cpuop_func op_4678_5;
+extern cpuop_func op_4679_5;
+extern cpuop_func op_4680_5;
+extern cpuop_func op_4690_5;
+extern cpuop_func op_4698_5;
+extern cpuop_func op_46a0_5;
+extern cpuop_func op_46a8_5;
+extern cpuop_func op_46b0_5;
+extern cpuop_func op_46b8_5;
+extern cpuop_func op_46b9_5;
+extern cpuop_func op_46c0_5;
+extern cpuop_func op_46d0_5;
+extern cpuop_func op_46d8_5;
+extern cpuop_func op_46e0_5;
+extern cpuop_func op_46e8_5;
+extern cpuop_func op_46f0_5;
+extern cpuop_func op_46f8_5;
+extern cpuop_func op_46f9_5;
+extern cpuop_func op_46fa_5;
+extern cpuop_func op_46fb_5;
+extern cpuop_func op_46fc_5;
+extern cpuop_func op_4800_5;
+extern cpuop_func op_4810_5;
+extern cpuop_func op_4818_5;
+extern cpuop_func op_4820_5;
+extern cpuop_func op_4828_5;
+extern cpuop_func op_4830_5;
+extern cpuop_func op_4838_5;
+extern cpuop_func op_4839_5;
+extern cpuop_func op_4840_5;
+extern cpuop_func op_4850_5;
+extern cpuop_func op_4868_5;
+extern cpuop_func op_4870_5;
+extern cpuop_func op_4878_5;
+extern cpuop_func op_4879_5;
+extern cpuop_func op_487a_5;
+extern cpuop_func op_487b_5;
+extern cpuop_func op_4880_5;
+extern cpuop_func op_4890_5;
+extern cpuop_func op_48a0_5;
+extern cpuop_func op_48a8_5;
+extern cpuop_func op_48b0_5;
+extern cpuop_func op_48b8_5;
+extern cpuop_func op_48b9_5;
+extern cpuop_func op_48c0_5;
+extern cpuop_func op_48d0_5;
+extern cpuop_func op_48e0_5;
+extern cpuop_func op_48e8_5;
+extern cpuop_func op_48f0_5;
+extern cpuop_func op_48f8_5;
+extern cpuop_func op_48f9_5;
+extern cpuop_func op_49c0_5;
+extern cpuop_func op_4a00_5;
+extern cpuop_func op_4a10_5;
+extern cpuop_func op_4a18_5;
+extern cpuop_func op_4a20_5;
+extern cpuop_func op_4a28_5;
+extern cpuop_func op_4a30_5;
+extern cpuop_func op_4a38_5;
+extern cpuop_func op_4a39_5;
+extern cpuop_func op_4a3a_5;
+extern cpuop_func op_4a3b_5;
+extern cpuop_func op_4a3c_5;
+extern cpuop_func op_4a40_5;
+extern cpuop_func op_4a48_5;
+extern cpuop_func op_4a50_5;
+extern cpuop_func op_4a58_5;
+extern cpuop_func op_4a60_5;
+extern cpuop_func op_4a68_5;
+extern cpuop_func op_4a70_5;
+extern cpuop_func op_4a78_5;
+extern cpuop_func op_4a79_5;
+extern cpuop_func op_4a7a_5;
+extern cpuop_func op_4a7b_5;
+extern cpuop_func op_4a7c_5;
+extern cpuop_func op_4a80_5;
+extern cpuop_func op_4a88_5;
+extern cpuop_func op_4a90_5;
+extern cpuop_func op_4a98_5;
+extern cpuop_func op_4aa0_5;
+extern cpuop_func op_4aa8_5;
+extern cpuop_func op_4ab0_5;
+extern cpuop_func op_4ab8_5;
+extern cpuop_func op_4ab9_5;
+extern cpuop_func op_4aba_5;
+extern cpuop_func op_4abb_5;
+extern cpuop_func op_4abc_5;
+extern cpuop_func op_4ac0_5;
+extern cpuop_func op_4ad0_5;
+extern cpuop_func op_4ad8_5;
+extern cpuop_func op_4ae0_5;
+extern cpuop_func op_4ae8_5;
+extern cpuop_func op_4af0_5;
+extern cpuop_func op_4af8_5;
+extern cpuop_func op_4af9_5;
+extern cpuop_func op_4c90_5;
+extern cpuop_func op_4c98_5;
+extern cpuop_func op_4ca8_5;
+extern cpuop_func op_4cb0_5;
+extern cpuop_func op_4cb8_5;
+extern cpuop_func op_4cb9_5;
+extern cpuop_func op_4cba_5;
+extern cpuop_func op_4cbb_5;
+extern cpuop_func op_4cd0_5;
+extern cpuop_func op_4cd8_5;
+extern cpuop_func op_4ce8_5;
+extern cpuop_func op_4cf0_5;
+extern cpuop_func op_4cf8_5;
+extern cpuop_func op_4cf9_5;
+extern cpuop_func op_4cfa_5;
+extern cpuop_func op_4cfb_5;
+extern cpuop_func op_4e40_5;
+extern cpuop_func op_4e50_5;
+extern cpuop_func op_4e58_5;
+extern cpuop_func op_4e60_5;
+extern cpuop_func op_4e68_5;
+extern cpuop_func op_4e70_5;
+extern cpuop_func op_4e71_5;
+extern cpuop_func op_4e72_5;
+extern cpuop_func op_4e73_5;
+extern cpuop_func op_4e74_5;
+extern cpuop_func op_4e75_5;
+extern cpuop_func op_4e76_5;
+extern cpuop_func op_4e77_5;
+extern cpuop_func op_4e90_5;
+extern cpuop_func op_4ea8_5;
+extern cpuop_func op_4eb0_5;
+extern cpuop_func op_4eb8_5;
+extern cpuop_func op_4eb9_5;
+extern cpuop_func op_4eba_5;
+extern cpuop_func op_4ebb_5;
+extern cpuop_func op_4ed0_5;
+extern cpuop_func op_4ee8_5;
+extern cpuop_func op_4ef0_5;
+extern cpuop_func op_4ef8_5;
+extern cpuop_func op_4ef9_5;
+extern cpuop_func op_4efa_5;
+extern cpuop_func op_4efb_5;
+extern cpuop_func op_5000_5;
+extern cpuop_func op_5010_5;
+extern cpuop_func op_5018_5;
+extern cpuop_func op_5020_5;
+extern cpuop_func op_5028_5;
+extern cpuop_func op_5030_5;
+extern cpuop_func op_5038_5;
+extern cpuop_func op_5039_5;
+extern cpuop_func op_5040_5;
+extern cpuop_func op_5048_5;
+extern cpuop_func op_5050_5;
+extern cpuop_func op_5058_5;
+extern cpuop_func op_5060_5;
+extern cpuop_func op_5068_5;
+extern cpuop_func op_5070_5;
+extern cpuop_func op_5078_5;
+extern cpuop_func op_5079_5;
+extern cpuop_func op_5080_5;
+extern cpuop_func op_5088_5;
+extern cpuop_func op_5090_5;
+extern cpuop_func op_5098_5;
+extern cpuop_func op_50a0_5;
+extern cpuop_func op_50a8_5;
+extern cpuop_func op_50b0_5;
+extern cpuop_func op_50b8_5;
+extern cpuop_func op_50b9_5;
+extern cpuop_func op_50c0_5;
+extern cpuop_func op_50c8_5;
+extern cpuop_func op_50d0_5;
+extern cpuop_func op_50d8_5;
+extern cpuop_func op_50e0_5;
+extern cpuop_func op_50e8_5;
+extern cpuop_func op_50f0_5;
+extern cpuop_func op_50f8_5;
+extern cpuop_func op_50f9_5;
+extern cpuop_func op_5100_5;
+extern cpuop_func op_5110_5;
+extern cpuop_func op_5118_5;
+extern cpuop_func op_5120_5;
+extern cpuop_func op_5128_5;
+extern cpuop_func op_5130_5;
+extern cpuop_func op_5138_5;
+extern cpuop_func op_5139_5;
+extern cpuop_func op_5140_5;
+extern cpuop_func op_5148_5;
+extern cpuop_func op_5150_5;
+extern cpuop_func op_5158_5;
+extern cpuop_func op_5160_5;
+extern cpuop_func op_5168_5;
+extern cpuop_func op_5170_5;
+extern cpuop_func op_5178_5;
+extern cpuop_func op_5179_5;
+extern cpuop_func op_5180_5;
+extern cpuop_func op_5188_5;
+extern cpuop_func op_5190_5;
+extern cpuop_func op_5198_5;
+extern cpuop_func op_51a0_5;
+extern cpuop_func op_51a8_5;
+extern cpuop_func op_51b0_5;
+extern cpuop_func op_51b8_5;
+extern cpuop_func op_51b9_5;
+extern cpuop_func op_51c0_5;
+extern cpuop_func op_51c8_5;
+extern cpuop_func op_51d0_5;
+extern cpuop_func op_51d8_5;
+extern cpuop_func op_51e0_5;
+extern cpuop_func op_51e8_5;
+extern cpuop_func op_51f0_5;
+extern cpuop_func op_51f8_5;
+extern cpuop_func op_51f9_5;
+extern cpuop_func op_52c0_5;
+extern cpuop_func op_52c8_5;
+extern cpuop_func op_52d0_5;
+extern cpuop_func op_52d8_5;
+extern cpuop_func op_52e0_5;
+extern cpuop_func op_52e8_5;
+extern cpuop_func op_52f0_5;
+extern cpuop_func op_52f8_5;
+extern cpuop_func op_52f9_5;
+extern cpuop_func op_53c0_5;
+extern cpuop_func op_53c8_5;
+extern cpuop_func op_53d0_5;
+extern cpuop_func op_53d8_5;
+extern cpuop_func op_53e0_5;
+extern cpuop_func op_53e8_5;
+extern cpuop_func op_53f0_5;
+extern cpuop_func op_53f8_5;
+extern cpuop_func op_53f9_5;
+extern cpuop_func op_54c0_5;
+extern cpuop_func op_54c8_5;
+extern cpuop_func op_54d0_5;
+extern cpuop_func op_54d8_5;
+extern cpuop_func op_54e0_5;
+extern cpuop_func op_54e8_5;
+extern cpuop_func op_54f0_5;
+extern cpuop_func op_54f8_5;
+extern cpuop_func op_54f9_5;
+extern cpuop_func op_55c0_5;
+extern cpuop_func op_55c8_5;
+extern cpuop_func op_55d0_5;
+extern cpuop_func op_55d8_5;
+extern cpuop_func op_55e0_5;
+extern cpuop_func op_55e8_5;
+extern cpuop_func op_55f0_5;
+extern cpuop_func op_55f8_5;
+extern cpuop_func op_55f9_5;
+extern cpuop_func op_56c0_5;
+extern cpuop_func op_56c8_5;
+extern cpuop_func op_56d0_5;
+extern cpuop_func op_56d8_5;
+extern cpuop_func op_56e0_5;
+extern cpuop_func op_56e8_5;
+extern cpuop_func op_56f0_5;
+extern cpuop_func op_56f8_5;
+extern cpuop_func op_56f9_5;
+extern cpuop_func op_57c0_5;
+extern cpuop_func op_57c8_5;
+extern cpuop_func op_57d0_5;
+extern cpuop_func op_57d8_5;
+extern cpuop_func op_57e0_5;
+extern cpuop_func op_57e8_5;
+extern cpuop_func op_57f0_5;
+extern cpuop_func op_57f8_5;
+extern cpuop_func op_57f9_5;
+extern cpuop_func op_58c0_5;
+extern cpuop_func op_58c8_5;
+extern cpuop_func op_58d0_5;
+extern cpuop_func op_58d8_5;
+extern cpuop_func op_58e0_5;
+extern cpuop_func op_58e8_5;
+extern cpuop_func op_58f0_5;
+extern cpuop_func op_58f8_5;
+extern cpuop_func op_58f9_5;
+extern cpuop_func op_59c0_5;
+extern cpuop_func op_59c8_5;
+extern cpuop_func op_59d0_5;
+extern cpuop_func op_59d8_5;
+extern cpuop_func op_59e0_5;
+extern cpuop_func op_59e8_5;
+extern cpuop_func op_59f0_5;
+extern cpuop_func op_59f8_5;
+extern cpuop_func op_59f9_5;
+extern cpuop_func op_5ac0_5;
+extern cpuop_func op_5ac8_5;
+extern cpuop_func op_5ad0_5;
+extern cpuop_func op_5ad8_5;
+extern cpuop_func op_5ae0_5;
+extern cpuop_func op_5ae8_5;
+extern cpuop_func op_5af0_5;
+extern cpuop_func op_5af8_5;
+extern cpuop_func op_5af9_5;
+extern cpuop_func op_5bc0_5;
+extern cpuop_func op_5bc8_5;
+extern cpuop_func op_5bd0_5;
+extern cpuop_func op_5bd8_5;
+extern cpuop_func op_5be0_5;
+extern cpuop_func op_5be8_5;
+extern cpuop_func op_5bf0_5;
+extern cpuop_func op_5bf8_5;
+extern cpuop_func op_5bf9_5;
+extern cpuop_func op_5cc0_5;
+extern cpuop_func op_5cc8_5;
+extern cpuop_func op_5cd0_5;
+extern cpuop_func op_5cd8_5;
+extern cpuop_func op_5ce0_5;
+extern cpuop_func op_5ce8_5;
+extern cpuop_func op_5cf0_5;
+extern cpuop_func op_5cf8_5;
+extern cpuop_func op_5cf9_5;
+extern cpuop_func op_5dc0_5;
+extern cpuop_func op_5dc8_5;
+extern cpuop_func op_5dd0_5;
+extern cpuop_func op_5dd8_5;
+extern cpuop_func op_5de0_5;
+extern cpuop_func op_5de8_5;
+extern cpuop_func op_5df0_5;
+extern cpuop_func op_5df8_5;
+extern cpuop_func op_5df9_5;
+extern cpuop_func op_5ec0_5;
+extern cpuop_func op_5ec8_5;
+extern cpuop_func op_5ed0_5;
+extern cpuop_func op_5ed8_5;
+extern cpuop_func op_5ee0_5;
+extern cpuop_func op_5ee8_5;
+extern cpuop_func op_5ef0_5;
+extern cpuop_func op_5ef8_5;
+extern cpuop_func op_5ef9_5;
+extern cpuop_func op_5fc0_5;
+extern cpuop_func op_5fc8_5;
+extern cpuop_func op_5fd0_5;
+extern cpuop_func op_5fd8_5;
+extern cpuop_func op_5fe0_5;
+extern cpuop_func op_5fe8_5;
+extern cpuop_func op_5ff0_5;
+extern cpuop_func op_5ff8_5;
+extern cpuop_func op_5ff9_5;
+extern cpuop_func op_6000_5;
+extern cpuop_func op_6001_5;
+extern cpuop_func op_60ff_5;
+extern cpuop_func op_6100_5;
+extern cpuop_func op_6101_5;
+extern cpuop_func op_61ff_5;
+extern cpuop_func op_6200_5;
+extern cpuop_func op_6201_5;
+extern cpuop_func op_62ff_5;
+extern cpuop_func op_6300_5;
+extern cpuop_func op_6301_5;
+extern cpuop_func op_63ff_5;
+extern cpuop_func op_6400_5;
+extern cpuop_func op_6401_5;
+extern cpuop_func op_64ff_5;
+extern cpuop_func op_6500_5;
+extern cpuop_func op_6501_5;
+extern cpuop_func op_65ff_5;
+extern cpuop_func op_6600_5;
+extern cpuop_func op_6601_5;
+extern cpuop_func op_66ff_5;
+extern cpuop_func op_6700_5;
+extern cpuop_func op_6701_5;
+extern cpuop_func op_67ff_5;
+extern cpuop_func op_6800_5;
+extern cpuop_func op_6801_5;
+extern cpuop_func op_68ff_5;
+extern cpuop_func op_6900_5;
+extern cpuop_func op_6901_5;
+extern cpuop_func op_69ff_5;
+extern cpuop_func op_6a00_5;
+extern cpuop_func op_6a01_5;
+extern cpuop_func op_6aff_5;
+extern cpuop_func op_6b00_5;
+extern cpuop_func op_6b01_5;
+extern cpuop_func op_6bff_5;
+extern cpuop_func op_6c00_5;
+extern cpuop_func op_6c01_5;
+extern cpuop_func op_6cff_5;
+extern cpuop_func op_6d00_5;
+extern cpuop_func op_6d01_5;
+extern cpuop_func op_6dff_5;
+extern cpuop_func op_6e00_5;
+extern cpuop_func op_6e01_5;
+extern cpuop_func op_6eff_5;
+extern cpuop_func op_6f00_5;
+extern cpuop_func op_6f01_5;
+extern cpuop_func op_6fff_5;
+extern cpuop_func op_7000_5;
+extern cpuop_func op_8000_5;
+extern cpuop_func op_8010_5;
+extern cpuop_func op_8018_5;
+extern cpuop_func op_8020_5;
+extern cpuop_func op_8028_5;
+extern cpuop_func op_8030_5;
+extern cpuop_func op_8038_5;
+extern cpuop_func op_8039_5;
+extern cpuop_func op_803a_5;
+extern cpuop_func op_803b_5;
+extern cpuop_func op_803c_5;
+extern cpuop_func op_8040_5;
+extern cpuop_func op_8050_5;
+extern cpuop_func op_8058_5;
+extern cpuop_func op_8060_5;
+extern cpuop_func op_8068_5;
+extern cpuop_func op_8070_5;
+extern cpuop_func op_8078_5;
+extern cpuop_func op_8079_5;
+extern cpuop_func op_807a_5;
+extern cpuop_func op_807b_5;
+extern cpuop_func op_807c_5;
+extern cpuop_func op_8080_5;
+extern cpuop_func op_8090_5;
+extern cpuop_func op_8098_5;
+extern cpuop_func op_80a0_5;
+extern cpuop_func op_80a8_5;
+extern cpuop_func op_80b0_5;
+extern cpuop_func op_80b8_5;
+extern cpuop_func op_80b9_5;
+extern cpuop_func op_80ba_5;
+extern cpuop_func op_80bb_5;
+extern cpuop_func op_80bc_5;
+extern cpuop_func op_80c0_5;
+extern cpuop_func op_80d0_5;
+extern cpuop_func op_80d8_5;
+extern cpuop_func op_80e0_5;
+extern cpuop_func op_80e8_5;
+extern cpuop_func op_80f0_5;
+extern cpuop_func op_80f8_5;
+extern cpuop_func op_80f9_5;
+extern cpuop_func op_80fa_5;
+extern cpuop_func op_80fb_5;
+extern cpuop_func op_80fc_5;
+extern cpuop_func op_8100_5;
+extern cpuop_func op_8108_5;
+extern cpuop_func op_8110_5;
+extern cpuop_func op_8118_5;
+extern cpuop_func op_8120_5;
+extern cpuop_func op_8128_5;
+extern cpuop_func op_8130_5;
+extern cpuop_func op_8138_5;
+extern cpuop_func op_8139_5;
+extern cpuop_func op_8150_5;
+extern cpuop_func op_8158_5;
+extern cpuop_func op_8160_5;
+extern cpuop_func op_8168_5;
+extern cpuop_func op_8170_5;
+extern cpuop_func op_8178_5;
+extern cpuop_func op_8179_5;
+extern cpuop_func op_8190_5;
+extern cpuop_func op_8198_5;
+extern cpuop_func op_81a0_5;
+extern cpuop_func op_81a8_5;
+extern cpuop_func op_81b0_5;
+extern cpuop_func op_81b8_5;
+extern cpuop_func op_81b9_5;
+extern cpuop_func op_81c0_5;
+extern cpuop_func op_81d0_5;
+extern cpuop_func op_81d8_5;
+extern cpuop_func op_81e0_5;
+extern cpuop_func op_81e8_5;
+extern cpuop_func op_81f0_5;
+extern cpuop_func op_81f8_5;
+extern cpuop_func op_81f9_5;
+extern cpuop_func op_81fa_5;
+extern cpuop_func op_81fb_5;
+extern cpuop_func op_81fc_5;
+extern cpuop_func op_9000_5;
+extern cpuop_func op_9010_5;
+extern cpuop_func op_9018_5;
+extern cpuop_func op_9020_5;
+extern cpuop_func op_9028_5;
+extern cpuop_func op_9030_5;
+extern cpuop_func op_9038_5;
+extern cpuop_func op_9039_5;
+extern cpuop_func op_903a_5;
+extern cpuop_func op_903b_5;
+extern cpuop_func op_903c_5;
+extern cpuop_func op_9040_5;
+extern cpuop_func op_9048_5;
+extern cpuop_func op_9050_5;
+extern cpuop_func op_9058_5;
+extern cpuop_func op_9060_5;
+extern cpuop_func op_9068_5;
+extern cpuop_func op_9070_5;
+extern cpuop_func op_9078_5;
+extern cpuop_func op_9079_5;
+extern cpuop_func op_907a_5;
+extern cpuop_func op_907b_5;
+extern cpuop_func op_907c_5;
+extern cpuop_func op_9080_5;
+extern cpuop_func op_9088_5;
+extern cpuop_func op_9090_5;
+extern cpuop_func op_9098_5;
+extern cpuop_func op_90a0_5;
+extern cpuop_func op_90a8_5;
+extern cpuop_func op_90b0_5;
+extern cpuop_func op_90b8_5;
+extern cpuop_func op_90b9_5;
+extern cpuop_func op_90ba_5;
+extern cpuop_func op_90bb_5;
+extern cpuop_func op_90bc_5;
+extern cpuop_func op_90c0_5;
+extern cpuop_func op_90c8_5;
+extern cpuop_func op_90d0_5;
+extern cpuop_func op_90d8_5;
+extern cpuop_func op_90e0_5;
+extern cpuop_func op_90e8_5;
+extern cpuop_func op_90f0_5;
+extern cpuop_func op_90f8_5;
+extern cpuop_func op_90f9_5;
+extern cpuop_func op_90fa_5;
+extern cpuop_func op_90fb_5;
+extern cpuop_func op_90fc_5;
+extern cpuop_func op_9100_5;
+extern cpuop_func op_9108_5;
+extern cpuop_func op_9110_5;
+extern cpuop_func op_9118_5;
+extern cpuop_func op_9120_5;
+extern cpuop_func op_9128_5;
+extern cpuop_func op_9130_5;
+extern cpuop_func op_9138_5;
+extern cpuop_func op_9139_5;
+extern cpuop_func op_9140_5;
+extern cpuop_func op_9148_5;
+extern cpuop_func op_9150_5;
+extern cpuop_func op_9158_5;
+extern cpuop_func op_9160_5;
+extern cpuop_func op_9168_5;
+extern cpuop_func op_9170_5;
+extern cpuop_func op_9178_5;
+extern cpuop_func op_9179_5;
+extern cpuop_func op_9180_5;
+extern cpuop_func op_9188_5;
+extern cpuop_func op_9190_5;
+extern cpuop_func op_9198_5;
+extern cpuop_func op_91a0_5;
+extern cpuop_func op_91a8_5;
+extern cpuop_func op_91b0_5;
+extern cpuop_func op_91b8_5;
+extern cpuop_func op_91b9_5;
+extern cpuop_func op_91c0_5;
+extern cpuop_func op_91c8_5;
+extern cpuop_func op_91d0_5;
+extern cpuop_func op_91d8_5;
+extern cpuop_func op_91e0_5;
+extern cpuop_func op_91e8_5;
+extern cpuop_func op_91f0_5;
+extern cpuop_func op_91f8_5;
+extern cpuop_func op_91f9_5;
+extern cpuop_func op_91fa_5;
+extern cpuop_func op_91fb_5;
+extern cpuop_func op_91fc_5;
+extern cpuop_func op_b000_5;
+extern cpuop_func op_b010_5;
+extern cpuop_func op_b018_5;
+extern cpuop_func op_b020_5;
+extern cpuop_func op_b028_5;
+extern cpuop_func op_b030_5;
+extern cpuop_func op_b038_5;
+extern cpuop_func op_b039_5;
+extern cpuop_func op_b03a_5;
+extern cpuop_func op_b03b_5;
+extern cpuop_func op_b03c_5;
+extern cpuop_func op_b040_5;
+extern cpuop_func op_b048_5;
+extern cpuop_func op_b050_5;
+extern cpuop_func op_b058_5;
+extern cpuop_func op_b060_5;
+extern cpuop_func op_b068_5;
+extern cpuop_func op_b070_5;
+extern cpuop_func op_b078_5;
+extern cpuop_func op_b079_5;
+extern cpuop_func op_b07a_5;
+extern cpuop_func op_b07b_5;
+extern cpuop_func op_b07c_5;
+extern cpuop_func op_b080_5;
+extern cpuop_func op_b088_5;
+extern cpuop_func op_b090_5;
+extern cpuop_func op_b098_5;
+extern cpuop_func op_b0a0_5;
+extern cpuop_func op_b0a8_5;
+extern cpuop_func op_b0b0_5;
+extern cpuop_func op_b0b8_5;
+extern cpuop_func op_b0b9_5;
+extern cpuop_func op_b0ba_5;
+extern cpuop_func op_b0bb_5;
+extern cpuop_func op_b0bc_5;
+extern cpuop_func op_b0c0_5;
+extern cpuop_func op_b0c8_5;
+extern cpuop_func op_b0d0_5;
+extern cpuop_func op_b0d8_5;
+extern cpuop_func op_b0e0_5;
+extern cpuop_func op_b0e8_5;
+extern cpuop_func op_b0f0_5;
+extern cpuop_func op_b0f8_5;
+extern cpuop_func op_b0f9_5;
+extern cpuop_func op_b0fa_5;
+extern cpuop_func op_b0fb_5;
+extern cpuop_func op_b0fc_5;
+extern cpuop_func op_b100_5;
+extern cpuop_func op_b108_5;
+extern cpuop_func op_b110_5;
+extern cpuop_func op_b118_5;
+extern cpuop_func op_b120_5;
+extern cpuop_func op_b128_5;
+extern cpuop_func op_b130_5;
+extern cpuop_func op_b138_5;
+extern cpuop_func op_b139_5;
+extern cpuop_func op_b140_5;
+extern cpuop_func op_b148_5;
+extern cpuop_func op_b150_5;
+extern cpuop_func op_b158_5;
+extern cpuop_func op_b160_5;
+extern cpuop_func op_b168_5;
+extern cpuop_func op_b170_5;
+extern cpuop_func op_b178_5;
+extern cpuop_func op_b179_5;
+extern cpuop_func op_b180_5;
+extern cpuop_func op_b188_5;
+extern cpuop_func op_b190_5;
+extern cpuop_func op_b198_5;
+extern cpuop_func op_b1a0_5;
+extern cpuop_func op_b1a8_5;
+extern cpuop_func op_b1b0_5;
+extern cpuop_func op_b1b8_5;
+extern cpuop_func op_b1b9_5;
+extern cpuop_func op_b1c0_5;
+extern cpuop_func op_b1c8_5;
+extern cpuop_func op_b1d0_5;
+extern cpuop_func op_b1d8_5;
+extern cpuop_func op_b1e0_5;
+extern cpuop_func op_b1e8_5;
+extern cpuop_func op_b1f0_5;
+extern cpuop_func op_b1f8_5;
+extern cpuop_func op_b1f9_5;
+extern cpuop_func op_b1fa_5;
+extern cpuop_func op_b1fb_5;
+extern cpuop_func op_b1fc_5;
+extern cpuop_func op_c000_5;
+extern cpuop_func op_c010_5;
+extern cpuop_func op_c018_5;
+extern cpuop_func op_c020_5;
+extern cpuop_func op_c028_5;
+extern cpuop_func op_c030_5;
+extern cpuop_func op_c038_5;
+extern cpuop_func op_c039_5;
+extern cpuop_func op_c03a_5;
+extern cpuop_func op_c03b_5;
+extern cpuop_func op_c03c_5;
+extern cpuop_func op_c040_5;
+extern cpuop_func op_c050_5;
+extern cpuop_func op_c058_5;
+extern cpuop_func op_c060_5;
+extern cpuop_func op_c068_5;
+extern cpuop_func op_c070_5;
+extern cpuop_func op_c078_5;
+extern cpuop_func op_c079_5;
+extern cpuop_func op_c07a_5;
+extern cpuop_func op_c07b_5;
+extern cpuop_func op_c07c_5;
+extern cpuop_func op_c080_5;
+extern cpuop_func op_c090_5;
+extern cpuop_func op_c098_5;
+extern cpuop_func op_c0a0_5;
+extern cpuop_func op_c0a8_5;
+extern cpuop_func op_c0b0_5;
+extern cpuop_func op_c0b8_5;
+extern cpuop_func op_c0b9_5;
+extern cpuop_func op_c0ba_5;
+extern cpuop_func op_c0bb_5;
+extern cpuop_func op_c0bc_5;
+extern cpuop_func op_c0c0_5;
+extern cpuop_func op_c0d0_5;
+extern cpuop_func op_c0d8_5;
+extern cpuop_func op_c0e0_5;
+extern cpuop_func op_c0e8_5;
+extern cpuop_func op_c0f0_5;
+extern cpuop_func op_c0f8_5;
+extern cpuop_func op_c0f9_5;
+extern cpuop_func op_c0fa_5;
+extern cpuop_func op_c0fb_5;
+extern cpuop_func op_c0fc_5;
+extern cpuop_func op_c100_5;
+extern cpuop_func op_c108_5;
+extern cpuop_func op_c110_5;
+extern cpuop_func op_c118_5;
+extern cpuop_func op_c120_5;
+extern cpuop_func op_c128_5;
+extern cpuop_func op_c130_5;
+extern cpuop_func op_c138_5;
+extern cpuop_func op_c139_5;
+extern cpuop_func op_c140_5;
+extern cpuop_func op_c148_5;
+extern cpuop_func op_c150_5;
+extern cpuop_func op_c158_5;
+extern cpuop_func op_c160_5;
+extern cpuop_func op_c168_5;
+extern cpuop_func op_c170_5;
+extern cpuop_func op_c178_5;
+extern cpuop_func op_c179_5;
+extern cpuop_func op_c188_5;
+extern cpuop_func op_c190_5;
+extern cpuop_func op_c198_5;
+extern cpuop_func op_c1a0_5;
+extern cpuop_func op_c1a8_5;
+extern cpuop_func op_c1b0_5;
+extern cpuop_func op_c1b8_5;
+extern cpuop_func op_c1b9_5;
+extern cpuop_func op_c1c0_5;
+extern cpuop_func op_c1d0_5;
+extern cpuop_func op_c1d8_5;
+extern cpuop_func op_c1e0_5;
+extern cpuop_func op_c1e8_5;
+extern cpuop_func op_c1f0_5;
+extern cpuop_func op_c1f8_5;
+extern cpuop_func op_c1f9_5;
+extern cpuop_func op_c1fa_5;
+extern cpuop_func op_c1fb_5;
+extern cpuop_func op_c1fc_5;
+extern cpuop_func op_d000_5;
+extern cpuop_func op_d010_5;
+extern cpuop_func op_d018_5;
+extern cpuop_func op_d020_5;
+extern cpuop_func op_d028_5;
+extern cpuop_func op_d030_5;
+extern cpuop_func op_d038_5;
+extern cpuop_func op_d039_5;
+extern cpuop_func op_d03a_5;
+extern cpuop_func op_d03b_5;
+extern cpuop_func op_d03c_5;
+extern cpuop_func op_d040_5;
+extern cpuop_func op_d048_5;
+extern cpuop_func op_d050_5;
+extern cpuop_func op_d058_5;
+extern cpuop_func op_d060_5;
+extern cpuop_func op_d068_5;
+extern cpuop_func op_d070_5;
+extern cpuop_func op_d078_5;
+extern cpuop_func op_d079_5;
+extern cpuop_func op_d07a_5;
+extern cpuop_func op_d07b_5;
+extern cpuop_func op_d07c_5;
+extern cpuop_func op_d080_5;
+extern cpuop_func op_d088_5;
+extern cpuop_func op_d090_5;
+extern cpuop_func op_d098_5;
+extern cpuop_func op_d0a0_5;
+extern cpuop_func op_d0a8_5;
+extern cpuop_func op_d0b0_5;
+extern cpuop_func op_d0b8_5;
+extern cpuop_func op_d0b9_5;
+extern cpuop_func op_d0ba_5;
+extern cpuop_func op_d0bb_5;
+extern cpuop_func op_d0bc_5;
+extern cpuop_func op_d0c0_5;
+extern cpuop_func op_d0c8_5;
+extern cpuop_func op_d0d0_5;
+extern cpuop_func op_d0d8_5;
+extern cpuop_func op_d0e0_5;
+extern cpuop_func op_d0e8_5;
+extern cpuop_func op_d0f0_5;
+extern cpuop_func op_d0f8_5;
+extern cpuop_func op_d0f9_5;
+extern cpuop_func op_d0fa_5;
+extern cpuop_func op_d0fb_5;
+extern cpuop_func op_d0fc_5;
+extern cpuop_func op_d100_5;
+extern cpuop_func op_d108_5;
+extern cpuop_func op_d110_5;
+extern cpuop_func op_d118_5;
+extern cpuop_func op_d120_5;
+extern cpuop_func op_d128_5;
+extern cpuop_func op_d130_5;
+extern cpuop_func op_d138_5;
+extern cpuop_func op_d139_5;
+extern cpuop_func op_d140_5;
+extern cpuop_func op_d148_5;
+extern cpuop_func op_d150_5;
+extern cpuop_func op_d158_5;
+extern cpuop_func op_d160_5;
+extern cpuop_func op_d168_5;
+extern cpuop_func op_d170_5;
+extern cpuop_func op_d178_5;
+extern cpuop_func op_d179_5;
+extern cpuop_func op_d180_5;
+extern cpuop_func op_d188_5;
+extern cpuop_func op_d190_5;
+extern cpuop_func op_d198_5;
+extern cpuop_func op_d1a0_5;
+extern cpuop_func op_d1a8_5;
+extern cpuop_func op_d1b0_5;
+extern cpuop_func op_d1b8_5;
+extern cpuop_func op_d1b9_5;
+extern cpuop_func op_d1c0_5;
+extern cpuop_func op_d1c8_5;
+extern cpuop_func op_d1d0_5;
+extern cpuop_func op_d1d8_5;
+extern cpuop_func op_d1e0_5;
+extern cpuop_func op_d1e8_5;
+extern cpuop_func op_d1f0_5;
+extern cpuop_func op_d1f8_5;
+extern cpuop_func op_d1f9_5;
+extern cpuop_func op_d1fa_5;
+extern cpuop_func op_d1fb_5;
+extern cpuop_func op_d1fc_5;
+extern cpuop_func op_e000_5;
+extern cpuop_func op_e008_5;
+extern cpuop_func op_e010_5;
+extern cpuop_func op_e018_5;
+extern cpuop_func op_e020_5;
+extern cpuop_func op_e028_5;
+extern cpuop_func op_e030_5;
+extern cpuop_func op_e038_5;
+extern cpuop_func op_e040_5;
+extern cpuop_func op_e048_5;
+extern cpuop_func op_e050_5;
+extern cpuop_func op_e058_5;
+extern cpuop_func op_e060_5;
+extern cpuop_func op_e068_5;
+extern cpuop_func op_e070_5;
+extern cpuop_func op_e078_5;
+extern cpuop_func op_e080_5;
+extern cpuop_func op_e088_5;
+extern cpuop_func op_e090_5;
+extern cpuop_func op_e098_5;
+extern cpuop_func op_e0a0_5;
+extern cpuop_func op_e0a8_5;
+extern cpuop_func op_e0b0_5;
+extern cpuop_func op_e0b8_5;
+extern cpuop_func op_e0d0_5;
+extern cpuop_func op_e0d8_5;
+extern cpuop_func op_e0e0_5;
+extern cpuop_func op_e0e8_5;
+extern cpuop_func op_e0f0_5;
+extern cpuop_func op_e0f8_5;
+extern cpuop_func op_e0f9_5;
+extern cpuop_func op_e100_5;
+extern cpuop_func op_e108_5;
+extern cpuop_func op_e110_5;
+extern cpuop_func op_e118_5;
+extern cpuop_func op_e120_5;
+extern cpuop_func op_e128_5;
+extern cpuop_func op_e130_5;
+extern cpuop_func op_e138_5;
+extern cpuop_func op_e140_5;
+extern cpuop_func op_e148_5;
+extern cpuop_func op_e150_5;
+extern cpuop_func op_e158_5;
+extern cpuop_func op_e160_5;
+extern cpuop_func op_e168_5;
+extern cpuop_func op_e170_5;
+extern cpuop_func op_e178_5;
+extern cpuop_func op_e180_5;
+extern cpuop_func op_e188_5;
+extern cpuop_func op_e190_5;
+extern cpuop_func op_e198_5;
+extern cpuop_func op_e1a0_5;
+extern cpuop_func op_e1a8_5;
+extern cpuop_func op_e1b0_5;
+extern cpuop_func op_e1b8_5;
+extern cpuop_func op_e1d0_5;
+extern cpuop_func op_e1d8_5;
+extern cpuop_func op_e1e0_5;
+extern cpuop_func op_e1e8_5;
+extern cpuop_func op_e1f0_5;
+extern cpuop_func op_e1f8_5;
+extern cpuop_func op_e1f9_5;
+extern cpuop_func op_e2d0_5;
+extern cpuop_func op_e2d8_5;
+extern cpuop_func op_e2e0_5;
+extern cpuop_func op_e2e8_5;
+extern cpuop_func op_e2f0_5;
+extern cpuop_func op_e2f8_5;
+extern cpuop_func op_e2f9_5;
+extern cpuop_func op_e3d0_5;
+extern cpuop_func op_e3d8_5;
+extern cpuop_func op_e3e0_5;
+extern cpuop_func op_e3e8_5;
+extern cpuop_func op_e3f0_5;
+extern cpuop_func op_e3f8_5;
+extern cpuop_func op_e3f9_5;
+extern cpuop_func op_e4d0_5;
+extern cpuop_func op_e4d8_5;
+extern cpuop_func op_e4e0_5;
+extern cpuop_func op_e4e8_5;
+extern cpuop_func op_e4f0_5;
+extern cpuop_func op_e4f8_5;
+extern cpuop_func op_e4f9_5;
+extern cpuop_func op_e5d0_5;
+extern cpuop_func op_e5d8_5;
+extern cpuop_func op_e5e0_5;
+extern cpuop_func op_e5e8_5;
+extern cpuop_func op_e5f0_5;
+extern cpuop_func op_e5f8_5;
+extern cpuop_func op_e5f9_5;
+extern cpuop_func op_e6d0_5;
+extern cpuop_func op_e6d8_5;
+extern cpuop_func op_e6e0_5;
+extern cpuop_func op_e6e8_5;
+extern cpuop_func op_e6f0_5;
+extern cpuop_func op_e6f8_5;
+extern cpuop_func op_e6f9_5;
+extern cpuop_func op_e7d0_5;
+extern cpuop_func op_e7d8_5;
+extern cpuop_func op_e7e0_5;
+extern cpuop_func op_e7e8_5;
+extern cpuop_func op_e7f0_5;
+extern cpuop_func op_e7f8_5;
+extern cpuop_func op_e7f9_5;
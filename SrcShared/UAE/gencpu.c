@@ -40,6 +40,7 @@ static int cpu_level;
 #define PALM_HEADERS		1	// Changes made to accounts for Poser's header structures
 #define PALM_BUG_FIX		1	// Changes made to fix UAE bugs.
 #define PALM_SYSTEM_CALL	1	// Changes made to track system calls
+#define PALM_FAST			1	// Changes made to generate the direct-access handlers
 
 #if PALM_STACK
 int adda_hack = 0;
@@ -3128,6 +3129,33 @@ static void generate_includes (FILE * f)
 #endif	// PALM_HEADERS
 }
 
+#if PALM_FAST
+/* The second table of 68000 handlers (postfix 5) is the same code as the
+ * first, compiled with loads and stores that go straight to host memory
+ * for plain RAM and ROM banks instead of through the bank handlers.  See
+ * EmMemFastGet32 and friends in EmMemory.h.  EmCPU68K switches to this
+ * table when no debugging, profiling or access checking is enabled.  */
+static void generate_fast_accessors (FILE * f)
+{
+    static const char *names[] = {
+	"get_long", "EmMemFastGet32",
+	"get_word", "EmMemFastGet16",
+	"get_byte", "EmMemFastGet8",
+	"put_long", "EmMemFastPut32",
+	"put_word", "EmMemFastPut16",
+	"put_byte", "EmMemFastPut8",
+	NULL
+    };
+    int i;
+
+    fprintf (f, "\n");
+    for (i = 0; names[i]; i += 2) {
+	fprintf (f, "#undef %s\n", names[i]);
+	fprintf (f, "#define %s %s\n", names[i], names[i + 1]);
+    }
+}
+#endif	// PALM_FAST
+
 static int postfix;
 
 static void generate_one_opcode (int rp)
@@ -3262,8 +3290,17 @@ static void generate_func (void)
     using_prefetch = 0;
     using_exception_3 = 0;
 #if PALM_MIN
+#if PALM_FAST
+    for (i = 3; i <= 5; i += 2) {
+	if (i == 5) {
+	    freopen ("cpuemufast.c", "wb", stdout);
+	    generate_includes (stdout);
+	    generate_fast_accessors (stdout);
+	}
+#else	// PALM_FAST
     {
 	i = 3;
+#endif	// PALM_FAST
 	cpu_level = 0;
     for (rp = 0; rp < nr_cpuop_funcs; rp++)
 	opcode_next_clev[rp] = 0;
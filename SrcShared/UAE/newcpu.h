@@ -221,6 +221,8 @@ extern struct cputbl op_smalltbl_2[];
 extern struct cputbl op_smalltbl_3[];
 /* 68000 slow but compatible.  */
 extern struct cputbl op_smalltbl_4[];
+/* 68000 with direct RAM/ROM access (see cpuemufast.c).  */
+extern struct cputbl op_smalltbl_5[];
 
 extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
 
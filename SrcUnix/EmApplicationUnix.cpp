@@ -0,0 +1,225 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmApplicationUnix.h"
+
+#include "EmDocument.h"			// gDocument
+#include "EmFileRef.h"			// EmFileRef::SetEmulatorRef
+#include "Hordes.h"				// gErrorHappened, gWarningHappened
+#include "PreferenceMgr.h"		// EmulatorPreferences
+
+#include <limits.h>				// PATH_MAX
+#include <signal.h>				// signal, SIGPIPE
+
+
+EmApplicationUnix*	gHostApplication;
+
+// How long to sleep between idle calls.  The CPU runs in its own thread,
+// so this only determines how quickly we respond to deferred actions
+// (session close, quit, debugger and RPC packets).
+
+const long	kIdleInterval	= 10000;	// In microseconds.
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	main
+ *
+ * DESCRIPTION:	Application entry point.  Creates the preferences and
+ *				then the application object.  Uses the application
+ *				object to initizalize, run, and shutdown the system.
+ *				A top-level exception handler is also installed in
+ *				order to catch any wayward exceptions and report them
+ *				with a Fatal Internal Error message.
+ *
+ * PARAMETERS:	Standard main parameters
+ *
+ * RETURNED:	Zero by default.  If a non-fatal error occurred, returns
+ *				1.  If a fatal error occurred while running a Gremlin,
+ *				returns 2.  This is the same as the Windows version.
+ *
+ ***********************************************************************/
+
+int main (int argc, char** argv)
+{
+	// A debugger or RPC client going away shouldn't take us with it.
+
+	signal (SIGPIPE, SIG_IGN);
+
+	EmulatorPreferences		prefs;
+	EmApplicationUnix		theApp;
+
+	try
+	{
+		if (theApp.Startup (argc, argv))
+		{
+			theApp.Run ();
+		}
+	}
+	catch (...)
+	{
+		fprintf (stderr, "Palm OS Emulator: Fatal Internal Error\n");
+		gErrorHappened = true;
+	}
+
+	theApp.Shutdown ();
+
+	return
+		gErrorHappened ? 2 :
+		gWarningHappened ? 1 : 0;
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationUnix::EmApplicationUnix
+ *
+ * DESCRIPTION:	Constructor.  Sets the global host application variable
+ *				to point to us.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+EmApplicationUnix::EmApplicationUnix (void) :
+	EmApplication ()
+{
+	EmAssert (gHostApplication == NULL);
+	gHostApplication = this;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationUnix::~EmApplicationUnix
+ *
+ * DESCRIPTION:	Destructor.  Sets the global host application variable
+ *				to NULL.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+EmApplicationUnix::~EmApplicationUnix (void)
+{
+	EmAssert (gHostApplication == this);
+	gHostApplication = NULL;
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationUnix::Startup
+ *
+ * DESCRIPTION:	Performs one-time startup initialization.
+ *
+ * PARAMETERS:	argc, argv - the command line.
+ *
+ * RETURNED:	True if the application should continue to run.
+ *
+ ***********************************************************************/
+
+Bool EmApplicationUnix::Startup (int argc, char** argv)
+{
+	// Establish a ref for the emulator application.  The preferences,
+	// skins and caches are looked up relative to it.
+
+	// argv[0] isn't a path if we were found on $PATH, so prefer what
+	// the kernel says we are (Linux only; elsewhere readlink fails).
+
+	char	path[PATH_MAX];
+	int		len = readlink ("/proc/self/exe", path, sizeof (path) - 1);
+
+	if (len > 0)
+	{
+		path[len] = 0;
+		EmFileRef::SetEmulatorRef (EmFileRef (path));
+	}
+	else
+	{
+		EmFileRef::SetEmulatorRef (EmFileRef (argv[0]));
+	}
+
+	// Cross-platform initialization.
+
+	return EmApplication::Startup (argc, argv);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationUnix::Run
+ *
+ * DESCRIPTION:	Generally run the application.  Open or create whatever
+ *				the command line asked for, then idle until something
+ *				(a -quit_on_exit app exiting, a Horde finishing with
+ *				-horde_quit_when_done, an RPC client) asks us to quit
+ *				or closes the session.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmApplicationUnix::Run (void)
+{
+	// Open or create any documents as needed.
+
+	this->HandleStartupActions ();
+
+	// While it's not time to quit...
+
+	while (!this->GetTimeToQuit ())
+	{
+		// There's nobody to ask to create or open a session, so
+		// once we're without one, we're done.
+
+		if (!gDocument)
+		{
+			this->HandleCommand (kCommandQuit);
+			break;
+		}
+
+		this->HandleIdle ();
+
+		usleep (kIdleInterval);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmApplicationUnix::Shutdown
+ *
+ * DESCRIPTION:	Performs one-time shutdown operations.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmApplicationUnix::Shutdown (void)
+{
+	EmApplication::Shutdown ();
+}
@@ -0,0 +1,45 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmApplicationUnix_h
+#define EmApplicationUnix_h
+
+#include "EmApplication.h"		// EmApplication
+
+/*
+	EmApplicationUnix is the headless sub-class of EmApplication.  It is
+	meant for running Gremlin Hordes, event playback and minimization
+	from scripts: everything it does is driven from the command line,
+	no window is ever opened, and dialogs are answered automatically
+	(see EmDlgUnix.cpp).
+
+	Run () handles the startup actions and then idles the application
+	until it's time to quit.  If the startup actions didn't produce a
+	session, there's nothing to do and it quits right away.
+*/
+
+class EmApplicationUnix : public EmApplication
+{
+	public:
+								EmApplicationUnix		(void);
+		virtual					~EmApplicationUnix		(void);
+
+	public:
+		virtual Bool			Startup					(int argc, char** argv);
+		void					Run						(void);
+		virtual void			Shutdown				(void);
+};
+
+extern EmApplicationUnix*		gHostApplication;
+
+#endif	// EmApplicationUnix_h
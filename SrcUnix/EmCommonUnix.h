@@ -0,0 +1,102 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 1999-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmCommonUnix_h
+#define EmCommonUnix_h
+
+// Common header file included by all Palm OS Emulator for Unix files.
+
+
+// Palm headers
+
+#include "Palm.h"
+
+
+// Std C/C++ Library stuff
+
+#include <ctype.h>				// isalpha, tolower
+#include <errno.h>				// errno, ENOENT
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>			// find, sort
+#include <deque>				// deque
+#include <iterator>				// back_inserter
+#include <list> 				// list
+#include <map>
+#include <string>
+#include <utility>				// pair
+#include <vector>
+
+
+// POSIX headers
+
+#include <sys/types.h>
+#include <unistd.h>				// getcwd, unlink, usleep
+
+
+// ============================================
+// ========== Windows type mapping ============
+// ============================================
+
+// The CLIE support in SrcShared was written against the Win32 types.
+// Provide the handful it uses outside of SrcWin.
+
+typedef int				BOOL;
+typedef unsigned char	BYTE;
+typedef unsigned short	WORD;
+typedef unsigned long	DWORD;
+typedef char*			LPSTR;
+typedef const char*		LPCSTR;
+
+#ifndef TRUE
+#define TRUE			1
+#endif
+
+#ifndef FALSE
+#define FALSE			0
+#endif
+
+// ============================================
+// ========== Socket mapping ==================
+// ============================================
+
+// SocketMessaging and the NetLib/serial socket code use the WinSock names.
+
+typedef int				SOCKET;
+
+#define INVALID_SOCKET	(-1)
+#define SOCKET_ERROR	(-1)
+
+#define closesocket		close
+#define ioctlsocket		ioctl
+
+#define WSAEINVAL		EINVAL
+
+
+// ============================================
+// ========== Debug output ====================
+// ============================================
+
+// The Sony patch modules trace their library calls with this in debug
+// builds.  There's no debugger output window, so send it to stderr.
+
+inline void OutputDebugString (const char* s)
+{
+	fputs (s, stderr);
+}
+
+#endif	/* EmCommonUnix_h */
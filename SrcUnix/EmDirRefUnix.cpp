@@ -0,0 +1,573 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmDirRefUnix.h"
+
+#include "EmFileRef.h"
+
+#include <dirent.h>				// opendir, readdir, closedir
+#include <limits.h>				// PATH_MAX
+#include <sys/stat.h>			// stat, mkdir
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::EmDirRef
+ *
+ * DESCRIPTION:	Various ways to make a directory reference.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	nothing.
+ *
+ ***********************************************************************/
+
+EmDirRef::EmDirRef (void) :
+	fDirPath ()
+{
+}
+
+
+EmDirRef::EmDirRef (const EmDirRef& other) :
+	fDirPath (other.fDirPath)
+{
+}
+
+
+EmDirRef::EmDirRef (const char* path) :
+	fDirPath (path)
+{
+	this->MaybeAppendSlash ();
+	this->MaybeResolveLink ();
+}
+
+
+EmDirRef::EmDirRef (const string& path) :
+	fDirPath (path)
+{
+	this->MaybeAppendSlash ();
+	this->MaybeResolveLink ();
+}
+
+
+EmDirRef::EmDirRef (const EmDirRef& parent, const char* path) :
+	fDirPath (parent.GetFullPath () + path)
+{
+	this->MaybeAppendSlash ();
+	this->MaybeResolveLink ();
+}
+
+
+EmDirRef::EmDirRef (const EmDirRef& parent, const string& path) :
+	fDirPath (parent.GetFullPath () + path)
+{
+	this->MaybeAppendSlash ();
+	this->MaybeResolveLink ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::~EmDirRef
+ *
+ * DESCRIPTION:	EmDirRef destructor.  Nothing special to do...
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	nothing.
+ *
+ ***********************************************************************/
+
+EmDirRef::~EmDirRef (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::operator=
+ *
+ * DESCRIPTION:	Assignment operator.  If "other" is not the same as
+ *				the controlled object, copy the contents.
+ *
+ * PARAMETERS:	other - object to copy.
+ *
+ * RETURNED:	reference to self.
+ *
+ ***********************************************************************/
+
+EmDirRef&
+EmDirRef::operator= (const EmDirRef& other)
+{
+	if (&other != this)
+	{
+		fDirPath = other.fDirPath;
+	}
+
+	return *this;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::IsSpecified
+ *
+ * DESCRIPTION:	Returns whether or not the controlled object has been
+ *				pointed to a (possibly non-existant) directory, or if
+ *				it's empty (that it, it was created with the default
+ *				ctor).
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	True if the object points to a directory.
+ *
+ ***********************************************************************/
+
+Bool
+EmDirRef::IsSpecified (void) const
+{
+	return !fDirPath.empty ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::Exists
+ *
+ * DESCRIPTION:	Returns whether or not the controlled object points to
+ *				an existing directory.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	True if the referenced directory exists.
+ *
+ ***********************************************************************/
+
+Bool
+EmDirRef::Exists (void) const
+{
+	if (this->IsSpecified ())
+	{
+		return ::PrvIsExistingDirectory (fDirPath);
+	}
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::Create
+ *
+ * DESCRIPTION:	Create the directory, along with any missing parent
+ *				directories.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	nothing.
+ *
+ ***********************************************************************/
+
+void
+EmDirRef::Create (void) const
+{
+	if (!this->Exists () && this->IsSpecified ())
+	{
+		// Make sure all directories down to us are created, too.
+
+		EmDirRef	parent = this->GetParent ();
+		parent.Create ();
+
+		if (::mkdir (fDirPath.c_str (), 0777) != 0 && errno != EEXIST)
+		{
+			// !!! throw...
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::GetName
+ *
+ * DESCRIPTION:	Returns the name of the referenced directory.  Only the
+ *				directory *name* is returned, not the full path.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	A string containing the name.  If the directory is not
+ *				specified, an empty string is returned.  No checks are
+ *				made to see if the directory actually exists.
+ *
+ ***********************************************************************/
+
+string
+EmDirRef::GetName (void) const
+{
+	string	result;
+
+	if (this->IsSpecified () && fDirPath != "/")
+	{
+		// Chop off the trailing '/', and return everything after
+		// the '/' before that.
+
+		string				dirPath (fDirPath, 0, fDirPath.size () - 1);
+		string::size_type	pos = dirPath.rfind ('/');
+
+		if (pos == string::npos)
+			result = dirPath;
+		else
+			result = dirPath.substr (pos + 1);
+	}
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::GetParent
+ *
+ * DESCRIPTION:	Returns an object representing the parent (or container)
+ *				of the managed directory.  If the managed directory is
+ *				the root directory, the returned EmDirRef will be
+ *				unspecified.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	An object representing the directory's parent.
+ *
+ ***********************************************************************/
+
+EmDirRef
+EmDirRef::GetParent (void) const
+{
+	EmDirRef	result;
+
+	if (this->IsSpecified () && fDirPath != "/")
+	{
+		// Chop off the trailing '/', and keep everything up to and
+		// including the '/' before that.
+
+		string				dirPath (fDirPath, 0, fDirPath.size () - 1);
+		string::size_type	pos = dirPath.rfind ('/');
+
+		if (pos != string::npos)
+		{
+			result = EmDirRef (dirPath.substr (0, pos + 1));
+		}
+	}
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::GetFullPath
+ *
+ * DESCRIPTION:	Get a full (platform-specific) path to the object.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	An string representing the directory's path.  It always
+ *				ends with a '/'.
+ *
+ ***********************************************************************/
+
+string
+EmDirRef::GetFullPath (void) const
+{
+	return fDirPath;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::GetChildren
+ *
+ * DESCRIPTION:	Get the files and directories in the managed directory.
+ *
+ * PARAMETERS:	fileList, dirList - lists to receive the children.
+ *					Either may be NULL.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmDirRef::GetChildren (EmFileRefList* fileList, EmDirRefList* dirList) const
+{
+	DIR*	dir = ::opendir (fDirPath.c_str ());
+
+	if (!dir)
+		return;
+
+	struct dirent*	ent;
+
+	while ((ent = ::readdir (dir)) != NULL)
+	{
+		// If this is the current or parent directory shortcut,
+		// skip it.
+
+		if ((strcmp (ent->d_name, ".") == 0) ||
+			(strcmp (ent->d_name, "..") == 0))
+		{
+			continue;
+		}
+
+		// Determine if this is a directory or file (following any
+		// symbolic links), and push it onto the appropriate list.
+
+		string	fullPath (fDirPath + ent->d_name);
+
+		if (::PrvIsExistingDirectory (fullPath))
+		{
+			if (dirList)
+			{
+				dirList->push_back (EmDirRef (fullPath));
+			}
+		}
+		else
+		{
+			if (fileList)
+			{
+				fileList->push_back (EmFileRef (fullPath));
+			}
+		}
+	}
+
+	::closedir (dir);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::operator==
+ * FUNCTION:	EmDirRef::operator!=
+ * FUNCTION:	EmDirRef::operator>
+ * FUNCTION:	EmDirRef::operator<
+ *
+ * DESCRIPTION:	Comparison operators, needed to store these objects in
+ *				STL containers.
+ *
+ * PARAMETERS:	other - object to compare ourself to.
+ *
+ * RETURNED:	True if the requested condition is true.  Comparisons
+ *				are based on the directory's full path, and are case-
+ *				sensitive.
+ *
+ ***********************************************************************/
+
+bool
+EmDirRef::operator== (const EmDirRef& other) const
+{
+	return fDirPath == other.fDirPath;
+}
+
+
+bool
+EmDirRef::operator!= (const EmDirRef& other) const
+{
+	return fDirPath != other.fDirPath;
+}
+
+
+bool
+EmDirRef::operator> (const EmDirRef& other) const
+{
+	return fDirPath > other.fDirPath;
+}
+
+
+bool
+EmDirRef::operator< (const EmDirRef& other) const
+{
+	return fDirPath < other.fDirPath;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	FromPrefString
+ *
+ * DESCRIPTION:	Initialize this object from the string containing a
+ *				directory reference stored in a preference file.
+ *
+ * PARAMETERS:	s - the string from the preference file
+ *
+ * RETURNED:	True if we were able to carry out the initialization.
+ *				False otherwise.  Note that the string is NOT validated
+ *				to see if it refers to an existing directory.
+ *
+ ***********************************************************************/
+
+bool
+EmDirRef::FromPrefString (const string& s)
+{
+	fDirPath = s;
+	this->MaybeAppendSlash ();
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	ToPrefString
+ *
+ * DESCRIPTION:	Produce a string that can be stored to a preference file
+ *				and which can later be used to reproduce the current
+ *				directory reference object.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The string to be written to the preference file.
+ *
+ ***********************************************************************/
+
+string
+EmDirRef::ToPrefString (void) const
+{
+	return fDirPath;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::GetEmulatorDirectory
+ *
+ * DESCRIPTION:	Return an EmDirRef for Poser's directory.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The desired EmDirRef.
+ *
+ ***********************************************************************/
+
+EmDirRef
+EmDirRef::GetEmulatorDirectory (void)
+{
+	return EmFileRef::GetEmulatorRef ().GetParent ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDirRef::GetPrefsDirectory
+ *
+ * DESCRIPTION:	Return an EmDirRef for Poser's preferences directory.
+ *				This is the user's home directory, or the current
+ *				directory if $HOME isn't set (as is sometimes the case
+ *				for jobs started by batch systems).
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The desired EmDirRef.
+ *
+ ***********************************************************************/
+
+EmDirRef
+EmDirRef::GetPrefsDirectory (void)
+{
+	const char*	home = ::getenv ("HOME");
+
+	if (home && home[0] != 0)
+		return EmDirRef (home);
+
+	char	buffer[PATH_MAX];
+
+	if (::getcwd (buffer, sizeof (buffer)))
+		return EmDirRef (buffer);
+
+	return EmDirRef ("/");
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	MaybeAppendSlash
+ *
+ * DESCRIPTION:	Append a trailing slash to the full path if there isn't
+ *				one already there.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void
+EmDirRef::MaybeAppendSlash (void)
+{
+	if (this->IsSpecified () && fDirPath[fDirPath.size () - 1] != '/')
+	{
+		fDirPath += '/';
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	MaybeResolveLink
+ *
+ * DESCRIPTION:	If the managed path is a symbolic link, replace it with
+ *				the path it resolves to.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void
+EmDirRef::MaybeResolveLink (void)
+{
+	char	buffer[PATH_MAX];
+
+	if (this->IsSpecified () && ::realpath (fDirPath.c_str (), buffer))
+	{
+		fDirPath = buffer;
+		this->MaybeAppendSlash ();
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvIsExistingDirectory, PrvIsExistingFile
+ *
+ * DESCRIPTION:	Return whether the given path names an existing
+ *				directory or non-directory, following symbolic links.
+ *
+ * PARAMETERS:	path - path to test.
+ *
+ * RETURNED:	True if the path names the requested kind of object.
+ *
+ ***********************************************************************/
+
+Bool PrvIsExistingDirectory (const string& path)
+{
+	struct stat	st;
+
+	return ::stat (path.c_str (), &st) == 0 && S_ISDIR (st.st_mode);
+}
+
+
+Bool PrvIsExistingFile (const string& path)
+{
+	struct stat	st;
+
+	return ::stat (path.c_str (), &st) == 0 && !S_ISDIR (st.st_mode);
+}
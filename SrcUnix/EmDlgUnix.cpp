@@ -0,0 +1,691 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmDlg.h"
+
+#include "EmRect.h"				// EmRect
+#include "Platform.h"			// Platform::GetString
+#include "Strings.r.h"			// kStr_AppName, kStr_Debug
+
+/*
+	There's nobody to show dialogs to, so they're answered automatically.
+
+	A modal dialog is "run" against an EmDlgUnixRecord, which stands in for
+	the window and remembers whatever the dialog handler puts into its
+	items.  The handler gets its usual Init call, one item is selected on
+	its behalf, and then it's destroyed:
+
+		* Common dialogs (errors, warnings, questions) are written to
+		  stderr and answered with their default button.  If that's the
+		  Debug button, the cancel button or the first other enabled
+		  button is used instead; there's no debugger to break into, and
+		  choosing Debug without one just brings the dialog back.
+
+		* All other dialogs are cancelled.  They ask for configuration
+		  that has to come from the command line or the preferences file
+		  in a headless run.
+
+	File dialogs are cancelled, and "save changes?" is answered with No.
+	Modeless dialogs (Gremlin Control, Minimization Progress) are never
+	created.
+*/
+
+struct EmDlgUnixItem
+{
+	EmDlgUnixItem (void) :
+		fMin (0),
+		fValue (0),
+		fMax (0),
+		fEnabled (true),
+		fVisible (true)
+	{
+	}
+
+	string				fText;
+	long				fMin;
+	long				fValue;
+	long				fMax;
+	Bool				fEnabled;
+	Bool				fVisible;
+	EmRect				fBounds;
+	StringList			fList;
+	EmDlgListIndexList	fSelection;
+};
+
+typedef map<EmDlgItemID, EmDlgUnixItem>	EmDlgUnixItemMap;
+
+struct EmDlgUnixRecord
+{
+	EmRect				fBounds;
+	EmDlgUnixItemMap	fItems;
+};
+
+
+static EmDlgUnixItem*	PrvGetItem (EmDlgRef dlg, EmDlgItemID item);
+static EmDlgItemID		PrvChooseCommonButton (EmDlgUnixRecord& record,
+											   const EmDlgContext& context);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunGetFile
+ *
+ * DESCRIPTION:	Platform-specific routine for getting the name of a
+ *				file from the user.  There is no user, so this always
+ *				cancels.
+ *
+ * PARAMETERS:	parameters - DoGetFileParameters.
+ *
+ * RETURNED:	kDlgItemCancel
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunGetFile (const void* parameters)
+{
+	UNUSED_PARAM (parameters)
+
+	return kDlgItemCancel;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunGetFileList
+ *
+ * DESCRIPTION:	See HostRunGetFile.
+ *
+ * PARAMETERS:	parameters - DoGetFileListParameters.
+ *
+ * RETURNED:	kDlgItemCancel
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunGetFileList (const void* parameters)
+{
+	UNUSED_PARAM (parameters)
+
+	return kDlgItemCancel;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunPutFile
+ *
+ * DESCRIPTION:	See HostRunGetFile.
+ *
+ * PARAMETERS:	parameters - DoPutFileParameters.
+ *
+ * RETURNED:	kDlgItemCancel
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunPutFile (const void* parameters)
+{
+	UNUSED_PARAM (parameters)
+
+	return kDlgItemCancel;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunGetDirectory
+ *
+ * DESCRIPTION:	See HostRunGetFile.
+ *
+ * PARAMETERS:	parameters - DoGetDirectoryParameters.
+ *
+ * RETURNED:	kDlgItemCancel
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunGetDirectory (const void* parameters)
+{
+	UNUSED_PARAM (parameters)
+
+	return kDlgItemCancel;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunAboutBox
+ *
+ * DESCRIPTION:	Print the application name and version.
+ *
+ * PARAMETERS:	parameters - unused.
+ *
+ * RETURNED:	kDlgItemOK
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunAboutBox (const void* parameters)
+{
+	UNUSED_PARAM (parameters)
+
+	string	app (Platform::GetString (kStr_AppName));
+	string	version (Platform::GetShortVersionString ());
+
+	printf ("%s %s\n", app.c_str (), version.c_str ());
+
+	return kDlgItemOK;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunSessionSave
+ *
+ * DESCRIPTION:	Ask whether to save the session.  Sessions are only
+ *				saved when asked for explicitly (-horde_save_dir, or
+ *				an RPC client), so the answer is always "no".
+ *
+ * PARAMETERS:	parameters - DoSessionSaveParameters.
+ *
+ * RETURNED:	kDlgItemNo
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunSessionSave (const void* parameters)
+{
+	UNUSED_PARAM (parameters)
+
+	return kDlgItemNo;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostRunDialog
+ *
+ * DESCRIPTION:	Common routine that handles the creation of a dialog,
+ *				initializes it (via the dialog handler), picks an item
+ *				as described at the top of this file, and closes the
+ *				dialog.
+ *
+ * PARAMETERS:	parameters - RunDialogParameters.
+ *
+ * RETURNED:	ID of the dialog item that closed the dialog.
+ *
+ ***********************************************************************/
+
+EmDlgItemID EmDlg::HostRunDialog (const void* parameters)
+{
+	EmAssert (parameters);
+	RunDialogParameters&	data = *(RunDialogParameters*) parameters;
+
+	EmDlgUnixRecord			record;
+	EmDlgContext			context;
+
+	context.fFn				= data.fFn;
+	context.fDlg			= &record;
+	context.fDlgID			= data.fDlgID;
+	context.fUserData		= data.fUserData;
+
+	EmDlgItemID		result = kDlgItemCancel;
+
+	if (context.Init () != kDlgResultClose)
+	{
+		if (context.fDlgID == kDlgCommonDialog)
+		{
+			result = ::PrvChooseCommonButton (record, context);
+		}
+		else if (context.fCancelItem != kDlgItemNone)
+		{
+			result = context.fCancelItem;
+		}
+
+		context.Event (result);
+	}
+
+	context.Destroy ();
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostDialogOpen
+ *
+ * DESCRIPTION:	Create a modeless dialog.  Nobody would see it, so
+ *				don't.
+ *
+ * PARAMETERS:	fn - the custom dialog handler
+ *				userData - custom data passed back to the dialog handler.
+ *				dlgID - ID of dialog to create.
+ *
+ * RETURNED:	NULL
+ *
+ ***********************************************************************/
+
+EmDlgRef EmDlg::HostDialogOpen (EmDlgFn fn, void* data, EmDlgID dlgID)
+{
+	UNUSED_PARAM (fn)
+	UNUSED_PARAM (data)
+	UNUSED_PARAM (dlgID)
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostDialogClose
+ *
+ * DESCRIPTION:	Close a modeless dialog.  See HostDialogOpen.
+ *
+ * PARAMETERS:	dlg - the dialog.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmDlg::HostDialogClose (EmDlgRef dlg)
+{
+	UNUSED_PARAM (dlg)
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostDialogInit
+ *
+ * DESCRIPTION:	Platform-specific dialog initialization.  Nothing to
+ *				do here.
+ *
+ * PARAMETERS:	context - the dialog context.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmDlg::HostDialogInit (EmDlgContext& context)
+{
+	UNUSED_PARAM (context)
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostStartIdling
+ *
+ * DESCRIPTION:	Start calling the dialog handler at idle time.  Our
+ *				dialogs close as soon as they open, so they never idle.
+ *
+ * PARAMETERS:	context - the dialog context.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmDlg::HostStartIdling (EmDlgContext& context)
+{
+	UNUSED_PARAM (context)
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	HostStopIdling
+ *
+ * DESCRIPTION:	See HostStartIdling.
+ *
+ * PARAMETERS:	context - the dialog context.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmDlg::HostStopIdling (EmDlgContext& context)
+{
+	UNUSED_PARAM (context)
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmDlg::SetDlgBounds, etc.
+// ---------------------------------------------------------------------------
+// The functions below just remember what they're told so that the dialog
+// handlers can read it back.
+
+void EmDlg::SetDlgBounds (EmDlgRef dlg, const EmRect& bounds)
+{
+	if (dlg)
+	{
+		((EmDlgUnixRecord*) dlg)->fBounds = bounds;
+	}
+}
+
+
+EmRect EmDlg::GetDlgBounds (EmDlgRef dlg)
+{
+	if (dlg)
+	{
+		return ((EmDlgUnixRecord*) dlg)->fBounds;
+	}
+
+	return EmRect (0, 0, 0, 0);
+}
+
+
+void EmDlg::CenterDlg (EmDlgRef dlg)
+{
+	UNUSED_PARAM (dlg)
+}
+
+
+void EmDlg::SetDlgDefaultButton (EmDlgContext& context, EmDlgItemID item)
+{
+	context.fDefaultItem = item;
+}
+
+
+void EmDlg::SetDlgCancelButton (EmDlgContext& context, EmDlgItemID item)
+{
+	context.fCancelItem = item;
+}
+
+
+void EmDlg::SetItemMin (EmDlgRef dlg, EmDlgItemID item, long minValue)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fMin = minValue;
+}
+
+
+void EmDlg::SetItemValue (EmDlgRef dlg, EmDlgItemID item, long value)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fValue = value;
+}
+
+
+void EmDlg::SetItemMax (EmDlgRef dlg, EmDlgItemID item, long maxValue)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fMax = maxValue;
+}
+
+
+void EmDlg::SetItemBounds (EmDlgRef dlg, EmDlgItemID item, const EmRect& bounds)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fBounds = bounds;
+}
+
+
+void EmDlg::SetItemText (EmDlgRef dlg, EmDlgItemID item, string str)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fText = str;
+}
+
+
+long EmDlg::GetItemMin (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	return p ? p->fMin : 0;
+}
+
+
+long EmDlg::GetItemValue (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	return p ? p->fValue : 0;
+}
+
+
+long EmDlg::GetItemMax (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	return p ? p->fMax : 0;
+}
+
+
+EmRect EmDlg::GetItemBounds (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	return p ? p->fBounds : EmRect (0, 0, 0, 0);
+}
+
+
+string EmDlg::GetItemText (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	return p ? p->fText : string ();
+}
+
+
+void EmDlg::EnableItem (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fEnabled = true;
+}
+
+
+void EmDlg::DisableItem (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fEnabled = false;
+}
+
+
+void EmDlg::ShowItem (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fVisible = true;
+}
+
+
+void EmDlg::HideItem (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+		p->fVisible = false;
+}
+
+
+#ifdef SONY_ROM
+void EmDlg::ShowItem (EmDlgRef dlg, EmDlgItemID item, BOOL show)
+{
+	EmDlg::ShowHideItem (dlg, item, show);
+}
+#endif // SONY_ROM
+
+
+void EmDlg::ClearMenu (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlg::ClearList (dlg, item);
+}
+
+
+void EmDlg::AppendToMenu (EmDlgRef dlg, EmDlgItemID item, const StringList& strList)
+{
+	EmDlg::AppendToList (dlg, item, strList);
+}
+
+
+void EmDlg::EnableMenuItem (EmDlgRef dlg, EmDlgItemID item, long menuItem)
+{
+	UNUSED_PARAM (dlg)
+	UNUSED_PARAM (item)
+	UNUSED_PARAM (menuItem)
+}
+
+
+void EmDlg::DisableMenuItem (EmDlgRef dlg, EmDlgItemID item, long menuItem)
+{
+	UNUSED_PARAM (dlg)
+	UNUSED_PARAM (item)
+	UNUSED_PARAM (menuItem)
+}
+
+
+void EmDlg::ClearList (EmDlgRef dlg, EmDlgItemID item)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+	{
+		p->fList.clear ();
+		p->fSelection.clear ();
+	}
+}
+
+
+void EmDlg::AppendToList (EmDlgRef dlg, EmDlgItemID item, const StringList& strList)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+	{
+		p->fList.insert (p->fList.end (), strList.begin (), strList.end ());
+	}
+}
+
+
+void EmDlg::SelectListItems (EmDlgRef dlg, EmDlgItemID item, const EmDlgListIndexList& itemList)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (!p)
+		return;
+
+	EmDlgListIndexList::const_iterator	iter = itemList.begin ();
+	while (iter != itemList.end ())
+	{
+		if (find (p->fSelection.begin (), p->fSelection.end (), *iter) == p->fSelection.end ())
+		{
+			p->fSelection.push_back (*iter);
+		}
+
+		++iter;
+	}
+
+	sort (p->fSelection.begin (), p->fSelection.end ());
+}
+
+
+void EmDlg::UnselectListItems (EmDlgRef dlg, EmDlgItemID item, const EmDlgListIndexList& itemList)
+{
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (!p)
+		return;
+
+	EmDlgListIndexList::const_iterator	iter = itemList.begin ();
+	while (iter != itemList.end ())
+	{
+		p->fSelection.erase (
+			remove (p->fSelection.begin (), p->fSelection.end (), *iter),
+			p->fSelection.end ());
+
+		++iter;
+	}
+}
+
+
+void EmDlg::GetSelectedItems (EmDlgRef dlg, EmDlgItemID item, EmDlgListIndexList& itemList)
+{
+	itemList.clear ();
+
+	EmDlgUnixItem*	p = ::PrvGetItem (dlg, item);
+	if (p)
+	{
+		itemList = p->fSelection;
+	}
+}
+
+
+int EmDlg::GetTextHeight (EmDlgRef dlg, EmDlgItemID item, const string& s)
+{
+	UNUSED_PARAM (dlg)
+	UNUSED_PARAM (item)
+	UNUSED_PARAM (s)
+
+	return 0;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvGetItem
+// ---------------------------------------------------------------------------
+// Return the record for the given item, creating it if needed.  Returns
+// NULL for modeless dialogs (which are never created).
+
+EmDlgUnixItem* PrvGetItem (EmDlgRef dlg, EmDlgItemID item)
+{
+	if (!dlg)
+		return NULL;
+
+	return &((EmDlgUnixRecord*) dlg)->fItems[item];
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvChooseCommonButton
+// ---------------------------------------------------------------------------
+// Report the message in a common dialog and pick the button to answer it
+// with.  See the comments at the top of the file.
+
+EmDlgItemID PrvChooseCommonButton (EmDlgUnixRecord& record, const EmDlgContext& context)
+{
+	string	appName (Platform::GetString (kStr_AppName));
+	string	debug (Platform::GetString (kStr_Debug));
+
+	fprintf (stderr, "%s: %s\n", appName.c_str (),
+		record.fItems[kDlgItemCmnText].fText.c_str ());
+
+	EmDlgItemID	candidates[5] =
+	{
+		context.fDefaultItem,
+		context.fCancelItem,
+		kDlgItemCmnButton1,
+		kDlgItemCmnButton2,
+		kDlgItemCmnButton3
+	};
+
+	EmDlgItemID	result = kDlgItemCmnButton1;
+
+	for (int ii = 0; ii < 5; ++ii)
+	{
+		EmDlgItemID	item = candidates[ii];
+
+		if (item == kDlgItemNone)
+			continue;
+
+		EmDlgUnixItem&	button = record.fItems[item];
+
+		if (button.fVisible && button.fEnabled && button.fText != debug)
+		{
+			result = item;
+			break;
+		}
+	}
+
+	fprintf (stderr, "%s: answered \"%s\"\n", appName.c_str (),
+		record.fItems[result].fText.c_str ());
+
+	return result;
+}
@@ -0,0 +1,126 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmDocumentUnix.h"
+
+#include "EmScreen.h"			// EmScreen, EmScreenUpdateInfo
+
+EmDocumentUnix*	gHostDocument;
+
+// ---------------------------------------------------------------------------
+//		 EmDocument::HostCreateDocument
+// ---------------------------------------------------------------------------
+// Create our document instance.  This is the one and only function that
+// creates the document.
+
+EmDocument* EmDocument::HostCreateDocument (void)
+{
+	return new EmDocumentUnix;
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDocumentUnix::EmDocumentUnix
+ *
+ * DESCRIPTION:	Constructor.  Sets the global host document variable
+ *				to point to us.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:    Nothing
+ *
+ ***********************************************************************/
+
+EmDocumentUnix::EmDocumentUnix (void) :
+	EmDocument ()
+{
+	EmAssert (gHostDocument == NULL);
+	gHostDocument = this;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmDocumentUnix::~EmDocumentUnix
+ *
+ * DESCRIPTION:	Destructor.  Sets the host document variable to NULL.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:    Nothing
+ *
+ ***********************************************************************/
+
+EmDocumentUnix::~EmDocumentUnix (void)
+{
+	EmAssert (gHostDocument == this);
+	gHostDocument = NULL;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmDocumentUnix::HostCanSaveBound
+// ---------------------------------------------------------------------------
+// Binding works by adding resources to the Windows executable, so there's
+// nothing we can bind to.
+
+Bool EmDocumentUnix::HostCanSaveBound (void)
+{
+	fprintf (stderr, "Creating bound emulators is not supported in this build.\n");
+
+	return false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmDocumentUnix::HostSaveScreen
+// ---------------------------------------------------------------------------
+// Save the current contents of the LCD buffer to the given file.  There's
+// no window to ask for them, so go to EmScreen directly (as the window
+// would) and write the result out as a binary PPM.  The grab runs in the
+// CPU thread between instructions; scripts that take a screenshot after
+// every step shouldn't have to pay for a full suspend and resume.
+
+void EmDocumentUnix::HostSaveScreen (const EmFileRef& destRef)
+{
+	EmScreenUpdateInfo		info;
+
+	if (!EmScreen::GetAllBits (info))
+		return;
+
+	info.fImage.ConvertToFormat (kPixMapFormat24RGB);
+
+	FILE*	file = fopen (destRef.GetFullPath ().c_str (), "wb");
+
+	if (file)
+	{
+		EmPoint			size		= info.fImage.GetSize ();
+		long			rowBytes	= info.fImage.GetRowBytes ();
+		const uint8*	bits		= (const uint8*) info.fImage.GetBits ();
+
+		fprintf (file, "P6\n%ld %ld\n255\n", (long) size.fX, (long) size.fY);
+
+		for (EmCoord yy = 0; yy < size.fY; ++yy)
+		{
+			fwrite (bits + yy * rowBytes, 3, size.fX, file);
+		}
+
+		fclose (file);
+	}
+}
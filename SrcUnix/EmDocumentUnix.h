@@ -0,0 +1,38 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmDocumentUnix_h
+#define EmDocumentUnix_h
+
+#include "EmDocument.h"
+
+/*
+	EmDocumentUnix is the headless sub-class of EmDocument.  There's no
+	window to close along with the document, and screen shots are taken
+	straight from EmScreen.
+*/
+
+class EmDocumentUnix : public EmDocument
+{
+	public:
+								EmDocumentUnix		(void);
+		virtual					~EmDocumentUnix		(void);
+
+	public:
+		virtual Bool			HostCanSaveBound	(void);
+		virtual void			HostSaveScreen		(const EmFileRef&);
+};
+
+extern EmDocumentUnix*	gHostDocument;
+
+#endif	// EmDocumentUnix_h
@@ -0,0 +1,644 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmFileRefUnix.h"
+
+#include "EmDirRefUnix.h"		// PrvIsExistingFile
+#include "Miscellaneous.h"		// EndsWith, StartsWith
+
+#include <limits.h>				// PATH_MAX
+#include <sys/stat.h>			// stat, chmod
+
+
+const char*	kExtension[] =
+{
+	NULL,		// kFileTypeNone,
+	NULL,		// kFileTypeApplication,
+	".rom",		// kFileTypeROM,
+	".psf",		// kFileTypeSession,
+	".pev",		// kFileTypeEvents
+	".ini",		// kFileTypePreference,
+	".prc",		// kFileTypePalmApp,
+	".pdb",		// kFileTypePalmDB,
+	".pqa",		// kFileTypePalmQA,
+	".txt",		// kFileTypeText,
+	".ppm",		// kFileTypePicture,
+	".skin",	// kFileTypeSkin,
+	".mwp",		// kFileTypeProfile,
+	NULL,		// kFileTypePalmAll,
+	NULL		// kFileTypeAll
+};
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::EmFileRef
+ *
+ * DESCRIPTION:	Various ways to make a file reference.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	nothing.
+ *
+ ***********************************************************************/
+
+EmFileRef::EmFileRef (void) :
+	fFilePath ()
+{
+}
+
+
+EmFileRef::EmFileRef (const EmFileRef& other) :
+	fFilePath (other.fFilePath)
+{
+}
+
+
+EmFileRef::EmFileRef (const char* path) :
+	fFilePath (path)
+{
+	this->MaybePrependCurrentDirectory ();
+	this->MaybeNormalize ();
+	this->MaybeResolveLink ();
+}
+
+
+EmFileRef::EmFileRef (const string& path) :
+	fFilePath (path)
+{
+	this->MaybePrependCurrentDirectory ();
+	this->MaybeNormalize ();
+	this->MaybeResolveLink ();
+}
+
+
+EmFileRef::EmFileRef (const EmDirRef& parent, const char* path) :
+	fFilePath (parent.GetFullPath () + path)
+{
+	this->MaybeNormalize ();
+	this->MaybeResolveLink ();
+}
+
+
+EmFileRef::EmFileRef (const EmDirRef& parent, const string& path) :
+	fFilePath (parent.GetFullPath () + path)
+{
+	this->MaybeNormalize ();
+	this->MaybeResolveLink ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::~EmFileRef
+ *
+ * DESCRIPTION:	EmFileRef destructor.  Nothing special to do...
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	nothing.
+ *
+ ***********************************************************************/
+
+EmFileRef::~EmFileRef (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::operator=
+ *
+ * DESCRIPTION:	Assignment operator.  If "other" is not the same as
+ *				the controlled object, copy the contents.
+ *
+ * PARAMETERS:	other - object to copy.
+ *
+ * RETURNED:	reference to self.
+ *
+ ***********************************************************************/
+
+EmFileRef&
+EmFileRef::operator= (const EmFileRef& other)
+{
+	if (&other != this)
+	{
+		fFilePath = other.fFilePath;
+	}
+
+	return *this;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::IsSpecified
+ *
+ * DESCRIPTION:	Returns whether or not the controlled object has been
+ *				pointed to a (possibly non-existant) file, or if it's
+ *				empty (that it, it was created with the default ctor).
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	True if the object points to a file.
+ *
+ ***********************************************************************/
+
+Bool
+EmFileRef::IsSpecified (void) const
+{
+	return !fFilePath.empty ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::Exists
+ *
+ * DESCRIPTION:	Returns whether or not the controlled object points to
+ *				an existing file.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	True if the referenced file exists.
+ *
+ ***********************************************************************/
+
+Bool
+EmFileRef::Exists (void) const
+{
+	if (this->IsSpecified ())
+	{
+		return ::PrvIsExistingFile (fFilePath);
+	}
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::Delete
+ *
+ * DESCRIPTION:	Delete the managed file from the file system.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmFileRef::Delete (void) const
+{
+	::unlink (fFilePath.c_str ());
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:    EmFileRef::IsType
+ *
+ * DESCRIPTION: Determine whether the managed file is of the given type,
+ *				based on its file name extension.
+ *
+ * PARAMETERS:  type - type to test for.
+ *
+ * RETURNED:    True if the file appears to be of that type.
+ *
+ ***********************************************************************/
+
+Bool
+EmFileRef::IsType (EmFileType type) const
+{
+	if (fFilePath.size () > 4 &&
+		kExtension[type] != NULL &&
+		::EndsWith (fFilePath.c_str (), kExtension[type]))
+	{
+		return true;
+	}
+
+	// Add special hacks for ROM files.
+
+	if (type == kFileTypeROM &&
+		(::StartsWith (this->GetName ().c_str (), "rom.") ||
+		::EndsWith (fFilePath.c_str (), ".widebin")))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::SetCreatorAndType
+ *
+ * DESCRIPTION: Set the Finder type and creator information of the
+ *				managed file.  Unix files don't have these.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void
+EmFileRef::SetCreatorAndType (EmFileCreator, EmFileType) const
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::GetAttr
+ *
+ * DESCRIPTION: Get basic file attributes of the managed file.  Unix
+ *				files have no "system" attribute; files whose names
+ *				start with a '.' are considered hidden.
+ *
+ * PARAMETERS:	A pointer to an integer where the mode bits will be stored.
+ *
+ * RETURNED:	An integer containing an errno style error result, 0 for no error.
+ *
+ ***********************************************************************/
+
+int
+EmFileRef::GetAttr (int* mode) const
+{
+	EmAssert (mode);
+
+	*mode = 0;
+
+	if (!this->IsSpecified ())
+		return ENOENT;
+
+	struct stat	st;
+
+	if (::stat (fFilePath.c_str (), &st) != 0)
+		return errno;
+
+	if ((st.st_mode & S_IWUSR) == 0)
+		*mode |= kFileAttrReadOnly;
+
+	if (this->GetName ()[0] == '.')
+		*mode |= kFileAttrHidden;
+
+	return 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::GetSizeAndModDate
+ *
+ * DESCRIPTION: Get the size and modification date of the managed file.
+ *				This is a single stat call, so it's a cheap way to tell
+ *				whether a file has changed since it was last looked at.
+ *
+ * PARAMETERS:	Pointers to integers where the size in bytes and the
+ *				modification date (in seconds since 1970) will be stored.
+ *
+ * RETURNED:	An integer containing an errno style error result, 0 for no error.
+ *
+ ***********************************************************************/
+
+int
+EmFileRef::GetSizeAndModDate (uint32* size, uint32* modDate) const
+{
+	EmAssert (size);
+	EmAssert (modDate);
+
+	*size = 0;
+	*modDate = 0;
+
+	if (!this->IsSpecified ())
+		return ENOENT;
+
+	struct stat	st;
+
+	if (::stat (fFilePath.c_str (), &st) != 0)
+		return errno;
+
+	*size = (uint32) st.st_size;
+	*modDate = (uint32) st.st_mtime;
+
+	return 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::SetAttr
+ *
+ * DESCRIPTION: Set basic file attributes of the managed file.  Only
+ *				kFileAttrReadOnly is supported; it maps onto the
+ *				owner's write permission.
+ *
+ * PARAMETERS:	An integer containing bits from the EmFileAttr enum.
+ *
+ * RETURNED:	An integer containing an errno style error result, 0 for no error.
+ *
+ ***********************************************************************/
+
+int
+EmFileRef::SetAttr (int mode) const
+{
+	if (!this->IsSpecified ())
+		return ENOENT;
+
+	struct stat	st;
+
+	if (::stat (fFilePath.c_str (), &st) != 0)
+		return errno;
+
+	mode_t	newMode = st.st_mode & 07777;
+
+	if (mode & kFileAttrReadOnly)
+		newMode &= ~(S_IWUSR | S_IWGRP | S_IWOTH);
+	else
+		newMode |= S_IWUSR;
+
+	if (::chmod (fFilePath.c_str (), newMode) != 0)
+		return errno;
+
+	return 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::GetName
+ *
+ * DESCRIPTION:	Returns the name of the referenced file.  Only the file
+ *				*name* is returned, not the full path.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	A string containing the name.  If the file is not
+ *				specified, an empty string is returned.  No checks are
+ *				made to see if the file actually exists.
+ *
+ ***********************************************************************/
+
+string
+EmFileRef::GetName (void) const
+{
+	string	result;
+
+	if (this->IsSpecified ())
+	{
+		string::size_type	pos = fFilePath.rfind ('/');
+
+		if (pos == string::npos)
+			result = fFilePath;
+		else
+			result = fFilePath.substr (pos + 1);
+	}
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::GetParent
+ *
+ * DESCRIPTION:	Returns an object representing the parent (or container)
+ *				of the managed file.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	An object representing the file's parent.
+ *
+ ***********************************************************************/
+
+EmDirRef
+EmFileRef::GetParent (void) const
+{
+	EmDirRef	result;
+
+	if (this->IsSpecified ())
+	{
+		string::size_type	pos = fFilePath.rfind ('/');
+
+		if (pos != string::npos)
+		{
+			result = EmDirRef (fFilePath.substr (0, pos + 1));
+		}
+	}
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::GetFullPath
+ *
+ * DESCRIPTION:	Get a full (platform-specific) path to the object.
+ *
+ * PARAMETERS:	none.
+ *
+ * RETURNED:	An string representing the file's path.
+ *
+ ***********************************************************************/
+
+string
+EmFileRef::GetFullPath (void) const
+{
+	return fFilePath;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::operator==
+ * FUNCTION:	EmFileRef::operator!=
+ * FUNCTION:	EmFileRef::operator>
+ * FUNCTION:	EmFileRef::operator<
+ *
+ * DESCRIPTION:	Comparison operators, needed to store these objects in
+ *				STL containers.
+ *
+ * PARAMETERS:	other - object to compare ourself to.
+ *
+ * RETURNED:	True if the requested condition is true.  Comparisons
+ *				are based on the file's full path, and are case-
+ *				sensitive.
+ *
+ ***********************************************************************/
+
+bool
+EmFileRef::operator== (const EmFileRef& other) const
+{
+	return fFilePath == other.fFilePath;
+}
+
+
+bool
+EmFileRef::operator!= (const EmFileRef& other) const
+{
+	return fFilePath != other.fFilePath;
+}
+
+
+bool
+EmFileRef::operator> (const EmFileRef& other) const
+{
+	return fFilePath > other.fFilePath;
+}
+
+
+bool
+EmFileRef::operator< (const EmFileRef& other) const
+{
+	return fFilePath < other.fFilePath;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	FromPrefString
+ *
+ * DESCRIPTION:	Initialize this object from the string containing a file
+ *				reference stored in a preference file.
+ *
+ * PARAMETERS:	s - the string from the preference file
+ *
+ * RETURNED:	True if we were able to carry out the initialization.
+ *				False otherwise.  Note that the string is NOT validated
+ *				to see if it refers to an existing file.
+ *
+ ***********************************************************************/
+
+bool
+EmFileRef::FromPrefString (const string& s)
+{
+	fFilePath = s;
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	ToPrefString
+ *
+ * DESCRIPTION:	Produce a string that can be stored to a preference file
+ *				and which can later be used to reproduce the current
+ *				file reference object.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The string to be written to the preference file.
+ *
+ ***********************************************************************/
+
+string
+EmFileRef::ToPrefString (void) const
+{
+	return fFilePath;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	MaybePrependCurrentDirectory
+ *
+ * DESCRIPTION:	Prepend the current working directory if the managed
+ *				path is not a full path.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void
+EmFileRef::MaybePrependCurrentDirectory (void)
+{
+	if (!fFilePath.empty () && fFilePath[0] != '/')
+	{
+		char	buffer[PATH_MAX];
+
+		if (::getcwd (buffer, sizeof (buffer)))
+		{
+			string	cwd (buffer);
+
+			if (cwd[cwd.size () - 1] != '/')
+				cwd += '/';
+
+			fFilePath = cwd + fFilePath;
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	MaybeNormalize
+ *
+ * DESCRIPTION:	Collapse any "//" or "/./" sequences in the managed
+ *				path.  ".." components are left alone, as they may
+ *				not mean what they appear to in the presence of
+ *				symbolic links.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void
+EmFileRef::MaybeNormalize (void)
+{
+	string::size_type	pos;
+
+	while ((pos = fFilePath.find ("//")) != string::npos)
+	{
+		fFilePath.erase (pos, 1);
+	}
+
+	while ((pos = fFilePath.find ("/./")) != string::npos)
+	{
+		fFilePath.erase (pos, 2);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	MaybeResolveLink
+ *
+ * DESCRIPTION:	If the managed path is an existing symbolic link,
+ *				replace it with the path it resolves to.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void
+EmFileRef::MaybeResolveLink (void)
+{
+	char	buffer[PATH_MAX];
+
+	if (::PrvIsExistingFile (fFilePath) && ::realpath (fFilePath.c_str (), buffer))
+	{
+		fFilePath = buffer;
+	}
+}
@@ -0,0 +1,1327 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmTransportSerialUnix.h"
+
+#include "EmCPU68K.h"			// gCPU68K
+#include "EmErrCodes.h"			// kError_CommOpen, ConvertFromStdCError
+#include "EmHAL.h"				// EmHAL::GetSystemClockFrequency
+#include "Logging.h"			// LogSerial, LogThreadExit
+
+#include <dirent.h>				// opendir, readdir
+#include <errno.h>				// errno, EAGAIN, EINTR
+#include <fcntl.h>				// open, fcntl, O_RDWR, O_NOCTTY, O_NONBLOCK
+#include <stdlib.h>				// posix_openpt, grantpt, unlockpt, ptsname
+#include <sys/ioctl.h>			// ioctl, TIOCMGET, TIOCMBIS, TIOCMBIC
+#include <sys/select.h>			// select, fd_set
+#include <sys/stat.h>			// lstat, S_ISLNK
+#include <termios.h>			// tcgetattr, tcsetattr, cfmakeraw
+#include <unistd.h>				// read, write, close, pipe, symlink
+
+
+/*
+	Serial ports on Unix are either real tty devices (any port name
+	starting with "/") or pseudo-terminals.  A port named "pty" gets a
+	fresh pseudo-terminal whose slave name is printed when it's opened;
+	"pty:/some/path" also makes a symlink to the slave at that path so
+	that scripts have a fixed name to connect to.
+
+	A single thread per open port does all of the host I/O.  It blocks
+	in select () on the port and on a wake-up pipe, so it uses no CPU
+	while the line is idle.  It reads only while the incoming queue has
+	room and asks for writability only while there's something to
+	write, and it moves data in chunks rather than a byte at a time.
+
+	The emulated side paces incoming data at the configured baud rate.
+	Bytes are handed to the UART only as fast as the emulated CPU's
+	cycle count says they could have arrived on a real line, so a host
+	that dumps a whole file into the pty doesn't overrun the Palm OS
+	serial manager's buffers.
+*/
+
+#define PRINTF	if (!LogSerial ()) ; else LogAppendMsg
+
+
+static void PrvAddDevices (const char* prefix, EmTransportSerial::PortNameList& results);
+static speed_t PrvGetSpeed (EmTransportSerial::Baud baud);
+
+const long		kIOChunkSize		= 4096;
+const long		kMaxReadBuffer		= 64 * 1024;
+const long		kMaxWriteBuffer		= 64 * 1024;
+const long		kMaxPacedBytes		= 256;
+const char		kPtyPortName[]		= "pty";
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostConstruct
+ *
+ * DESCRIPTION:	Construct platform-specific objects/data.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostConstruct (void)
+{
+	fHost = new EmHostTransportSerial;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostDestruct
+ *
+ * DESCRIPTION:	Destroy platform-specific objects/data.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostDestruct (void)
+{
+	delete fHost;
+	fHost = NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostOpen
+ *
+ * DESCRIPTION:	Open the serial port in a platform-specific fashion.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportSerial::HostOpen (void)
+{
+	ErrCode	err = fHost->OpenCommPort (fConfig);
+
+	if (!err)
+		err = fHost->CreateCommThreads (fConfig);
+
+	if (err)
+		this->HostClose ();
+
+	return err;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostClose
+ *
+ * DESCRIPTION:	Close the serial port in a platform-specific fashion.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportSerial::HostClose (void)
+{
+	ErrCode	err;
+
+	err = fHost->DestroyCommThreads ();
+	err = fHost->CloseCommPort ();
+
+	return err;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostRead
+ *
+ * DESCRIPTION:	Read bytes from the port in a platform-specific fashion.
+ *				No more bytes are returned than the baud rate allows
+ *				for the time that's passed; see HostBytesInBuffer.
+ *
+ * PARAMETERS:	len - maximum number of bytes to read.
+ *				data - buffer to receive the bytes.
+ *
+ * RETURNED:	0 if no error.  The number of bytes actually read is
+ *				returned in len if there was no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportSerial::HostRead (long& len, void* data)
+{
+	if (fHost->fCyclesPerByte != 0)
+	{
+		long	paced = fHost->fCycleCredit / fHost->fCyclesPerByte;
+
+		if (len > paced)
+			len = paced;
+	}
+
+	fHost->GetIncomingData (data, len);
+	fHost->ConsumePacing (len);
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostWrite
+ *
+ * DESCRIPTION:	Write bytes to the port in a platform-specific fashion.
+ *
+ * PARAMETERS:	len - number of bytes in the buffer.
+ *				data - buffer containing the bytes.
+ *
+ * RETURNED:	0 if no error.  The number of bytes actually written is
+ *				returned in len if there was no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportSerial::HostWrite (long& len, const void* data)
+{
+	fHost->PutOutgoingData (data, len);
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostBytesInBuffer
+ *
+ * DESCRIPTION:	Returns the number of bytes that can be read with the
+ *				Read method.  This is the number of received bytes
+ *				that would have made it across the wire at the
+ *				current baud rate by now, not the number sitting in
+ *				the host buffer.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Number of bytes that can be read.
+ *
+ ***********************************************************************/
+
+long EmTransportSerial::HostBytesInBuffer (long /*minBytes*/)
+{
+	return fHost->PacedDataSize ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostSetConfig
+ *
+ * DESCRIPTION:	Configure the serial port in a platform-specific
+ *				fasion.  The port is assumed to be open.
+ *
+ * PARAMETERS:	config - configuration information.
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportSerial::HostSetConfig (const ConfigSerial& config)
+{
+	PRINTF ("EmTransportSerial::HostSetConfig: Setting settings.");
+
+	return fHost->SetCommConfig (config);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostSetRTS
+ *
+ * DESCRIPTION:	Set the state of the RTS line.  In automatic mode, the
+ *				line is left to the driver's hardware handshaking.
+ *
+ * PARAMETERS:	state - the new state.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostSetRTS (RTSControl state)
+{
+	if (fHost->fCommHandle < 0 || fHost->IsPseudoTerminal () || state == kRTSAuto)
+		return;
+
+	int	bits = TIOCM_RTS;
+	::ioctl (fHost->fCommHandle, state == kRTSOn ? TIOCMBIS : TIOCMBIC, &bits);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostSetDTR
+ *
+ * DESCRIPTION:	Set the state of the DTR line.
+ *
+ * PARAMETERS:	state - the new state.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostSetDTR (Bool state)
+{
+	if (fHost->fCommHandle < 0 || fHost->IsPseudoTerminal ())
+		return;
+
+	int	bits = TIOCM_DTR;
+	::ioctl (fHost->fCommHandle, state ? TIOCMBIS : TIOCMBIC, &bits);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostSetBreak
+ *
+ * DESCRIPTION:	Set or clear the break condition.
+ *
+ * PARAMETERS:	state - the new state.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostSetBreak (Bool state)
+{
+	if (fHost->fCommHandle < 0 || fHost->IsPseudoTerminal ())
+		return;
+
+	::ioctl (fHost->fCommHandle, state ? TIOCSBRK : TIOCCBRK, 0);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostGetCTS
+ *
+ * DESCRIPTION:	Return the state of the CTS line.  Pseudo-terminals
+ *				have no modem lines, so they always report it as set.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	True if CTS is asserted.
+ *
+ ***********************************************************************/
+
+Bool EmTransportSerial::HostGetCTS (void)
+{
+	if (fHost->fCommHandle < 0)
+		return false;
+
+	if (fHost->IsPseudoTerminal ())
+		return true;
+
+	int	bits = 0;
+	if (::ioctl (fHost->fCommHandle, TIOCMGET, &bits) < 0)
+		return false;
+
+	return (bits & TIOCM_CTS) != 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostGetDSR
+ *
+ * DESCRIPTION:	Return the state of the DSR line.  As with CTS, this
+ *				is always set for pseudo-terminals.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	True if DSR is asserted.
+ *
+ ***********************************************************************/
+
+Bool EmTransportSerial::HostGetDSR (void)
+{
+	if (fHost->fCommHandle < 0)
+		return false;
+
+	if (fHost->IsPseudoTerminal ())
+		return true;
+
+	int	bits = 0;
+	if (::ioctl (fHost->fCommHandle, TIOCMGET, &bits) < 0)
+		return false;
+
+	return (bits & TIOCM_DSR) != 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostGetPortNameList
+ *
+ * DESCRIPTION:	Return the list of serial ports on this computer.  The
+ *				first entry is always the pseudo-terminal port,
+ *				followed by whatever serial devices are in /dev.
+ *
+ * PARAMETERS:	results - receives the list of port names.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostGetPortNameList (PortNameList& results)
+{
+	results.clear ();
+
+	results.push_back (kPtyPortName);
+
+	::PrvAddDevices ("ttyS", results);
+	::PrvAddDevices ("ttyUSB", results);
+	::PrvAddDevices ("ttyACM", results);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportSerial::HostGetSerialBaudList
+ *
+ * DESCRIPTION:	Return the list of baud rates supported by the
+ *				serial ports on this computer.
+ *
+ * PARAMETERS:	results - receives the list of baud rates.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportSerial::HostGetSerialBaudList (BaudList& results)
+{
+	results.clear ();
+
+	results.push_back (115200);
+	results.push_back (57600);
+	results.push_back (38400);
+	results.push_back (19200);
+	results.push_back (14400);
+	results.push_back (9600);
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial c'tor
+ *
+ * DESCRIPTION:	Constructor.  Initialize our data members.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+EmHostTransportSerial::EmHostTransportSerial (void) :
+	fCommHandle (-1),
+	fSlaveHandle (-1),
+	fLinkName (),
+
+	fCommThread (NULL),
+	fCommQuit (false),
+
+	fReadMutex (),
+	fReadBuffer (),
+
+	fWriteMutex (),
+	fWriteBuffer (),
+
+	fBaud (0),
+	fBitsPerChar (10),
+	fCyclesPerByte (0),
+	fLastCycles (0),
+	fCycleCredit (0)
+{
+	fWakePipe[0] = -1;
+	fWakePipe[1] = -1;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial d'tor
+ *
+ * DESCRIPTION:	Destructor.  Delete our data members.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+EmHostTransportSerial::~EmHostTransportSerial (void)
+{
+	EmAssert (fCommHandle < 0);
+	EmAssert (fSlaveHandle < 0);
+
+	EmAssert (fCommThread == NULL);
+	EmAssert (fWakePipe[0] < 0);
+	EmAssert (fWakePipe[1] < 0);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::OpenCommPort
+ *
+ * DESCRIPTION:	Open the serial port.  "pty" and "pty:<path>" create
+ *				a pseudo-terminal; anything else is opened as a tty
+ *				device.
+ *
+ * PARAMETERS:	config - data block describing which port to use.
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmHostTransportSerial::OpenCommPort (const EmTransportSerial::ConfigSerial& config)
+{
+	EmTransportSerial::PortName	portName = config.fPort;
+
+	PRINTF ("EmTransportSerial::HostOpen: attempting to open port \"%s\"",
+			portName.c_str());
+
+	if (portName.empty ())
+	{
+		PRINTF ("EmTransportSerial::HostOpen: No port selected in the Properties dialog box...");
+		return kError_CommOpen;
+	}
+
+	if (portName == kPtyPortName || portName.find (string (kPtyPortName) + ":") == 0)
+	{
+		fCommHandle = ::posix_openpt (O_RDWR | O_NOCTTY);
+		if (fCommHandle < 0)
+			return ::ConvertFromStdCError (errno);
+
+		if (::grantpt (fCommHandle) < 0 || ::unlockpt (fCommHandle) < 0)
+			return ::ConvertFromStdCError (errno);
+
+		const char*	slaveName = ::ptsname (fCommHandle);
+		if (!slaveName)
+			return ::ConvertFromStdCError (errno);
+
+		string	slave (slaveName);
+
+		// Keep the slave side open ourselves.  Otherwise, reading the
+		// master fails with EIO whenever nothing else has the slave
+		// open, and select () would report it as readable forever.
+
+		fSlaveHandle = ::open (slave.c_str (), O_RDWR | O_NOCTTY);
+		if (fSlaveHandle < 0)
+			return ::ConvertFromStdCError (errno);
+
+		// Put the slave in raw mode so that the line discipline
+		// doesn't echo or translate anything the Palm sends.
+
+		struct termios	tio;
+		if (::tcgetattr (fSlaveHandle, &tio) == 0)
+		{
+			::cfmakeraw (&tio);
+			::tcsetattr (fSlaveHandle, TCSANOW, &tio);
+		}
+
+		if (portName.size () > strlen (kPtyPortName) + 1)
+		{
+			fLinkName = portName.substr (strlen (kPtyPortName) + 1);
+
+			// Replace a stale link from an earlier run, but never
+			// anything that isn't a symlink.
+
+			struct stat	info;
+			if (::lstat (fLinkName.c_str (), &info) == 0 && S_ISLNK (info.st_mode))
+				::unlink (fLinkName.c_str ());
+
+			if (::symlink (slave.c_str (), fLinkName.c_str ()) < 0)
+			{
+				int	linkErr = errno;
+				fLinkName.erase ();
+				return ::ConvertFromStdCError (linkErr);
+			}
+
+			fprintf (stderr, "Serial port is at %s (%s)\n",
+				fLinkName.c_str (), slave.c_str ());
+		}
+		else
+		{
+			fprintf (stderr, "Serial port is at %s\n", slave.c_str ());
+		}
+	}
+	else
+	{
+		fCommHandle = ::open (portName.c_str (), O_RDWR | O_NOCTTY | O_NONBLOCK);
+		if (fCommHandle < 0)
+			return ::ConvertFromStdCError (errno);
+
+		if (!::isatty (fCommHandle))
+			return kError_CommOpen;
+	}
+
+	int	flags = ::fcntl (fCommHandle, F_GETFL);
+	if (flags < 0 || ::fcntl (fCommHandle, F_SETFL, flags | O_NONBLOCK) < 0)
+		return ::ConvertFromStdCError (errno);
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::CreateCommThreads
+ *
+ * DESCRIPTION:	Create the thread that asynchronously reads from and
+ *				writes to the serial port, along with the pipe used
+ *				to wake it up.
+ *
+ * PARAMETERS:	config - data block describing which port to use.
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmHostTransportSerial::CreateCommThreads (const EmTransportSerial::ConfigSerial& /*config*/)
+{
+	PRINTF ("EmTransportSerial::HostOpen: Creating serial port handler thread...");
+
+	if (::pipe (fWakePipe) < 0)
+	{
+		int	pipeErr = errno;
+
+		fWakePipe[0] = -1;
+		fWakePipe[1] = -1;
+
+		return ::ConvertFromStdCError (pipeErr);
+	}
+
+	::fcntl (fWakePipe[0], F_SETFL, ::fcntl (fWakePipe[0], F_GETFL) | O_NONBLOCK);
+	::fcntl (fWakePipe[1], F_SETFL, ::fcntl (fWakePipe[1], F_GETFL) | O_NONBLOCK);
+
+	fCommQuit = false;
+
+	// Use the variant that takes a function returning void* so that
+	// the thread is created undetached and we can join it later.
+
+	fCommThread = omni_thread::create (&EmHostTransportSerial::CommIOStatic, this,
+		omni_thread::PRIORITY_HIGH);
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::DestroyCommThreads
+ *
+ * DESCRIPTION:	Shutdown and destroy the comm thread.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmHostTransportSerial::DestroyCommThreads (void)
+{
+	if (fCommThread)
+	{
+		fCommQuit = true;
+		this->WakeCommThread ();
+
+		fCommThread->join (NULL);
+		fCommThread = NULL;
+	}
+
+	if (fWakePipe[0] >= 0)
+	{
+		::close (fWakePipe[0]);
+		::close (fWakePipe[1]);
+
+		fWakePipe[0] = -1;
+		fWakePipe[1] = -1;
+	}
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::CloseCommPort
+ *
+ * DESCRIPTION:	Close the comm port, and remove the pseudo-terminal's
+ *				symlink if we made one.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmHostTransportSerial::CloseCommPort (void)
+{
+	if (fCommHandle >= 0)
+	{
+		::close (fCommHandle);
+		fCommHandle = -1;
+	}
+
+	if (fSlaveHandle >= 0)
+	{
+		::close (fSlaveHandle);
+		fSlaveHandle = -1;
+	}
+
+	if (!fLinkName.empty ())
+	{
+		::unlink (fLinkName.c_str ());
+		fLinkName.erase ();
+	}
+
+	{
+		omni_mutex_lock lock (fReadMutex);
+		fReadBuffer.clear ();
+	}
+
+	{
+		omni_mutex_lock lock (fWriteMutex);
+		fWriteBuffer.clear ();
+	}
+
+	fCyclesPerByte = 0;
+	fCycleCredit = 0;
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::SetCommConfig
+ *
+ * DESCRIPTION:	Set the line parameters.  Real ttys get them through
+ *				termios; for pseudo-terminals they only determine how
+ *				fast incoming data is passed on to the emulated UART.
+ *
+ * PARAMETERS:	config - configuration information.
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmHostTransportSerial::SetCommConfig (const EmTransportSerial::ConfigSerial& config)
+{
+	fBaud			= config.fBaud;
+	fBitsPerChar	= 1 + config.fDataBits + config.fStopBits +
+					  (config.fParity == EmTransportSerial::kNoParity ? 0 : 1);
+	fCyclesPerByte	= 0;
+	fCycleCredit	= 0;
+
+	if (fCommHandle < 0)
+		return kError_CommNotOpen;
+
+	if (this->IsPseudoTerminal ())
+		return errNone;
+
+	speed_t	speed = ::PrvGetSpeed (config.fBaud);
+	if (speed == B0)
+		return kError_InvalidConfiguration;
+
+	struct termios	tio;
+	if (::tcgetattr (fCommHandle, &tio) < 0)
+		return ::ConvertFromStdCError (errno);
+
+	::cfmakeraw (&tio);
+	::cfsetispeed (&tio, speed);
+	::cfsetospeed (&tio, speed);
+
+	tio.c_cflag &= ~(CSIZE | PARENB | PARODD | CSTOPB);
+	tio.c_cflag |= CLOCAL | CREAD;
+
+	switch (config.fDataBits)
+	{
+		case 5:		tio.c_cflag |= CS5;	break;
+		case 6:		tio.c_cflag |= CS6;	break;
+		case 7:		tio.c_cflag |= CS7;	break;
+		default:	tio.c_cflag |= CS8;	break;
+	}
+
+	if (config.fParity != EmTransportSerial::kNoParity)
+		tio.c_cflag |= PARENB;
+
+	if (config.fParity == EmTransportSerial::kOddParity)
+		tio.c_cflag |= PARODD;
+
+	if (config.fStopBits == 2)
+		tio.c_cflag |= CSTOPB;
+
+#ifdef CRTSCTS
+	if (config.fHwrHandshake)
+		tio.c_cflag |= CRTSCTS;
+	else
+		tio.c_cflag &= ~CRTSCTS;
+#endif
+
+	PRINTF ("	baud		= %ld", (long) config.fBaud);
+	PRINTF ("	dataBits	= %ld", (long) config.fDataBits);
+	PRINTF ("	stopBits	= %ld", (long) config.fStopBits);
+	PRINTF ("	parity		= %ld", (long) config.fParity);
+	PRINTF ("	handshake	= %ld", (long) config.fHwrHandshake);
+
+	if (::tcsetattr (fCommHandle, TCSANOW, &tio) < 0)
+		return ::ConvertFromStdCError (errno);
+
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::PutIncomingData
+ *
+ * DESCRIPTION:	Thread-safe method for adding data to the queue that
+ *				holds data read from the serial port.
+ *
+ * PARAMETERS:	data - pointer to the read data.
+ *				len - number of bytes pointed to by "data".
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::PutIncomingData	(const void* data, long& len)
+{
+	if (len == 0)
+		return;
+
+	omni_mutex_lock lock (fReadMutex);
+
+	const char*	begin = (const char*) data;
+	fReadBuffer.insert (fReadBuffer.end (), begin, begin + len);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::GetIncomingData
+ *
+ * DESCRIPTION:	Thread-safe method for getting data from the queue
+ *				holding data read from the serial port.  If the queue
+ *				was full enough that the comm thread stopped reading,
+ *				wake it up so that it starts again.
+ *
+ * PARAMETERS:	data - pointer to buffer to receive data.
+ *				len - on input, number of bytes available in "data".
+ *					On exit, number of bytes written to "data".
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::GetIncomingData	(void* data, long& len)
+{
+	Bool	wasFull;
+
+	{
+		omni_mutex_lock lock (fReadMutex);
+
+		if (len > (long) fReadBuffer.size ())
+			len = fReadBuffer.size ();
+
+		wasFull = (long) fReadBuffer.size () >= kMaxReadBuffer;
+
+		char*	p = (char*) data;
+		deque<char>::iterator	begin = fReadBuffer.begin ();
+		deque<char>::iterator	end = begin + len;
+
+		copy (begin, end, p);
+		fReadBuffer.erase (begin, end);
+	}
+
+	if (wasFull && len > 0)
+		this->WakeCommThread ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::IncomingDataSize
+ *
+ * DESCRIPTION:	Thread-safe method returning the number of bytes in the
+ *				read queue.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Number of bytes in the read queue.
+ *
+ ***********************************************************************/
+
+long EmHostTransportSerial::IncomingDataSize (void)
+{
+	omni_mutex_lock lock (fReadMutex);
+
+	return fReadBuffer.size ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::PutOutgoingData
+ *
+ * DESCRIPTION:	Thread-safe method for adding data to the queue that
+ *				holds data to be written to the serial port.  If
+ *				nothing is draining the port, bytes past the queue
+ *				limit are dropped, the way a real line would lose
+ *				them.
+ *
+ * PARAMETERS:	data - pointer to the read data.
+ *				len - number of bytes pointed to by "data".
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::PutOutgoingData	(const void* data, long& len)
+{
+	if (len == 0)
+		return;
+
+	Bool	wasEmpty;
+
+	{
+		omni_mutex_lock lock (fWriteMutex);
+
+		wasEmpty = fWriteBuffer.empty ();
+
+		long	room = kMaxWriteBuffer - (long) fWriteBuffer.size ();
+		long	count = len < room ? len : room;
+
+		if (count < len)
+			PRINTF ("EmHostTransportSerial::PutOutgoingData: dropping %ld bytes", len - count);
+
+		if (count > 0)
+		{
+			const char*	begin = (const char*) data;
+			fWriteBuffer.insert (fWriteBuffer.end (), begin, begin + count);
+		}
+	}
+
+	// The comm thread only watches for writability while it has
+	// something to write, so tell it that it now does.
+
+	if (wasEmpty)
+		this->WakeCommThread ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::GetOutgoingData
+ *
+ * DESCRIPTION:	Thread-safe method for getting data from the queue
+ *				holding data to be written to the serial port.
+ *
+ * PARAMETERS:	data - pointer to buffer to receive data.
+ *				len - on input, number of bytes available in "data".
+ *					On exit, number of bytes written to "data".
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::GetOutgoingData	(void* data, long& len)
+{
+	omni_mutex_lock lock (fWriteMutex);
+
+	if (len > (long) fWriteBuffer.size ())
+		len = fWriteBuffer.size ();
+
+	char*	p = (char*) data;
+	deque<char>::iterator	begin = fWriteBuffer.begin ();
+	deque<char>::iterator	end = begin + len;
+
+	copy (begin, end, p);
+	fWriteBuffer.erase (begin, end);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::OutgoingDataSize
+ *
+ * DESCRIPTION:	Thread-safe method returning the number of bytes in the
+ *				write queue.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Number of bytes in the write queue.
+ *
+ ***********************************************************************/
+
+long EmHostTransportSerial::OutgoingDataSize (void)
+{
+	omni_mutex_lock lock (fWriteMutex);
+
+	return fWriteBuffer.size ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::PacedDataSize
+ *
+ * DESCRIPTION:	Return the number of received bytes that the emulated
+ *				UART may see now.  Emulated CPU cycles are converted
+ *				into "line time" at the configured baud rate; one
+ *				character's worth of cycles releases one byte.
+ *
+ *				Credit only builds up while data is waiting, so an
+ *				idle line doesn't save up a burst for later.  While
+ *				the CPU is stopped, its cycle count doesn't move, so
+ *				each poll then counts as one 10 msec timer tick;
+ *				otherwise a Palm dozing until the next interrupt
+ *				would never see its data arrive.
+ *
+ *				Called on the CPU thread only.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Number of bytes that can be read.
+ *
+ ***********************************************************************/
+
+long EmHostTransportSerial::PacedDataSize (void)
+{
+	long	available = this->IncomingDataSize ();
+
+	if (!gCPU68K || fBaud <= 0)
+	{
+		fCyclesPerByte = 0;
+		return available;
+	}
+
+	uint32	now = gCPU68K->GetCycleCount ();
+	uint32	elapsed = now - fLastCycles;
+
+	fLastCycles = now;
+
+	if (available == 0)
+	{
+		fCycleCredit = 0;
+		return 0;
+	}
+
+	int32	clockFrequency = EmHAL::GetSystemClockFrequency ();
+
+	fCyclesPerByte = (uint32) ((double) clockFrequency * fBitsPerChar / fBaud);
+
+	if (fCyclesPerByte == 0)
+		return available;
+
+	if (gCPU68K->Stopped ())
+		elapsed += clockFrequency / 100;
+
+	// Cap the credit at a FIFO's worth or so of characters.  This also
+	// covers the cycle counter being reset, which shows up here as an
+	// enormous elapsed time.
+
+	long	limit = available < kMaxPacedBytes ? available : kMaxPacedBytes;
+	uint32	maxCredit = fCyclesPerByte * limit;
+
+	if (elapsed > maxCredit || fCycleCredit + elapsed > maxCredit)
+		fCycleCredit = maxCredit;
+	else
+		fCycleCredit += elapsed;
+
+	return fCycleCredit / fCyclesPerByte;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::ConsumePacing
+ *
+ * DESCRIPTION:	Use up the credit for bytes handed to the UART.
+ *
+ * PARAMETERS:	len - number of bytes read.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::ConsumePacing (long len)
+{
+	uint32	used = fCyclesPerByte * len;
+
+	if (used > fCycleCredit)
+		fCycleCredit = 0;
+	else
+		fCycleCredit -= used;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::WakeCommThread
+ *
+ * DESCRIPTION:	Make the comm thread return from select () and look at
+ *				its queues (and quit flag) again.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::WakeCommThread (void)
+{
+	if (fWakePipe[1] >= 0)
+	{
+		char	c = 0;
+
+		// If the pipe is full, the thread has plenty of wake-ups
+		// pending already, so ignore EAGAIN.
+
+		(void) ::write (fWakePipe[1], &c, 1);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::CommIOStatic
+ *
+ * DESCRIPTION:	Thread entry point; calls through to CommIO.
+ *
+ * PARAMETERS:	data - the EmHostTransportSerial.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void* EmHostTransportSerial::CommIOStatic (void* data)
+{
+	((EmHostTransportSerial*) data)->CommIO ();
+
+	::LogThreadExit ();
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmHostTransportSerial::CommIO
+ *
+ * DESCRIPTION:	Body of the comm thread.  Moves data between the port
+ *				and the read and write queues until told to quit.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmHostTransportSerial::CommIO (void)
+{
+	char	buffer[kIOChunkSize];
+	Bool	canRead = true;
+
+	while (!fCommQuit)
+	{
+		fd_set	readFds;
+		fd_set	writeFds;
+
+		FD_ZERO (&readFds);
+		FD_ZERO (&writeFds);
+
+		FD_SET (fWakePipe[0], &readFds);
+
+		if (canRead && this->IncomingDataSize () < kMaxReadBuffer)
+			FD_SET (fCommHandle, &readFds);
+
+		if (this->OutgoingDataSize () > 0)
+			FD_SET (fCommHandle, &writeFds);
+
+		int		maxFd = fWakePipe[0] > fCommHandle ? fWakePipe[0] : fCommHandle;
+		int		result = ::select (maxFd + 1, &readFds, &writeFds, NULL, NULL);
+
+		if (result < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			PRINTF ("EmHostTransportSerial::CommIO: select failed, errno = %ld", (long) errno);
+			break;
+		}
+
+		if (FD_ISSET (fWakePipe[0], &readFds))
+		{
+			while (::read (fWakePipe[0], buffer, sizeof (buffer)) > 0)
+				;
+		}
+
+		if (FD_ISSET (fCommHandle, &readFds))
+		{
+			ssize_t	got = ::read (fCommHandle, buffer, sizeof (buffer));
+
+			if (got > 0)
+			{
+				long	len = got;
+				this->PutIncomingData (buffer, len);
+			}
+			else if (got == 0 || (errno != EAGAIN && errno != EINTR))
+			{
+				// The other end is gone (or the device is).  Stop
+				// asking select () about it, or we'd spin.
+
+				PRINTF ("EmHostTransportSerial::CommIO: read failed, errno = %ld", (long) errno);
+				canRead = false;
+			}
+		}
+
+		if (FD_ISSET (fCommHandle, &writeFds))
+		{
+			omni_mutex_lock lock (fWriteMutex);
+
+			// Write straight out of the queue and erase only what the
+			// port took.  Nobody else removes data from the front, so
+			// holding the lock across the write is all we need.
+
+			long	len = fWriteBuffer.size ();
+			if (len > kIOChunkSize)
+				len = kIOChunkSize;
+
+			copy (fWriteBuffer.begin (), fWriteBuffer.begin () + len, buffer);
+
+			ssize_t	put = ::write (fCommHandle, buffer, len);
+
+			if (put > 0)
+			{
+				fWriteBuffer.erase (fWriteBuffer.begin (), fWriteBuffer.begin () + put);
+			}
+			else if (put < 0 && errno != EAGAIN && errno != EINTR)
+			{
+				PRINTF ("EmHostTransportSerial::CommIO: write failed, errno = %ld", (long) errno);
+				fWriteBuffer.clear ();
+			}
+		}
+	}
+}
+
+
+#pragma mark -
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvAddDevices
+ *
+ * DESCRIPTION:	Add the /dev entries whose names are the given prefix
+ *				followed by a number, in numeric order.
+ *
+ * PARAMETERS:	prefix - device name prefix, such as "ttyS".
+ *				results - list to append the full paths to.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void PrvAddDevices (const char* prefix, EmTransportSerial::PortNameList& results)
+{
+	DIR*	dir = ::opendir ("/dev");
+	if (!dir)
+		return;
+
+	vector<long>	numbers;
+	size_t			prefixLen = strlen (prefix);
+	struct dirent*	entry;
+
+	while ((entry = ::readdir (dir)) != NULL)
+	{
+		const char*	name = entry->d_name;
+
+		if (strncmp (name, prefix, prefixLen) != 0 || !isdigit (name[prefixLen]))
+			continue;
+
+		char*	end;
+		long	number = strtol (name + prefixLen, &end, 10);
+
+		if (*end == 0)
+			numbers.push_back (number);
+	}
+
+	::closedir (dir);
+
+	sort (numbers.begin (), numbers.end ());
+
+	vector<long>::iterator	iter = numbers.begin ();
+	while (iter != numbers.end ())
+	{
+		char	path[64];
+		sprintf (path, "/dev/%s%ld", prefix, *iter);
+
+		results.push_back (path);
+
+		++iter;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetSpeed
+ *
+ * DESCRIPTION:	Map a baud rate onto the termios speed constant.
+ *
+ * PARAMETERS:	baud - the baud rate.
+ *
+ * RETURNED:	The speed_t, or B0 if the rate isn't supported.
+ *
+ ***********************************************************************/
+
+speed_t PrvGetSpeed (EmTransportSerial::Baud baud)
+{
+	switch (baud)
+	{
+		case 1200:		return B1200;
+		case 2400:		return B2400;
+		case 4800:		return B4800;
+		case 9600:		return B9600;
+		case 19200:		return B19200;
+		case 38400:		return B38400;
+#ifdef B57600
+		case 57600:		return B57600;
+#endif
+#ifdef B115200
+		case 115200:	return B115200;
+#endif
+#ifdef B230400
+		case 230400:	return B230400;
+#endif
+	}
+
+	return B0;
+}
@@ -0,0 +1,77 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmTransportSerialUnix_h
+#define EmTransportSerialUnix_h
+
+#include "EmTransportSerial.h"
+
+#include "omnithread.h"			// omni_mutex, omni_thread
+
+class EmHostTransportSerial
+{
+	public:
+								EmHostTransportSerial (void);
+								~EmHostTransportSerial (void);
+
+		ErrCode					OpenCommPort		(const EmTransportSerial::ConfigSerial&);
+		ErrCode					CreateCommThreads	(const EmTransportSerial::ConfigSerial&);
+		ErrCode					DestroyCommThreads	(void);
+		ErrCode					CloseCommPort		(void);
+
+		ErrCode					SetCommConfig		(const EmTransportSerial::ConfigSerial&);
+
+		// Manage data coming in the host serial port.
+		void					PutIncomingData	(const void*, long&);
+		void					GetIncomingData	(void*, long&);
+		long					IncomingDataSize (void);
+
+		// Manage data going out the host serial port.
+		void					PutOutgoingData	(const void*, long&);
+		void					GetOutgoingData	(void*, long&);
+		long					OutgoingDataSize (void);
+
+		// Pace incoming data at the configured baud rate, measured
+		// in emulated CPU cycles.
+		long					PacedDataSize	(void);
+		void					ConsumePacing	(long);
+
+		static void*			CommIOStatic	(void*);
+		void					CommIO			(void);
+		void					WakeCommThread	(void);
+
+		Bool					IsPseudoTerminal (void) const { return fSlaveHandle >= 0; }
+
+	public:
+		int						fCommHandle;
+		int						fSlaveHandle;
+		string					fLinkName;
+
+		omni_thread*			fCommThread;
+		int						fWakePipe[2];
+		Bool					fCommQuit;
+
+		omni_mutex				fReadMutex;
+		deque<char>				fReadBuffer;
+
+		omni_mutex				fWriteMutex;
+		deque<char>				fWriteBuffer;
+
+		long					fBaud;
+		long					fBitsPerChar;
+		uint32					fCyclesPerByte;
+		uint32					fLastCycles;
+		uint32					fCycleCredit;
+};
+
+#endif	/* EmTransportSerialUnix_h */
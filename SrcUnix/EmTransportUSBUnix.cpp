@@ -0,0 +1,226 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmTransportUSB.h"
+
+#include "EmErrCodes.h"			// kError_CommOpen, kError_CommNotOpen
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostHasUSB
+ *
+ * DESCRIPTION:	Return whether or not USB facilities are available.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	False; there's no USB support in the headless build.
+ *
+ ***********************************************************************/
+
+Bool EmTransportUSB::HostHasUSB (void)
+{
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostConstruct
+ *
+ * DESCRIPTION:	Construct platform-specific objects/data.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportUSB::HostConstruct (void)
+{
+	fHost = NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostDestruct
+ *
+ * DESCRIPTION:	Destroy platform-specific objects/data.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmTransportUSB::HostDestruct (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostOpen
+ *
+ * DESCRIPTION:	Open the transport in a platform-specific fashion.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	kError_CommOpen
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportUSB::HostOpen (void)
+{
+	return kError_CommOpen;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostClose
+ *
+ * DESCRIPTION:	Close the transport in a platform-specific fashion.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	0 if no error.
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportUSB::HostClose (void)
+{
+	return errNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostRead
+ *
+ * DESCRIPTION:	Read bytes from the port in a platform-specific fashion.
+ *
+ * PARAMETERS:	len - maximum number of bytes to read.
+ *				data - buffer to receive the bytes.
+ *
+ * RETURNED:	kError_CommNotOpen
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportUSB::HostRead (long& len, void* data)
+{
+	UNUSED_PARAM (data)
+
+	len = 0;
+
+	return kError_CommNotOpen;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostWrite
+ *
+ * DESCRIPTION:	Write bytes to the port in a platform-specific fashion.
+ *
+ * PARAMETERS:	len - number of bytes in the buffer.
+ *				data - buffer containing the bytes.
+ *
+ * RETURNED:	kError_CommNotOpen
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportUSB::HostWrite (long& len, const void* data)
+{
+	UNUSED_PARAM (data)
+
+	len = 0;
+
+	return kError_CommNotOpen;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostCanRead
+ *
+ * DESCRIPTION:	Return whether or not the transport can be read from.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	False
+ *
+ ***********************************************************************/
+
+Bool EmTransportUSB::HostCanRead (void)
+{
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostCanWrite
+ *
+ * DESCRIPTION:	Return whether or not the transport can be written to.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	False
+ *
+ ***********************************************************************/
+
+Bool EmTransportUSB::HostCanWrite (void)
+{
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostBytesInBuffer
+ *
+ * DESCRIPTION:	Returns the number of bytes that can be read with the
+ *				Read method.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Zero
+ *
+ ***********************************************************************/
+
+long EmTransportUSB::HostBytesInBuffer (long /*minBytes*/)
+{
+	return 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTransportUSB::HostSetConfig
+ *
+ * DESCRIPTION:	Configure the transport in a platform-specific fasion.
+ *
+ * PARAMETERS:	config - configuration information.
+ *
+ * RETURNED:	kError_CommNotOpen
+ *
+ ***********************************************************************/
+
+ErrCode EmTransportUSB::HostSetConfig (const ConfigUSB& config)
+{
+	UNUSED_PARAM (config)
+
+	return kError_CommNotOpen;
+}
@@ -0,0 +1,28 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmWindow.h"
+
+// ---------------------------------------------------------------------------
+//		 EmWindow::NewWindow
+// ---------------------------------------------------------------------------
+// The headless build never opens a window.  The rest of Poser treats a
+// NULL gWindow as "nothing to draw on": the document and application
+// check for it before idling or painting, and the LCD is read directly
+// from EmScreen when a screen shot is needed.
+
+EmWindow* EmWindow::NewWindow (void)
+{
+	return NULL;
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/perl -w
+# -*- mode: Perl; tab-width: 4 -*-
+# ===================================================================== #
+#	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+#	All rights reserved.
+#
+#	This file is part of the Palm OS Emulator.
+#
+#	This program is free software; you can redistribute it and/or modify
+#	it under the terms of the GNU General Public License as published by
+#	the Free Software Foundation; either version 2 of the License, or
+#	(at your option) any later version.
+# ===================================================================== #
+
+# Generates ResStrings.cpp -- the Unix equivalent of the Windows
+# STRINGTABLE resource -- from SrcWin/Res/Strings.rc.
+#
+#	Usage: perl MakeResStrings.pl <Strings.rc> > ResStrings.cpp
+#
+# Strings.rc is itself generated (from SrcShared/Strings.txt), so it has
+# a simple, regular layout: a header comment, an #include of Strings.r.h,
+# and a STRINGTABLE in which each entry is on a line of its own, as an ID
+# followed by a tab and a quoted string.  Everything else in the table
+# (comments, blank lines) is copied as-is.  RC files escape a quote by
+# doubling it; C uses a backslash.
+
+use strict;
+
+my $inTable = 0;
+
+binmode (STDIN);
+binmode (STDOUT);
+
+while (<>)
+{
+	s/\r?\n$//;
+
+	if (!$inTable)
+	{
+		if (/^#include "Strings.r.h"/)
+		{
+			print "#include \"EmCommon.h\"\n";
+			print "#include \"ResStrings.h\"\n";
+			print "\n";
+			print "#include \"Strings.r.h\"\t\t// kStr_ values\n";
+		}
+		elsif (/^\/\* This file is generated from /)
+		{
+			print "/* This file is generated from SrcWin/Res/Strings.rc */\n";
+		}
+		elsif (/^STRINGTABLE/)
+		{
+			print "const ResStringEntry\tkResStrings[] =\n";
+		}
+		elsif (/^BEGIN$/)
+		{
+			print "{\n";
+			$inTable = 1;
+		}
+		else
+		{
+			print "$_\n";
+		}
+	}
+	else
+	{
+		if (/^END$/)
+		{
+			print "\t{ 0,\tNULL }\n";
+			print "};\n";
+			$inTable = 0;
+		}
+		elsif (/^\t([^\t\/"][^\t"]*)\t"(.*)"$/)
+		{
+			my ($id, $string) = ($1, $2);
+
+			$string =~ s/""/\\"/g;
+
+			print "\t{ $id,\t\"$string\" },\n";
+		}
+		else
+		{
+			print "$_\n";
+		}
+	}
+}
@@ -0,0 +1,952 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "Platform.h"
+
+#include "ChunkFile.h"			// ChunkFile
+#include "EmFileRef.h"			// EmFileRef
+#include "EmSession.h"			// gSession
+#include "ErrorHandling.h"		// Errors::ThrowIfNULL
+#include "Miscellaneous.h"		// StMemory
+#include "ResStrings.h"			// kResStrings
+#include "SessionFile.h"		// SessionFile::kROMUnixPathTag
+#include "Strings.r.h"			// kStr_ values
+
+#include <fcntl.h>				// open
+#include <strings.h>			// strcasecmp, strncasecmp
+#include <sys/mman.h>			// mmap, munmap
+#include <sys/stat.h>			// fstat
+#include <sys/time.h>			// gettimeofday
+
+
+// ===========================================================================
+//		 Globals
+// ===========================================================================
+
+// There's no system clipboard when running headless.  Keep the last thing
+// copied so that a paste within the same session gets it back.
+
+static ByteList		gClipboardPalmChars;
+static ByteList		gClipboardHostChars;
+
+
+// ===========================================================================
+//		 Platform
+// ===========================================================================
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Initialize
+ *
+ * DESCRIPTION:	Initializes platform-dependent stuff.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Initialize (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Reset
+ *
+ * DESCRIPTION:	Resets platform-dependent stuff.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Reset (void)
+{
+	Platform::StopSound ();	// Kill any sounds in progress or pending
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Save
+ *
+ * DESCRIPTION:	Saves platform-dependent stuff.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Save (SessionFile&)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Load
+ *
+ * DESCRIPTION:	Loads platform-dependent stuff.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Load (SessionFile&)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Dispose
+ *
+ * DESCRIPTION:	Disposes of platform-dependent stuff.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Dispose (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::GetString
+ *
+ * DESCRIPTION:	Return the string based on the given ID.  The strings
+ *				come from the table in ResStrings.cpp, which holds the
+ *				same text as the Windows string table.
+ *
+ * PARAMETERS:	id - id of the string to return.  IDs are defined
+ *					in Strings.r.h.
+ *
+ * RETURNED:	String object containing the requested text.  If the
+ *				string could not be located, the returned string
+ *				object contains the error message "<missing string #>".
+ *
+ ***********************************************************************/
+
+string Platform::GetString (StrCode id)
+{
+	typedef map<StrCode, const char*>	StringMap;
+
+	static StringMap	gStrings;
+
+	if (gStrings.empty ())
+	{
+		for (const ResStringEntry* p = kResStrings; p->fString; ++p)
+		{
+			gStrings[p->fID] = p->fString;
+		}
+	}
+
+	StringMap::iterator	iter = gStrings.find (id);
+
+	if (iter == gStrings.end ())
+	{
+		char	buffer[20];
+		sprintf (buffer, "%ld", (long) id);
+		return string ("<missing string ") + buffer + ">";
+	}
+
+	return string (iter->second);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::GetIDForError
+ *
+ * DESCRIPTION:	Map a platform-specific error number into an id for
+ *				an error string.
+ *
+ * PARAMETERS:	error - platform-specific error code (an errno value).
+ *
+ * RETURNED:	String ID for corresponding error message.	If a
+ *				string specific to the given error cannot be found,
+ *				kStr_GenericError is returned.
+ *
+ ***********************************************************************/
+
+int Platform::GetIDForError (ErrCode error)
+{
+	switch (error)
+	{
+		case ENOENT:		return kStr_FileNotFound;
+		case ENOTDIR:		return kStr_FileNotFound;
+		case EMFILE:		return kStr_TooManyFilesOpen;
+		case ENFILE:		return kStr_TooManyFilesOpen;
+		case ENOMEM:		return kStr_MemFull;
+		case ENODEV:		return kStr_DiskMissing;
+		case ENXIO:			return kStr_DiskMissing;
+		case EROFS:			return kStr_DiskLocked;
+		case EACCES:		return kStr_FileLocked;
+		case EBUSY:			return kStr_FileBusy;
+		case ENOSPC:		return kStr_DiskFull;
+		case ENAMETOOLONG:	return kStr_BadFileName;
+		case EIO:			return kStr_IOError;
+	}
+
+	return kStr_GenericError;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::GetIDForRecovery
+ *
+ * DESCRIPTION:	Map the given platform-specific error code into and ID
+ *				for an error recovery string.
+ *
+ * PARAMETERS:	error - platform-specific error code.
+ *
+ * RETURNED:	String ID for corresponding recovery message.  If a
+ *				string specific to the given error cannot be found,
+ *				zero is returned.
+ *
+ ***********************************************************************/
+
+int Platform::GetIDForRecovery (ErrCode error)
+{
+	UNUSED_PARAM (error)
+
+	return 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::GetShortVersionString
+ *
+ * DESCRIPTION:	Returns a short version string.  There's no version
+ *				resource to read, so this returns the same version
+ *				the Windows build puts in Emulator.rc.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Formatted version string.
+ *
+ ***********************************************************************/
+
+string Platform::GetShortVersionString (void)
+{
+	return string ("3.4");
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::CopyToClipboard
+ *
+ * DESCRIPTION:	Copy the given text to the clipboard.  The headless
+ *				build keeps its own clipboard.
+ *
+ * PARAMETERS:	palmChars - text in Palm OS encoding.
+ *				hostChars - the same text in host encoding.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::CopyToClipboard (const ByteList& palmChars,
+								const ByteList& hostChars)
+{
+	ByteList	palmChars2 (palmChars);
+	ByteList	hostChars2 (hostChars);
+
+	// See if any mapping needs to be done.
+
+	if (hostChars2.size () > 0 && palmChars2.size () == 0)
+	{
+		Platform::RemapHostToPalmChars (hostChars2, palmChars2);
+	}
+	else if (palmChars2.size () > 0 && hostChars2.size () == 0)
+	{
+		Platform::RemapPalmToHostChars (palmChars2, hostChars2);
+	}
+
+	gClipboardPalmChars = palmChars2;
+	gClipboardHostChars = hostChars2;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::CopyFromClipboard
+ *
+ * DESCRIPTION:	Return whatever was last given to CopyToClipboard.
+ *
+ * PARAMETERS:	palmChars - receives the text in Palm OS encoding.
+ *				hostChars - receives the text in host encoding.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::CopyFromClipboard (ByteList& palmChars,
+								  ByteList& hostChars)
+{
+	palmChars = gClipboardPalmChars;
+	hostChars = gClipboardHostChars;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::RemapHostToPalmChars
+ *
+ * DESCRIPTION:	Convert host text to Palm OS text.  Both sides use LF
+ *				for line endings, so the text is copied as-is.
+ *
+ * PARAMETERS:	hostChars - text to convert.
+ *				palmChars - receives the converted text.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::RemapHostToPalmChars	(const ByteList& hostChars,
+									 ByteList& palmChars)
+{
+	palmChars = hostChars;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::RemapPalmToHostChars
+ *
+ * DESCRIPTION:	Convert Palm OS text to host text.  See above.
+ *
+ * PARAMETERS:	palmChars - text to convert.
+ *				hostChars - receives the converted text.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::RemapPalmToHostChars	(const ByteList& palmChars,
+									 ByteList& hostChars)
+{
+	hostChars = palmChars;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::PinToScreen
+ *
+ * DESCRIPTION:	Make sure the given rectangle is on the screen.  There
+ *				is no screen, so there's nothing to do.
+ *
+ * PARAMETERS:	r - rectangle to pin.
+ *
+ * RETURNED:	True if the rectangle was changed.
+ *
+ ***********************************************************************/
+
+Bool Platform::PinToScreen (EmRect& r)
+{
+	UNUSED_PARAM (r)
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::ToHostEOL
+ *
+ * DESCRIPTION:	Converts a string of characters into another string
+ *				where the EOL sequence is consistant for files on the
+ *				underlying platform.
+ *
+ * PARAMETERS:	dest - receives the converted text.
+ *				destLen - receives the length of the converted text.
+ *				src - text to convert.
+ *				srcLen - length of the text to convert.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::ToHostEOL (	StMemory& dest, long& destLen,
+							const char* src, long srcLen)
+{
+	char*	d = (char*) Platform::AllocateMemory (srcLen);
+	char*	p = d;
+	Bool	previousWas0x0D = false;
+
+	for (long ii = 0; ii < srcLen; ++ii)
+	{
+		char	ch = src[ii];
+
+		// Convert 0x0D to 0x0A.
+
+		if (ch == 0x0D)
+		{
+			*p++ = 0x0A;
+		}
+
+		// Copy 0x0A through, but not if it's part of
+		// a 0x0D/0x0A sequence
+
+		else if (ch == 0x0A)
+		{
+			if (!previousWas0x0D)
+			{
+				*p++ = 0x0A;
+			}
+		}
+
+		// Copy all other characters straight through.
+
+		else
+		{
+			*p++ = ch;
+		}
+
+		previousWas0x0D = ch == 0x0D;
+	}
+
+	destLen = p - d;
+	d = (char*) Platform::ReallocMemory (d, destLen);
+	dest.Adopt (d);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::ReadROMFileReference
+ *
+ * DESCRIPTION:	Read the reference to the ROM file from the session
+ *				file.
+ *
+ * PARAMETERS:	docFile - the session file.
+ *				f - receives the ROM file reference.
+ *
+ * RETURNED:	True if a reference to an existing file was found.
+ *
+ ***********************************************************************/
+
+Bool Platform::ReadROMFileReference (ChunkFile& docFile, EmFileRef& f)
+{
+	string	path;
+
+	if (docFile.ReadString (SessionFile::kROMUnixPathTag, path))
+	{
+		f = EmFileRef (path);
+		if (f.Exists ())
+			return true;
+	}
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::WriteROMFileReference
+ *
+ * DESCRIPTION:	Write the reference to the ROM file to the session
+ *				file.
+ *
+ * PARAMETERS:	docFile - the session file.
+ *				f - the ROM file reference.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::WriteROMFileReference (ChunkFile& docFile, const EmFileRef& f)
+{
+	docFile.WriteString (SessionFile::kROMUnixPathTag, f.GetFullPath ());
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Delay
+ *
+ * DESCRIPTION:	Delay 10 msecs.  Delaying by this amount pauses us 1/100
+ *				of a second, which is the rate at which the device's
+ *				tickcount counter increments.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Delay (void)
+{
+	EmAssert (gSession);
+	gSession->Sleep (10);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::CycleSlowly
+ *
+ * DESCRIPTION:	Nothing to do; the CPU runs in its own thread.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::CycleSlowly (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::RealAllocateMemory
+ *
+ * DESCRIPTION:	Allocate a block of memory, throwing an exception if
+ *				the allocation fails.
+ *
+ * PARAMETERS:	size - size of the block.
+ *				clear - true if the block should be zeroed.
+ *				file, line - allocation site (unused).
+ *
+ * RETURNED:	Pointer to the block.
+ *
+ ***********************************************************************/
+
+void* Platform::RealAllocateMemory (size_t size, Bool clear, const char*, int)
+{
+	void*	result;
+
+	if (clear)
+		result = calloc (size, 1);
+	else
+		result = malloc (size);
+
+	Errors::ThrowIfNULL (result);
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::RealReallocMemory
+ *
+ * DESCRIPTION:	Resize a block of memory, throwing an exception if the
+ *				allocation fails.
+ *
+ * PARAMETERS:	p - block to resize.
+ *				size - new size of the block.
+ *				file, line - allocation site (unused).
+ *
+ * RETURNED:	Pointer to the (possibly moved) block.
+ *
+ ***********************************************************************/
+
+void* Platform::RealReallocMemory (void* p, size_t size, const char*, int)
+{
+	void*	result = realloc (p, size);
+
+	Errors::ThrowIfNULL (result);
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::RealDisposeMemory
+ *
+ * DESCRIPTION:	Free a block allocated with RealAllocateMemory.
+ *
+ * PARAMETERS:	p - block to free.  May be NULL.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::RealDisposeMemory (void* p)
+{
+	if (p)
+	{
+		free (p);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::MapFile
+ *
+ * DESCRIPTION:	Map the given file into memory with copy-on-write
+ *				semantics: the caller can modify the pages, but the
+ *				changes are never written back to the file.
+ *
+ * PARAMETERS:	f - file to map.
+ *				size - size the file must have.
+ *
+ * RETURNED:	Pointer to the mapped pages, or NULL if the file
+ *				could not be opened, isn't "size" bytes long, or
+ *				could not be mapped.
+ *
+ ***********************************************************************/
+
+void* Platform::MapFile (const EmFileRef& f, size_t size)
+{
+	int		fd = ::open (f.GetFullPath ().c_str (), O_RDONLY);
+
+	if (fd < 0)
+		return NULL;
+
+	struct stat	st;
+
+	if (::fstat (fd, &st) != 0 || (size_t) st.st_size != size)
+	{
+		::close (fd);
+		return NULL;
+	}
+
+	// The mapping holds its own reference to the file.
+
+	void*	result = ::mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+	::close (fd);
+
+	if (result == MAP_FAILED)
+		return NULL;
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::UnmapFile
+ *
+ * DESCRIPTION:	Undo a mapping made by MapFile.
+ *
+ * PARAMETERS:	p - pointer returned by MapFile.  May be NULL.
+ *				size - size passed to MapFile.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::UnmapFile (void* p, size_t size)
+{
+	if (p)
+	{
+		::munmap (p, size);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::ForceStartupScreen
+ *
+ * DESCRIPTION:	See if the user has requested that the Startup dialog
+ *				be presented instead of attempting to use the latest
+ *				session file or creating a new session.  There's no
+ *				keyboard to check, so the answer is always "no".
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	False
+ *
+ ***********************************************************************/
+
+Bool Platform::ForceStartupScreen (void)
+{
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::StopOnResetKeyDown
+ *
+ * DESCRIPTION:	See Platform::ForceStartupScreen.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	False
+ *
+ ***********************************************************************/
+
+Bool Platform::StopOnResetKeyDown (void)
+{
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::CollectOptions
+ *
+ * DESCRIPTION:	Pass each command-line argument to the given callback.
+ *
+ * PARAMETERS:	argc, argv - the command line.
+ *				errorArg - receives the index of the argument that
+ *					the callback rejected.
+ *				cb - the callback.
+ *
+ * RETURNED:	True if all arguments were accepted.
+ *
+ ***********************************************************************/
+
+Bool Platform::CollectOptions (int argc, char** argv, int& errorArg, int (*cb)(int, char**, int&))
+{
+	errorArg = 1;
+	while (errorArg < argc)
+	{
+		if (cb (argc, argv, errorArg) == 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::PrintHelp
+ *
+ * DESCRIPTION:	Print the host-specific part of the command-line help.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::PrintHelp (void)
+{
+	printf ("\n");
+	printf ("This build never opens a window.  It runs until the session\n");
+	printf ("is closed, usually by -quit_on_exit or -horde_quit_when_done.\n");
+	printf ("Dialogs are answered automatically and their text is written\n");
+	printf ("to stderr.  The exit code is 2 if an error dialog was shown,\n");
+	printf ("1 if a warning was shown, and 0 otherwise.\n");
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::GetMilliseconds
+ *
+ * DESCRIPTION:	Return a millisecond counter.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Milliseconds since some arbitrary point in time.
+ *
+ ***********************************************************************/
+
+uint32 Platform::GetMilliseconds (void)
+{
+	struct timeval	tv;
+	::gettimeofday (&tv, NULL);
+
+	return (uint32) (tv.tv_sec * 1000 + tv.tv_usec / 1000);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::CreateDebuggerSocket
+ *
+ * DESCRIPTION:	Create the platform-specific debugger socket.  There's
+ *				no shared-memory transport here; external debuggers
+ *				connect over TCP.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	NULL
+ *
+ ***********************************************************************/
+
+CSocket* Platform::CreateDebuggerSocket (void)
+{
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::ExitDebugger
+ *
+ * DESCRIPTION:	Perform platform-specific operations when debug mode is
+ *				exited.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::ExitDebugger (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::ViewDrawLine
+ *
+ * DESCRIPTION:	Draw a debugging line in the LCD.  No-op.
+ *
+ * PARAMETERS:	xStart, yStart, xEnd, yEnd - end points.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::ViewDrawLine (int, int, int, int)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::ViewDrawPixel
+ *
+ * DESCRIPTION:	Draw a debugging pixel in the LCD.  No-op.
+ *
+ * PARAMETERS:	xPos, yPos - the pixel.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::ViewDrawPixel (int, int)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::SndDoCmd
+ *
+ * DESCRIPTION:	Handle a SndDoCmd call.  There's nobody to hear it,
+ *				so the tones the Windows version plays itself are
+ *				swallowed; the rest are left to the ROM as usual.
+ *
+ * PARAMETERS:	cmd - the sound command.
+ *
+ * RETURNED:	kExecuteROM or kSkipROM.
+ *
+ ***********************************************************************/
+
+CallROMType Platform::SndDoCmd (SndCommandType& cmd)
+{
+	switch (cmd.cmd)
+	{
+		case sndCmdFreqDurationAmp:
+		case sndCmdFrqOn:
+			return kSkipROM;
+
+		case sndCmdNoteOn:
+		case sndCmdQuiet:
+			return kExecuteROM;
+	}
+
+	return kExecuteROM;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::StopSound
+ *
+ * DESCRIPTION:	Stop any sound in progress.  No-op.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::StopSound (void)
+{
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::Beep
+ *
+ * DESCRIPTION:	Beep.  No-op.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void Platform::Beep (void)
+{
+}
+
+
+#pragma mark -
+
+// ===========================================================================
+//		 Microsoft C library compatibility
+// ===========================================================================
+
+int _stricmp (const char* s1, const char* s2)
+{
+	return strcasecmp (s1, s2);
+}
+
+
+int _strnicmp (const char* s1, const char* s2, int n)
+{
+	return strncasecmp (s1, s2, n);
+}
+
+
+char* _strdup (const char* s)
+{
+	return strdup (s);
+}
+
+
+char* _strlwr (char* s)
+{
+	for (char* p = s; *p; ++p)
+	{
+		*p = (char) tolower ((unsigned char) *p);
+	}
+
+	return s;
+}
@@ -0,0 +1,28 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 1998-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef ResStrings_h
+#define ResStrings_h
+
+// The Unix equivalent of the Windows STRINGTABLE resource.  The table is
+// terminated by an entry with a NULL string.
+
+struct ResStringEntry
+{
+	StrCode		fID;
+	const char*	fString;
+};
+
+extern const ResStringEntry	kResStrings[];
+
+#endif	// ResStrings_h
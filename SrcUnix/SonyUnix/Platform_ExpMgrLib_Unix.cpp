@@ -0,0 +1,119 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 1998-2000 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "SonyShared/Platform_ExpMgrLib.h"
+
+#include "ChunkFile.h"			// Chunk, EmStreamChunk
+
+static	UInt16	g_bReadyExpMgrLib = FALSE;
+
+/************************************************************
+ *  FUNCTION    : IsUsable()
+ *
+ *  DESCRIPTION : Return whether the ExpansionMgr functions can be used
+ *                (that is, whether ExpInit has been called).
+ *              
+ *  PARAMETERS  : 
+ *              
+ *  RETURNS     : true if usable
+ *************************************************************/
+Bool Platform_ExpMgrLib::IsUsable ()
+{
+	return g_bReadyExpMgrLib;
+}
+
+void Platform_ExpMgrLib::Initialize ()
+{
+	g_bReadyExpMgrLib = false;
+}
+
+/************************************************************
+ *  FUNCTION    : Reset()
+ *
+ *  DESCRIPTION : 
+ *              
+ *  PARAMETERS  : 
+ *              
+ *  RETURNS     : nothing
+ *************************************************************/
+void Platform_ExpMgrLib::Reset ()
+{
+	g_bReadyExpMgrLib = false;
+}
+
+/************************************************************
+ *  FUNCTION    : CalledExpInit()
+ *
+ *  DESCRIPTION : Called when the ExpMgr library itself has been
+ *                initialized.
+ *              
+ *  PARAMETERS  : 
+ *              
+ *  RETURNS     : nothing
+ *************************************************************/
+void Platform_ExpMgrLib::CalledExpInit ()
+{
+	g_bReadyExpMgrLib = true;
+}
+
+/************************************************************
+ *  FUNCTION    : Load()
+ *
+ *  DESCRIPTION : Read the ExpMgr library state from the session file
+ *                (PSF).  Same format as the Windows version, so that
+ *                sessions can move between the two.
+ *              
+ *  PARAMETERS  : f - the session file
+ *              
+ *  RETURNS     : nothing
+ *************************************************************/
+void Platform_ExpMgrLib::Load(SessionFile& f)
+{
+	Chunk	chunk;
+	if (f.ReadMSfsInfo (chunk))
+	{
+		long			version;
+		EmStreamChunk	s (chunk);
+
+		s >> version;
+		s >> g_bReadyExpMgrLib;
+	}
+	else
+	{
+		f.SetCanReload (false);
+	}
+}
+
+/************************************************************
+ *  FUNCTION    : Save()
+ *
+ *  DESCRIPTION : Write the ExpMgr library state to the session file
+ *                (PSF).
+ *              
+ *  PARAMETERS  : f - the session file
+ *              
+ *  RETURNS     : nothing
+ *************************************************************/
+void Platform_ExpMgrLib::Save(SessionFile& f)
+{
+	const long	kCurrentVersion = 1;
+
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kCurrentVersion;
+	s << g_bReadyExpMgrLib;
+
+	f.WriteMSfsInfo (chunk);
+}
@@ -0,0 +1,349 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 1998-2000 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "SonyShared/Platform_MsfsLib.h"
+
+/*
+	The headless build has no host directory standing in for the Memory
+	Stick.  The card is reported as removed, and every file system call
+	fails with expErrCardNotPresent.
+*/
+
+Int16	g_nCardInserted = MSSTATE_REMOVED;	// Memory Stick INSERT/REMOVE state
+											// -1:REMOVE    0 or more:INSERT
+
+/************************************************************
+ *  FUNCTION    : Initialize()
+ *
+ *  DESCRIPTION : 
+ *              
+ *  PARAMETERS  : 
+ *              
+ *  RETURNS     : nothing
+ *************************************************************/
+void Platform_MsfsLib::Initialize ()
+{
+	g_nCardInserted = MSSTATE_REMOVED;
+}
+
+void Platform_MsfsLib::Initialize(const Configuration& cfg)
+{
+	UNUSED_PARAM(cfg)
+
+	Platform_MsfsLib::Initialize ();
+}
+
+/************************************************************
+ *  FUNCTION    : Load()
+ *
+ *  DESCRIPTION : Nothing is saved, since there is never a card.
+ *              
+ *  PARAMETERS  : f - the session file
+ *              
+ *  RETURNS     : nothing
+ *************************************************************/
+void Platform_MsfsLib::Load (SessionFile& f)
+{
+	UNUSED_PARAM(f)
+}
+
+void Platform_MsfsLib::Save (SessionFile& f)
+{
+	UNUSED_PARAM(f)
+}
+
+void Platform_MsfsLib::Reset ()
+{
+}
+
+/************************************************************
+ *  FUNCTION    : GetVfsErrorCode()
+ *
+ *  DESCRIPTION : 
+ *              
+ *  PARAMETERS  : defaultErrCode - the code to return
+ *              
+ *  RETURNS     : defaultErrCode
+ *************************************************************/
+Err Platform_MsfsLib::GetVfsErrorCode (Err defaultErrCode)
+{
+	return defaultErrCode;
+}
+
+Bool Platform_MsfsLib::CardIsWriteProtect(UInt16 nVolRefNum)
+{
+	UNUSED_PARAM(nVolRefNum)
+
+	return false;
+}
+
+UInt16	Platform_MsfsLib::GetSlotLibRefNum( )
+{
+	return 0;
+}
+
+//--------------------------------------------------
+// Library initialization, shutdown, sleep and wake
+//--------------------------------------------------
+
+Err Platform_MsfsLib::LibOpen (UInt16 libRefNum)
+{
+	UNUSED_PARAM(libRefNum)
+
+	return errNone;
+}
+
+Err Platform_MsfsLib::LibClose (UInt16 libRefNum)
+{
+	UNUSED_PARAM(libRefNum)
+
+	return errNone;
+}
+
+Err Platform_MsfsLib::LibSleep (UInt16 libRefNum)
+{
+	UNUSED_PARAM(libRefNum)
+
+	return errNone;
+}
+
+Err Platform_MsfsLib::LibWake (UInt16 libRefNum)
+{
+	UNUSED_PARAM(libRefNum)
+
+	return errNone;
+}
+
+//--------------------------------------------------
+// File system calls
+//--------------------------------------------------
+
+Err Platform_MsfsLib::FSFileCreate (UInt16 volRefNum, char *pPathName)
+{
+	UNUSED_PARAM(volRefNum)
+	UNUSED_PARAM(pPathName)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileOpen (UInt16 volRefNum, char *pPathName, UInt16 openMode, FileRef* pFileRef)
+{
+	UNUSED_PARAM(volRefNum)
+	UNUSED_PARAM(pPathName)
+	UNUSED_PARAM(openMode)
+	UNUSED_PARAM(pFileRef)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileClose (FileRef nFileRef)
+{
+	UNUSED_PARAM(nFileRef)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileReadData (FileRef nFileRef, UInt32 nNumBytes, void*pBufBase, UInt32 nOffset, UInt32* pnNumByteRead)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nNumBytes)
+	UNUSED_PARAM(pBufBase)
+	UNUSED_PARAM(nOffset)
+	UNUSED_PARAM(pnNumByteRead)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileRead (FileRef nFileRef, UInt32 nNumBytes, void*pBufBase, UInt32* pnNumByteRead)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nNumBytes)
+	UNUSED_PARAM(pBufBase)
+	UNUSED_PARAM(pnNumByteRead)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileWrite (FileRef nFileRef, UInt32 nNumBytes, void*pBufBase, UInt32* pnNumByteWrite)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nNumBytes)
+	UNUSED_PARAM(pBufBase)
+	UNUSED_PARAM(pnNumByteWrite)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileDelete (UInt16 volRefNum, char* pPathName)
+{
+	UNUSED_PARAM(volRefNum)
+	UNUSED_PARAM(pPathName)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileRename (UInt16 volRefNum, char* pPathName, char* pNewName)
+{
+	UNUSED_PARAM(volRefNum)
+	UNUSED_PARAM(pPathName)
+	UNUSED_PARAM(pNewName)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileSeek (FileRef nFileRef, FileOrigin nOrigin, Int32 nOffset)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nOrigin)
+	UNUSED_PARAM(nOffset)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileEOF (FileRef nFileRef)
+{
+	UNUSED_PARAM(nFileRef)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileTell (FileRef nFileRef, UInt32 *pFilePos)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(pFilePos)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileAttributesGet (FileRef nFileRef, UInt32 *pAttr)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(pAttr)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileAttributesSet (FileRef nFileRef, UInt32 nAttr)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nAttr)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileDateGet (FileRef nFileRef, UInt16 nWhichDate, UInt32* pDate)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nWhichDate)
+	UNUSED_PARAM(pDate)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileDateSet (FileRef nFileRef, UInt16 nWhichDate, UInt32 nDate)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nWhichDate)
+	UNUSED_PARAM(nDate)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileSize (FileRef nFileRef, UInt32 *pFileSize)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(pFileSize)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSFileResize (FileRef nFileRef, UInt32 nNewSize)
+{
+	UNUSED_PARAM(nFileRef)
+	UNUSED_PARAM(nNewSize)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSDirCreate (UInt16 nVolRefNum, char *pDirName)
+{
+	UNUSED_PARAM(nVolRefNum)
+	UNUSED_PARAM(pDirName)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSDirEntryEnumerate (FileRef nDirRef, UInt32 *pDir, FileInfoType *pInfo)
+{
+	UNUSED_PARAM(nDirRef)
+	UNUSED_PARAM(pDir)
+	UNUSED_PARAM(pInfo)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeFormat (VFSAnyMountParamPtr pVfsMountParam)
+{
+	UNUSED_PARAM(pVfsMountParam)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeInfo (UInt16 nVolRefNum, VolumeInfoType* pVolInfo)
+{
+	UNUSED_PARAM(nVolRefNum)
+	UNUSED_PARAM(pVolInfo)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeMount (VFSAnyMountParamPtr pVfsMountParam)
+{
+	UNUSED_PARAM(pVfsMountParam)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeUnmount (UInt16 nVolRefNum)
+{
+	UNUSED_PARAM(nVolRefNum)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeSize (UInt16 nVolRefNum, UInt32* pVolUsed, UInt32* pVolTotal)
+{
+	UNUSED_PARAM(nVolRefNum)
+	UNUSED_PARAM(pVolUsed)
+	UNUSED_PARAM(pVolTotal)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeLabelGet (UInt16 nVolRefNum, LPSTR pVolumeLabel, UInt16 nBufLen)
+{
+	UNUSED_PARAM(nVolRefNum)
+	UNUSED_PARAM(pVolumeLabel)
+	UNUSED_PARAM(nBufLen)
+
+	return expErrCardNotPresent;
+}
+
+Err Platform_MsfsLib::FSVolumeLabelSet (UInt16 nVolRefNum, LPSTR pVolumeLabel)
+{
+	UNUSED_PARAM(nVolRefNum)
+	UNUSED_PARAM(pVolumeLabel)
+
+	return expErrCardNotPresent;
+}
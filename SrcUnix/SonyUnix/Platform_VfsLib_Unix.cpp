@@ -0,0 +1,35 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 1998-2000 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "SonyShared/Platform_VfsLib.h"
+
+/************************************************************
+ *  FUNCTION    : VFSImportDatabaseFromFile()
+ *
+ *  DESCRIPTION : There is no Memory Stick in the headless build, so
+ *                there is nothing to import from.
+ *              
+ *  PARAMETERS  : 
+ *              
+ *  RETURNS     : expErrCardNotPresent
+ *************************************************************/
+Err Platform_VfsLib::VFSImportDatabaseFromFile(UInt16 nVolRefNum, char*pPathName, UInt16 *pCardNo, LocalID *pDbID)
+{
+	UNUSED_PARAM(nVolRefNum)
+	UNUSED_PARAM(pPathName)
+	UNUSED_PARAM(pCardNo)
+	UNUSED_PARAM(pDbID)
+
+	return expErrCardNotPresent;
+}
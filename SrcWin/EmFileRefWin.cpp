@@ -295,6 +295,49 @@ EmFileRef::GetAttr (int * mode) const
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileRef::GetSizeAndModDate
+ *
+ * DESCRIPTION: Get the size and modification date of the managed file.
+ *				The date is only used to tell whether a file has changed,
+ *				so it's just the FILETIME in seconds, truncated to 32 bits.
+ *
+ * PARAMETERS:	Pointers to integers where the size in bytes and the
+ *				modification date will be stored.
+ *
+ * RETURNED:	An integer containing an errno style error result, 0 for no error.
+ *
+ ***********************************************************************/
+
+int
+EmFileRef::GetSizeAndModDate (uint32* size, uint32* modDate) const
+{
+	EmAssert(size);
+	EmAssert(modDate);
+
+	*size = 0;
+	*modDate = 0;
+
+	if (!IsSpecified())
+		return ENOENT;
+
+	WIN32_FILE_ATTRIBUTE_DATA	data;
+
+	if (!GetFileAttributesEx(GetFullPath().c_str(), GetFileExInfoStandard, &data))
+		return ENOENT;
+
+	ULARGE_INTEGER	time;
+	time.LowPart = data.ftLastWriteTime.dwLowDateTime;
+	time.HighPart = data.ftLastWriteTime.dwHighDateTime;
+
+	*size = data.nFileSizeLow;
+	*modDate = (uint32) (time.QuadPart / 10000000);
+
+	return 0;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmFileRef::SetAttr
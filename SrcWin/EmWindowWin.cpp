@@ -32,7 +32,7 @@
 
 #ifdef SONY_ROM
 #include "EmCPU68K.h"			// GetRegisters
-#include "SonyWin/Platform_ExpMgrLib.h"
+#include "SonyShared/Platform_ExpMgrLib.h"
 #include "SonyWin/SonyButtonProc.h"
 #include "SonyShared/SonyChars.h"
 extern	ScaleType		gCurrentScale;
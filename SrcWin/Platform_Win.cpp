@@ -884,6 +884,75 @@ void Platform::RealDisposeMemory (void* p)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::MapFile
+ *
+ * DESCRIPTION:	Map a file into memory, copy-on-write.
+ *
+ * PARAMETERS:	f - file to map.
+ *
+ *				size - expected size of the file.
+ *
+ * RETURNED:	Pointer to the mapped file, or NULL if the file could
+ *				not be mapped or was not the expected size.
+ *
+ ***********************************************************************/
+
+void* Platform::MapFile (const EmFileRef& f, size_t size)
+{
+	HANDLE	hFile = ::CreateFile (f.GetFullPath ().c_str (), GENERIC_READ,
+		FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (hFile == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	if (::GetFileSize (hFile, NULL) != size)
+	{
+		::CloseHandle (hFile);
+		return NULL;
+	}
+
+	HANDLE	hMapping = ::CreateFileMapping (hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+	::CloseHandle (hFile);
+
+	if (hMapping == NULL)
+		return NULL;
+
+	// The view keeps the mapping object alive, so we can close it now.
+
+	void*	result = ::MapViewOfFile (hMapping, FILE_MAP_COPY, 0, 0, size);
+
+	::CloseHandle (hMapping);
+
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Platform::UnmapFile
+ *
+ * DESCRIPTION:	Release a mapping created by MapFile.
+ *
+ * PARAMETERS:	p - pointer returned by MapFile.
+ *
+ *				size - size passed to MapFile.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void Platform::UnmapFile (void* p, size_t /*size*/)
+{
+	if (p)
+	{
+		::UnmapViewOfFile (p);
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Platform::ForceStartupScreen
@@ -1,7 +1,7 @@
 #include <ROMStubs.h>
 #include "resource.h"			// IDI_EMULATOR
 #include "SonyShared\SonyChars.h"			// for Sony & JogDial
-#include "SonyWin\Platform_MsfsLib.h"
+#include "SonyShared/Platform_MsfsLib.h"
 
 static Bool		gButtonTracking;
 
@@ -12,7 +12,7 @@
 \* ===================================================================== */
 
 #include "EmCommon.h"
-#include "Platform_VfsLib.h"
+#include "SonyShared/Platform_VfsLib.h"
 
 #include "Logging.h"			// LogAppendMsg
 #include "Marshal.h"
@@ -27,8 +27,8 @@
 #include <string.h>
 #include <fcntl.h>
 #include <tchar.h>
-#include "Platform_ExpMgrLib.h"
-#include "Platform_MsfsLib.h"
+#include "SonyShared/Platform_ExpMgrLib.h"
+#include "SonyShared/Platform_MsfsLib.h"
 #include "EmWindow.h"		// EmWindow
 #include "EmWindowWin.h"	// EmWindowHostData
 
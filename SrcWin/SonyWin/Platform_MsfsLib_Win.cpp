@@ -17,7 +17,7 @@
 #include "Logging.h"			// LogAppendMsg
 #include "Marshal.h"
 #include "Platform.h"			// AllocateMemory
-#include "Platform_MsfsLib.h"
+#include "SonyShared/Platform_MsfsLib.h"
 #include "EmLowMem.h"			// EmLowMem_GetGlobal
 #include "EmWindow.h"			// EmWindow
 #include "EmWindowWin.h"		// EmWindowHostData
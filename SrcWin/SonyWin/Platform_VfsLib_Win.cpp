@@ -12,7 +12,7 @@
 \* ===================================================================== */
 
 #include "EmCommon.h"
-#include "Platform_VfsLib.h"
+#include "SonyShared/Platform_VfsLib.h"
 
 #include "Logging.h"			// LogAppendMsg
 #include "Marshal.h"
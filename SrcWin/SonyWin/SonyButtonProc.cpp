@@ -10,8 +10,8 @@
 #include <ROMStubs.h>
 #include "resource.h"			// IDI_EMULATOR
 #include "SonyShared\SonyChars.h"			// for Sony & JogDial
-#include "SonyWin\Platform_MsfsLib.h"
-#include "SonyWin\Platform_ExpMgrLib.h"
+#include "SonyShared/Platform_MsfsLib.h"
+#include "SonyShared/Platform_ExpMgrLib.h"
 #include "SonyButtonProc.h"
 
 static	CPrvBrush		gbrsHatch;